@@ -26,10 +26,13 @@
 #include "portfft/common/workitem.hpp"
 #include "portfft/descriptor.hpp"
 #include "portfft/dispatcher/global_dispatcher.hpp"
+#include "portfft/dispatcher/multi_dim_dispatcher.hpp"
 #include "portfft/dispatcher/subgroup_dispatcher.hpp"
 #include "portfft/dispatcher/workgroup_dispatcher.hpp"
 #include "portfft/dispatcher/workitem_dispatcher.hpp"
 #include "portfft/enums.hpp"
+#include "portfft/plan_group.hpp"
+#include "portfft/ragged_batch.hpp"
 #include "portfft/traits.hpp"
 
 #endif
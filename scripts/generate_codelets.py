@@ -0,0 +1,286 @@
+"""************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ ************************************************************************"""
+import math
+
+# Every radix up to 16 and the primes that the workitem implementation can otherwise only compute with a naive DFT
+SIZES = list(range(2, 17)) + [17, 19, 23, 29, 31]
+DST = "./src/portfft/common/codelets.hpp"
+# line length limit for the generated statements, not counting their indentation
+MAX_LINE_LENGTH = 118
+
+template = """/***************************************************************************
+ *
+ *  Generated by scripts/generate_codelets.py. Do not edit!
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMON_CODELETS_HPP
+#define PORTFFT_COMMON_CODELETS_HPP
+
+#include "portfft/defines.hpp"
+
+namespace portfft::detail {{
+
+/*
+Straight-line forward DFTs of small sizes. Prime sizes use the symmetric algorithm computing output pairs k and N-k
+together from the sums and differences of input pairs, which needs about a quarter of the multiplications of a naive
+DFT. Composite sizes are split with Cooley-Tukey at generation time, with trivial twiddles (multiples of pi/4)
+simplified away.
+
+All codelets load every input before storing any output, so they can work in or out of place.
+*/
+{codelets}
+/**
+ * Checks whether there is a codelet for the given size.
+ *
+ * @param fft_size size of the DFT transform
+ * @return true if `codelet_dft` can compute the DFT of this size
+ */
+PORTFFT_INLINE constexpr bool has_codelet(Idx fft_size) {{
+  switch (fft_size) {{
+{has_cases}
+      return true;
+    default:
+      return false;
+  }}
+}}
+
+/**
+ * Calculates DFT using the codelet for its size. Can work in or out of place. Does nothing if `has_codelet(fft_size)`
+ * is false.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param fft_size size of the DFT transform
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft(const T* in, T* out, Idx fft_size, Idx stride_in, Idx stride_out) {{
+  switch (fft_size) {{
+{dispatch_cases}
+    default:
+      break;
+  }}
+}}
+
+}}  // namespace portfft::detail
+
+#endif
+"""
+
+codelet_template = """
+/**
+ * Calculates DFT of size {size} using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_{size}(const T* in, T* out, Idx stride_in, Idx stride_out) {{
+  // clang-format off
+{body}
+  // clang-format on
+}}
+"""
+
+
+class Emitter:
+    """Collects the statements of one codelet. Complex values are pairs of names of real temporaries."""
+
+    def __init__(self):
+        self.statements = []
+        self.constants = {}
+        self.n_temps = 0
+
+    def temp(self, expr):
+        name = "t{}".format(self.n_temps)
+        self.n_temps += 1
+        statement = "const T {} = {};".format(name, expr)
+        # wrap long sums, keeping the operators at the start of the continuation lines
+        lines = []
+        while len(statement) > MAX_LINE_LENGTH:
+            split = max(statement.rfind(" + ", 0, MAX_LINE_LENGTH), statement.rfind(" - ", 0, MAX_LINE_LENGTH))
+            lines.append(statement[:split])
+            statement = "    " + statement[split + 1:]
+        lines.append(statement)
+        self.statements.append("\n  ".join(lines))
+        return name
+
+    def constant(self, value):
+        """Returns the name of a constant with absolute value `value`, declaring it on first use."""
+        key = repr(abs(value))
+        if key not in self.constants:
+            self.constants[key] = "k{}".format(len(self.constants))
+        return self.constants[key]
+
+    def linear(self, terms):
+        """Emits a sum of `(sign, constant or None, name)` terms and returns the name of the result."""
+        expr = ""
+        for sign, const, name in terms:
+            term = name if const is None else "{} * {}".format(const, name)
+            if not expr:
+                expr = term if sign > 0 else "-" + term
+            else:
+                expr += (" + " if sign > 0 else " - ") + term
+        return self.temp(expr)
+
+
+def cos_sin(numerator, size):
+    """Exact where possible cos and sin of 2*pi*numerator/size."""
+    numerator %= size
+    if 8 * numerator % size == 0:
+        octant = 8 * numerator // size
+        half = math.sqrt(0.5)
+        return [(1.0, 0.0), (half, half), (0.0, 1.0), (-half, half), (-1.0, 0.0), (-half, -half), (0.0, -1.0),
+                (half, -half)][octant]
+    theta = 2. * math.pi * numerator / size
+    return math.cos(theta), math.sin(theta)
+
+
+def sign_of(value):
+    return 1 if value > 0 else -1
+
+
+def twiddle(em, x, exponent, size):
+    """Multiplies complex `x` by exp(-2*pi*i*exponent/size)."""
+    c, s = cos_sin(exponent, size)
+    s = -s
+    xr, xi = x
+    if s == 0.0:
+        if c > 0:
+            return x
+        return em.linear([(-1, None, xr)]), em.linear([(-1, None, xi)])
+    if c == 0.0:
+        # multiplication by +-i
+        return em.linear([(-sign_of(s), None, xi)]), em.linear([(sign_of(s), None, xr)])
+    if abs(c) == abs(s):
+        k = em.constant(c)
+        sum_r = em.linear([(sign_of(c), None, xr), (-sign_of(s), None, xi)])
+        sum_i = em.linear([(sign_of(c), None, xi), (sign_of(s), None, xr)])
+        return em.linear([(1, k, sum_r)]), em.linear([(1, k, sum_i)])
+    kc = em.constant(c)
+    ks = em.constant(s)
+    return (em.linear([(sign_of(c), kc, xr), (-sign_of(s), ks, xi)]),
+            em.linear([(sign_of(c), kc, xi), (sign_of(s), ks, xr)]))
+
+
+def factorize(size):
+    """The largest factor of `size` not larger than its square root, as `detail::factorize`."""
+    res = 1
+    i = 2
+    while i * i <= size:
+        if size % i == 0:
+            res = i
+        i += 1
+    return res
+
+
+def dft(em, xs):
+    size = len(xs)
+    if size == 1:
+        return xs
+    if size == 2:
+        (ar, ai), (br, bi) = xs
+        return [(em.linear([(1, None, ar), (1, None, br)]), em.linear([(1, None, ai), (1, None, bi)])),
+                (em.linear([(1, None, ar), (-1, None, br)]), em.linear([(1, None, ai), (-1, None, bi)]))]
+    factor_n1 = factorize(size)
+    if factor_n1 == 1:
+        return prime_dft(em, xs)
+    # Cooley-Tukey: n = n2 + factor_n2 * n1, k = k1 + factor_n1 * k2
+    factor_n2 = size // factor_n1
+    inner = []
+    for n2 in range(factor_n2):
+        sub = dft(em, [xs[n2 + factor_n2 * n1] for n1 in range(factor_n1)])
+        inner.append([twiddle(em, sub[k1], n2 * k1, size) for k1 in range(factor_n1)])
+    res = [None] * size
+    for k1 in range(factor_n1):
+        sub = dft(em, [inner[n2][k1] for n2 in range(factor_n2)])
+        for k2 in range(factor_n2):
+            res[k1 + factor_n1 * k2] = sub[k2]
+    return res
+
+
+def prime_dft(em, xs):
+    size = len(xs)
+    half = (size - 1) // 2
+    x0r, x0i = xs[0]
+    sums = []
+    diffs = []
+    for k in range(1, half + 1):
+        (ar, ai), (br, bi) = xs[k], xs[size - k]
+        sums.append((em.linear([(1, None, ar), (1, None, br)]), em.linear([(1, None, ai), (1, None, bi)])))
+        diffs.append((em.linear([(1, None, ar), (-1, None, br)]), em.linear([(1, None, ai), (-1, None, bi)])))
+    res = [None] * size
+    res[0] = (em.linear([(1, None, x0r)] + [(1, None, s[0]) for s in sums]),
+              em.linear([(1, None, x0i)] + [(1, None, s[1]) for s in sums]))
+    for m in range(1, half + 1):
+        cos_terms_r = [(1, None, x0r)]
+        cos_terms_i = [(1, None, x0i)]
+        sin_terms_r = []
+        sin_terms_i = []
+        for k in range(1, half + 1):
+            c, s = cos_sin(m * k, size)
+            kc = em.constant(c)
+            ks = em.constant(s)
+            cos_terms_r.append((sign_of(c), kc, sums[k - 1][0]))
+            cos_terms_i.append((sign_of(c), kc, sums[k - 1][1]))
+            sin_terms_r.append((sign_of(s), ks, diffs[k - 1][0]))
+            sin_terms_i.append((sign_of(s), ks, diffs[k - 1][1]))
+        ar = em.linear(cos_terms_r)
+        ai = em.linear(cos_terms_i)
+        br = em.linear(sin_terms_r)
+        bi = em.linear(sin_terms_i)
+        # X[m] = a - i * b, X[size - m] = a + i * b
+        res[m] = (em.linear([(1, None, ar), (1, None, bi)]), em.linear([(1, None, ai), (-1, None, br)]))
+        res[size - m] = (em.linear([(1, None, ar), (-1, None, bi)]), em.linear([(1, None, ai), (1, None, br)]))
+    return res
+
+
+def generate_codelet(size):
+    em = Emitter()
+    xs = []
+    for i in range(size):
+        xs.append((em.temp("in[{} * stride_in + 0]".format(2 * i)), em.temp("in[{} * stride_in + 1]".format(2 * i))))
+    ys = dft(em, xs)
+    lines = ["  constexpr T {} = static_cast<T>({});".format(name, value) for value, name in em.constants.items()]
+    lines += ["  " + statement for statement in em.statements]
+    for i, (yr, yi) in enumerate(ys):
+        lines.append("  out[{} * stride_out + 0] = {};".format(2 * i, yr))
+        lines.append("  out[{} * stride_out + 1] = {};".format(2 * i, yi))
+    return codelet_template.format(size=size, body="\n".join(lines))
+
+
+def write(path, sizes):
+    codelets = "".join(generate_codelet(size) for size in sizes)
+    has_cases = "\n".join("    case {}:".format(size) for size in sizes)
+    dispatch_cases = "\n".join(
+        "    case {0}:\n      codelet_dft_{0}(in, out, stride_in, stride_out);\n      break;".format(size)
+        for size in sizes)
+    with open(path, "w") as fil:
+        fil.write(template.format(codelets=codelets, has_cases=has_cases, dispatch_cases=dispatch_cases))
+
+
+if __name__ == "__main__":
+    write(DST, SIZES)
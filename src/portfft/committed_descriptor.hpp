@@ -27,6 +27,9 @@
 #include <vector>
 
 #include "enums.hpp"
+#include "recorded_compute.hpp"
+#include "traits.hpp"
+#include "wisdom.hpp"
 
 #include "committed_descriptor_impl.hpp"
 
@@ -34,6 +37,9 @@ namespace portfft {
 
 template <typename Scalar, domain Domain>
 class committed_descriptor : private detail::committed_descriptor_impl<Scalar, Domain> {
+  friend class plan_group<Scalar, Domain>;
+  friend class ragged_batch<Scalar>;
+
  public:
   /**
    * Alias for `Scalar`.
@@ -308,6 +314,257 @@ class committed_descriptor : private detail::committed_descriptor_impl<Scalar, D
     return dispatch_direction(in_real, out_real, in_imag, out_imag, complex_storage::SPLIT_COMPLEX, direction::BACKWARD,
                               dependencies);
   }
+
+  /**
+   * Computes forward FFT on data stored in a reduced precision type, working on USM memory. Values are converted to
+   * `Scalar` when they are loaded and back to `StorageScalar` when they are stored, so the computation is done in
+   * `Scalar` precision. Input and output can point to the same memory for in-place FFT.
+   *
+   * @tparam StorageScalar type of the real values in memory, either `sycl::half` or `sycl::ext::oneapi::bfloat16`
+   * @param in USM pointer to memory containing input data, with real and imaginary values interleaved
+   * @param out USM pointer to memory containing output data, with real and imaginary values interleaved
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <typename StorageScalar,
+            std::enable_if_t<detail::is_reduced_precision_storage_v<StorageScalar>, bool> = true>
+  sycl::event compute_forward(const StorageScalar* in, StorageScalar* out,
+                              const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, direction::FORWARD, dependencies);
+  }
+
+  /**
+   * Computes forward FFT on data stored in a reduced precision type, working on USM memory. Values are converted to
+   * `Scalar` when they are loaded and back to `StorageScalar` when they are stored, so the computation is done in
+   * `Scalar` precision. Input and output can point to the same memory for in-place FFT.
+   *
+   * @tparam StorageScalar type of the real values in memory, either `sycl::half` or `sycl::ext::oneapi::bfloat16`
+   * @param in_real USM pointer to memory containing real part of the input data
+   * @param in_imag USM pointer to memory containing imaginary part of the input data
+   * @param out_real USM pointer to memory containing real part of the output data
+   * @param out_imag USM pointer to memory containing imaginary part of the output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <typename StorageScalar,
+            std::enable_if_t<detail::is_reduced_precision_storage_v<StorageScalar>, bool> = true>
+  sycl::event compute_forward(const StorageScalar* in_real, const StorageScalar* in_imag, StorageScalar* out_real,
+                              StorageScalar* out_imag, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in_real, out_real, in_imag, out_imag, complex_storage::SPLIT_COMPLEX, direction::FORWARD,
+                              dependencies);
+  }
+
+  /**
+   * Computes backward FFT on data stored in a reduced precision type, working on USM memory. Values are converted to
+   * `Scalar` when they are loaded and back to `StorageScalar` when they are stored, so the computation is done in
+   * `Scalar` precision. Input and output can point to the same memory for in-place FFT.
+   *
+   * @tparam StorageScalar type of the real values in memory, either `sycl::half` or `sycl::ext::oneapi::bfloat16`
+   * @param in USM pointer to memory containing input data, with real and imaginary values interleaved
+   * @param out USM pointer to memory containing output data, with real and imaginary values interleaved
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <typename StorageScalar,
+            std::enable_if_t<detail::is_reduced_precision_storage_v<StorageScalar>, bool> = true>
+  sycl::event compute_backward(const StorageScalar* in, StorageScalar* out,
+                               const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, direction::BACKWARD,
+                              dependencies);
+  }
+
+  /**
+   * Computes backward FFT on data stored in a reduced precision type, working on USM memory. Values are converted to
+   * `Scalar` when they are loaded and back to `StorageScalar` when they are stored, so the computation is done in
+   * `Scalar` precision. Input and output can point to the same memory for in-place FFT.
+   *
+   * @tparam StorageScalar type of the real values in memory, either `sycl::half` or `sycl::ext::oneapi::bfloat16`
+   * @param in_real USM pointer to memory containing real part of the input data
+   * @param in_imag USM pointer to memory containing imaginary part of the input data
+   * @param out_real USM pointer to memory containing real part of the output data
+   * @param out_imag USM pointer to memory containing imaginary part of the output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <typename StorageScalar,
+            std::enable_if_t<detail::is_reduced_precision_storage_v<StorageScalar>, bool> = true>
+  sycl::event compute_backward(const StorageScalar* in_real, const StorageScalar* in_imag, StorageScalar* out_real,
+                               StorageScalar* out_imag, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in_real, out_real, in_imag, out_imag, complex_storage::SPLIT_COMPLEX, direction::BACKWARD,
+                              dependencies);
+  }
+
+  /**
+   * Computes out-of-place forward FFT on integer input, such as raw samples from an analog-to-digital converter,
+   * working on USM memory. Values are converted to `Scalar` as they are loaded and multiplied by
+   * `descriptor.integer_input_scale`, so the input is read from global memory only once.
+   *
+   * @tparam IntegerT type of the real values in the input, either `std::int16_t` or `std::int8_t`
+   * @param in USM pointer to memory containing input data, with real and imaginary values interleaved
+   * @param out USM pointer to memory containing output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <typename IntegerT, std::enable_if_t<detail::is_integer_storage_v<IntegerT>, bool> = true>
+  sycl::event compute_forward(const IntegerT* in, complex_type* out,
+                              const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, direction::FORWARD, dependencies);
+  }
+
+  /**
+   * Computes out-of-place backward FFT on integer input, working on USM memory. Values are converted to `Scalar` as
+   * they are loaded and multiplied by `descriptor.integer_input_scale`, so the input is read from global memory only
+   * once.
+   *
+   * @tparam IntegerT type of the real values in the input, either `std::int16_t` or `std::int8_t`
+   * @param in USM pointer to memory containing input data, with real and imaginary values interleaved
+   * @param out USM pointer to memory containing output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <typename IntegerT, std::enable_if_t<detail::is_integer_storage_v<IntegerT>, bool> = true>
+  sycl::event compute_backward(const IntegerT* in, complex_type* out,
+                               const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, direction::BACKWARD,
+                              dependencies);
+  }
+
+  /**
+   * Computes out-of-place forward FFT of transforms each in its own USM allocation. Each transform is read from and
+   * written to the pointers of the arrays at its index, inside the kernel, so the transforms do not need to be gathered
+   * into one allocation first. Only supported by 1D plans committed to the workitem or subgroup implementation, with
+   * packed interleaved complex data and no offsets. Pointers in both arrays can be equal for in-place FFT. Lengths
+   * computed by the workgroup or global implementation throw `unsupported_configuration`; such transforms must be
+   * gathered into one allocation first.
+   *
+   * @param ins USM pointer to an array of `number_of_transforms` pointers to the input of each transform
+   * @param outs USM pointer to an array of `number_of_transforms` pointers to the output of each transform
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event compute_forward(const complex_type* const* ins, complex_type* const* outs,
+                              const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return this->dispatch_pointer_array(ins, outs, direction::FORWARD, dependencies);
+  }
+
+  /**
+   * Computes out-of-place backward FFT of transforms each in its own USM allocation. Each transform is read from and
+   * written to the pointers of the arrays at its index, inside the kernel, so the transforms do not need to be gathered
+   * into one allocation first. Only supported by 1D plans committed to the workitem or subgroup implementation, with
+   * packed interleaved complex data and no offsets. Pointers in both arrays can be equal for in-place FFT. Lengths
+   * computed by the workgroup or global implementation throw `unsupported_configuration`; such transforms must be
+   * gathered into one allocation first.
+   *
+   * @param ins USM pointer to an array of `number_of_transforms` pointers to the input of each transform
+   * @param outs USM pointer to an array of `number_of_transforms` pointers to the output of each transform
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event compute_backward(const complex_type* const* ins, complex_type* const* outs,
+                               const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return this->dispatch_pointer_array(ins, outs, direction::BACKWARD, dependencies);
+  }
+
+  /**
+   * Computes forward FFT of data in host memory. The batch is split into chunks of transforms, and the copies of each
+   * chunk to and from the device overlap with the computation of other chunks. The copies overlap best when the host
+   * memory is allocated with `sycl::malloc_host`. The host memory must not be accessed until the returned event
+   * completes.
+   *
+   * @param host_in host pointer to memory containing input data
+   * @param host_out host pointer to memory containing output data, may be equal to `host_in`
+   * @param chunk_batches number of transforms in each chunk, 0 to choose it by timing the plan on the device
+   * @param dependencies events that must complete before the input is read
+   * @return sycl::event completing once all the output is in host memory
+   */
+  sycl::event compute_forward_stream(const complex_type* host_in, complex_type* host_out, std::size_t chunk_batches = 0,
+                                     const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return this->dispatch_stream(host_in, host_out, chunk_batches, direction::FORWARD, dependencies);
+  }
+
+  /**
+   * Computes backward FFT of data in host memory. The batch is split into chunks of transforms, and the copies of each
+   * chunk to and from the device overlap with the computation of other chunks. The copies overlap best when the host
+   * memory is allocated with `sycl::malloc_host`. The host memory must not be accessed until the returned event
+   * completes.
+   *
+   * @param host_in host pointer to memory containing input data
+   * @param host_out host pointer to memory containing output data, may be equal to `host_in`
+   * @param chunk_batches number of transforms in each chunk, 0 to choose it by timing the plan on the device
+   * @param dependencies events that must complete before the input is read
+   * @return sycl::event completing once all the output is in host memory
+   */
+  sycl::event compute_backward_stream(const complex_type* host_in, complex_type* host_out,
+                                      std::size_t chunk_batches = 0,
+                                      const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return this->dispatch_stream(host_in, host_out, chunk_batches, direction::BACKWARD, dependencies);
+  }
+
+  /**
+   * Records a forward FFT of data in USM, to be computed with `recorded_compute::replay`. Where SYCL command graphs are
+   * supported, the kernels of the FFT are recorded once and each replay is a single submission. The recorded
+   * computation owns a copy of the committed descriptor with its own scratch memory, so it can be moved but not copied.
+   * The pointers must stay valid as long as it is replayed.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory containing output data, may be equal to `in` for an in-place FFT
+   * @return the recorded computation
+   */
+  recorded_compute record_forward(const complex_type* in, complex_type* out) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return record(in, out, direction::FORWARD);
+  }
+
+  /**
+   * Records a backward FFT of data in USM, to be computed with `recorded_compute::replay`.
+   * @see record_forward
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory containing output data, may be equal to `in` for an in-place FFT
+   * @return the recorded computation
+   */
+  recorded_compute record_backward(const complex_type* in, complex_type* out) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return record(in, out, direction::BACKWARD);
+  }
+
+  /**
+   * Records the plan decisions made at commit in wisdom, replacing the ones recorded for the same device and
+   * descriptor shape. Passing the wisdom to `descriptor::commit` applies the decisions instead of choosing them again.
+   *
+   * @param plan_wisdom wisdom to record the decisions in
+   */
+  void export_wisdom(wisdom& plan_wisdom) const {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    plan_wisdom.add(this->get_wisdom_entry());
+  }
+
+ private:
+  /**
+   * Records an FFT of data in USM.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory containing output data
+   * @param compute_direction direction of the FFT
+   * @return the recorded computation
+   */
+  recorded_compute record(const complex_type* in, complex_type* out, direction compute_direction) {
+    return {this->get_queue(), [plan = *this, in, out, compute_direction](
+                                   const std::vector<sycl::event>& dependencies) mutable {
+              return plan.dispatch_direction(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, compute_direction,
+                                             dependencies);
+            }};
+  }
 };
 
 }  // namespace portfft
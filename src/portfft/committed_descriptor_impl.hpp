@@ -23,24 +23,46 @@
 
 #include <sycl/sycl.hpp>
 
+#include <algorithm>
+#include <array>
 #include <complex>
 #include <cstdint>
 #include <functional>
+#include <future>
+#include <memory>
 #include <numeric>
+#include <optional>
 #include <vector>
 
 #include "common/exceptions.hpp"
+#include "common/helpers.hpp"
+#include "common/local_padding.hpp"
+#include "common/stream_pipeline.hpp"
 #include "common/subgroup_ct.hpp"
 #include "defines.hpp"
 #include "enums.hpp"
 #include "specialization_constant.hpp"
+#include "traits.hpp"
 #include "utils.hpp"
+#include "wisdom.hpp"
 
 namespace portfft {
 
 template <typename Scalar, domain Domain>
 struct descriptor;
 
+template <typename Scalar, domain Domain>
+class committed_streaming_descriptor;
+
+template <typename Scalar, domain Domain>
+class committed_sharded_descriptor;
+
+template <typename Scalar, domain Domain>
+class plan_group;
+
+template <typename Scalar>
+class ragged_batch;
+
 namespace detail {
 
 template <typename Scalar, domain Domain>
@@ -63,15 +85,19 @@ sycl::event transpose_level(const typename committed_descriptor_impl<Scalar, Dom
                             complex_storage storage);
 
 // kernel names
-template <typename Scalar, domain, detail::memory, Idx SubgroupSize>
+// StorageScalar is the type of the real values in global memory, which may be narrower than Scalar. For integer input
+// it is the type of the input, the output being stored as Scalar.
+template <typename Scalar, domain, detail::memory, Idx SubgroupSize, typename StorageScalar>
 class workitem_kernel;
-template <typename Scalar, domain, detail::memory, Idx SubgroupSize>
+template <typename Scalar, domain, detail::memory, Idx SubgroupSize, typename StorageScalar>
 class subgroup_kernel;
-template <typename Scalar, domain, detail::memory, Idx SubgroupSize>
+template <typename Scalar, domain, detail::memory, Idx SubgroupSize, typename StorageScalar>
 class workgroup_kernel;
-template <typename Scalar, domain, detail::memory, Idx SubgroupSize>
+template <typename Scalar, domain, detail::memory, Idx SubgroupSize, typename StorageScalar>
 class global_kernel;
-template <typename Scalar, detail::memory>
+template <typename Scalar, domain, detail::memory, Idx SubgroupSize, typename StorageScalar>
+class multi_dim_kernel;
+template <typename Scalar, detail::memory, typename StorageScalar>
 class transpose_kernel;
 
 /**
@@ -83,6 +109,10 @@ class transpose_kernel;
 template <typename Scalar, domain Domain>
 class committed_descriptor_impl {
   friend struct descriptor<Scalar, Domain>;
+  friend class committed_streaming_descriptor<Scalar, Domain>;
+  friend class committed_sharded_descriptor<Scalar, Domain>;
+  friend class plan_group<Scalar, Domain>;
+  friend class ragged_batch<Scalar>;
   template <typename Scalar1, domain Domain1, Idx SubgroupSize, typename TIn>
   friend std::vector<sycl::event> detail::compute_level(
       const typename committed_descriptor_impl<Scalar1, Domain1>::kernel_data_struct& kd_struct, const TIn& input,
@@ -112,10 +142,58 @@ class committed_descriptor_impl {
   Idx n_compute_units;
   std::vector<std::size_t> supported_sg_sizes;
   Idx local_memory_size;
+  // number of local memory banks, 0 if local memory is not banked
+  Idx n_local_banks;
   IdxGlobal llc_size;
   std::shared_ptr<Scalar> scratch_ptr_1;
   std::shared_ptr<Scalar> scratch_ptr_2;
-  std::size_t scratch_space_required;
+  // last computation using the scratch memory, which must complete before the memory is freed
+  sycl::event last_scratch_event;
+
+  // number of chunks of the streaming interface that can be in flight at once, each with its own device buffers
+  static constexpr std::size_t StreamRingSize = 3;
+
+  /**
+   * State of the streaming interface. It is only created once the interface is used and is not copied with the
+   * committed descriptor.
+   */
+  struct stream_struct {
+    // slots of the chunks in flight, shared with `committed_streaming_descriptor`
+    detail::stream_pipeline<std::complex<Scalar>> pipeline;
+    // number of transforms per chunk chosen by timing the plan for forward and backward direction, 0 if not yet timed
+    std::array<std::size_t, 2> tuned_chunk_transforms{0, 0};
+
+    explicit stream_struct(sycl::queue& queue) : pipeline(queue, StreamRingSize) {}
+  };
+  std::unique_ptr<stream_struct> stream;
+
+  /**
+   * Base pointers of the transforms of a computation on arrays of pointers, passed from `dispatch_pointer_array` to the
+   * kernel. Null for all other computations.
+   */
+  struct batch_pointers_struct {
+    const Scalar* const* inputs = nullptr;
+    Scalar* const* outputs = nullptr;
+    // index of the first transform in the arrays and number of transforms, in device memory, read by the kernel. The
+    // number of transforms the kernel is launched for is then an upper bound. Null if the kernel computes all of them.
+    const IdxGlobal* range = nullptr;
+
+    /**
+     * Moves the arrays to the first transform of the range and returns the number of transforms to compute. Called by
+     * the kernel.
+     *
+     * @param n_transforms number of transforms the kernel is launched for
+     * @return number of transforms to compute
+     */
+    PORTFFT_INLINE IdxGlobal resolve_range(IdxGlobal n_transforms) {
+      if (range == nullptr) {
+        return n_transforms;
+      }
+      inputs += range[0];
+      outputs += range[0];
+      return range[1];
+    }
+  };
 
   struct kernel_data_struct {
     sycl::kernel_bundle<sycl::bundle_state::executable> exec_bundle;
@@ -129,6 +207,22 @@ class committed_descriptor_impl {
     std::size_t local_mem_required;
     IdxGlobal global_range;
     IdxGlobal local_range;
+    // Local memory in scalars and subgroups per workgroup the kernel is launched with, for each input layout. They are
+    // computed at commit with `precompute_launch_params`, so that launching the kernel does not need to.
+    struct launch_params_struct {
+      std::size_t local_elements = 0;
+      Idx num_sgs_per_wg = 0;
+    };
+    std::array<launch_params_struct, 3> launch_params{};
+
+    /**
+     * Get the launch parameters of the kernel for the given input layout.
+     *
+     * @param input_layout the layout of the input data of the transforms
+     */
+    const launch_params_struct& get_launch_params(layout input_layout) const {
+      return launch_params[static_cast<std::size_t>(input_layout)];
+    }
 
     kernel_data_struct(sycl::kernel_bundle<sycl::bundle_state::executable>&& exec_bundle,
                        const std::vector<Idx>& factors, std::size_t length, Idx used_sg_size, Idx num_sgs_per_wg,
@@ -154,7 +248,8 @@ class committed_descriptor_impl {
     // The committed length (as in the user specified length) for the particular dimension
     std::size_t committed_length;
     Idx used_sg_size;
-    Idx num_batches_in_l2;
+    // chosen at commit for the global implementation unless it is recorded in wisdom
+    Idx num_batches_in_l2 = 0;
     Idx num_factors;
     detail::fft_algorithm algorithm;
 
@@ -174,7 +269,121 @@ class committed_descriptor_impl {
     }
   };
 
-  std::vector<dimension_struct> dimensions;
+  /**
+   * The part of a committed plan that does not change after commit: the compiled kernels with their twiddles, the
+   * factors of the global implementation and the layouts of the data. It is shared by the copies of a committed
+   * descriptor, which only own the mutable state used while computing - scratch memory and streaming buffers.
+   */
+  struct plan_core_struct {
+    std::vector<dimension_struct> dimensions;
+    // layout of the data in forward and backward domain, which every computation needs
+    std::array<layout, 2> committed_layouts{};
+    // number of scalars in each of the scratch arrays of the global implementation, 0 if they are not needed
+    std::size_t scratch_space_required = 0;
+    // window the input of forward transforms is multiplied by on load, null without one
+    std::shared_ptr<Scalar> forward_window;
+  };
+  // null only for a descriptor that was moved from
+  std::shared_ptr<plan_core_struct> core;
+
+  /**
+   * Get the layout of the data in the given domain.
+   *
+   * @param dir direction whose input data the layout is of
+   */
+  layout get_committed_layout(direction dir) const {
+    return core->committed_layouts[dir == direction::FORWARD ? 0 : 1];
+  }
+
+  /**
+   * Precomputes the local memory and the number of subgroups per workgroup the kernels of a dimension are launched
+   * with for each of the input layouts.
+   *
+   * @param dimension_data the dimension to precompute the launch parameters for
+   */
+  void precompute_launch_params(dimension_struct& dimension_data) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (dimension_data.level == detail::level::GLOBAL) {
+      // the kernels of the global implementation have their launch parameters set when their twiddles are calculated
+      return;
+    }
+    for (auto* kernels : {&dimension_data.forward_kernels, &dimension_data.backward_kernels}) {
+      for (kernel_data_struct& kernel_data : *kernels) {
+        for (layout input_layout : {layout::PACKED, layout::UNPACKED, layout::BATCH_INTERLEAVED}) {
+          auto& launch = kernel_data.launch_params[static_cast<std::size_t>(input_layout)];
+          launch.num_sgs_per_wg = kernel_data.num_sgs_per_wg;
+          launch.local_elements =
+              num_scalars_in_local_mem(kernel_data.level, kernel_data.length, kernel_data.used_sg_size,
+                                       kernel_data.factors, launch.num_sgs_per_wg, input_layout);
+        }
+      }
+    }
+  }
+
+  /**
+   * Replaces the number of subgroups per workgroup of the kernels of a dimension with the ones recorded in wisdom and
+   * derives the local memory from them. Launch parameters that were not recorded are kept.
+   *
+   * @param dimension_data the dimension to apply the launch parameters to
+   * @param recorded decisions recorded in wisdom for the dimension
+   */
+  void apply_recorded_launch_params(dimension_struct& dimension_data, const wisdom_dimension& recorded) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (dimension_data.level == detail::level::GLOBAL) {
+      return;
+    }
+    for (auto* kernels : {&dimension_data.forward_kernels, &dimension_data.backward_kernels}) {
+      for (std::size_t k = 0; k < kernels->size() && k < recorded.kernels.size(); k++) {
+        const wisdom_kernel& recorded_kernel = recorded.kernels[k];
+        for (std::size_t l = 0; l < recorded_kernel.num_sgs_per_wg.size(); l++) {
+          if (recorded_kernel.num_sgs_per_wg[l] == 0) {
+            continue;
+          }
+          kernel_data_struct& kernel_data = (*kernels)[k];
+          const Idx num_sgs_per_wg = recorded_kernel.num_sgs_per_wg[l];
+          if (static_cast<std::size_t>(num_sgs_per_wg) * static_cast<std::size_t>(kernel_data.used_sg_size) >
+              dev.get_info<sycl::info::device::max_work_group_size>()) {
+            throw invalid_configuration("Subgroups per workgroup recorded in wisdom exceed the workgroup size limit");
+          }
+          auto& launch = kernel_data.launch_params[l];
+          launch.num_sgs_per_wg = num_sgs_per_wg;
+          launch.local_elements =
+              num_scalars_in_local_mem(kernel_data.level, kernel_data.length, kernel_data.used_sg_size,
+                                       kernel_data.factors, launch.num_sgs_per_wg, static_cast<layout>(l));
+          if (launch.num_sgs_per_wg != num_sgs_per_wg ||
+              launch.local_elements * sizeof(Scalar) > static_cast<std::size_t>(local_memory_size)) {
+            throw invalid_configuration("Subgroups per workgroup recorded in wisdom do not fit in local memory");
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Get an entry of wisdom with the device and the shape of the descriptor, without any decisions.
+   */
+  wisdom_entry make_wisdom_key() const {
+    wisdom_entry key;
+    key.device = detail::get_wisdom_device_key(dev);
+    key.scalar = detail::get_wisdom_scalar_name<Scalar>();
+    key.dom = Domain;
+    key.lengths = params.lengths;
+    key.number_of_transforms = params.number_of_transforms;
+    key.place = params.placement;
+    key.storage = params.complex_storage;
+    key.layouts = {detail::get_layout(params, direction::FORWARD), detail::get_layout(params, direction::BACKWARD)};
+    return key;
+  }
+
+  /**
+   * Chooses the padding of local memory for the banks of the device.
+   *
+   * @param row_size distance between the elements accessed by consecutive work-items, in scalars
+   * @return bank lines per pad, 0 for no padding
+   */
+  Idx bank_lines_per_pad(Idx row_size) const {
+    return detail::choose_bank_lines_per_pad<Scalar>(row_size, n_local_banks);
+  }
 
   template <typename Impl, typename... Args>
   auto dispatch(detail::level level, Args&&... args) {
@@ -187,6 +396,8 @@ class committed_descriptor_impl {
         return Impl::template inner<detail::level::WORKGROUP, void>::execute(*this, args...);
       case detail::level::GLOBAL:
         return Impl::template inner<detail::level::GLOBAL, void>::execute(*this, args...);
+      case detail::level::MULTI_DIM:
+        return Impl::template inner<detail::level::MULTI_DIM, void>::execute(*this, args...);
       default:
         // This should be unreachable
         throw unsupported_configuration("Unimplemented");
@@ -204,6 +415,8 @@ class committed_descriptor_impl {
         return Impl::template inner<detail::level::WORKGROUP, SubgroupSize, void>::execute(*this, args...);
       case detail::level::GLOBAL:
         return Impl::template inner<detail::level::GLOBAL, SubgroupSize, void>::execute(*this, args...);
+      case detail::level::MULTI_DIM:
+        return Impl::template inner<detail::level::MULTI_DIM, SubgroupSize, void>::execute(*this, args...);
       default:
         // This should be unreachable
         throw unsupported_configuration("Unimplemented");
@@ -237,10 +450,9 @@ class committed_descriptor_impl {
               {{detail::level::WORKITEM, ids, {static_cast<Idx>(fft_size)}}}};
     }
     if (detail::fits_in_sg<Scalar>(fft_size, SubgroupSize)) {
-      Idx factor_sg = detail::factorize_sg(static_cast<Idx>(fft_size), SubgroupSize);
+      Idx factor_sg = detail::factorize_sg<Scalar>(static_cast<Idx>(fft_size), SubgroupSize);
       Idx factor_wi = static_cast<Idx>(fft_size) / factor_sg;
-      // This factorization is duplicated in the dispatch logic on the device.
-      // The CT and spec constant factors should match.
+      // The kernel gets these factors through specialization constants, so it does not need to repeat the cost model.
       factors.push_back(factor_wi);
       factors.push_back(factor_sg);
       ids = detail::get_ids<detail::subgroup_kernel, Scalar, Domain, SubgroupSize>();
@@ -252,9 +464,9 @@ class committed_descriptor_impl {
         detail::can_cast_safely<IdxGlobal, Idx>(fft_size / n_idx_global)) {
       Idx n = static_cast<Idx>(n_idx_global);
       Idx m = static_cast<Idx>(fft_size / n_idx_global);
-      Idx factor_sg_n = detail::factorize_sg(n, SubgroupSize);
+      Idx factor_sg_n = detail::factorize_sg<Scalar>(n, SubgroupSize);
       Idx factor_wi_n = n / factor_sg_n;
-      Idx factor_sg_m = detail::factorize_sg(m, SubgroupSize);
+      Idx factor_sg_m = detail::factorize_sg<Scalar>(m, SubgroupSize);
       Idx factor_wi_m = m / factor_sg_m;
       Idx temp_num_sgs_in_wg;
       std::size_t local_memory_usage =
@@ -270,8 +482,8 @@ class committed_descriptor_impl {
         factors.push_back(factor_sg_n);
         factors.push_back(factor_wi_m);
         factors.push_back(factor_sg_m);
-        // This factorization of N and M is duplicated in the dispatch logic on the device.
-        // The CT and spec constant factors should match.
+        // The factorization of the fft size into N and M is duplicated in the dispatch logic on the device. The
+        // subgroup factors of N and M are passed to the kernel through specialization constants.
         ids = detail::get_ids<detail::workgroup_kernel, Scalar, Domain, SubgroupSize>();
         PORTFFT_LOG_TRACE("Prepared workgroup impl with factor_wi_n:", factor_wi_n, " factor_sg_n:", factor_sg_n,
                           " factor_wi_m:", factor_wi_m, " factor_sg_m:", factor_sg_m);
@@ -292,7 +504,7 @@ class committed_descriptor_impl {
       }
       bool fits_in_local_memory_subgroup = [&]() {
         Idx temp_num_sgs_in_wg;
-        IdxGlobal factor_sg = detail::factorize_sg<IdxGlobal>(factor_size, SubgroupSize);
+        IdxGlobal factor_sg = detail::factorize_sg<Scalar, IdxGlobal>(factor_size, SubgroupSize);
         IdxGlobal factor_wi = factor_size / factor_sg;
         if (detail::can_cast_safely<IdxGlobal, Idx>(factor_sg) && detail::can_cast_safely<IdxGlobal, Idx>(factor_wi)) {
           std::size_t input_scalars =
@@ -306,7 +518,7 @@ class committed_descriptor_impl {
       }();
       if (detail::fits_in_sg<Scalar>(factor_size, SubgroupSize) && fits_in_local_memory_subgroup &&
           !PORTFFT_SLOW_SG_SHUFFLES) {
-        Idx factor_sg = detail::factorize_sg(static_cast<Idx>(factor_size), SubgroupSize);
+        Idx factor_sg = detail::factorize_sg<Scalar>(static_cast<Idx>(factor_size), SubgroupSize);
         Idx factor_wi = static_cast<Idx>(factor_size) / factor_sg;
         PORTFFT_LOG_TRACE("Subgroup kernel for factor:", factor_size, "with factor_wi:", factor_wi,
                           "and factor_sg:", factor_sg);
@@ -383,6 +595,11 @@ class committed_descriptor_impl {
     in_bundle.template set_specialization_constant<detail::SpecConstConjugateOnStore>(conjugate_on_store);
     PORTFFT_LOG_TRACE("get_spec_constant_scale:", scale_factor);
     in_bundle.template set_specialization_constant<detail::get_spec_constant_scale<Scalar>()>(scale_factor);
+    PORTFFT_LOG_TRACE("get_spec_constant_integer_input_scale:", params.integer_input_scale);
+    in_bundle.template set_specialization_constant<detail::get_spec_constant_integer_input_scale<Scalar>()>(
+        params.integer_input_scale);
+    PORTFFT_LOG_TRACE("SpecConstNumLocalBanks:", n_local_banks);
+    in_bundle.template set_specialization_constant<detail::SpecConstNumLocalBanks>(n_local_banks);
     PORTFFT_LOG_TRACE("SpecConstInputStride:", input_stride);
     in_bundle.template set_specialization_constant<detail::SpecConstInputStride>(input_stride);
     PORTFFT_LOG_TRACE("SpecConstOutputStride:", output_stride);
@@ -450,6 +667,45 @@ class committed_descriptor_impl {
     return dispatch<calculate_twiddles_struct>(level, dimension_data, kernels);
   }
 
+  /**
+   * Number of outer batch dimensions, counted from the innermost, the kernel of a plan computes along with the batches
+   * of `number_of_transforms`. The workitem implementation of a 1D transform and the subgroup implementation of the
+   * Cooley-Tukey algorithm, for input that is not batch interleaved, split the index of a transform into an inner and
+   * an outer batch index, see `get_batch_offset`. The innermost outer batch dimension is indexed this way, along with
+   * any dimensions laid out as a single one with it: each `count * distance` of the next one apart in both domains. The
+   * other dimensions, or all of them for the other implementations, are launched once for each outer batch.
+   *
+   * @param top_level selected level of implementation
+   * @param algorithm algorithm of the kernel of the plan
+   * @param compute_direction direction of compute, forward / backward
+   * @return the number of outer batch dimensions indexed by the kernel
+   */
+  std::size_t get_n_folded_outer_dims(detail::level top_level, detail::fft_algorithm algorithm,
+                                      direction compute_direction) const noexcept {
+    const std::vector<std::size_t>& counts = params.outer_batch_counts;
+    if (counts.empty() || params.lengths.size() != 1) {
+      return 0;
+    }
+    // the batch interleaved codepath of the subgroup kernel loads consecutive transforms together
+    const bool subgroup_folds = top_level == detail::level::SUBGROUP &&
+                                algorithm == detail::fft_algorithm::COOLEY_TUKEY &&
+                                detail::get_layout(params, compute_direction) != detail::layout::BATCH_INTERLEAVED;
+    if (top_level != detail::level::WORKITEM && !subgroup_folds) {
+      return 0;
+    }
+    const std::vector<std::size_t>& forward_distances = params.forward_outer_distances;
+    const std::vector<std::size_t>& backward_distances = params.backward_outer_distances;
+    std::size_t n_folded = 1;
+    for (std::size_t dim = counts.size() - 1; dim-- > 0;) {
+      if (forward_distances[dim] != counts[dim + 1] * forward_distances[dim + 1] ||
+          backward_distances[dim] != counts[dim + 1] * backward_distances[dim + 1]) {
+        break;
+      }
+      n_folded++;
+    }
+    return n_folded;
+  }
+
   /**
    * Sets the specialization constants for all the kernel_ids contained in the vector
    * returned from prepare_implementation
@@ -528,6 +784,26 @@ class committed_descriptor_impl {
 
       auto in_bundle = sycl::get_kernel_bundle<sycl::bundle_state::input>(queue.get_context(), ids);
 
+      // the workitem and subgroup implementations fold the innermost outer batch dimensions into their indexing, see
+      // `dispatch_outer_batches`
+      const auto algorithm = factor_size != static_cast<Idx>(params.lengths[dimension_num]) && !is_global
+                                 ? detail::fft_algorithm::BLUESTEIN
+                                 : detail::fft_algorithm::COOLEY_TUKEY;
+      IdxGlobal batches_per_outer_batch = 0;
+      IdxGlobal input_outer_distance = 0;
+      IdxGlobal output_outer_distance = 0;
+      if (get_n_folded_outer_dims(top_level, algorithm, compute_direction) != 0) {
+        batches_per_outer_batch = static_cast<IdxGlobal>(params.number_of_transforms);
+        input_outer_distance = static_cast<IdxGlobal>(params.get_outer_distances(compute_direction).back());
+        output_outer_distance = static_cast<IdxGlobal>(params.get_outer_distances(inv(compute_direction)).back());
+      }
+      PORTFFT_LOG_TRACE("SpecConstBatchesPerOuterBatch:", batches_per_outer_batch);
+      in_bundle.template set_specialization_constant<detail::SpecConstBatchesPerOuterBatch>(batches_per_outer_batch);
+      PORTFFT_LOG_TRACE("SpecConstInputOuterDistance:", input_outer_distance);
+      in_bundle.template set_specialization_constant<detail::SpecConstInputOuterDistance>(input_outer_distance);
+      PORTFFT_LOG_TRACE("SpecConstOutputOuterDistance:", output_outer_distance);
+      in_bundle.template set_specialization_constant<detail::SpecConstOutputOuterDistance>(output_outer_distance);
+
       if (factor_size != static_cast<Idx>(params.lengths[dimension_num]) && !is_global) {
         in_bundle.template set_specialization_constant<detail::SpecConstFFTAlgorithm>(detail::fft_algorithm::BLUESTEIN);
         in_bundle.template set_specialization_constant<detail::SpecConstCommittedLength>(
@@ -566,6 +842,49 @@ class committed_descriptor_impl {
     return result;
   }
 
+  /**
+   * Builds the kernel bundles of a dimension for an implementation prepared for it.
+   *
+   * @tparam SubgroupSize subgroup size the implementation was prepared for
+   * @param dimension_num The dimension for which the kernels are being built
+   * @param top_level selected level of implementation
+   * @param fft_size size of the DFT the implementation was prepared for
+   * @param prepared_vec vector of tuples of: implementation to use for a kernel, vector of kernel ids, factors
+   * @return `dimension_struct` for the newly built kernels, std::nullopt if the kernels are not compatible with the
+   * device or could not be built
+   */
+  template <Idx SubgroupSize>
+  std::optional<dimension_struct> build_prepared(std::size_t dimension_num, detail::level top_level,
+                                                 std::size_t fft_size, kernel_ids_and_metadata_t& prepared_vec) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    for (auto [level, ids, factors] : prepared_vec) {
+      if (!sycl::is_compatible(ids, dev)) {
+        return std::nullopt;
+      }
+    }
+    // the bundles of the two directions are independent, the backward ones are built on another thread
+    auto backward_future = std::async(std::launch::async, [this, top_level, &prepared_vec, dimension_num]() {
+      return set_spec_constants_driver<SubgroupSize>(top_level, prepared_vec, direction::BACKWARD, dimension_num);
+    });
+    auto forward_kernels =
+        set_spec_constants_driver<SubgroupSize>(top_level, prepared_vec, direction::FORWARD, dimension_num);
+    auto backward_kernels = backward_future.get();
+    detail::fft_algorithm algorithm;
+    if (fft_size == params.lengths[dimension_num]) {
+      algorithm = detail::fft_algorithm::COOLEY_TUKEY;
+    } else if (fft_size > params.lengths[dimension_num]) {
+      algorithm = detail::fft_algorithm::BLUESTEIN;
+    } else {
+      throw internal_error("Invalid FFT size encountered while preparing the implementation");
+    }
+
+    if (forward_kernels.has_value() && backward_kernels.has_value()) {
+      return dimension_struct(forward_kernels.value(), backward_kernels.value(), top_level, fft_size,
+                              params.lengths[dimension_num], SubgroupSize, algorithm);
+    }
+    return std::nullopt;
+  }
+
   /**
    * Builds the kernel bundles with appropriate values of specialization constants for the first supported subgroup
    * size.
@@ -573,7 +892,6 @@ class committed_descriptor_impl {
    * @tparam SubgroupSize first subgroup size
    * @tparam OtherSGSizes other subgroup sizes
    * @param dimension_num The dimension for which the kernels are being built
-   * @param skip_scaling whether or not to skip scaling
    * @return `dimension_struct` for the newly built kernels
    */
   template <Idx SubgroupSize, Idx... OtherSGSizes>
@@ -582,52 +900,219 @@ class committed_descriptor_impl {
     if (std::count(supported_sg_sizes.begin(), supported_sg_sizes.end(), SubgroupSize)) {
       auto [top_level, fft_size, prepared_vec] =
           prepare_implementation<SubgroupSize>(static_cast<IdxGlobal>(params.lengths[dimension_num]));
-      bool is_compatible = true;
-      for (auto [level, ids, factors] : prepared_vec) {
-        is_compatible = is_compatible && sycl::is_compatible(ids, dev);
-        if (!is_compatible) {
+      auto dimension_data = build_prepared<SubgroupSize>(dimension_num, top_level, fft_size, prepared_vec);
+      if (dimension_data.has_value()) {
+        return std::move(dimension_data.value());
+      }
+    }
+    if constexpr (sizeof...(OtherSGSizes) == 0) {
+      throw unsupported_configuration("None of the compiled subgroup sizes are supported by the device");
+    } else {
+      return build_w_spec_const<OtherSGSizes...>(dimension_num);
+    }
+  }
+
+  /**
+   * Builds the kernel bundles of a dimension with the level, factors and subgroup size recorded in wisdom instead of
+   * choosing them.
+   *
+   * @tparam SubgroupSize first subgroup size
+   * @tparam OtherSGSizes other subgroup sizes
+   * @param dimension_num The dimension for which the kernels are being built
+   * @param recorded decisions recorded for the dimension
+   * @return `dimension_struct` for the newly built kernels
+   */
+  template <Idx SubgroupSize, Idx... OtherSGSizes>
+  dimension_struct build_recorded(std::size_t dimension_num, const wisdom_dimension& recorded) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (recorded.subgroup_size == SubgroupSize) {
+      if (!std::count(supported_sg_sizes.begin(), supported_sg_sizes.end(), SubgroupSize)) {
+        throw invalid_configuration("Subgroup size ", SubgroupSize,
+                                    " recorded in wisdom is not supported by the device");
+      }
+      std::size_t factors_product = 1;
+      for (const wisdom_kernel& kernel : recorded.kernels) {
+        factors_product = std::accumulate(kernel.factors.begin(), kernel.factors.end(), factors_product,
+                                          [](std::size_t a, Idx b) { return a * static_cast<std::size_t>(b); });
+      }
+      const bool single_kernel_level = recorded.level != detail::level::GLOBAL;
+      if (recorded.level == detail::level::MULTI_DIM || recorded.kernels.empty() ||
+          (single_kernel_level && recorded.kernels.size() != 1) || factors_product != recorded.fft_size ||
+          recorded.fft_size < params.lengths[dimension_num]) {
+        throw invalid_configuration("Invalid kernels recorded in wisdom for dimension ", dimension_num);
+      }
+      std::vector<sycl::kernel_id> ids;
+      switch (recorded.level) {
+        case detail::level::WORKITEM:
+          ids = detail::get_ids<detail::workitem_kernel, Scalar, Domain, SubgroupSize>();
           break;
-        }
+        case detail::level::SUBGROUP:
+          ids = detail::get_ids<detail::subgroup_kernel, Scalar, Domain, SubgroupSize>();
+          break;
+        case detail::level::WORKGROUP:
+          ids = detail::get_ids<detail::workgroup_kernel, Scalar, Domain, SubgroupSize>();
+          break;
+        default:
+          ids = detail::get_ids<detail::global_kernel, Scalar, Domain, SubgroupSize>();
+      }
+      kernel_ids_and_metadata_t prepared_vec;
+      for (const wisdom_kernel& kernel : recorded.kernels) {
+        prepared_vec.emplace_back(single_kernel_level ? recorded.level : kernel.level, ids, kernel.factors);
+      }
+      auto dimension_data =
+          build_prepared<SubgroupSize>(dimension_num, recorded.level, recorded.fft_size, prepared_vec);
+      if (!dimension_data.has_value()) {
+        throw invalid_configuration("The kernels recorded in wisdom for dimension ", dimension_num,
+                                    " could not be built for the device");
       }
+      PORTFFT_LOG_TRACE("Built the kernels recorded in wisdom for dimension", dimension_num);
+      dimension_data->num_batches_in_l2 = recorded.num_batches_in_l2;
+      return std::move(dimension_data.value());
+    }
+    if constexpr (sizeof...(OtherSGSizes) == 0) {
+      throw invalid_configuration("Subgroup size ", recorded.subgroup_size,
+                                  " recorded in wisdom is not one of PORTFFT_SUBGROUP_SIZES");
+    } else {
+      return build_recorded<OtherSGSizes...>(dimension_num, recorded);
+    }
+  }
 
-      if (is_compatible) {
-        auto forward_kernels =
-            set_spec_constants_driver<SubgroupSize>(top_level, prepared_vec, direction::FORWARD, dimension_num);
-        auto backward_kernels =
-            set_spec_constants_driver<SubgroupSize>(top_level, prepared_vec, direction::BACKWARD, dimension_num);
-        detail::fft_algorithm algorithm;
-        if (fft_size == params.lengths[dimension_num]) {
-          algorithm = detail::fft_algorithm::COOLEY_TUKEY;
-        } else if (fft_size > params.lengths[dimension_num]) {
-          algorithm = detail::fft_algorithm::BLUESTEIN;
-        } else {
-          throw internal_error("Invalid FFT size encountered while preparing the implementation");
-        }
+  /**
+   * Builds the kernels of a dimension and calculates their twiddles. Only reads the state of the committed descriptor,
+   * so it can be called for several dimensions concurrently.
+   *
+   * @param dimension_num The dimension for which the kernels are being built
+   * @param recorded decisions recorded in wisdom for the dimension, nullptr to choose them
+   * @return `dimension_struct` for the newly built kernels
+   */
+  dimension_struct build_dimension(std::size_t dimension_num, const wisdom_dimension* recorded) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    dimension_struct dimension_data = recorded ? build_recorded<PORTFFT_SUBGROUP_SIZES>(dimension_num, *recorded)
+                                               : build_w_spec_const<PORTFFT_SUBGROUP_SIZES>(dimension_num);
+    dimension_data.forward_kernels.at(0).twiddles_forward = std::shared_ptr<Scalar>(
+        calculate_twiddles(dimension_data.level, dimension_data, dimension_data.forward_kernels),
+        [queue = queue](Scalar* ptr) {
+          if (ptr != nullptr) {
+            sycl::free(ptr, queue);
+          }
+        });
+    // TODO: refactor multi-dimensional fft's such that they can use a single pointer for twiddles.
+    dimension_data.backward_kernels.at(0).twiddles_forward = std::shared_ptr<Scalar>(
+        calculate_twiddles(dimension_data.level, dimension_data, dimension_data.backward_kernels),
+        [queue = queue](Scalar* ptr) {
+          if (ptr != nullptr) {
+            PORTFFT_LOG_TRACE("Freeing the array for twiddle factors");
+            sycl::free(ptr, queue);
+          }
+        });
+    return dimension_data;
+  }
+
+  /**
+   * Checks whether all the dimensions of the transform can be computed by a single kernel. Each workgroup of that
+   * kernel loads whole transforms into local memory, so every dimension must be small enough to be computed by a
+   * workitem.
+   *
+   * @return true if the transform can be computed by the multi-dimensional kernel
+   */
+  bool fits_in_multi_dim() {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if constexpr (Domain != domain::COMPLEX) {
+      return false;
+    }
+    const std::size_t n_dimensions = params.lengths.size();
+    if (n_dimensions < 2 || n_dimensions > static_cast<std::size_t>(detail::MaxFusedDimensions)) {
+      return false;
+    }
+    if (detail::get_layout(params, direction::FORWARD) != detail::layout::PACKED ||
+        detail::get_layout(params, direction::BACKWARD) != detail::layout::PACKED) {
+      return false;
+    }
+    return std::all_of(params.lengths.begin(), params.lengths.end(), [](std::size_t length) {
+      return detail::fits_in_wi<Scalar>(static_cast<IdxGlobal>(length));
+    });
+  }
 
-        if (forward_kernels.has_value() && backward_kernels.has_value()) {
-          return {forward_kernels.value(),
-                  backward_kernels.value(),
-                  top_level,
-                  fft_size,
-                  params.lengths[dimension_num],
-                  SubgroupSize,
-                  algorithm};
+  /**
+   * Builds the kernel bundles computing all the dimensions of the transform in a single kernel for the first supported
+   * subgroup size.
+   *
+   * @tparam SubgroupSize first subgroup size
+   * @tparam OtherSGSizes other subgroup sizes
+   * @param required_sg_size subgroup size recorded in wisdom, 0 to use the first supported one
+   * @return `dimension_struct` for the whole transform or std::nullopt if the transform does not fit in local memory or
+   * the kernels could not be built for any of the subgroup sizes
+   */
+  template <Idx SubgroupSize, Idx... OtherSGSizes>
+  std::optional<dimension_struct> build_multi_dim(Idx required_sg_size = 0) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if ((required_sg_size == 0 || required_sg_size == SubgroupSize) &&
+        std::count(supported_sg_sizes.begin(), supported_sg_sizes.end(), SubgroupSize)) {
+      const std::size_t fft_size = params.get_flattened_length();
+      std::vector<Idx> lengths;
+      for (std::size_t length : params.lengths) {
+        lengths.push_back(static_cast<Idx>(length));
+      }
+      Idx num_sgs_per_wg;
+      std::size_t local_memory_usage = num_scalars_in_local_mem(detail::level::MULTI_DIM, fft_size, SubgroupSize,
+                                                                lengths, num_sgs_per_wg, layout::PACKED) *
+                                       sizeof(Scalar);
+      auto ids = detail::get_ids<detail::multi_dim_kernel, Scalar, Domain, SubgroupSize>();
+      if (local_memory_usage <= static_cast<std::size_t>(local_memory_size) && sycl::is_compatible(ids, dev)) {
+        auto build_direction = [&](direction compute_direction) {
+          const auto conjugate = compute_direction == direction::BACKWARD ? detail::complex_conjugate::APPLIED
+                                                                          : detail::complex_conjugate::NOT_APPLIED;
+          auto in_bundle = sycl::get_kernel_bundle<sycl::bundle_state::input>(queue.get_context(), ids);
+          set_spec_constants(detail::level::MULTI_DIM, in_bundle, static_cast<Idx>(fft_size), lengths,
+                             detail::elementwise_multiply::NOT_APPLIED, detail::elementwise_multiply::NOT_APPLIED,
+                             detail::apply_scale_factor::APPLIED, detail::level::MULTI_DIM, conjugate, conjugate,
+                             params.get_scale(compute_direction), 1, 1, static_cast<IdxGlobal>(fft_size),
+                             static_cast<IdxGlobal>(fft_size));
+          PORTFFT_LOG_TRACE("Building multi-dimensional kernel bundle with subgroup size", SubgroupSize);
+          std::vector<kernel_data_struct> kernels;
+          kernels.emplace_back(sycl::build(in_bundle), lengths, fft_size, SubgroupSize, num_sgs_per_wg,
+                               std::shared_ptr<Scalar>(), detail::level::MULTI_DIM);
+          return kernels;
+        };
+        try {
+          // the bundles of the two directions are independent, the backward one is built on another thread
+          auto backward_future = std::async(std::launch::async, build_direction, direction::BACKWARD);
+          std::vector<kernel_data_struct> forward_kernels = build_direction(direction::FORWARD);
+          std::vector<kernel_data_struct> backward_kernels = backward_future.get();
+          return dimension_struct(forward_kernels, backward_kernels, detail::level::MULTI_DIM, fft_size, fft_size,
+                                  SubgroupSize, detail::fft_algorithm::COOLEY_TUKEY);
+        } catch (std::exception& e) {
+          PORTFFT_LOG_WARNING("Build for subgroup size", SubgroupSize, "failed with message:\n", e.what());
         }
       }
     }
     if constexpr (sizeof...(OtherSGSizes) == 0) {
-      throw unsupported_configuration("None of the compiled subgroup sizes are supported by the device");
+      return std::nullopt;
     } else {
-      return build_w_spec_const<OtherSGSizes...>(dimension_num);
+      return build_multi_dim<OtherSGSizes...>(required_sg_size);
     }
   }
 
+  /**
+   * Allocates the scratch memory of the global implementation, unless it is not needed or already allocated. Copies of
+   * a committed descriptor do not share scratch memory, each allocates its own once it computes a global level FFT.
+   */
+  void allocate_scratch() {
+    if (scratch_ptr_1 || core->scratch_space_required == 0) {
+      return;
+    }
+    PORTFFT_LOG_TRACE("Allocating 2 scratch arrays of size", core->scratch_space_required, "scalars in global memory");
+    scratch_ptr_1 = detail::make_shared<Scalar>(core->scratch_space_required, queue);
+    scratch_ptr_2 = detail::make_shared<Scalar>(core->scratch_space_required, queue);
+  }
+
   /**
    * Function which calculates the amount of scratch space required, and also pre computes the necessary scans required.
    * @param num_global_level_dimensions number of global level dimensions in the committed size
    */
   void allocate_scratch_and_precompute_scan(Idx num_global_level_dimensions) {
     PORTFFT_LOG_FUNCTION_ENTRY();
+    std::vector<dimension_struct>& dimensions = core->dimensions;
     std::size_t n_kernels = params.lengths.size();
     if (num_global_level_dimensions == 1) {
       std::size_t global_dimension = 0;
@@ -652,16 +1137,21 @@ class committed_descriptor_impl {
       dimensions.at(global_dimension).num_factors = static_cast<Idx>(factors.size());
       std::size_t cache_space_left_for_batches = static_cast<std::size_t>(llc_size) - cache_required_for_twiddles;
       // TODO: In case of multi-dim (single dim global sized), this should be batches corresponding to that dim
-      dimensions.at(global_dimension).num_batches_in_l2 = static_cast<Idx>(std::min(
-          static_cast<std::size_t>(PORTFFT_MAX_CONCURRENT_KERNELS),
-          std::min(params.number_of_transforms,
-                   std::max(std::size_t(1), cache_space_left_for_batches /
-                                                (2 * dimensions.at(global_dimension).length * sizeof(Scalar))))));
-      scratch_space_required = 2 * dimensions.at(global_dimension).length *
-                               static_cast<std::size_t>(dimensions.at(global_dimension).num_batches_in_l2);
-      PORTFFT_LOG_TRACE("Allocating 2 scratch arrays of size", scratch_space_required, "scalars in global memory");
-      scratch_ptr_1 = detail::make_shared<Scalar>(scratch_space_required, queue);
-      scratch_ptr_2 = detail::make_shared<Scalar>(scratch_space_required, queue);
+      Idx& num_batches_in_l2 = dimensions.at(global_dimension).num_batches_in_l2;
+      if (num_batches_in_l2 > 0) {
+        // recorded in wisdom
+        num_batches_in_l2 = static_cast<Idx>(std::min(static_cast<std::size_t>(num_batches_in_l2),
+                                                      std::max(std::size_t(1), params.number_of_transforms)));
+      } else {
+        num_batches_in_l2 = static_cast<Idx>(std::min(
+            static_cast<std::size_t>(PORTFFT_MAX_CONCURRENT_KERNELS),
+            std::min(params.number_of_transforms,
+                     std::max(std::size_t(1), cache_space_left_for_batches /
+                                                  (2 * dimensions.at(global_dimension).length * sizeof(Scalar))))));
+      }
+      core->scratch_space_required = 2 * dimensions.at(global_dimension).length *
+                                     static_cast<std::size_t>(dimensions.at(global_dimension).num_batches_in_l2);
+      allocate_scratch();
       inclusive_scan.push_back(factors.at(0));
       for (std::size_t i = 1; i < factors.size(); i++) {
         inclusive_scan.push_back(inclusive_scan.at(i - 1) * factors.at(i));
@@ -671,30 +1161,40 @@ class committed_descriptor_impl {
                         "scan:", inclusive_scan);
       dimensions.at(global_dimension).factors_and_scan =
           detail::make_shared<IdxGlobal>(factors.size() + sub_batches.size() + inclusive_scan.size(), queue);
-      queue.copy(factors.data(), dimensions.at(global_dimension).factors_and_scan.get(), factors.size());
-      queue.copy(sub_batches.data(), dimensions.at(global_dimension).factors_and_scan.get() + factors.size(),
-                 sub_batches.size());
-      queue.copy(inclusive_scan.data(),
-                 dimensions.at(global_dimension).factors_and_scan.get() + factors.size() + sub_batches.size(),
-                 inclusive_scan.size());
-      queue.wait();
-      // build transpose kernels
+      // only wait for these copies, the queue may be computing with another committed descriptor
+      std::vector<sycl::event> copy_events;
+      copy_events.push_back(
+          queue.copy(factors.data(), dimensions.at(global_dimension).factors_and_scan.get(), factors.size()));
+      copy_events.push_back(queue.copy(sub_batches.data(),
+                                       dimensions.at(global_dimension).factors_and_scan.get() + factors.size(),
+                                       sub_batches.size()));
+      copy_events.push_back(
+          queue.copy(inclusive_scan.data(),
+                     dimensions.at(global_dimension).factors_and_scan.get() + factors.size() + sub_batches.size(),
+                     inclusive_scan.size()));
+      // build transpose kernels, each on its own thread while the copies are in flight
       std::size_t num_transposes_required = factors.size() - 1;
+      std::vector<std::future<sycl::kernel_bundle<sycl::bundle_state::executable>>> transpose_bundles;
+      for (std::size_t i = 0; i < num_transposes_required; i++) {
+        transpose_bundles.push_back(std::async(std::launch::async, [this, i, num_factors = factors.size()]() {
+          auto in_bundle = sycl::get_kernel_bundle<sycl::bundle_state::input>(
+              queue.get_context(), detail::get_transpose_kernel_ids<Scalar>());
+          PORTFFT_LOG_TRACE("Setting specialization constants for transpose kernel", i);
+          PORTFFT_LOG_TRACE("SpecConstComplexStorage:", params.complex_storage);
+          in_bundle.template set_specialization_constant<detail::SpecConstComplexStorage>(params.complex_storage);
+          PORTFFT_LOG_TRACE("GlobalSpecConstLevelNum:", i);
+          in_bundle.template set_specialization_constant<detail::GlobalSpecConstLevelNum>(static_cast<Idx>(i));
+          PORTFFT_LOG_TRACE("GlobalSpecConstNumFactors:", num_factors);
+          in_bundle.template set_specialization_constant<detail::GlobalSpecConstNumFactors>(
+              static_cast<Idx>(num_factors));
+          return sycl::build(in_bundle);
+        }));
+      }
+      sycl::event::wait(copy_events);
       for (std::size_t i = 0; i < num_transposes_required; i++) {
-        std::vector<sycl::kernel_id> ids;
-        auto in_bundle = sycl::get_kernel_bundle<sycl::bundle_state::input>(queue.get_context(),
-                                                                            detail::get_transpose_kernel_ids<Scalar>());
-        PORTFFT_LOG_TRACE("Setting specialization constants for transpose kernel", i);
-        PORTFFT_LOG_TRACE("SpecConstComplexStorage:", params.complex_storage);
-        in_bundle.template set_specialization_constant<detail::SpecConstComplexStorage>(params.complex_storage);
-        PORTFFT_LOG_TRACE("GlobalSpecConstLevelNum:", i);
-        in_bundle.template set_specialization_constant<detail::GlobalSpecConstLevelNum>(static_cast<Idx>(i));
-        PORTFFT_LOG_TRACE("GlobalSpecConstNumFactors:", factors.size());
-        in_bundle.template set_specialization_constant<detail::GlobalSpecConstNumFactors>(
-            static_cast<Idx>(factors.size()));
         dimensions.at(global_dimension)
             .transpose_kernels.emplace_back(
-                sycl::build(in_bundle),
+                transpose_bundles.at(i).get(),
                 std::vector<Idx>{static_cast<Idx>(factors.at(i)), static_cast<Idx>(sub_batches.at(i))}, 1, 1, 1,
                 std::shared_ptr<Scalar>(), detail::level::GLOBAL);
       }
@@ -709,9 +1209,8 @@ class committed_descriptor_impl {
       }
       // TODO: max_scratch_size should be max(global_size_1 * corresponding_batches_in_l2, global_size_1 *
       // corresponding_batches_in_l2), in the case of multi-dim global FFTs.
-      scratch_space_required = 2 * max_encountered_global_size * params.number_of_transforms;
-      scratch_ptr_1 = detail::make_shared<Scalar>(scratch_space_required, queue);
-      scratch_ptr_2 = detail::make_shared<Scalar>(scratch_space_required, queue);
+      core->scratch_space_required = 2 * max_encountered_global_size * params.number_of_transforms;
+      allocate_scratch();
       for (std::size_t i = 0; i < n_kernels; i++) {
         if (dimensions.at(i).level == detail::level::GLOBAL) {
           std::vector<IdxGlobal> factors;
@@ -730,25 +1229,34 @@ class committed_descriptor_impl {
           dimensions.at(i).num_factors = static_cast<Idx>(factors.size());
           dimensions.at(i).factors_and_scan =
               detail::make_shared<IdxGlobal>(factors.size() + sub_batches.size() + inclusive_scan.size(), queue);
-          queue.copy(factors.data(), dimensions.at(i).factors_and_scan.get(), factors.size());
-          queue.copy(sub_batches.data(), dimensions.at(i).factors_and_scan.get() + factors.size(), sub_batches.size());
-          queue.copy(inclusive_scan.data(),
-                     dimensions.at(i).factors_and_scan.get() + factors.size() + sub_batches.size(),
-                     inclusive_scan.size());
-          queue.wait();
-          // build transpose kernels
+          std::vector<sycl::event> copy_events;
+          copy_events.push_back(queue.copy(factors.data(), dimensions.at(i).factors_and_scan.get(), factors.size()));
+          copy_events.push_back(queue.copy(sub_batches.data(), dimensions.at(i).factors_and_scan.get() + factors.size(),
+                                           sub_batches.size()));
+          copy_events.push_back(
+              queue.copy(inclusive_scan.data(),
+                         dimensions.at(i).factors_and_scan.get() + factors.size() + sub_batches.size(),
+                         inclusive_scan.size()));
+          // build transpose kernels, each on its own thread while the copies are in flight
           std::size_t num_transposes_required = factors.size() - 1;
+          std::vector<std::future<sycl::kernel_bundle<sycl::bundle_state::executable>>> transpose_bundles;
+          for (std::size_t j = 0; j < num_transposes_required; j++) {
+            transpose_bundles.push_back(std::async(std::launch::async, [this, i, j, num_factors = factors.size()]() {
+              auto in_bundle = sycl::get_kernel_bundle<sycl::bundle_state::input>(
+                  queue.get_context(), detail::get_transpose_kernel_ids<Scalar>());
+              PORTFFT_LOG_TRACE("Setting specilization constants for transpose kernel", j);
+              PORTFFT_LOG_TRACE("GlobalSpecConstLevelNum:", i);
+              in_bundle.template set_specialization_constant<detail::GlobalSpecConstLevelNum>(static_cast<Idx>(i));
+              PORTFFT_LOG_TRACE("GlobalSpecConstNumFactors:", num_factors);
+              in_bundle.template set_specialization_constant<detail::GlobalSpecConstNumFactors>(
+                  static_cast<Idx>(num_factors));
+              return sycl::build(in_bundle);
+            }));
+          }
+          sycl::event::wait(copy_events);
           for (std::size_t j = 0; j < num_transposes_required; j++) {
-            auto in_bundle = sycl::get_kernel_bundle<sycl::bundle_state::input>(
-                queue.get_context(), detail::get_transpose_kernel_ids<Scalar>());
-            PORTFFT_LOG_TRACE("Setting specilization constants for transpose kernel", j);
-            PORTFFT_LOG_TRACE("GlobalSpecConstLevelNum:", i);
-            in_bundle.template set_specialization_constant<detail::GlobalSpecConstLevelNum>(static_cast<Idx>(i));
-            PORTFFT_LOG_TRACE("GlobalSpecConstNumFactors:", factors.size());
-            in_bundle.template set_specialization_constant<detail::GlobalSpecConstNumFactors>(
-                static_cast<Idx>(factors.size()));
             dimensions.at(i).transpose_kernels.emplace_back(
-                sycl::build(in_bundle),
+                transpose_bundles.at(j).get(),
                 std::vector<Idx>{static_cast<Idx>(factors.at(j)), static_cast<Idx>(sub_batches.at(j))}, 1, 1, 1,
                 std::shared_ptr<Scalar>(), detail::level::GLOBAL);
           }
@@ -762,8 +1270,10 @@ class committed_descriptor_impl {
    *
    * @param params descriptor this is created from
    * @param queue queue to use when enqueueing device work
+   * @param plan_wisdom wisdom whose decisions are applied if it has an entry for the device and the descriptor shape
    */
-  committed_descriptor_impl(const descriptor<Scalar, Domain>& params, sycl::queue& queue)
+  committed_descriptor_impl(const descriptor<Scalar, Domain>& params, sycl::queue& queue,
+                            const wisdom* plan_wisdom = nullptr)
       : params(params),
         queue(queue),
         dev(queue.get_device()),
@@ -772,34 +1282,68 @@ class committed_descriptor_impl {
         n_compute_units(static_cast<Idx>(dev.get_info<sycl::info::device::max_compute_units>())),
         supported_sg_sizes(dev.get_info<sycl::info::device::sub_group_sizes>()),
         local_memory_size(static_cast<Idx>(queue.get_device().get_info<sycl::info::device::local_mem_size>())),
+        n_local_banks(detail::get_local_banks(queue)),
         llc_size(static_cast<IdxGlobal>(queue.get_device().get_info<sycl::info::device::global_mem_cache_size>())) {
     PORTFFT_LOG_FUNCTION_ENTRY();
+    core = std::make_shared<plan_core_struct>();
+    std::vector<dimension_struct>& dimensions = core->dimensions;
     PORTFFT_LOG_TRACE("Device info:");
     PORTFFT_LOG_TRACE("n_compute_units:", n_compute_units);
     PORTFFT_LOG_TRACE("supported_sg_sizes:", supported_sg_sizes);
     PORTFFT_LOG_TRACE("local_memory_size:", local_memory_size);
+    PORTFFT_LOG_TRACE("n_local_banks:", n_local_banks);
     PORTFFT_LOG_TRACE("llc_size:", llc_size);
 
-    // compile the kernels and precalculate twiddles
-    std::size_t n_kernels = params.lengths.size();
+    const wisdom_entry* recorded = plan_wisdom ? plan_wisdom->find(make_wisdom_key()) : nullptr;
+    const bool recorded_multi_dim = recorded && recorded->dimensions.size() == 1 &&
+                                    recorded->dimensions[0].level == detail::level::MULTI_DIM;
+    if (recorded) {
+      PORTFFT_LOG_TRACE("Applying the plan recorded in wisdom");
+      if (!recorded_multi_dim && recorded->dimensions.size() != params.lengths.size()) {
+        throw invalid_configuration("Wisdom records ", recorded->dimensions.size(),
+                                    " dimensions for a descriptor with ", params.lengths.size());
+      }
+    }
+
+    // small multi-dimensional transforms are computed by a single kernel, without going through global memory between
+    // the dimensions
+    std::optional<dimension_struct> multi_dim;
+    if (recorded_multi_dim) {
+      if (fits_in_multi_dim()) {
+        multi_dim = build_multi_dim<PORTFFT_SUBGROUP_SIZES>(recorded->dimensions[0].subgroup_size);
+      }
+      if (!multi_dim.has_value()) {
+        throw invalid_configuration("The multi-dimensional kernel recorded in wisdom can not be used");
+      }
+    } else if (!recorded && fits_in_multi_dim()) {
+      multi_dim = build_multi_dim<PORTFFT_SUBGROUP_SIZES>();
+    }
+    if (multi_dim.has_value()) {
+      PORTFFT_LOG_TRACE("Using the multi-dimensional kernel for all the dimensions");
+      dimensions.emplace_back(std::move(multi_dim.value()));
+    }
+
+    // compile the kernels and precalculate twiddles. The dimensions are independent, each is prepared on its own
+    // thread, so the twiddles of one dimension are computed and uploaded while the kernels of another are being built.
+    std::size_t n_kernels = multi_dim.has_value() ? 0 : params.lengths.size();
+    std::vector<std::future<dimension_struct>> dimension_futures;
     for (std::size_t i = 0; i < n_kernels; i++) {
-      dimensions.emplace_back(build_w_spec_const<PORTFFT_SUBGROUP_SIZES>(i));
-      dimensions.back().forward_kernels.at(0).twiddles_forward = std::shared_ptr<Scalar>(
-          calculate_twiddles(dimensions.back().level, dimensions.at(i), dimensions.back().forward_kernels),
-          [queue](Scalar* ptr) {
-            if (ptr != nullptr) {
-              sycl::free(ptr, queue);
-            }
-          });
-      // TODO: refactor multi-dimensional fft's such that they can use a single pointer for twiddles.
-      dimensions.back().backward_kernels.at(0).twiddles_forward = std::shared_ptr<Scalar>(
-          calculate_twiddles(dimensions.back().level, dimensions.at(i), dimensions.back().backward_kernels),
-          [queue](Scalar* ptr) {
-            if (ptr != nullptr) {
-              PORTFFT_LOG_TRACE("Freeing the array for twiddle factors");
-              sycl::free(ptr, queue);
-            }
-          });
+      const wisdom_dimension* recorded_dimension = recorded ? &recorded->dimensions[i] : nullptr;
+      dimension_futures.push_back(std::async(std::launch::async, [this, i, recorded_dimension]() {
+        return build_dimension(i, recorded_dimension);
+      }));
+    }
+    for (auto& dimension_future : dimension_futures) {
+      dimensions.emplace_back(dimension_future.get());
+    }
+
+    core->committed_layouts = {detail::get_layout(params, direction::FORWARD),
+                               detail::get_layout(params, direction::BACKWARD)};
+    for (std::size_t i = 0; i < dimensions.size(); i++) {
+      precompute_launch_params(dimensions[i]);
+      if (recorded) {
+        apply_recorded_launch_params(dimensions[i], recorded->dimensions[i]);
+      }
     }
 
     Idx num_global_level_dimensions = static_cast<Idx>(std::count_if(
@@ -815,14 +1359,30 @@ class committed_descriptor_impl {
 
       allocate_scratch_and_precompute_scan(num_global_level_dimensions);
     }
+
+    if (!params.forward_window.empty()) {
+      const dimension_struct& dimension = dimensions.front();
+      const bool windowed_level =
+          dimension.level == detail::level::WORKITEM || dimension.level == detail::level::SUBGROUP;
+      if (!windowed_level || dimension.algorithm != detail::fft_algorithm::COOLEY_TUKEY) {
+        throw unsupported_configuration(
+            "A forward window is only supported for sizes computed by the workitem or subgroup implementations");
+      }
+      PORTFFT_LOG_TRACE("Copying the forward window to global memory");
+      core->forward_window = detail::make_shared<Scalar>(params.forward_window.size(), queue);
+      queue.copy(params.forward_window.data(), core->forward_window.get(), params.forward_window.size()).wait();
+    }
   }
 
   /**
-   * Utility function for copy constructor and copy assignment operator
+   * Utility function for copy constructor and copy assignment operator. The copy shares the plan core, its own scratch
+   * memory is only allocated once it is needed.
    * @param desc `committed_descriptor_impl` of which the copy is to be made
    */
   void create_copy(const committed_descriptor_impl<Scalar, Domain>& desc) {
     PORTFFT_LOG_FUNCTION_ENTRY();
+    // the scratch memory being replaced may still be in use
+    last_scratch_event.wait();
 #define PORTFFT_COPY(x) this->x = desc.x;
     PORTFFT_COPY(params)
     PORTFFT_COPY(queue)
@@ -831,25 +1391,15 @@ class committed_descriptor_impl {
     PORTFFT_COPY(n_compute_units)
     PORTFFT_COPY(supported_sg_sizes)
     PORTFFT_COPY(local_memory_size)
-    PORTFFT_COPY(dimensions)
-    PORTFFT_COPY(scratch_space_required)
+    PORTFFT_COPY(n_local_banks)
+    PORTFFT_COPY(core)
     PORTFFT_COPY(llc_size)
 #undef PORTFFT_COPY
-
-    bool is_scratch_required = false;
-    for (std::size_t i = 0; i < desc.dimensions.size(); i++) {
-      if (desc.dimensions.at(i).level == detail::level::GLOBAL) {
-        is_scratch_required = true;
-        break;
-      }
-    }
-    if (is_scratch_required) {
-      PORTFFT_LOG_TRACE("Allocating 2 scratch arrays of size", desc.scratch_space_required, "Scalars in global memory");
-      this->scratch_ptr_1 =
-          detail::make_shared<Scalar>(static_cast<std::size_t>(desc.scratch_space_required), this->queue);
-      this->scratch_ptr_2 =
-          detail::make_shared<Scalar>(static_cast<std::size_t>(desc.scratch_space_required), this->queue);
-    }
+    this->scratch_ptr_1.reset();
+    this->scratch_ptr_2.reset();
+    this->last_scratch_event = {};
+    // the buffers and the tuned chunk size of the streaming interface belong to the plan being replaced
+    this->stream.reset();
   }
 
  public:
@@ -866,6 +1416,37 @@ class committed_descriptor_impl {
     return *this;
   }
 
+  committed_descriptor_impl(committed_descriptor_impl&& desc) noexcept = default;
+
+  committed_descriptor_impl& operator=(committed_descriptor_impl&& desc) noexcept {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (this != &desc) {
+      // the scratch memory being replaced may still be in use
+      try {
+        last_scratch_event.wait();
+      } catch (...) {
+        // a failure to wait can not be reported from a noexcept move, the memory is freed without waiting
+      }
+#define PORTFFT_MOVE(x) this->x = std::move(desc.x);
+      PORTFFT_MOVE(params)
+      PORTFFT_MOVE(queue)
+      PORTFFT_MOVE(dev)
+      PORTFFT_MOVE(ctx)
+      PORTFFT_MOVE(n_compute_units)
+      PORTFFT_MOVE(supported_sg_sizes)
+      PORTFFT_MOVE(local_memory_size)
+      PORTFFT_MOVE(n_local_banks)
+      PORTFFT_MOVE(llc_size)
+      PORTFFT_MOVE(scratch_ptr_1)
+      PORTFFT_MOVE(scratch_ptr_2)
+      PORTFFT_MOVE(last_scratch_event)
+      PORTFFT_MOVE(stream)
+      PORTFFT_MOVE(core)
+#undef PORTFFT_MOVE
+    }
+    return *this;
+  }
+
   static_assert(std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>,
                 "Scalar must be either float or double!");
 
@@ -874,13 +1455,48 @@ class committed_descriptor_impl {
    */
   ~committed_descriptor_impl() {
     PORTFFT_LOG_FUNCTION_ENTRY();
-    queue.wait();
+    if (core) {
+      queue.wait();
+    }
   }
 
   // default construction is not appropriate
   committed_descriptor_impl() = delete;
 
  protected:
+  /**
+   * Get the queue the descriptor was committed for.
+   */
+  sycl::queue get_queue() const { return queue; }
+
+  /**
+   * Get the decisions made at commit, as an entry of wisdom.
+   */
+  wisdom_entry get_wisdom_entry() const {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    wisdom_entry entry = make_wisdom_key();
+    for (const dimension_struct& dimension_data : core->dimensions) {
+      wisdom_dimension recorded;
+      recorded.level = dimension_data.level;
+      recorded.fft_size = dimension_data.length;
+      recorded.subgroup_size = dimension_data.used_sg_size;
+      recorded.num_batches_in_l2 = dimension_data.level == detail::level::GLOBAL ? dimension_data.num_batches_in_l2 : 0;
+      for (const kernel_data_struct& kernel_data : dimension_data.forward_kernels) {
+        wisdom_kernel recorded_kernel;
+        recorded_kernel.level = kernel_data.level;
+        recorded_kernel.factors = kernel_data.factors;
+        if (dimension_data.level != detail::level::GLOBAL) {
+          for (std::size_t l = 0; l < kernel_data.launch_params.size(); l++) {
+            recorded_kernel.num_sgs_per_wg[l] = kernel_data.launch_params[l].num_sgs_per_wg;
+          }
+        }
+        recorded.kernels.push_back(recorded_kernel);
+      }
+      entry.dimensions.push_back(recorded);
+    }
+    return entry;
+  }
+
   /**
    * Dispatches to the implementation for the appropriate direction.
    *
@@ -904,6 +1520,39 @@ class committed_descriptor_impl {
                                  complex_storage used_storage, direction compute_direction,
                                  const std::vector<sycl::event>& dependencies = {}) {
     PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_direction(in, out, in_imag, out_imag, used_storage, compute_direction, dependencies,
+                              params.get_offset(compute_direction), params.get_offset(inv(compute_direction)),
+                              params.number_of_transforms);
+  }
+
+  /**
+   * Dispatches a range of the batch to the implementation for the appropriate direction. Used by the sharded descriptor
+   * to compute a part of the batch on each queue.
+   *
+   * @tparam TIn Type of the input buffer or USM pointer
+   * @tparam TOut Type of the output buffer or USM pointer
+   * @param in buffer or USM pointer to memory containing input data. Real part of input data if
+   * `descriptor.complex_storage` is split.
+   * @param out buffer or USM pointer to memory containing output data. Real part of input data if
+   * `descriptor.complex_storage` is split.
+   * @param in_imag buffer or USM pointer to memory containing imaginary part of the input data. Ignored if
+   * `descriptor.complex_storage` is interleaved.
+   * @param out_imag buffer or USM pointer to memory containing imaginary part of the output data. Ignored if
+   * `descriptor.complex_storage` is interleaved.
+   * @param used_storage how components of a complex value are stored - either split or interleaved
+   * @param compute_direction direction of compute, forward / backward
+   * @param dependencies events that must complete before the computation
+   * @param input_offset offset into input of the first transform of the range
+   * @param output_offset offset into output of the first transform of the range
+   * @param n_transforms number of transforms in the range
+   * @return sycl::event
+   */
+  template <typename TIn, typename TOut>
+  sycl::event dispatch_direction(const TIn& in, TOut& out, const TIn& in_imag, TOut& out_imag,
+                                 complex_storage used_storage, direction compute_direction,
+                                 const std::vector<sycl::event>& dependencies, std::size_t input_offset,
+                                 std::size_t output_offset, std::size_t n_transforms) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
 #ifndef PORTFFT_ENABLE_BUFFER_BUILDS
     if constexpr (!std::is_pointer_v<TIn> || !std::is_pointer_v<TOut>) {
       throw invalid_configuration("Buffer interface can not be called when buffer builds are disabled.");
@@ -919,12 +1568,260 @@ class committed_descriptor_impl {
           "To use interface with interleaved real and imaginary values, descriptor.complex_storage must be set to "
           "INTERLEAVED_COMPLEX.");
     }
-    if (compute_direction == direction::FORWARD) {
-      return dispatch_dimensions(in, out, in_imag, out_imag, dependencies, params.forward_offset,
-                                 params.backward_offset, compute_direction);
+    if (params.overlapping_forward_batches && compute_direction == direction::BACKWARD) {
+      throw invalid_configuration("Backward transforms can not write to the overlapping batches of the forward domain");
     }
-    return dispatch_dimensions(in, out, in_imag, out_imag, dependencies, params.backward_offset, params.forward_offset,
-                               compute_direction);
+    if (!params.outer_batch_counts.empty()) {
+      if (n_transforms != params.number_of_transforms) {
+        throw internal_error("Outer batch dimensions can only be computed for the whole batch");
+      }
+      return dispatch_outer_batches(in, out, in_imag, out_imag, compute_direction, dependencies);
+    }
+    return dispatch_dimensions(in, out, in_imag, out_imag, dependencies, input_offset, output_offset,
+                               compute_direction, n_transforms);
+  }
+
+  /**
+   * Computes the FFTs of a descriptor with outer batch dimensions. The workitem and subgroup implementations of a 1D
+   * transform index the innermost outer batch dimensions in their kernel, so a single launch computes all the
+   * transforms of a descriptor whose outer batches are evenly spaced, see `get_n_folded_outer_dims`. Any other outer
+   * batch dimension, or all of them for the other implementations, is looped over with one launch per outer batch.
+   *
+   * @tparam TIn Type of the input buffer or USM pointer
+   * @tparam TOut Type of the output buffer or USM pointer
+   * @param in buffer or USM pointer to memory containing input data. Real part of input data if
+   * `descriptor.complex_storage` is split.
+   * @param out buffer or USM pointer to memory containing output data. Real part of input data if
+   * `descriptor.complex_storage` is split.
+   * @param in_imag buffer or USM pointer to memory containing imaginary part of the input data. Ignored if
+   * `descriptor.complex_storage` is interleaved.
+   * @param out_imag buffer or USM pointer to memory containing imaginary part of the output data. Ignored if
+   * `descriptor.complex_storage` is interleaved.
+   * @param compute_direction direction of compute, forward / backward
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event
+   */
+  template <typename TIn, typename TOut>
+  sycl::event dispatch_outer_batches(const TIn& in, TOut& out, const TIn& in_imag, TOut& out_imag,
+                                     direction compute_direction, const std::vector<sycl::event>& dependencies) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const std::vector<std::size_t>& counts = params.outer_batch_counts;
+    const std::vector<std::size_t>& input_outer_distances = params.get_outer_distances(compute_direction);
+    const std::vector<std::size_t>& output_outer_distances = params.get_outer_distances(inv(compute_direction));
+    const dimension_struct& dimension = core->dimensions.front();
+    const std::size_t n_folded_dims = get_n_folded_outer_dims(dimension.level, dimension.algorithm, compute_direction);
+    // outer batch dimensions looped over by launching the kernels once per batch
+    const std::size_t n_launched_dims = counts.size() - n_folded_dims;
+    const auto launched_dims_end = counts.begin() + static_cast<std::ptrdiff_t>(n_launched_dims);
+    const std::size_t n_launches =
+        std::accumulate(counts.begin(), launched_dims_end, std::size_t(1), std::multiplies<std::size_t>());
+    const std::size_t n_transforms =
+        std::accumulate(launched_dims_end, counts.end(), params.number_of_transforms, std::multiplies<std::size_t>());
+    // the launches of a plan using scratch space share it, so they must not run concurrently
+    const bool serialize = core->scratch_space_required != 0;
+    PORTFFT_LOG_TRACE("Dispatching", n_launches, "launches of", n_transforms, "transforms each");
+
+    std::vector<sycl::event> events;
+    for (std::size_t launch = 0; launch < n_launches; launch++) {
+      std::size_t input_offset = params.get_offset(compute_direction);
+      std::size_t output_offset = params.get_offset(inv(compute_direction));
+      std::size_t remaining = launch;
+      for (std::size_t dim = n_launched_dims; dim-- > 0;) {
+        const std::size_t outer_idx = remaining % counts[dim];
+        remaining /= counts[dim];
+        input_offset += outer_idx * input_outer_distances[dim];
+        output_offset += outer_idx * output_outer_distances[dim];
+      }
+      const std::vector<sycl::event> launch_dependencies =
+          serialize && !events.empty() ? std::vector<sycl::event>{events.back()} : dependencies;
+      events.push_back(dispatch_dimensions(in, out, in_imag, out_imag, launch_dependencies, input_offset, output_offset,
+                                           compute_direction, n_transforms));
+    }
+    if (events.size() == 1) {
+      return events.front();
+    }
+    return queue.ext_oneapi_submit_barrier(events);
+  }
+
+  /**
+   * Computes the FFT of transforms each at its own base pointer, given by arrays of pointers in USM memory. The
+   * pointers are resolved by the workitem and subgroup kernels as they load and store each transform.
+   *
+   * @param ins USM pointer to an array with the input pointer of each transform
+   * @param outs USM pointer to an array with the output pointer of each transform
+   * @param compute_direction direction of compute, forward / backward
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event
+   */
+  sycl::event dispatch_pointer_array(const std::complex<Scalar>* const* ins, std::complex<Scalar>* const* outs,
+                                     direction compute_direction, const std::vector<sycl::event>& dependencies) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch_pointer_array(ins, outs, compute_direction, dependencies, params.number_of_transforms, nullptr);
+  }
+
+  /**
+   * Computes the FFT of transforms each at its own base pointer, given by arrays of pointers in USM memory, for a
+   * number of transforms that may only be known on the device.
+   *
+   * @param ins USM pointer to an array with the input pointer of each transform
+   * @param outs USM pointer to an array with the output pointer of each transform
+   * @param compute_direction direction of compute, forward / backward
+   * @param dependencies events that must complete before the computation
+   * @param n_transforms number of transforms, or an upper bound of it if `range` is set
+   * @param range USM pointer to the index of the first transform in the arrays and the number of transforms, read by
+   * the kernel, or null to compute the first `n_transforms` transforms
+   * @return sycl::event
+   */
+  sycl::event dispatch_pointer_array(const std::complex<Scalar>* const* ins, std::complex<Scalar>* const* outs,
+                                     direction compute_direction, const std::vector<sycl::event>& dependencies,
+                                     std::size_t n_transforms, const IdxGlobal* range) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (params.complex_storage != complex_storage::INTERLEAVED_COMPLEX) {
+      throw invalid_configuration(
+          "To use interface with interleaved real and imaginary values, descriptor.complex_storage must be set to "
+          "INTERLEAVED_COMPLEX.");
+    }
+    if (params.lengths.size() != 1 || (core->dimensions.front().level != detail::level::WORKITEM &&
+                                       core->dimensions.front().level != detail::level::SUBGROUP)) {
+      throw unsupported_configuration(
+          "Arrays of pointers are only supported by 1D plans committed to the workitem or subgroup implementation");
+    }
+    if (get_committed_layout(compute_direction) != detail::layout::PACKED ||
+        get_committed_layout(inv(compute_direction)) != detail::layout::PACKED || params.forward_offset != 0 ||
+        params.backward_offset != 0 || !params.outer_batch_counts.empty()) {
+      throw unsupported_configuration("Arrays of pointers are only supported with default strides and distances");
+    }
+    const batch_pointers_struct batch_pointers{reinterpret_cast<const Scalar* const*>(ins),
+                                               reinterpret_cast<Scalar* const*>(outs), range};
+    // the kernel takes the pointers of the transforms from the arrays instead
+    const Scalar* in = nullptr;
+    Scalar* out = nullptr;
+    return dispatch_kernel_1d(in, out, in, out, dependencies, n_transforms,
+                              get_committed_layout(compute_direction), 0, 0, core->dimensions.front(),
+                              compute_direction, batch_pointers);
+  }
+
+  /**
+   * Computes the FFT of data in host memory. The transforms are split into chunks and each chunk is copied to the
+   * device, computed and copied back through a `detail::stream_pipeline`, with the copies of a chunk overlapping the
+   * computation of its neighbours. Each of the `StreamRingSize` chunks in flight uses its own slot of device buffers.
+   * No host synchronization is done, the ordering is expressed by events only.
+   *
+   * @param host_in host pointer to memory containing input data
+   * @param host_out host pointer to memory containing output data, may be equal to `host_in`
+   * @param chunk_transforms number of transforms in each chunk, 0 to choose it with `tune_stream_chunk`
+   * @param compute_direction direction of compute, forward / backward
+   * @param dependencies events that must complete before the input is read
+   * @return event completing once all the output is in host memory
+   */
+  sycl::event dispatch_stream(const std::complex<Scalar>* host_in, std::complex<Scalar>* host_out,
+                              std::size_t chunk_transforms, direction compute_direction,
+                              const std::vector<sycl::event>& dependencies) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if constexpr (Domain == domain::REAL) {
+      throw unsupported_configuration("The streaming interface only supports complex domain");
+    }
+    if (params.complex_storage != complex_storage::INTERLEAVED_COMPLEX) {
+      throw invalid_configuration(
+          "To use interface with interleaved real and imaginary values, descriptor.complex_storage must be set to "
+          "INTERLEAVED_COMPLEX.");
+    }
+    if (detail::get_layout(params, compute_direction) != detail::layout::PACKED ||
+        detail::get_layout(params, inv(compute_direction)) != detail::layout::PACKED) {
+      throw unsupported_configuration("The streaming interface only supports default strides and distances");
+    }
+    if (!params.outer_batch_counts.empty()) {
+      throw unsupported_configuration("The streaming interface does not support outer batch dimensions");
+    }
+    const std::size_t n_transforms = params.number_of_transforms;
+    const std::size_t fft_size = params.get_flattened_length();
+    if (chunk_transforms == 0) {
+      chunk_transforms = tune_stream_chunk(compute_direction);
+    }
+    chunk_transforms = std::min(chunk_transforms, n_transforms);
+    const std::size_t n_chunks = detail::divide_ceil(n_transforms, chunk_transforms);
+    PORTFFT_LOG_TRACE("Streaming", n_transforms, "transforms in", n_chunks, "chunks of", chunk_transforms);
+    detail::stream_pipeline<std::complex<Scalar>>& slots = get_stream().pipeline;
+    slots.reserve(chunk_transforms * fft_size, false);
+    host_in += params.get_offset(compute_direction);
+    host_out += params.get_offset(inv(compute_direction));
+    auto chunk_size = [&](std::size_t chunk) {
+      return std::min(chunk_transforms, n_transforms - chunk * chunk_transforms) * fft_size;
+    };
+
+    std::vector<sycl::event> downloads = slots.submit(
+        n_chunks,
+        [&](std::size_t chunk, std::size_t slot, const std::vector<sycl::event>& upload_dependencies) {
+          return slots.get_upload_queue().copy(host_in + chunk * chunk_transforms * fft_size, slots.get_device_in(slot),
+                                               chunk_size(chunk), upload_dependencies);
+        },
+        [&](std::size_t chunk, std::size_t slot, const std::vector<sycl::event>& compute_dependencies) {
+          const std::complex<Scalar>* device_in = slots.get_device_in(slot);
+          std::complex<Scalar>* device_out = slots.get_device_out(slot);
+          return dispatch_dimensions(device_in, device_out, device_in, device_out, compute_dependencies, 0, 0,
+                                     compute_direction, chunk_size(chunk) / fft_size);
+        },
+        [&](std::size_t chunk, std::size_t slot, const std::vector<sycl::event>& download_dependencies) {
+          return slots.get_download_queue().copy(slots.get_device_out(slot),
+                                                 host_out + chunk * chunk_transforms * fft_size, chunk_size(chunk),
+                                                 download_dependencies);
+        },
+        dependencies);
+    return queue.ext_oneapi_submit_barrier(downloads);
+  }
+
+  /**
+   * Gets the state of the streaming interface, creating it if needed.
+   *
+   * @return the state of the streaming interface
+   */
+  stream_struct& get_stream() {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (!stream) {
+      stream = std::make_unique<stream_struct>(queue);
+    }
+    return *stream;
+  }
+
+  /**
+   * Chooses the number of transforms per chunk of the streaming interface with `detail::tune_chunk_transforms`. The
+   * result is cached.
+   *
+   * @param compute_direction direction of compute, forward / backward
+   * @return number of transforms per chunk
+   */
+  std::size_t tune_stream_chunk(direction compute_direction) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    stream_struct& st = get_stream();
+    std::size_t& tuned = st.tuned_chunk_transforms[compute_direction == direction::FORWARD ? 0 : 1];
+    if (tuned != 0) {
+      return tuned;
+    }
+    const std::size_t fft_size = params.get_flattened_length();
+    const std::size_t buffer_bytes = fft_size * sizeof(std::complex<Scalar>);
+    // enough chunks to fill the ring, and the buffers of the ring within a quarter of global memory
+    const std::size_t global_mem_size = static_cast<std::size_t>(dev.get_info<sycl::info::device::global_mem_size>());
+    const std::size_t max_alloc_size = static_cast<std::size_t>(dev.get_info<sycl::info::device::max_mem_alloc_size>());
+    std::size_t max_chunk = detail::divide_ceil(params.number_of_transforms, StreamRingSize);
+    max_chunk =
+        std::min({max_chunk, global_mem_size / (8 * StreamRingSize * buffer_bytes), max_alloc_size / buffer_bytes});
+
+    tuned = detail::tune_chunk_transforms(
+        max_chunk,
+        [&](std::size_t n_transforms) {
+          st.pipeline.reserve(n_transforms * fft_size, false);
+          // chunks of an earlier stream may still be using the slot
+          st.pipeline.wait();
+          // zeroed input avoids timing slow paths for denormals or NaNs
+          queue.fill(st.pipeline.get_device_in(0), std::complex<Scalar>(0), n_transforms * fft_size).wait();
+        },
+        [&](std::size_t n_transforms) {
+          const std::complex<Scalar>* device_in = st.pipeline.get_device_in(0);
+          std::complex<Scalar>* device_out = st.pipeline.get_device_out(0);
+          return dispatch_dimensions(device_in, device_out, device_in, device_out, {}, 0, 0, compute_direction,
+                                     n_transforms);
+        });
+    return tuned;
   }
 
   /**
@@ -944,21 +1841,23 @@ class committed_descriptor_impl {
    * @param input_offset offset into input allocation where the data for FFTs start
    * @param output_offset offset into output allocation where the data for FFTs start
    * @param compute_direction direction of compute, forward / backward
+   * @param n_transforms number of transforms to compute, at most `descriptor.number_of_transforms` or, when the kernel
+   * folds the innermost outer batch dimensions, that times the counts of the dimensions
    * @return sycl::event
    */
   template <typename TIn, typename TOut>
   sycl::event dispatch_dimensions(const TIn& in, TOut& out, const TIn& in_imag, TOut& out_imag,
                                   const std::vector<sycl::event>& dependencies, std::size_t input_offset,
-                                  std::size_t output_offset, direction compute_direction) {
+                                  std::size_t output_offset, direction compute_direction, std::size_t n_transforms) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     using TOutConst = std::conditional_t<std::is_pointer_v<TOut>, const std::remove_pointer_t<TOut>*, const TOut>;
     std::size_t n_dimensions = params.lengths.size();
     std::size_t total_size = params.get_flattened_length();
 
-    const auto input_layout = detail::get_layout(params, compute_direction);
-    const auto output_layout = detail::get_layout(params, inv(compute_direction));
+    const auto input_layout = get_committed_layout(compute_direction);
+    const auto output_layout = get_committed_layout(inv(compute_direction));
 
-    if (dimensions.back().algorithm == detail::fft_algorithm::BLUESTEIN) {
+    if (core->dimensions.back().algorithm == detail::fft_algorithm::BLUESTEIN) {
       if (input_layout == detail::layout::UNPACKED || output_layout == detail::layout::UNPACKED) {
         throw unsupported_configuration("Unsupported configuration for prime sized DFTs");
       }
@@ -973,6 +1872,12 @@ class committed_descriptor_impl {
       throw internal_error("Only default layout is supported for multi-dimensional transforms.");
     }
 
+    if (core->dimensions.front().level == detail::level::MULTI_DIM) {
+      PORTFFT_LOG_TRACE("Dispatching the kernel for all the dimensions");
+      return dispatch_kernel_1d(in, out, in_imag, out_imag, dependencies, n_transforms, input_layout,
+                                input_offset, output_offset, core->dimensions.front(), compute_direction);
+    }
+
     // product of sizes of all dimension inner relative to the one we are currently working on
     std::size_t inner_size = 1;
     // product of sizes of all dimension outer relative to the one we are currently working on
@@ -980,8 +1885,8 @@ class committed_descriptor_impl {
 
     PORTFFT_LOG_TRACE("Dispatching the kernel for the last dimension");
     sycl::event previous_event =
-        dispatch_kernel_1d(in, out, in_imag, out_imag, dependencies, params.number_of_transforms * outer_size,
-                           input_layout, input_offset, output_offset, dimensions.back(), compute_direction);
+        dispatch_kernel_1d(in, out, in_imag, out_imag, dependencies, n_transforms * outer_size,
+                           input_layout, input_offset, output_offset, core->dimensions.back(), compute_direction);
     if (n_dimensions == 1) {
       return previous_event;
     }
@@ -994,10 +1899,10 @@ class committed_descriptor_impl {
       // kernels.
       std::size_t stride_between_kernels = inner_size * params.lengths[i];
       PORTFFT_LOG_TRACE("Dispatching the kernels for the dimension", i);
-      for (std::size_t j = 0; j < params.number_of_transforms * outer_size; j++) {
+      for (std::size_t j = 0; j < n_transforms * outer_size; j++) {
         sycl::event e = dispatch_kernel_1d<TOutConst, TOut>(
             out, out, out_imag, out_imag, previous_events, inner_size, layout::BATCH_INTERLEAVED,
-            output_offset + j * stride_between_kernels, output_offset + j * stride_between_kernels, dimensions[i],
+            output_offset + j * stride_between_kernels, output_offset + j * stride_between_kernels, core->dimensions[i],
             compute_direction);
         next_events.push_back(e);
       }
@@ -1028,17 +1933,19 @@ class committed_descriptor_impl {
    * @param output_offset offset into output allocation where the data for FFTs start
    * @param dimension_data data for the dimension this call will work on
    * @param compute_direction direction of compute, forward / backward
+   * @param batch_pointers arrays with the base pointer of each transform, used instead of `in` and `out` when set
    * @return sycl::event
    */
   template <typename TIn, typename TOut>
   sycl::event dispatch_kernel_1d(const TIn& in, TOut& out, const TIn& in_imag, TOut& out_imag,
                                  const std::vector<sycl::event>& dependencies, std::size_t n_transforms,
                                  layout input_layout, std::size_t input_offset, std::size_t output_offset,
-                                 dimension_struct& dimension_data, direction compute_direction) {
+                                 dimension_struct& dimension_data, direction compute_direction,
+                                 const batch_pointers_struct& batch_pointers = {}) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     return dispatch_kernel_1d_helper<TIn, TOut, PORTFFT_SUBGROUP_SIZES>(
         in, out, in_imag, out_imag, dependencies, n_transforms, input_layout, input_offset, output_offset,
-        dimension_data, compute_direction);
+        dimension_data, compute_direction, batch_pointers);
   }
 
   /**
@@ -1063,23 +1970,23 @@ class committed_descriptor_impl {
    * @param output_offset offset into output allocation where the data for FFTs start
    * @param dimension_data data for the dimension this call will work on
    * @param compute_direction direction of compute, forward / backward
+   * @param batch_pointers arrays with the base pointer of each transform, used instead of `in` and `out` when set
    * @return sycl::event
    */
   template <typename TIn, typename TOut, Idx SubgroupSize, Idx... OtherSGSizes>
   sycl::event dispatch_kernel_1d_helper(const TIn& in, TOut& out, const TIn& in_imag, TOut& out_imag,
                                         const std::vector<sycl::event>& dependencies, std::size_t n_transforms,
                                         layout input_layout, std::size_t input_offset, std::size_t output_offset,
-                                        dimension_struct& dimension_data, direction compute_direction) {
+                                        dimension_struct& dimension_data, direction compute_direction,
+                                        const batch_pointers_struct& batch_pointers) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     if (SubgroupSize == dimension_data.used_sg_size) {
       const bool input_batch_interleaved = input_layout == layout::BATCH_INTERLEAVED;
 
-      for (kernel_data_struct kernel_data : dimension_data.forward_kernels) {
+      for (const kernel_data_struct& kernel_data : dimension_data.forward_kernels) {
         if (input_batch_interleaved) {
           std::size_t minimum_local_mem_required =
-              num_scalars_in_local_mem(kernel_data.level, kernel_data.length, SubgroupSize, kernel_data.factors,
-                                       kernel_data.num_sgs_per_wg, layout::BATCH_INTERLEAVED) *
-              sizeof(Scalar);
+              kernel_data.get_launch_params(layout::BATCH_INTERLEAVED).local_elements * sizeof(Scalar);
           PORTFFT_LOG_TRACE("Local mem required:", minimum_local_mem_required, "B. Available: ", local_memory_size,
                             "B.");
           if (static_cast<Idx>(minimum_local_mem_required) > local_memory_size) {
@@ -1091,14 +1998,15 @@ class committed_descriptor_impl {
       }
 
       return run_kernel<SubgroupSize>(in, out, in_imag, out_imag, dependencies, n_transforms, input_offset,
-                                      output_offset, dimension_data, compute_direction, input_layout);
+                                      output_offset, dimension_data, compute_direction, input_layout,
+                                      batch_pointers);
     }
     if constexpr (sizeof...(OtherSGSizes) == 0) {
       throw invalid_configuration("None of the compiled subgroup sizes are supported by the device!");
     } else {
-      return dispatch_kernel_1d_helper<TIn, TOut, OtherSGSizes...>(in, out, in_imag, out_imag, dependencies,
-                                                                   n_transforms, input_layout, input_offset,
-                                                                   output_offset, dimension_data, compute_direction);
+      return dispatch_kernel_1d_helper<TIn, TOut, OtherSGSizes...>(
+          in, out, in_imag, out_imag, dependencies, n_transforms, input_layout, input_offset, output_offset,
+          dimension_data, compute_direction, batch_pointers);
     }
   }
 
@@ -1117,7 +2025,8 @@ class committed_descriptor_impl {
       static sycl::event execute(committed_descriptor_impl& desc, const TIn& in, TOut& out, const TIn& in_imag,
                                  TOut& out_imag, const std::vector<sycl::event>& dependencies, std::size_t n_transforms,
                                  std::size_t forward_offset, std::size_t backward_offset,
-                                 dimension_struct& dimension_data, direction compute_direction, layout input_layout);
+                                 dimension_struct& dimension_data, direction compute_direction, layout input_layout,
+                                 const batch_pointers_struct& batch_pointers);
     };
   };
 
@@ -1142,13 +2051,16 @@ class committed_descriptor_impl {
    * @param dimension_data data for the dimension this call will work on
    * @param compute_direction direction of fft, forward / backward
    * @param input_layout the layout of the input data of the transforms
+   * @param batch_pointers arrays with the base pointer of each transform, used instead of `in` and `out` when set.
+   * Only supported by the workitem and subgroup implementations.
    * @return sycl::event
    */
   template <Idx SubgroupSize, typename TIn, typename TOut>
   sycl::event run_kernel(const TIn& in, TOut& out, const TIn& in_imag, TOut& out_imag,
                          const std::vector<sycl::event>& dependencies, std::size_t n_transforms,
                          std::size_t input_offset, std::size_t output_offset, dimension_struct& dimension_data,
-                         direction compute_direction, layout input_layout) {
+                         direction compute_direction, layout input_layout,
+                         const batch_pointers_struct& batch_pointers) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     // mixing const and non-const inputs leads to hard-to-debug linking errors, as both use the same kernel name, but
     // are called from different template instantiations.
@@ -1159,14 +2071,23 @@ class committed_descriptor_impl {
     // hard-to-debug linking errors
     static_assert(std::is_pointer_v<TIn> == std::is_pointer_v<TOut>,
                   "Both input and output to the kernels should be the same - either buffers or USM");
-    using TInReinterpret = decltype(detail::reinterpret<const Scalar>(in));
-    using TOutReinterpret = decltype(detail::reinterpret<Scalar>(out));
+    // real values in global memory can be of a narrower type than Scalar, in which case they are converted on the fly
+    using StorageScalar = detail::get_storage_scalar_t<TIn>;
+    using OutStorageScalar = detail::get_storage_scalar_t<TOut>;
+    static_assert(std::is_same_v<StorageScalar, OutStorageScalar> ||
+                      (detail::is_integer_storage_v<StorageScalar> && std::is_same_v<OutStorageScalar, Scalar>),
+                  "Kernel names assume the storage type of the output is determined by the storage type of the input");
+    static_assert(detail::is_storage_scalar_v<StorageScalar> && sizeof(StorageScalar) <= sizeof(Scalar),
+                  "Unsupported storage type");
+    using TInReinterpret = decltype(detail::reinterpret<const StorageScalar>(in));
+    using TOutReinterpret = decltype(detail::reinterpret<OutStorageScalar>(out));
     std::size_t vec_multiplier = params.complex_storage == complex_storage::INTERLEAVED_COMPLEX ? 2 : 1;
     return dispatch<run_kernel_struct<SubgroupSize, TInReinterpret, TOutReinterpret>>(
-        dimension_data.level, detail::reinterpret<const Scalar>(in), detail::reinterpret<Scalar>(out),
-        detail::reinterpret<const Scalar>(in_imag), detail::reinterpret<Scalar>(out_imag), dependencies,
-        static_cast<IdxGlobal>(n_transforms), static_cast<IdxGlobal>(vec_multiplier * input_offset),
-        static_cast<IdxGlobal>(vec_multiplier * output_offset), dimension_data, compute_direction, input_layout);
+        dimension_data.level, detail::reinterpret<const StorageScalar>(in), detail::reinterpret<OutStorageScalar>(out),
+        detail::reinterpret<const StorageScalar>(in_imag), detail::reinterpret<OutStorageScalar>(out_imag),
+        dependencies, static_cast<IdxGlobal>(n_transforms), static_cast<IdxGlobal>(vec_multiplier * input_offset),
+        static_cast<IdxGlobal>(vec_multiplier * output_offset), dimension_data, compute_direction, input_layout,
+        batch_pointers);
   }
 };
 
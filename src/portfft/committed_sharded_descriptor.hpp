@@ -0,0 +1,353 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMITTED_SHARDED_DESCRIPTOR_HPP
+#define PORTFFT_COMMITTED_SHARDED_DESCRIPTOR_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "common/exceptions.hpp"
+#include "common/helpers.hpp"
+#include "common/logging.hpp"
+#include "committed_descriptor_impl.hpp"
+#include "defines.hpp"
+#include "enums.hpp"
+#include "utils.hpp"
+
+namespace portfft {
+
+template <typename Scalar, domain Domain>
+struct descriptor;
+
+/*
+Sharding splits the batch of transforms between several queues, for example on the sub-devices of a partitioned CPU or
+on the tiles of a multi-tile GPU. A plan is committed for the device of each queue. At commit, each plan computes a
+probe batch and the batch is split between the queues proportionally to their measured throughput. Each queue computes
+a contiguous range of transforms, offset by the distance between transforms, and the event returned by a computation
+depends on all of them.
+*/
+
+/**
+ * A committed descriptor computing a batch of FFTs split between several queues.
+ *
+ * @tparam Scalar type of the scalar used for computations
+ * @tparam Domain domain of the FFT
+ */
+template <typename Scalar, domain Domain>
+class committed_sharded_descriptor {
+  friend struct descriptor<Scalar, Domain>;
+
+ public:
+  /**
+   * Alias for `Scalar`.
+   */
+  using scalar_type = Scalar;
+
+  /**
+   * std::complex with `Scalar` scalar.
+   */
+  using complex_type = std::complex<Scalar>;
+
+  /**
+   * Computes in-place forward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param inout USM pointer to memory containing input and output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_forward(complex_type* inout, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return compute_forward(inout, inout, dependencies);
+  }
+
+  /**
+   * Computes in-place forward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param inout_real USM pointer to memory containing real part of the input and output data
+   * @param inout_imag USM pointer to memory containing imaginary part of the input and output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_forward(scalar_type* inout_real, scalar_type* inout_imag,
+                              const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return compute_forward(inout_real, inout_imag, inout_real, inout_imag, dependencies);
+  }
+
+  /**
+   * Computes in-place backward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param inout USM pointer to memory containing input and output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_backward(complex_type* inout, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return compute_backward(inout, inout, dependencies);
+  }
+
+  /**
+   * Computes in-place backward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param inout_real USM pointer to memory containing real part of the input and output data
+   * @param inout_imag USM pointer to memory containing imaginary part of the input and output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_backward(scalar_type* inout_real, scalar_type* inout_imag,
+                               const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return compute_backward(inout_real, inout_imag, inout_real, inout_imag, dependencies);
+  }
+
+  /**
+   * Computes out-of-place forward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory containing output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_forward(const complex_type* in, complex_type* out,
+                              const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, direction::FORWARD, dependencies);
+  }
+
+  /**
+   * Computes out-of-place forward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param in_real USM pointer to memory containing real part of the input data
+   * @param in_imag USM pointer to memory containing imaginary part of the input data
+   * @param out_real USM pointer to memory containing real part of the output data
+   * @param out_imag USM pointer to memory containing imaginary part of the output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_forward(const scalar_type* in_real, const scalar_type* in_imag, scalar_type* out_real,
+                              scalar_type* out_imag, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch(in_real, out_real, in_imag, out_imag, complex_storage::SPLIT_COMPLEX, direction::FORWARD,
+                    dependencies);
+  }
+
+  /**
+   * Computes out-of-place backward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory containing output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_backward(const complex_type* in, complex_type* out,
+                               const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch(in, out, in, out, complex_storage::INTERLEAVED_COMPLEX, direction::BACKWARD, dependencies);
+  }
+
+  /**
+   * Computes out-of-place backward FFT, working on USM memory accessible from all the devices.
+   *
+   * @param in_real USM pointer to memory containing real part of the input data
+   * @param in_imag USM pointer to memory containing imaginary part of the input data
+   * @param out_real USM pointer to memory containing real part of the output data
+   * @param out_imag USM pointer to memory containing imaginary part of the output data
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event completing once all the queues have finished the computation
+   */
+  sycl::event compute_backward(const scalar_type* in_real, const scalar_type* in_imag, scalar_type* out_real,
+                               scalar_type* out_imag, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return dispatch(in_real, out_real, in_imag, out_imag, complex_storage::SPLIT_COMPLEX, direction::BACKWARD,
+                    dependencies);
+  }
+
+  /**
+   * Get the number of transforms computed by each of the queues, in the order the queues were given in.
+   */
+  std::vector<std::size_t> get_shard_sizes() const {
+    std::vector<std::size_t> sizes;
+    for (std::size_t i = 0; i + 1 < shard_starts.size(); i++) {
+      sizes.push_back(shard_starts[i + 1] - shard_starts[i]);
+    }
+    return sizes;
+  }
+
+ private:
+  using plan_t = detail::committed_descriptor_impl<Scalar, Domain>;
+
+  descriptor<Scalar, Domain> params;
+  std::vector<sycl::queue> queues;
+  // plan for each of the queues, committed for the whole batch so that the split can be chosen after timing them
+  std::vector<std::unique_ptr<plan_t>> plans;
+  // first transform computed by each of the queues, followed by the number of transforms
+  std::vector<std::size_t> shard_starts;
+
+  /**
+   * Constructor.
+   *
+   * @param params descriptor this is created from
+   * @param queues queues to split the batch between, all sharing a context
+   */
+  committed_sharded_descriptor(const descriptor<Scalar, Domain>& params, const std::vector<sycl::queue>& queues)
+      : params(params), queues(queues) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (queues.empty()) {
+      throw invalid_configuration("At least one queue is required");
+    }
+    for (const sycl::queue& q : queues) {
+      if (q.get_context() != queues.front().get_context()) {
+        throw invalid_configuration("All the queues must share a context, so that the data is accessible from all");
+      }
+    }
+    if (detail::get_layout(params, direction::FORWARD) == detail::layout::BATCH_INTERLEAVED ||
+        detail::get_layout(params, direction::BACKWARD) == detail::layout::BATCH_INTERLEAVED) {
+      throw unsupported_configuration("Sharding is not supported for batch interleaved layouts");
+    }
+    if (!params.outer_batch_counts.empty()) {
+      throw unsupported_configuration("Sharding is not supported with outer batch dimensions");
+    }
+    for (sycl::queue& q : this->queues) {
+      plans.push_back(std::unique_ptr<plan_t>(new plan_t(params, q)));
+    }
+    split_batch(measure_throughput());
+  }
+
+  /**
+   * Measures the number of transforms per second each of the plans computes. The plans are timed one after the other on
+   * a probe batch of the size of an even split.
+   *
+   * @return throughput of each of the plans
+   */
+  std::vector<double> measure_throughput() {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    std::vector<double> throughput(queues.size(), 1.0);
+    if (queues.size() == 1) {
+      return throughput;
+    }
+    descriptor<Scalar, Domain> probe_params = params;
+    probe_params.number_of_transforms = detail::divide_ceil(params.number_of_transforms, queues.size());
+    probe_params.forward_offset = 0;
+    probe_params.backward_offset = 0;
+    // large enough for both directions, with interleaved or split complex values
+    const std::size_t probe_size = 2 * std::max(probe_params.get_input_count(direction::FORWARD),
+                                                probe_params.get_input_count(direction::BACKWARD));
+    using clock = std::chrono::steady_clock;
+    for (std::size_t i = 0; i < queues.size(); i++) {
+      std::shared_ptr<Scalar> in_sptr = detail::make_shared<Scalar>(probe_size, queues[i]);
+      std::shared_ptr<Scalar> out_sptr = detail::make_shared<Scalar>(probe_size, queues[i]);
+      const Scalar* in = in_sptr.get();
+      Scalar* out = out_sptr.get();
+      // zeroed input avoids timing slow paths for denormals or NaNs
+      queues[i].fill(in_sptr.get(), Scalar(0), probe_size).wait();
+      // the first run is not timed, it may include one-time launch overheads
+      plans[i]
+          ->dispatch_direction(in, out, in, out, params.complex_storage, direction::FORWARD, {}, 0, 0,
+                               probe_params.number_of_transforms)
+          .wait();
+      auto start = clock::now();
+      plans[i]
+          ->dispatch_direction(in, out, in, out, params.complex_storage, direction::FORWARD, {}, 0, 0,
+                               probe_params.number_of_transforms)
+          .wait();
+      double time = std::chrono::duration<double>(clock::now() - start).count();
+      throughput[i] = static_cast<double>(probe_params.number_of_transforms) / std::max(time, 1e-9);
+      PORTFFT_LOG_TRACE("Queue", i, "computes", throughput[i], "transforms per second");
+    }
+    return throughput;
+  }
+
+  /**
+   * Splits the batch between the queues proportionally to their throughput. Transforms left over by rounding are given
+   * to the fastest queue.
+   *
+   * @param throughput throughput of each of the queues
+   */
+  void split_batch(const std::vector<double>& throughput) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const std::size_t n_transforms = params.number_of_transforms;
+    double total_throughput = 0;
+    for (double t : throughput) {
+      total_throughput += t;
+    }
+    std::vector<std::size_t> sizes(queues.size());
+    std::size_t assigned = 0;
+    for (std::size_t i = 0; i < queues.size(); i++) {
+      sizes[i] = static_cast<std::size_t>(static_cast<double>(n_transforms) * throughput[i] / total_throughput);
+      sizes[i] = std::min(sizes[i], n_transforms - assigned);
+      assigned += sizes[i];
+    }
+    auto fastest = std::max_element(throughput.begin(), throughput.end()) - throughput.begin();
+    sizes[static_cast<std::size_t>(fastest)] += n_transforms - assigned;
+    shard_starts.assign(1, 0);
+    for (std::size_t i = 0; i < queues.size(); i++) {
+      PORTFFT_LOG_TRACE("Queue", i, "computes", sizes[i], "transforms");
+      shard_starts.push_back(shard_starts.back() + sizes[i]);
+    }
+  }
+
+  /**
+   * Dispatches the computation of each shard to its queue.
+   *
+   * @tparam TIn type of the input USM pointer
+   * @tparam TOut type of the output USM pointer
+   * @param in USM pointer to memory containing input data. Real part of input data if `descriptor.complex_storage` is
+   * split.
+   * @param out USM pointer to memory containing output data. Real part of output data if `descriptor.complex_storage`
+   * is split.
+   * @param in_imag USM pointer to memory containing imaginary part of the input data. Ignored if
+   * `descriptor.complex_storage` is interleaved.
+   * @param out_imag USM pointer to memory containing imaginary part of the output data. Ignored if
+   * `descriptor.complex_storage` is interleaved.
+   * @param used_storage how components of a complex value are stored - either split or interleaved
+   * @param compute_direction direction of compute, forward / backward
+   * @param dependencies events that must complete before the computation
+   * @return event depending on the computation of all the shards
+   */
+  template <typename TIn, typename TOut>
+  sycl::event dispatch(TIn in, TOut out, TIn in_imag, TOut out_imag, complex_storage used_storage,
+                       direction compute_direction, const std::vector<sycl::event>& dependencies) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const std::size_t input_distance = params.get_distance(compute_direction);
+    const std::size_t output_distance = params.get_distance(inv(compute_direction));
+    std::vector<sycl::event> shard_events;
+    for (std::size_t i = 0; i < queues.size(); i++) {
+      const std::size_t n_transforms = shard_starts[i + 1] - shard_starts[i];
+      if (n_transforms == 0) {
+        continue;
+      }
+      shard_events.push_back(plans[i]->dispatch_direction(
+          in, out, in_imag, out_imag, used_storage, compute_direction, dependencies,
+          params.get_offset(compute_direction) + shard_starts[i] * input_distance,
+          params.get_offset(inv(compute_direction)) + shard_starts[i] * output_distance, n_transforms));
+    }
+    return queues.front().ext_oneapi_submit_barrier(shard_events);
+  }
+};
+
+}  // namespace portfft
+
+#endif  // PORTFFT_COMMITTED_SHARDED_DESCRIPTOR_HPP
@@ -0,0 +1,468 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMITTED_STREAMING_DESCRIPTOR_HPP
+#define PORTFFT_COMMITTED_STREAMING_DESCRIPTOR_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "common/exceptions.hpp"
+#include "common/helpers.hpp"
+#include "common/logging.hpp"
+#include "common/stream_pipeline.hpp"
+#include "common/twiddle_calc.hpp"
+#include "common/workitem.hpp"
+#include "committed_descriptor_impl.hpp"
+#include "defines.hpp"
+#include "enums.hpp"
+#include "utils.hpp"
+
+namespace portfft {
+
+template <typename Scalar, domain Domain>
+struct descriptor;
+
+/*
+Streaming computes FFTs of data in host memory that does not need to fit in device memory. The data is split into
+chunks that are copied to the device, transformed and copied back. The chunks go through a `detail::stream_pipeline`,
+the same one a committed descriptor streams host data through. Each chunk in flight uses its own slot of device memory,
+so that the copies of one chunk, submitted to separate upload and download queues, overlap with the computation of the
+others on the queue of the descriptor.
+
+Batches are split into chunks of whole transforms, as many as the timing of the plan chooses within the budget. A
+single transform that does not fit in the device memory budget is computed with the four-step algorithm. Its size N
+is split into N = N1 * N2 using the same factorization as the global implementation, and the input is seen as an
+N1 x N2 row-major matrix:
+ 1. DFTs of size N1 on slabs of columns, each multiplied by the twiddles exp(-2*pi*i * column * row / N). The result is
+    stored transposed, as an N2 x N1 matrix, in the output.
+ 2. DFTs of size N2 on slabs of columns of that matrix, writing the result to the same columns of the output.
+The host gathers the columns of a slab into contiguous pinned staging memory before the upload, so that the device
+only ever transforms packed data.
+*/
+
+/**
+ * A committed descriptor computing FFTs of data in host memory that may be larger than the device memory.
+ *
+ * @tparam Scalar type of the scalar used for computations
+ * @tparam Domain domain of the FFT
+ */
+template <typename Scalar, domain Domain>
+class committed_streaming_descriptor {
+  friend struct descriptor<Scalar, Domain>;
+
+ public:
+  /**
+   * Alias for `Scalar`.
+   */
+  using scalar_type = Scalar;
+
+  /**
+   * std::complex with `Scalar` scalar.
+   */
+  using complex_type = std::complex<Scalar>;
+
+  /**
+   * Computes in-place forward FFT of data in host memory. Returns once the results have been written.
+   *
+   * @param inout host pointer to memory containing input and output data
+   */
+  void compute_forward(complex_type* inout) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    compute(inout, inout, direction::FORWARD);
+  }
+
+  /**
+   * Computes out-of-place forward FFT of data in host memory. Returns once the results have been written.
+   *
+   * @param in host pointer to memory containing input data
+   * @param out host pointer to memory containing output data
+   */
+  void compute_forward(const complex_type* in, complex_type* out) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    compute(in, out, direction::FORWARD);
+  }
+
+  /**
+   * Computes in-place backward FFT of data in host memory. Returns once the results have been written.
+   *
+   * @param inout host pointer to memory containing input and output data
+   */
+  void compute_backward(complex_type* inout) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    compute(inout, inout, direction::BACKWARD);
+  }
+
+  /**
+   * Computes out-of-place backward FFT of data in host memory. Returns once the results have been written.
+   *
+   * @param in host pointer to memory containing input data
+   * @param out host pointer to memory containing output data
+   */
+  void compute_backward(const complex_type* in, complex_type* out) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    compute(in, out, direction::BACKWARD);
+  }
+
+  /**
+   * Get the number of transforms copied to the device and computed at once, 0 if each transform is split into slabs.
+   */
+  std::size_t get_transforms_per_chunk() const noexcept { return transforms_per_chunk; }
+
+  /**
+   * Get the number of chunks in flight, each with its own device memory.
+   */
+  std::size_t get_ring_size() const noexcept { return pipeline->get_ring_size(); }
+
+ private:
+  using plan_t = detail::committed_descriptor_impl<Scalar, Domain>;
+
+  descriptor<Scalar, Domain> params;
+  sycl::queue queue;
+
+  // whole transforms per chunk, 0 if a transform is split into slabs
+  std::size_t transforms_per_chunk = 0;
+  std::unique_ptr<plan_t> chunk_plan;
+
+  // four-step decomposition: fft size = n_rows * n_columns, DFTs of size n_rows are computed first, `columns_per_slab`
+  // at a time, then DFTs of size n_columns, `rows_per_slab` at a time
+  std::size_t n_rows = 0;
+  std::size_t n_columns = 0;
+  std::size_t columns_per_slab = 0;
+  std::size_t rows_per_slab = 0;
+  std::unique_ptr<plan_t> column_plan;
+  std::unique_ptr<plan_t> row_plan;
+
+  // slots of the chunks in flight, with pinned host memory for gathering and scattering the columns of slabs
+  std::unique_ptr<detail::stream_pipeline<complex_type>> pipeline;
+
+  /**
+   * Constructor.
+   *
+   * @param params descriptor this is created from
+   * @param queue queue to use when enqueueing device work
+   * @param device_memory_budget number of bytes of device memory the data and the plans may use, 0 for half of the
+   * global memory of the device
+   * @param ring_size number of chunks in flight, each with its own device memory
+   */
+  committed_streaming_descriptor(const descriptor<Scalar, Domain>& params, sycl::queue& queue,
+                                 std::size_t device_memory_budget, std::size_t ring_size)
+      : params(params),
+        queue(queue),
+        pipeline(std::make_unique<detail::stream_pipeline<complex_type>>(this->queue, ring_size)) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if constexpr (Domain == domain::REAL) {
+      throw unsupported_configuration("Streaming is only supported for complex transforms");
+    }
+    if (params.complex_storage != complex_storage::INTERLEAVED_COMPLEX) {
+      throw unsupported_configuration("Streaming is only supported for interleaved complex storage");
+    }
+    if (detail::get_layout(params, direction::FORWARD) != detail::layout::PACKED ||
+        detail::get_layout(params, direction::BACKWARD) != detail::layout::PACKED) {
+      throw unsupported_configuration("Streaming is only supported for default strides and distances");
+    }
+    if (!params.outer_batch_counts.empty()) {
+      throw unsupported_configuration("Streaming is not supported with outer batch dimensions");
+    }
+
+    sycl::device dev = queue.get_device();
+    if (device_memory_budget == 0) {
+      device_memory_budget = static_cast<std::size_t>(dev.get_info<sycl::info::device::global_mem_size>()) / 2;
+    }
+    const std::size_t max_alloc_elements =
+        static_cast<std::size_t>(dev.get_info<sycl::info::device::max_mem_alloc_size>()) / sizeof(complex_type);
+    const std::size_t budget_elements = device_memory_budget / sizeof(complex_type);
+    const std::size_t fft_size = params.get_flattened_length();
+    // The plans need twiddles and, for large sizes, scratch memory. Up to 4 times the size of a transform is
+    // reserved for them and the rest of the budget is used for the input and output of the chunks in flight.
+    const std::size_t plan_elements = 4 * fft_size;
+    const std::size_t chunk_elements =
+        budget_elements > plan_elements
+            ? std::min((budget_elements - plan_elements) / (2 * ring_size), max_alloc_elements)
+            : 0;
+    PORTFFT_LOG_TRACE("Streaming with a device memory budget of", device_memory_budget, "bytes");
+
+    if (chunk_elements >= fft_size) {
+      // keep a few chunks so that copies and computation overlap even if the whole batch fits
+      const std::size_t max_chunk =
+          std::min(chunk_elements / fft_size, detail::divide_ceil(params.number_of_transforms, std::size_t(4)));
+      descriptor<Scalar, Domain> chunk_desc = params;
+      chunk_desc.number_of_transforms = max_chunk;
+      chunk_desc.forward_offset = 0;
+      chunk_desc.backward_offset = 0;
+      chunk_desc.placement = placement::OUT_OF_PLACE;
+      chunk_plan = std::unique_ptr<plan_t>(new plan_t(chunk_desc, this->queue));
+      pipeline->reserve(max_chunk * fft_size, false);
+      const complex_type* tuning_in = pipeline->get_device_in(0);
+      complex_type* tuning_out = pipeline->get_device_out(0);
+      transforms_per_chunk = detail::tune_chunk_transforms(
+          max_chunk,
+          [&](std::size_t n_transforms) {
+            // zeroed input avoids timing slow paths for denormals or NaNs
+            this->queue.fill(pipeline->get_device_in(0), complex_type(0), n_transforms * fft_size).wait();
+          },
+          [&](std::size_t n_transforms) {
+            return chunk_plan->dispatch_direction(tuning_in, tuning_out, tuning_in, tuning_out,
+                                                  complex_storage::INTERLEAVED_COMPLEX, direction::FORWARD, {}, 0, 0,
+                                                  n_transforms);
+          });
+      PORTFFT_LOG_TRACE("Streaming chunks of", transforms_per_chunk, "transforms");
+      return;
+    }
+
+    if (params.lengths.size() != 1) {
+      throw unsupported_configuration("Multi-dimensional transforms larger than the device memory are not supported");
+    }
+    if (params.placement == placement::IN_PLACE) {
+      throw unsupported_configuration("Transforms larger than the device memory are only supported out-of-place");
+    }
+    n_rows = static_cast<std::size_t>(detail::factorize(static_cast<IdxGlobal>(fft_size)));
+    n_columns = fft_size / n_rows;
+    if (n_rows == 1) {
+      throw unsupported_configuration("Prime sized transforms larger than the device memory are not supported");
+    }
+    const std::size_t slab_plan_elements = 4 * (n_rows + n_columns);
+    const std::size_t slab_elements =
+        budget_elements > slab_plan_elements
+            ? std::min((budget_elements - slab_plan_elements) / (2 * ring_size), max_alloc_elements)
+            : 0;
+    columns_per_slab = std::min(n_columns, slab_elements / n_rows);
+    rows_per_slab = std::min(n_rows, slab_elements / n_columns);
+    if (columns_per_slab == 0 || rows_per_slab == 0) {
+      throw unsupported_configuration("Device memory budget of ", device_memory_budget,
+                                      " bytes is too small for FFT size ", fft_size);
+    }
+    PORTFFT_LOG_TRACE("Streaming slabs of a", n_rows, "x", n_columns, "decomposition with", columns_per_slab,
+                      "and", rows_per_slab, "columns");
+
+    descriptor<Scalar, Domain> column_desc({n_rows});
+    column_desc.number_of_transforms = columns_per_slab;
+    column_plan = std::unique_ptr<plan_t>(new plan_t(column_desc, this->queue));
+    descriptor<Scalar, Domain> row_desc({n_columns});
+    row_desc.number_of_transforms = rows_per_slab;
+    row_desc.forward_scale = params.forward_scale;
+    row_desc.backward_scale = params.backward_scale;
+    row_plan = std::unique_ptr<plan_t>(new plan_t(row_desc, this->queue));
+    pipeline->reserve(std::max(columns_per_slab * n_rows, rows_per_slab * n_columns), true);
+  }
+
+  /**
+   * Computes the FFTs.
+   *
+   * @param in host pointer to the input, before the offset is applied
+   * @param out host pointer to the output, before the offset is applied
+   * @param compute_direction direction of the FFTs
+   */
+  void compute(const complex_type* in, complex_type* out, direction compute_direction) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    in += params.get_offset(compute_direction);
+    out += params.get_offset(inv(compute_direction));
+    if (transforms_per_chunk != 0) {
+      compute_chunks(in, out, compute_direction);
+    } else {
+      for (std::size_t i = 0; i < params.number_of_transforms; i++) {
+        compute_slabs(in + i * n_rows * n_columns, out + i * n_rows * n_columns, compute_direction);
+      }
+    }
+  }
+
+  /**
+   * Computes the FFTs in chunks of whole transforms.
+   *
+   * @param in host pointer to the first input value
+   * @param out host pointer to the first output value
+   * @param compute_direction direction of the FFTs
+   */
+  void compute_chunks(const complex_type* in, complex_type* out, direction compute_direction) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const std::size_t fft_size = params.get_flattened_length();
+    const std::size_t n_chunks = detail::divide_ceil(params.number_of_transforms, transforms_per_chunk);
+    auto chunk_transforms = [&](std::size_t chunk) {
+      return std::min(transforms_per_chunk, params.number_of_transforms - chunk * transforms_per_chunk);
+    };
+    detail::stream_pipeline<complex_type>& slots = *pipeline;
+    PORTFFT_LOG_TRACE("Streaming", n_chunks, "chunks");
+    std::vector<sycl::event> downloads = slots.submit(
+        n_chunks,
+        [&](std::size_t chunk, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          return slots.get_upload_queue().copy(in + chunk * transforms_per_chunk * fft_size, slots.get_device_in(slot),
+                                               chunk_transforms(chunk) * fft_size, dependencies);
+        },
+        [&](std::size_t chunk, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          const complex_type* chunk_in = slots.get_device_in(slot);
+          complex_type* chunk_out = slots.get_device_out(slot);
+          return chunk_plan->dispatch_direction(chunk_in, chunk_out, chunk_in, chunk_out,
+                                                complex_storage::INTERLEAVED_COMPLEX, compute_direction, dependencies,
+                                                0, 0, chunk_transforms(chunk));
+        },
+        [&](std::size_t chunk, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          return slots.get_download_queue().copy(slots.get_device_out(slot),
+                                                 out + chunk * transforms_per_chunk * fft_size,
+                                                 chunk_transforms(chunk) * fft_size, dependencies);
+        },
+        {});
+    sycl::event::wait(downloads);
+  }
+
+  /**
+   * Computes a single FFT with the four-step algorithm.
+   *
+   * @param in host pointer to the input of the transform
+   * @param out host pointer to the output of the transform
+   * @param compute_direction direction of the FFT
+   */
+  void compute_slabs(const complex_type* in, complex_type* out, direction compute_direction) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    detail::stream_pipeline<complex_type>& slots = *pipeline;
+    // step 1: DFTs along the columns of the n_rows x n_columns input, storing the transposed result in the output
+    slots.run_staged(
+        detail::divide_ceil(n_columns, columns_per_slab),
+        [&](std::size_t slab, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          std::size_t first_column = slab * columns_per_slab;
+          std::size_t slab_columns = std::min(columns_per_slab, n_columns - first_column);
+          gather_columns(in, n_rows, n_columns, first_column, slab_columns, slots.get_staging_in(slot));
+          return slots.get_upload_queue().copy(slots.get_staging_in(slot), slots.get_device_in(slot),
+                                               slab_columns * n_rows, dependencies);
+        },
+        [&](std::size_t slab, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          const complex_type* slab_in = slots.get_device_in(slot);
+          complex_type* slab_out = slots.get_device_out(slot);
+          sycl::event fft_event = column_plan->dispatch_direction(
+              slab_in, slab_out, slab_in, slab_out, complex_storage::INTERLEAVED_COMPLEX, compute_direction,
+              dependencies);
+          return apply_twiddles(slab_out, slab * columns_per_slab, compute_direction, fft_event);
+        },
+        [&](std::size_t slab, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          std::size_t first_column = slab * columns_per_slab;
+          std::size_t slab_columns = std::min(columns_per_slab, n_columns - first_column);
+          return slots.get_download_queue().copy(slots.get_device_out(slot), out + first_column * n_rows,
+                                                 slab_columns * n_rows, dependencies);
+        },
+        [](std::size_t, std::size_t) {});
+
+    // step 2: DFTs along the columns of the n_columns x n_rows intermediate result, in place
+    slots.run_staged(
+        detail::divide_ceil(n_rows, rows_per_slab),
+        [&](std::size_t slab, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          std::size_t first_column = slab * rows_per_slab;
+          std::size_t slab_columns = std::min(rows_per_slab, n_rows - first_column);
+          gather_columns(out, n_columns, n_rows, first_column, slab_columns, slots.get_staging_in(slot));
+          return slots.get_upload_queue().copy(slots.get_staging_in(slot), slots.get_device_in(slot),
+                                               slab_columns * n_columns, dependencies);
+        },
+        [&](std::size_t, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          const complex_type* slab_in = slots.get_device_in(slot);
+          complex_type* slab_out = slots.get_device_out(slot);
+          return row_plan->dispatch_direction(slab_in, slab_out, slab_in, slab_out,
+                                              complex_storage::INTERLEAVED_COMPLEX, compute_direction, dependencies);
+        },
+        [&](std::size_t slab, std::size_t slot, const std::vector<sycl::event>& dependencies) {
+          std::size_t slab_columns = std::min(rows_per_slab, n_rows - slab * rows_per_slab);
+          return slots.get_download_queue().copy(slots.get_device_out(slot), slots.get_staging_out(slot),
+                                                 slab_columns * n_columns, dependencies);
+        },
+        [&](std::size_t slab, std::size_t slot) {
+          std::size_t first_column = slab * rows_per_slab;
+          std::size_t slab_columns = std::min(rows_per_slab, n_rows - first_column);
+          scatter_columns(slots.get_staging_out(slot), out, n_columns, n_rows, first_column, slab_columns);
+        });
+  }
+
+  /**
+   * Copies columns of a row-major matrix to contiguous memory, one column after the other.
+   *
+   * @param matrix the matrix
+   * @param height number of rows of the matrix
+   * @param width number of columns of the matrix
+   * @param first_column first column to copy
+   * @param n_columns number of columns to copy
+   * @param dst destination of `height * n_columns` values
+   */
+  static void gather_columns(const complex_type* matrix, std::size_t height, std::size_t width,
+                             std::size_t first_column, std::size_t n_columns, complex_type* dst) {
+    for (std::size_t row = 0; row < height; row++) {
+      const complex_type* src = matrix + row * width + first_column;
+      for (std::size_t column = 0; column < n_columns; column++) {
+        dst[column * height + row] = src[column];
+      }
+    }
+  }
+
+  /**
+   * Copies contiguous columns, one after the other, to columns of a row-major matrix.
+   *
+   * @param src source of `height * n_columns` values
+   * @param matrix the matrix
+   * @param height number of rows of the matrix
+   * @param width number of columns of the matrix
+   * @param first_column first column to write
+   * @param n_columns number of columns to write
+   */
+  static void scatter_columns(const complex_type* src, complex_type* matrix, std::size_t height, std::size_t width,
+                              std::size_t first_column, std::size_t n_columns) {
+    for (std::size_t row = 0; row < height; row++) {
+      complex_type* dst = matrix + row * width + first_column;
+      for (std::size_t column = 0; column < n_columns; column++) {
+        dst[column] = src[column * height + row];
+      }
+    }
+  }
+
+  /**
+   * Multiplies the DFTs of a slab of columns by the twiddles of the four-step algorithm.
+   *
+   * @param data device pointer to the DFTs of the columns, one after the other
+   * @param first_column index of the first column of the slab
+   * @param compute_direction direction of the FFT
+   * @param dependency event of the DFTs
+   * @return event of the multiplication
+   */
+  sycl::event apply_twiddles(complex_type* data, std::size_t first_column, direction compute_direction,
+                             sycl::event dependency) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const IdxGlobal fft_size = static_cast<IdxGlobal>(n_rows * n_columns);
+    const IdxGlobal height = static_cast<IdxGlobal>(n_rows);
+    const IdxGlobal first = static_cast<IdxGlobal>(first_column);
+    const bool conjugate = compute_direction == direction::BACKWARD;
+    Scalar* scalars = reinterpret_cast<Scalar*>(data);
+    return queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependency);
+      cgh.parallel_for(sycl::range<2>(columns_per_slab, n_rows), [=](sycl::item<2> it) {
+        IdxGlobal column = static_cast<IdxGlobal>(it.get_id(0));
+        IdxGlobal row = static_cast<IdxGlobal>(it.get_id(1));
+        std::complex<Scalar> twiddle =
+            detail::calculate_twiddle_reduced<Scalar>(((first + column) * row) % fft_size, fft_size);
+        Scalar twiddle_imag = conjugate ? -twiddle.imag() : twiddle.imag();
+        IdxGlobal idx = 2 * (column * height + row);
+        Scalar re = scalars[idx];
+        Scalar im = scalars[idx + 1];
+        detail::multiply_complex(re, im, twiddle.real(), twiddle_imag, scalars[idx], scalars[idx + 1]);
+      });
+    });
+  }
+};
+
+}  // namespace portfft
+
+#endif  // PORTFFT_COMMITTED_STREAMING_DESCRIPTOR_HPP
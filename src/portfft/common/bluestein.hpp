@@ -38,19 +38,23 @@ namespace detail {
  */
 template <typename T>
 void populate_fft_chirp_signal(T* ptr, std::size_t committed_size, std::size_t dimension_size) {
-  using complex_t = std::complex<T>;
+  using complex_t = std::complex<double>;
   std::vector<complex_t> chirp_signal(dimension_size, 0);
   std::vector<complex_t> chirp_fft(dimension_size, 0);
   for (std::size_t i = 0; i < committed_size; i++) {
-    double theta = M_PI * static_cast<double>(i * i) / static_cast<double>(committed_size);
-    chirp_signal[i] = complex_t(static_cast<T>(std::cos(theta)), static_cast<T>(std::sin(theta)));
+    // exp(i*pi*i^2/committed_size) is periodic in i^2 with period 2 * committed_size
+    double theta = M_PI * static_cast<double>((i * i) % (2 * committed_size)) / static_cast<double>(committed_size);
+    chirp_signal[i] = complex_t(std::cos(theta), std::sin(theta));
   }
   std::size_t num_zeros = dimension_size - 2 * committed_size + 1;
   for (std::size_t i = 1; i < committed_size; i++) {
     chirp_signal[committed_size + num_zeros + i - 1] = chirp_signal[committed_size - i];
   }
-  host_cooley_tukey(chirp_signal.data(), chirp_fft.data(), dimension_size);
-  std::memcpy(ptr, reinterpret_cast<T*>(chirp_fft.data()), 2 * dimension_size * sizeof(T));
+  host_fft(chirp_signal.data(), chirp_fft.data(), dimension_size);
+  for (std::size_t i = 0; i < dimension_size; i++) {
+    ptr[2 * i] = static_cast<T>(chirp_fft[i].real());
+    ptr[2 * i + 1] = static_cast<T>(chirp_fft[i].imag());
+  }
 }
 
 /**
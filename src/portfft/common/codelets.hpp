@@ -0,0 +1,3746 @@
+/***************************************************************************
+ *
+ *  Generated by scripts/generate_codelets.py. Do not edit!
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMON_CODELETS_HPP
+#define PORTFFT_COMMON_CODELETS_HPP
+
+#include "portfft/defines.hpp"
+
+namespace portfft::detail {
+
+/*
+Straight-line forward DFTs of small sizes. Prime sizes use the symmetric algorithm computing output pairs k and N-k
+together from the sums and differences of input pairs, which needs about a quarter of the multiplications of a naive
+DFT. Composite sizes are split with Cooley-Tukey at generation time, with trivial twiddles (multiples of pi/4)
+simplified away.
+
+All codelets load every input before storing any output, so they can work in or out of place.
+*/
+
+/**
+ * Calculates DFT of size 2 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_2(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = t0 + t2;
+  const T t5 = t1 + t3;
+  const T t6 = t0 - t2;
+  const T t7 = t1 - t3;
+  out[0 * stride_out + 0] = t4;
+  out[0 * stride_out + 1] = t5;
+  out[2 * stride_out + 0] = t6;
+  out[2 * stride_out + 1] = t7;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 3 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_3(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.4999999999999998);
+  constexpr T k1 = static_cast<T>(0.8660254037844387);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = t2 + t4;
+  const T t7 = t3 + t5;
+  const T t8 = t2 - t4;
+  const T t9 = t3 - t5;
+  const T t10 = t0 + t6;
+  const T t11 = t1 + t7;
+  const T t12 = t0 - k0 * t6;
+  const T t13 = t1 - k0 * t7;
+  const T t14 = k1 * t8;
+  const T t15 = k1 * t9;
+  const T t16 = t12 + t15;
+  const T t17 = t13 - t14;
+  const T t18 = t12 - t15;
+  const T t19 = t13 + t14;
+  out[0 * stride_out + 0] = t10;
+  out[0 * stride_out + 1] = t11;
+  out[2 * stride_out + 0] = t16;
+  out[2 * stride_out + 1] = t17;
+  out[4 * stride_out + 0] = t18;
+  out[4 * stride_out + 1] = t19;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 4 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_4(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = t0 + t4;
+  const T t9 = t1 + t5;
+  const T t10 = t0 - t4;
+  const T t11 = t1 - t5;
+  const T t12 = t2 + t6;
+  const T t13 = t3 + t7;
+  const T t14 = t2 - t6;
+  const T t15 = t3 - t7;
+  const T t16 = t15;
+  const T t17 = -t14;
+  const T t18 = t8 + t12;
+  const T t19 = t9 + t13;
+  const T t20 = t8 - t12;
+  const T t21 = t9 - t13;
+  const T t22 = t10 + t16;
+  const T t23 = t11 + t17;
+  const T t24 = t10 - t16;
+  const T t25 = t11 - t17;
+  out[0 * stride_out + 0] = t18;
+  out[0 * stride_out + 1] = t19;
+  out[2 * stride_out + 0] = t22;
+  out[2 * stride_out + 1] = t23;
+  out[4 * stride_out + 0] = t20;
+  out[4 * stride_out + 1] = t21;
+  out[6 * stride_out + 0] = t24;
+  out[6 * stride_out + 1] = t25;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 5 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_5(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.30901699437494745);
+  constexpr T k1 = static_cast<T>(0.9510565162951535);
+  constexpr T k2 = static_cast<T>(0.8090169943749473);
+  constexpr T k3 = static_cast<T>(0.5877852522924732);
+  constexpr T k4 = static_cast<T>(0.30901699437494723);
+  constexpr T k5 = static_cast<T>(0.9510565162951536);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = t2 + t8;
+  const T t11 = t3 + t9;
+  const T t12 = t2 - t8;
+  const T t13 = t3 - t9;
+  const T t14 = t4 + t6;
+  const T t15 = t5 + t7;
+  const T t16 = t4 - t6;
+  const T t17 = t5 - t7;
+  const T t18 = t0 + t10 + t14;
+  const T t19 = t1 + t11 + t15;
+  const T t20 = t0 + k0 * t10 - k2 * t14;
+  const T t21 = t1 + k0 * t11 - k2 * t15;
+  const T t22 = k1 * t12 + k3 * t16;
+  const T t23 = k1 * t13 + k3 * t17;
+  const T t24 = t20 + t23;
+  const T t25 = t21 - t22;
+  const T t26 = t20 - t23;
+  const T t27 = t21 + t22;
+  const T t28 = t0 - k2 * t10 + k4 * t14;
+  const T t29 = t1 - k2 * t11 + k4 * t15;
+  const T t30 = k3 * t12 - k5 * t16;
+  const T t31 = k3 * t13 - k5 * t17;
+  const T t32 = t28 + t31;
+  const T t33 = t29 - t30;
+  const T t34 = t28 - t31;
+  const T t35 = t29 + t30;
+  out[0 * stride_out + 0] = t18;
+  out[0 * stride_out + 1] = t19;
+  out[2 * stride_out + 0] = t24;
+  out[2 * stride_out + 1] = t25;
+  out[4 * stride_out + 0] = t32;
+  out[4 * stride_out + 1] = t33;
+  out[6 * stride_out + 0] = t34;
+  out[6 * stride_out + 1] = t35;
+  out[8 * stride_out + 0] = t26;
+  out[8 * stride_out + 1] = t27;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 6 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_6(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.5000000000000001);
+  constexpr T k1 = static_cast<T>(0.8660254037844386);
+  constexpr T k2 = static_cast<T>(0.4999999999999998);
+  constexpr T k3 = static_cast<T>(0.8660254037844387);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = t0 + t6;
+  const T t13 = t1 + t7;
+  const T t14 = t0 - t6;
+  const T t15 = t1 - t7;
+  const T t16 = t2 + t8;
+  const T t17 = t3 + t9;
+  const T t18 = t2 - t8;
+  const T t19 = t3 - t9;
+  const T t20 = k0 * t18 + k1 * t19;
+  const T t21 = k0 * t19 - k1 * t18;
+  const T t22 = t4 + t10;
+  const T t23 = t5 + t11;
+  const T t24 = t4 - t10;
+  const T t25 = t5 - t11;
+  const T t26 = -k2 * t24 + k3 * t25;
+  const T t27 = -k2 * t25 - k3 * t24;
+  const T t28 = t16 + t22;
+  const T t29 = t17 + t23;
+  const T t30 = t16 - t22;
+  const T t31 = t17 - t23;
+  const T t32 = t12 + t28;
+  const T t33 = t13 + t29;
+  const T t34 = t12 - k2 * t28;
+  const T t35 = t13 - k2 * t29;
+  const T t36 = k3 * t30;
+  const T t37 = k3 * t31;
+  const T t38 = t34 + t37;
+  const T t39 = t35 - t36;
+  const T t40 = t34 - t37;
+  const T t41 = t35 + t36;
+  const T t42 = t20 + t26;
+  const T t43 = t21 + t27;
+  const T t44 = t20 - t26;
+  const T t45 = t21 - t27;
+  const T t46 = t14 + t42;
+  const T t47 = t15 + t43;
+  const T t48 = t14 - k2 * t42;
+  const T t49 = t15 - k2 * t43;
+  const T t50 = k3 * t44;
+  const T t51 = k3 * t45;
+  const T t52 = t48 + t51;
+  const T t53 = t49 - t50;
+  const T t54 = t48 - t51;
+  const T t55 = t49 + t50;
+  out[0 * stride_out + 0] = t32;
+  out[0 * stride_out + 1] = t33;
+  out[2 * stride_out + 0] = t46;
+  out[2 * stride_out + 1] = t47;
+  out[4 * stride_out + 0] = t38;
+  out[4 * stride_out + 1] = t39;
+  out[6 * stride_out + 0] = t52;
+  out[6 * stride_out + 1] = t53;
+  out[8 * stride_out + 0] = t40;
+  out[8 * stride_out + 1] = t41;
+  out[10 * stride_out + 0] = t54;
+  out[10 * stride_out + 1] = t55;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 7 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_7(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.6234898018587336);
+  constexpr T k1 = static_cast<T>(0.7818314824680298);
+  constexpr T k2 = static_cast<T>(0.22252093395631434);
+  constexpr T k3 = static_cast<T>(0.9749279121818236);
+  constexpr T k4 = static_cast<T>(0.900968867902419);
+  constexpr T k5 = static_cast<T>(0.43388373911755823);
+  constexpr T k6 = static_cast<T>(0.9009688679024191);
+  constexpr T k7 = static_cast<T>(0.433883739117558);
+  constexpr T k8 = static_cast<T>(0.6234898018587334);
+  constexpr T k9 = static_cast<T>(0.7818314824680299);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = t2 + t12;
+  const T t15 = t3 + t13;
+  const T t16 = t2 - t12;
+  const T t17 = t3 - t13;
+  const T t18 = t4 + t10;
+  const T t19 = t5 + t11;
+  const T t20 = t4 - t10;
+  const T t21 = t5 - t11;
+  const T t22 = t6 + t8;
+  const T t23 = t7 + t9;
+  const T t24 = t6 - t8;
+  const T t25 = t7 - t9;
+  const T t26 = t0 + t14 + t18 + t22;
+  const T t27 = t1 + t15 + t19 + t23;
+  const T t28 = t0 + k0 * t14 - k2 * t18 - k4 * t22;
+  const T t29 = t1 + k0 * t15 - k2 * t19 - k4 * t23;
+  const T t30 = k1 * t16 + k3 * t20 + k5 * t24;
+  const T t31 = k1 * t17 + k3 * t21 + k5 * t25;
+  const T t32 = t28 + t31;
+  const T t33 = t29 - t30;
+  const T t34 = t28 - t31;
+  const T t35 = t29 + t30;
+  const T t36 = t0 - k2 * t14 - k6 * t18 + k8 * t22;
+  const T t37 = t1 - k2 * t15 - k6 * t19 + k8 * t23;
+  const T t38 = k3 * t16 - k7 * t20 - k9 * t24;
+  const T t39 = k3 * t17 - k7 * t21 - k9 * t25;
+  const T t40 = t36 + t39;
+  const T t41 = t37 - t38;
+  const T t42 = t36 - t39;
+  const T t43 = t37 + t38;
+  const T t44 = t0 - k4 * t14 + k8 * t18 - k2 * t22;
+  const T t45 = t1 - k4 * t15 + k8 * t19 - k2 * t23;
+  const T t46 = k5 * t16 - k9 * t20 + k3 * t24;
+  const T t47 = k5 * t17 - k9 * t21 + k3 * t25;
+  const T t48 = t44 + t47;
+  const T t49 = t45 - t46;
+  const T t50 = t44 - t47;
+  const T t51 = t45 + t46;
+  out[0 * stride_out + 0] = t26;
+  out[0 * stride_out + 1] = t27;
+  out[2 * stride_out + 0] = t32;
+  out[2 * stride_out + 1] = t33;
+  out[4 * stride_out + 0] = t40;
+  out[4 * stride_out + 1] = t41;
+  out[6 * stride_out + 0] = t48;
+  out[6 * stride_out + 1] = t49;
+  out[8 * stride_out + 0] = t50;
+  out[8 * stride_out + 1] = t51;
+  out[10 * stride_out + 0] = t42;
+  out[10 * stride_out + 1] = t43;
+  out[12 * stride_out + 0] = t34;
+  out[12 * stride_out + 1] = t35;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 8 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_8(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.7071067811865476);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = t0 + t8;
+  const T t17 = t1 + t9;
+  const T t18 = t0 - t8;
+  const T t19 = t1 - t9;
+  const T t20 = t2 + t10;
+  const T t21 = t3 + t11;
+  const T t22 = t2 - t10;
+  const T t23 = t3 - t11;
+  const T t24 = t22 + t23;
+  const T t25 = t23 - t22;
+  const T t26 = k0 * t24;
+  const T t27 = k0 * t25;
+  const T t28 = t4 + t12;
+  const T t29 = t5 + t13;
+  const T t30 = t4 - t12;
+  const T t31 = t5 - t13;
+  const T t32 = t31;
+  const T t33 = -t30;
+  const T t34 = t6 + t14;
+  const T t35 = t7 + t15;
+  const T t36 = t6 - t14;
+  const T t37 = t7 - t15;
+  const T t38 = -t36 + t37;
+  const T t39 = -t37 - t36;
+  const T t40 = k0 * t38;
+  const T t41 = k0 * t39;
+  const T t42 = t16 + t28;
+  const T t43 = t17 + t29;
+  const T t44 = t16 - t28;
+  const T t45 = t17 - t29;
+  const T t46 = t20 + t34;
+  const T t47 = t21 + t35;
+  const T t48 = t20 - t34;
+  const T t49 = t21 - t35;
+  const T t50 = t49;
+  const T t51 = -t48;
+  const T t52 = t42 + t46;
+  const T t53 = t43 + t47;
+  const T t54 = t42 - t46;
+  const T t55 = t43 - t47;
+  const T t56 = t44 + t50;
+  const T t57 = t45 + t51;
+  const T t58 = t44 - t50;
+  const T t59 = t45 - t51;
+  const T t60 = t18 + t32;
+  const T t61 = t19 + t33;
+  const T t62 = t18 - t32;
+  const T t63 = t19 - t33;
+  const T t64 = t26 + t40;
+  const T t65 = t27 + t41;
+  const T t66 = t26 - t40;
+  const T t67 = t27 - t41;
+  const T t68 = t67;
+  const T t69 = -t66;
+  const T t70 = t60 + t64;
+  const T t71 = t61 + t65;
+  const T t72 = t60 - t64;
+  const T t73 = t61 - t65;
+  const T t74 = t62 + t68;
+  const T t75 = t63 + t69;
+  const T t76 = t62 - t68;
+  const T t77 = t63 - t69;
+  out[0 * stride_out + 0] = t52;
+  out[0 * stride_out + 1] = t53;
+  out[2 * stride_out + 0] = t70;
+  out[2 * stride_out + 1] = t71;
+  out[4 * stride_out + 0] = t56;
+  out[4 * stride_out + 1] = t57;
+  out[6 * stride_out + 0] = t74;
+  out[6 * stride_out + 1] = t75;
+  out[8 * stride_out + 0] = t54;
+  out[8 * stride_out + 1] = t55;
+  out[10 * stride_out + 0] = t72;
+  out[10 * stride_out + 1] = t73;
+  out[12 * stride_out + 0] = t58;
+  out[12 * stride_out + 1] = t59;
+  out[14 * stride_out + 0] = t76;
+  out[14 * stride_out + 1] = t77;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 9 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_9(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.4999999999999998);
+  constexpr T k1 = static_cast<T>(0.8660254037844387);
+  constexpr T k2 = static_cast<T>(0.766044443118978);
+  constexpr T k3 = static_cast<T>(0.6427876096865393);
+  constexpr T k4 = static_cast<T>(0.17364817766693041);
+  constexpr T k5 = static_cast<T>(0.984807753012208);
+  constexpr T k6 = static_cast<T>(0.9396926207859083);
+  constexpr T k7 = static_cast<T>(0.3420201433256689);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = t6 + t12;
+  const T t19 = t7 + t13;
+  const T t20 = t6 - t12;
+  const T t21 = t7 - t13;
+  const T t22 = t0 + t18;
+  const T t23 = t1 + t19;
+  const T t24 = t0 - k0 * t18;
+  const T t25 = t1 - k0 * t19;
+  const T t26 = k1 * t20;
+  const T t27 = k1 * t21;
+  const T t28 = t24 + t27;
+  const T t29 = t25 - t26;
+  const T t30 = t24 - t27;
+  const T t31 = t25 + t26;
+  const T t32 = t8 + t14;
+  const T t33 = t9 + t15;
+  const T t34 = t8 - t14;
+  const T t35 = t9 - t15;
+  const T t36 = t2 + t32;
+  const T t37 = t3 + t33;
+  const T t38 = t2 - k0 * t32;
+  const T t39 = t3 - k0 * t33;
+  const T t40 = k1 * t34;
+  const T t41 = k1 * t35;
+  const T t42 = t38 + t41;
+  const T t43 = t39 - t40;
+  const T t44 = t38 - t41;
+  const T t45 = t39 + t40;
+  const T t46 = k2 * t42 + k3 * t43;
+  const T t47 = k2 * t43 - k3 * t42;
+  const T t48 = k4 * t44 + k5 * t45;
+  const T t49 = k4 * t45 - k5 * t44;
+  const T t50 = t10 + t16;
+  const T t51 = t11 + t17;
+  const T t52 = t10 - t16;
+  const T t53 = t11 - t17;
+  const T t54 = t4 + t50;
+  const T t55 = t5 + t51;
+  const T t56 = t4 - k0 * t50;
+  const T t57 = t5 - k0 * t51;
+  const T t58 = k1 * t52;
+  const T t59 = k1 * t53;
+  const T t60 = t56 + t59;
+  const T t61 = t57 - t58;
+  const T t62 = t56 - t59;
+  const T t63 = t57 + t58;
+  const T t64 = k4 * t60 + k5 * t61;
+  const T t65 = k4 * t61 - k5 * t60;
+  const T t66 = -k6 * t62 + k7 * t63;
+  const T t67 = -k6 * t63 - k7 * t62;
+  const T t68 = t36 + t54;
+  const T t69 = t37 + t55;
+  const T t70 = t36 - t54;
+  const T t71 = t37 - t55;
+  const T t72 = t22 + t68;
+  const T t73 = t23 + t69;
+  const T t74 = t22 - k0 * t68;
+  const T t75 = t23 - k0 * t69;
+  const T t76 = k1 * t70;
+  const T t77 = k1 * t71;
+  const T t78 = t74 + t77;
+  const T t79 = t75 - t76;
+  const T t80 = t74 - t77;
+  const T t81 = t75 + t76;
+  const T t82 = t46 + t64;
+  const T t83 = t47 + t65;
+  const T t84 = t46 - t64;
+  const T t85 = t47 - t65;
+  const T t86 = t28 + t82;
+  const T t87 = t29 + t83;
+  const T t88 = t28 - k0 * t82;
+  const T t89 = t29 - k0 * t83;
+  const T t90 = k1 * t84;
+  const T t91 = k1 * t85;
+  const T t92 = t88 + t91;
+  const T t93 = t89 - t90;
+  const T t94 = t88 - t91;
+  const T t95 = t89 + t90;
+  const T t96 = t48 + t66;
+  const T t97 = t49 + t67;
+  const T t98 = t48 - t66;
+  const T t99 = t49 - t67;
+  const T t100 = t30 + t96;
+  const T t101 = t31 + t97;
+  const T t102 = t30 - k0 * t96;
+  const T t103 = t31 - k0 * t97;
+  const T t104 = k1 * t98;
+  const T t105 = k1 * t99;
+  const T t106 = t102 + t105;
+  const T t107 = t103 - t104;
+  const T t108 = t102 - t105;
+  const T t109 = t103 + t104;
+  out[0 * stride_out + 0] = t72;
+  out[0 * stride_out + 1] = t73;
+  out[2 * stride_out + 0] = t86;
+  out[2 * stride_out + 1] = t87;
+  out[4 * stride_out + 0] = t100;
+  out[4 * stride_out + 1] = t101;
+  out[6 * stride_out + 0] = t78;
+  out[6 * stride_out + 1] = t79;
+  out[8 * stride_out + 0] = t92;
+  out[8 * stride_out + 1] = t93;
+  out[10 * stride_out + 0] = t106;
+  out[10 * stride_out + 1] = t107;
+  out[12 * stride_out + 0] = t80;
+  out[12 * stride_out + 1] = t81;
+  out[14 * stride_out + 0] = t94;
+  out[14 * stride_out + 1] = t95;
+  out[16 * stride_out + 0] = t108;
+  out[16 * stride_out + 1] = t109;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 10 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_10(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.8090169943749475);
+  constexpr T k1 = static_cast<T>(0.5877852522924731);
+  constexpr T k2 = static_cast<T>(0.30901699437494745);
+  constexpr T k3 = static_cast<T>(0.9510565162951535);
+  constexpr T k4 = static_cast<T>(0.30901699437494734);
+  constexpr T k5 = static_cast<T>(0.9510565162951536);
+  constexpr T k6 = static_cast<T>(0.8090169943749473);
+  constexpr T k7 = static_cast<T>(0.5877852522924732);
+  constexpr T k8 = static_cast<T>(0.30901699437494723);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = t0 + t10;
+  const T t21 = t1 + t11;
+  const T t22 = t0 - t10;
+  const T t23 = t1 - t11;
+  const T t24 = t2 + t12;
+  const T t25 = t3 + t13;
+  const T t26 = t2 - t12;
+  const T t27 = t3 - t13;
+  const T t28 = k0 * t26 + k1 * t27;
+  const T t29 = k0 * t27 - k1 * t26;
+  const T t30 = t4 + t14;
+  const T t31 = t5 + t15;
+  const T t32 = t4 - t14;
+  const T t33 = t5 - t15;
+  const T t34 = k2 * t32 + k3 * t33;
+  const T t35 = k2 * t33 - k3 * t32;
+  const T t36 = t6 + t16;
+  const T t37 = t7 + t17;
+  const T t38 = t6 - t16;
+  const T t39 = t7 - t17;
+  const T t40 = -k4 * t38 + k5 * t39;
+  const T t41 = -k4 * t39 - k5 * t38;
+  const T t42 = t8 + t18;
+  const T t43 = t9 + t19;
+  const T t44 = t8 - t18;
+  const T t45 = t9 - t19;
+  const T t46 = -k6 * t44 + k7 * t45;
+  const T t47 = -k6 * t45 - k7 * t44;
+  const T t48 = t24 + t42;
+  const T t49 = t25 + t43;
+  const T t50 = t24 - t42;
+  const T t51 = t25 - t43;
+  const T t52 = t30 + t36;
+  const T t53 = t31 + t37;
+  const T t54 = t30 - t36;
+  const T t55 = t31 - t37;
+  const T t56 = t20 + t48 + t52;
+  const T t57 = t21 + t49 + t53;
+  const T t58 = t20 + k2 * t48 - k6 * t52;
+  const T t59 = t21 + k2 * t49 - k6 * t53;
+  const T t60 = k3 * t50 + k7 * t54;
+  const T t61 = k3 * t51 + k7 * t55;
+  const T t62 = t58 + t61;
+  const T t63 = t59 - t60;
+  const T t64 = t58 - t61;
+  const T t65 = t59 + t60;
+  const T t66 = t20 - k6 * t48 + k8 * t52;
+  const T t67 = t21 - k6 * t49 + k8 * t53;
+  const T t68 = k7 * t50 - k5 * t54;
+  const T t69 = k7 * t51 - k5 * t55;
+  const T t70 = t66 + t69;
+  const T t71 = t67 - t68;
+  const T t72 = t66 - t69;
+  const T t73 = t67 + t68;
+  const T t74 = t28 + t46;
+  const T t75 = t29 + t47;
+  const T t76 = t28 - t46;
+  const T t77 = t29 - t47;
+  const T t78 = t34 + t40;
+  const T t79 = t35 + t41;
+  const T t80 = t34 - t40;
+  const T t81 = t35 - t41;
+  const T t82 = t22 + t74 + t78;
+  const T t83 = t23 + t75 + t79;
+  const T t84 = t22 + k2 * t74 - k6 * t78;
+  const T t85 = t23 + k2 * t75 - k6 * t79;
+  const T t86 = k3 * t76 + k7 * t80;
+  const T t87 = k3 * t77 + k7 * t81;
+  const T t88 = t84 + t87;
+  const T t89 = t85 - t86;
+  const T t90 = t84 - t87;
+  const T t91 = t85 + t86;
+  const T t92 = t22 - k6 * t74 + k8 * t78;
+  const T t93 = t23 - k6 * t75 + k8 * t79;
+  const T t94 = k7 * t76 - k5 * t80;
+  const T t95 = k7 * t77 - k5 * t81;
+  const T t96 = t92 + t95;
+  const T t97 = t93 - t94;
+  const T t98 = t92 - t95;
+  const T t99 = t93 + t94;
+  out[0 * stride_out + 0] = t56;
+  out[0 * stride_out + 1] = t57;
+  out[2 * stride_out + 0] = t82;
+  out[2 * stride_out + 1] = t83;
+  out[4 * stride_out + 0] = t62;
+  out[4 * stride_out + 1] = t63;
+  out[6 * stride_out + 0] = t88;
+  out[6 * stride_out + 1] = t89;
+  out[8 * stride_out + 0] = t70;
+  out[8 * stride_out + 1] = t71;
+  out[10 * stride_out + 0] = t96;
+  out[10 * stride_out + 1] = t97;
+  out[12 * stride_out + 0] = t72;
+  out[12 * stride_out + 1] = t73;
+  out[14 * stride_out + 0] = t98;
+  out[14 * stride_out + 1] = t99;
+  out[16 * stride_out + 0] = t64;
+  out[16 * stride_out + 1] = t65;
+  out[18 * stride_out + 0] = t90;
+  out[18 * stride_out + 1] = t91;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 11 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_11(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.8412535328311812);
+  constexpr T k1 = static_cast<T>(0.5406408174555976);
+  constexpr T k2 = static_cast<T>(0.41541501300188644);
+  constexpr T k3 = static_cast<T>(0.9096319953545183);
+  constexpr T k4 = static_cast<T>(0.142314838273285);
+  constexpr T k5 = static_cast<T>(0.9898214418809328);
+  constexpr T k6 = static_cast<T>(0.654860733945285);
+  constexpr T k7 = static_cast<T>(0.7557495743542583);
+  constexpr T k8 = static_cast<T>(0.9594929736144974);
+  constexpr T k9 = static_cast<T>(0.28173255684142967);
+  constexpr T k10 = static_cast<T>(0.9594929736144975);
+  constexpr T k11 = static_cast<T>(0.2817325568414294);
+  constexpr T k12 = static_cast<T>(0.14231483827328523);
+  constexpr T k13 = static_cast<T>(0.9898214418809327);
+  constexpr T k14 = static_cast<T>(0.5406408174555974);
+  constexpr T k15 = static_cast<T>(0.41541501300188605);
+  constexpr T k16 = static_cast<T>(0.9096319953545186);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = t2 + t20;
+  const T t23 = t3 + t21;
+  const T t24 = t2 - t20;
+  const T t25 = t3 - t21;
+  const T t26 = t4 + t18;
+  const T t27 = t5 + t19;
+  const T t28 = t4 - t18;
+  const T t29 = t5 - t19;
+  const T t30 = t6 + t16;
+  const T t31 = t7 + t17;
+  const T t32 = t6 - t16;
+  const T t33 = t7 - t17;
+  const T t34 = t8 + t14;
+  const T t35 = t9 + t15;
+  const T t36 = t8 - t14;
+  const T t37 = t9 - t15;
+  const T t38 = t10 + t12;
+  const T t39 = t11 + t13;
+  const T t40 = t10 - t12;
+  const T t41 = t11 - t13;
+  const T t42 = t0 + t22 + t26 + t30 + t34 + t38;
+  const T t43 = t1 + t23 + t27 + t31 + t35 + t39;
+  const T t44 = t0 + k0 * t22 + k2 * t26 - k4 * t30 - k6 * t34 - k8 * t38;
+  const T t45 = t1 + k0 * t23 + k2 * t27 - k4 * t31 - k6 * t35 - k8 * t39;
+  const T t46 = k1 * t24 + k3 * t28 + k5 * t32 + k7 * t36 + k9 * t40;
+  const T t47 = k1 * t25 + k3 * t29 + k5 * t33 + k7 * t37 + k9 * t41;
+  const T t48 = t44 + t47;
+  const T t49 = t45 - t46;
+  const T t50 = t44 - t47;
+  const T t51 = t45 + t46;
+  const T t52 = t0 + k2 * t22 - k6 * t26 - k10 * t30 - k12 * t34 + k0 * t38;
+  const T t53 = t1 + k2 * t23 - k6 * t27 - k10 * t31 - k12 * t35 + k0 * t39;
+  const T t54 = k3 * t24 + k7 * t28 - k11 * t32 - k13 * t36 - k14 * t40;
+  const T t55 = k3 * t25 + k7 * t29 - k11 * t33 - k13 * t37 - k14 * t41;
+  const T t56 = t52 + t55;
+  const T t57 = t53 - t54;
+  const T t58 = t52 - t55;
+  const T t59 = t53 + t54;
+  const T t60 = t0 - k4 * t22 - k10 * t26 + k15 * t30 + k0 * t34 - k6 * t38;
+  const T t61 = t1 - k4 * t23 - k10 * t27 + k15 * t31 + k0 * t35 - k6 * t39;
+  const T t62 = k5 * t24 - k11 * t28 - k16 * t32 + k1 * t36 + k7 * t40;
+  const T t63 = k5 * t25 - k11 * t29 - k16 * t33 + k1 * t37 + k7 * t41;
+  const T t64 = t60 + t63;
+  const T t65 = t61 - t62;
+  const T t66 = t60 - t63;
+  const T t67 = t61 + t62;
+  const T t68 = t0 - k6 * t22 - k12 * t26 + k0 * t30 - k8 * t34 + k15 * t38;
+  const T t69 = t1 - k6 * t23 - k12 * t27 + k0 * t31 - k8 * t35 + k15 * t39;
+  const T t70 = k7 * t24 - k13 * t28 + k1 * t32 + k9 * t36 - k16 * t40;
+  const T t71 = k7 * t25 - k13 * t29 + k1 * t33 + k9 * t37 - k16 * t41;
+  const T t72 = t68 + t71;
+  const T t73 = t69 - t70;
+  const T t74 = t68 - t71;
+  const T t75 = t69 + t70;
+  const T t76 = t0 - k8 * t22 + k0 * t26 - k6 * t30 + k15 * t34 - k4 * t38;
+  const T t77 = t1 - k8 * t23 + k0 * t27 - k6 * t31 + k15 * t35 - k4 * t39;
+  const T t78 = k9 * t24 - k14 * t28 + k7 * t32 - k16 * t36 + k5 * t40;
+  const T t79 = k9 * t25 - k14 * t29 + k7 * t33 - k16 * t37 + k5 * t41;
+  const T t80 = t76 + t79;
+  const T t81 = t77 - t78;
+  const T t82 = t76 - t79;
+  const T t83 = t77 + t78;
+  out[0 * stride_out + 0] = t42;
+  out[0 * stride_out + 1] = t43;
+  out[2 * stride_out + 0] = t48;
+  out[2 * stride_out + 1] = t49;
+  out[4 * stride_out + 0] = t56;
+  out[4 * stride_out + 1] = t57;
+  out[6 * stride_out + 0] = t64;
+  out[6 * stride_out + 1] = t65;
+  out[8 * stride_out + 0] = t72;
+  out[8 * stride_out + 1] = t73;
+  out[10 * stride_out + 0] = t80;
+  out[10 * stride_out + 1] = t81;
+  out[12 * stride_out + 0] = t82;
+  out[12 * stride_out + 1] = t83;
+  out[14 * stride_out + 0] = t74;
+  out[14 * stride_out + 1] = t75;
+  out[16 * stride_out + 0] = t66;
+  out[16 * stride_out + 1] = t67;
+  out[18 * stride_out + 0] = t58;
+  out[18 * stride_out + 1] = t59;
+  out[20 * stride_out + 0] = t50;
+  out[20 * stride_out + 1] = t51;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 12 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_12(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.4999999999999998);
+  constexpr T k1 = static_cast<T>(0.8660254037844387);
+  constexpr T k2 = static_cast<T>(0.49999999999999994);
+  constexpr T k3 = static_cast<T>(0.5000000000000001);
+  constexpr T k4 = static_cast<T>(0.8660254037844386);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = t8 + t16;
+  const T t25 = t9 + t17;
+  const T t26 = t8 - t16;
+  const T t27 = t9 - t17;
+  const T t28 = t0 + t24;
+  const T t29 = t1 + t25;
+  const T t30 = t0 - k0 * t24;
+  const T t31 = t1 - k0 * t25;
+  const T t32 = k1 * t26;
+  const T t33 = k1 * t27;
+  const T t34 = t30 + t33;
+  const T t35 = t31 - t32;
+  const T t36 = t30 - t33;
+  const T t37 = t31 + t32;
+  const T t38 = t10 + t18;
+  const T t39 = t11 + t19;
+  const T t40 = t10 - t18;
+  const T t41 = t11 - t19;
+  const T t42 = t2 + t38;
+  const T t43 = t3 + t39;
+  const T t44 = t2 - k0 * t38;
+  const T t45 = t3 - k0 * t39;
+  const T t46 = k1 * t40;
+  const T t47 = k1 * t41;
+  const T t48 = t44 + t47;
+  const T t49 = t45 - t46;
+  const T t50 = t44 - t47;
+  const T t51 = t45 + t46;
+  const T t52 = k1 * t48 + k2 * t49;
+  const T t53 = k1 * t49 - k2 * t48;
+  const T t54 = k3 * t50 + k4 * t51;
+  const T t55 = k3 * t51 - k4 * t50;
+  const T t56 = t12 + t20;
+  const T t57 = t13 + t21;
+  const T t58 = t12 - t20;
+  const T t59 = t13 - t21;
+  const T t60 = t4 + t56;
+  const T t61 = t5 + t57;
+  const T t62 = t4 - k0 * t56;
+  const T t63 = t5 - k0 * t57;
+  const T t64 = k1 * t58;
+  const T t65 = k1 * t59;
+  const T t66 = t62 + t65;
+  const T t67 = t63 - t64;
+  const T t68 = t62 - t65;
+  const T t69 = t63 + t64;
+  const T t70 = k3 * t66 + k4 * t67;
+  const T t71 = k3 * t67 - k4 * t66;
+  const T t72 = -k0 * t68 + k1 * t69;
+  const T t73 = -k0 * t69 - k1 * t68;
+  const T t74 = t14 + t22;
+  const T t75 = t15 + t23;
+  const T t76 = t14 - t22;
+  const T t77 = t15 - t23;
+  const T t78 = t6 + t74;
+  const T t79 = t7 + t75;
+  const T t80 = t6 - k0 * t74;
+  const T t81 = t7 - k0 * t75;
+  const T t82 = k1 * t76;
+  const T t83 = k1 * t77;
+  const T t84 = t80 + t83;
+  const T t85 = t81 - t82;
+  const T t86 = t80 - t83;
+  const T t87 = t81 + t82;
+  const T t88 = t85;
+  const T t89 = -t84;
+  const T t90 = -t86;
+  const T t91 = -t87;
+  const T t92 = t28 + t60;
+  const T t93 = t29 + t61;
+  const T t94 = t28 - t60;
+  const T t95 = t29 - t61;
+  const T t96 = t42 + t78;
+  const T t97 = t43 + t79;
+  const T t98 = t42 - t78;
+  const T t99 = t43 - t79;
+  const T t100 = t99;
+  const T t101 = -t98;
+  const T t102 = t92 + t96;
+  const T t103 = t93 + t97;
+  const T t104 = t92 - t96;
+  const T t105 = t93 - t97;
+  const T t106 = t94 + t100;
+  const T t107 = t95 + t101;
+  const T t108 = t94 - t100;
+  const T t109 = t95 - t101;
+  const T t110 = t34 + t70;
+  const T t111 = t35 + t71;
+  const T t112 = t34 - t70;
+  const T t113 = t35 - t71;
+  const T t114 = t52 + t88;
+  const T t115 = t53 + t89;
+  const T t116 = t52 - t88;
+  const T t117 = t53 - t89;
+  const T t118 = t117;
+  const T t119 = -t116;
+  const T t120 = t110 + t114;
+  const T t121 = t111 + t115;
+  const T t122 = t110 - t114;
+  const T t123 = t111 - t115;
+  const T t124 = t112 + t118;
+  const T t125 = t113 + t119;
+  const T t126 = t112 - t118;
+  const T t127 = t113 - t119;
+  const T t128 = t36 + t72;
+  const T t129 = t37 + t73;
+  const T t130 = t36 - t72;
+  const T t131 = t37 - t73;
+  const T t132 = t54 + t90;
+  const T t133 = t55 + t91;
+  const T t134 = t54 - t90;
+  const T t135 = t55 - t91;
+  const T t136 = t135;
+  const T t137 = -t134;
+  const T t138 = t128 + t132;
+  const T t139 = t129 + t133;
+  const T t140 = t128 - t132;
+  const T t141 = t129 - t133;
+  const T t142 = t130 + t136;
+  const T t143 = t131 + t137;
+  const T t144 = t130 - t136;
+  const T t145 = t131 - t137;
+  out[0 * stride_out + 0] = t102;
+  out[0 * stride_out + 1] = t103;
+  out[2 * stride_out + 0] = t120;
+  out[2 * stride_out + 1] = t121;
+  out[4 * stride_out + 0] = t138;
+  out[4 * stride_out + 1] = t139;
+  out[6 * stride_out + 0] = t106;
+  out[6 * stride_out + 1] = t107;
+  out[8 * stride_out + 0] = t124;
+  out[8 * stride_out + 1] = t125;
+  out[10 * stride_out + 0] = t142;
+  out[10 * stride_out + 1] = t143;
+  out[12 * stride_out + 0] = t104;
+  out[12 * stride_out + 1] = t105;
+  out[14 * stride_out + 0] = t122;
+  out[14 * stride_out + 1] = t123;
+  out[16 * stride_out + 0] = t140;
+  out[16 * stride_out + 1] = t141;
+  out[18 * stride_out + 0] = t108;
+  out[18 * stride_out + 1] = t109;
+  out[20 * stride_out + 0] = t126;
+  out[20 * stride_out + 1] = t127;
+  out[22 * stride_out + 0] = t144;
+  out[22 * stride_out + 1] = t145;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 13 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_13(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.8854560256532099);
+  constexpr T k1 = static_cast<T>(0.4647231720437685);
+  constexpr T k2 = static_cast<T>(0.5680647467311559);
+  constexpr T k3 = static_cast<T>(0.8229838658936564);
+  constexpr T k4 = static_cast<T>(0.120536680255323);
+  constexpr T k5 = static_cast<T>(0.992708874098054);
+  constexpr T k6 = static_cast<T>(0.35460488704253545);
+  constexpr T k7 = static_cast<T>(0.9350162426854148);
+  constexpr T k8 = static_cast<T>(0.7485107481711012);
+  constexpr T k9 = static_cast<T>(0.6631226582407952);
+  constexpr T k10 = static_cast<T>(0.970941817426052);
+  constexpr T k11 = static_cast<T>(0.23931566428755768);
+  constexpr T k12 = static_cast<T>(0.7485107481711013);
+  constexpr T k13 = static_cast<T>(0.663122658240795);
+  constexpr T k14 = static_cast<T>(0.1205366802553232);
+  constexpr T k15 = static_cast<T>(0.88545602565321);
+  constexpr T k16 = static_cast<T>(0.4647231720437684);
+  constexpr T k17 = static_cast<T>(0.3546048870425359);
+  constexpr T k18 = static_cast<T>(0.9350162426854147);
+  constexpr T k19 = static_cast<T>(0.9709418174260521);
+  constexpr T k20 = static_cast<T>(0.23931566428755743);
+  constexpr T k21 = static_cast<T>(0.5680647467311548);
+  constexpr T k22 = static_cast<T>(0.822983865893657);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = t2 + t24;
+  const T t27 = t3 + t25;
+  const T t28 = t2 - t24;
+  const T t29 = t3 - t25;
+  const T t30 = t4 + t22;
+  const T t31 = t5 + t23;
+  const T t32 = t4 - t22;
+  const T t33 = t5 - t23;
+  const T t34 = t6 + t20;
+  const T t35 = t7 + t21;
+  const T t36 = t6 - t20;
+  const T t37 = t7 - t21;
+  const T t38 = t8 + t18;
+  const T t39 = t9 + t19;
+  const T t40 = t8 - t18;
+  const T t41 = t9 - t19;
+  const T t42 = t10 + t16;
+  const T t43 = t11 + t17;
+  const T t44 = t10 - t16;
+  const T t45 = t11 - t17;
+  const T t46 = t12 + t14;
+  const T t47 = t13 + t15;
+  const T t48 = t12 - t14;
+  const T t49 = t13 - t15;
+  const T t50 = t0 + t26 + t30 + t34 + t38 + t42 + t46;
+  const T t51 = t1 + t27 + t31 + t35 + t39 + t43 + t47;
+  const T t52 = t0 + k0 * t26 + k2 * t30 + k4 * t34 - k6 * t38 - k8 * t42 - k10 * t46;
+  const T t53 = t1 + k0 * t27 + k2 * t31 + k4 * t35 - k6 * t39 - k8 * t43 - k10 * t47;
+  const T t54 = k1 * t28 + k3 * t32 + k5 * t36 + k7 * t40 + k9 * t44 + k11 * t48;
+  const T t55 = k1 * t29 + k3 * t33 + k5 * t37 + k7 * t41 + k9 * t45 + k11 * t49;
+  const T t56 = t52 + t55;
+  const T t57 = t53 - t54;
+  const T t58 = t52 - t55;
+  const T t59 = t53 + t54;
+  const T t60 = t0 + k2 * t26 - k6 * t30 - k10 * t34 - k12 * t38 + k14 * t42 + k15 * t46;
+  const T t61 = t1 + k2 * t27 - k6 * t31 - k10 * t35 - k12 * t39 + k14 * t43 + k15 * t47;
+  const T t62 = k3 * t28 + k7 * t32 + k11 * t36 - k13 * t40 - k5 * t44 - k16 * t48;
+  const T t63 = k3 * t29 + k7 * t33 + k11 * t37 - k13 * t41 - k5 * t45 - k16 * t49;
+  const T t64 = t60 + t63;
+  const T t65 = t61 - t62;
+  const T t66 = t60 - t63;
+  const T t67 = t61 + t62;
+  const T t68 = t0 + k4 * t26 - k10 * t30 - k17 * t34 + k15 * t38 + k2 * t42 - k8 * t46;
+  const T t69 = t1 + k4 * t27 - k10 * t31 - k17 * t35 + k15 * t39 + k2 * t43 - k8 * t47;
+  const T t70 = k5 * t28 + k11 * t32 - k18 * t36 - k16 * t40 + k3 * t44 + k9 * t48;
+  const T t71 = k5 * t29 + k11 * t33 - k18 * t37 - k16 * t41 + k3 * t45 + k9 * t49;
+  const T t72 = t68 + t71;
+  const T t73 = t69 - t70;
+  const T t74 = t68 - t71;
+  const T t75 = t69 + t70;
+  const T t76 = t0 - k6 * t26 - k12 * t30 + k15 * t34 + k4 * t38 - k19 * t42 + k21 * t46;
+  const T t77 = t1 - k6 * t27 - k12 * t31 + k15 * t35 + k4 * t39 - k19 * t43 + k21 * t47;
+  const T t78 = k7 * t28 - k13 * t32 - k16 * t36 + k5 * t40 - k20 * t44 - k22 * t48;
+  const T t79 = k7 * t29 - k13 * t33 - k16 * t37 + k5 * t41 - k20 * t45 - k22 * t49;
+  const T t80 = t76 + t79;
+  const T t81 = t77 - t78;
+  const T t82 = t76 - t79;
+  const T t83 = t77 + t78;
+  const T t84 = t0 - k8 * t26 + k14 * t30 + k2 * t34 - k19 * t38 + k15 * t42 - k6 * t46;
+  const T t85 = t1 - k8 * t27 + k14 * t31 + k2 * t35 - k19 * t39 + k15 * t43 - k6 * t47;
+  const T t86 = k9 * t28 - k5 * t32 + k3 * t36 - k20 * t40 - k16 * t44 + k7 * t48;
+  const T t87 = k9 * t29 - k5 * t33 + k3 * t37 - k20 * t41 - k16 * t45 + k7 * t49;
+  const T t88 = t84 + t87;
+  const T t89 = t85 - t86;
+  const T t90 = t84 - t87;
+  const T t91 = t85 + t86;
+  const T t92 = t0 - k10 * t26 + k15 * t30 - k8 * t34 + k21 * t38 - k6 * t42 + k14 * t46;
+  const T t93 = t1 - k10 * t27 + k15 * t31 - k8 * t35 + k21 * t39 - k6 * t43 + k14 * t47;
+  const T t94 = k11 * t28 - k16 * t32 + k9 * t36 - k22 * t40 + k7 * t44 - k5 * t48;
+  const T t95 = k11 * t29 - k16 * t33 + k9 * t37 - k22 * t41 + k7 * t45 - k5 * t49;
+  const T t96 = t92 + t95;
+  const T t97 = t93 - t94;
+  const T t98 = t92 - t95;
+  const T t99 = t93 + t94;
+  out[0 * stride_out + 0] = t50;
+  out[0 * stride_out + 1] = t51;
+  out[2 * stride_out + 0] = t56;
+  out[2 * stride_out + 1] = t57;
+  out[4 * stride_out + 0] = t64;
+  out[4 * stride_out + 1] = t65;
+  out[6 * stride_out + 0] = t72;
+  out[6 * stride_out + 1] = t73;
+  out[8 * stride_out + 0] = t80;
+  out[8 * stride_out + 1] = t81;
+  out[10 * stride_out + 0] = t88;
+  out[10 * stride_out + 1] = t89;
+  out[12 * stride_out + 0] = t96;
+  out[12 * stride_out + 1] = t97;
+  out[14 * stride_out + 0] = t98;
+  out[14 * stride_out + 1] = t99;
+  out[16 * stride_out + 0] = t90;
+  out[16 * stride_out + 1] = t91;
+  out[18 * stride_out + 0] = t82;
+  out[18 * stride_out + 1] = t83;
+  out[20 * stride_out + 0] = t74;
+  out[20 * stride_out + 1] = t75;
+  out[22 * stride_out + 0] = t66;
+  out[22 * stride_out + 1] = t67;
+  out[24 * stride_out + 0] = t58;
+  out[24 * stride_out + 1] = t59;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 14 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_14(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9009688679024191);
+  constexpr T k1 = static_cast<T>(0.4338837391175581);
+  constexpr T k2 = static_cast<T>(0.6234898018587336);
+  constexpr T k3 = static_cast<T>(0.7818314824680298);
+  constexpr T k4 = static_cast<T>(0.22252093395631445);
+  constexpr T k5 = static_cast<T>(0.9749279121818236);
+  constexpr T k6 = static_cast<T>(0.22252093395631434);
+  constexpr T k7 = static_cast<T>(0.6234898018587335);
+  constexpr T k8 = static_cast<T>(0.7818314824680299);
+  constexpr T k9 = static_cast<T>(0.900968867902419);
+  constexpr T k10 = static_cast<T>(0.43388373911755823);
+  constexpr T k11 = static_cast<T>(0.433883739117558);
+  constexpr T k12 = static_cast<T>(0.6234898018587334);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = t0 + t14;
+  const T t29 = t1 + t15;
+  const T t30 = t0 - t14;
+  const T t31 = t1 - t15;
+  const T t32 = t2 + t16;
+  const T t33 = t3 + t17;
+  const T t34 = t2 - t16;
+  const T t35 = t3 - t17;
+  const T t36 = k0 * t34 + k1 * t35;
+  const T t37 = k0 * t35 - k1 * t34;
+  const T t38 = t4 + t18;
+  const T t39 = t5 + t19;
+  const T t40 = t4 - t18;
+  const T t41 = t5 - t19;
+  const T t42 = k2 * t40 + k3 * t41;
+  const T t43 = k2 * t41 - k3 * t40;
+  const T t44 = t6 + t20;
+  const T t45 = t7 + t21;
+  const T t46 = t6 - t20;
+  const T t47 = t7 - t21;
+  const T t48 = k4 * t46 + k5 * t47;
+  const T t49 = k4 * t47 - k5 * t46;
+  const T t50 = t8 + t22;
+  const T t51 = t9 + t23;
+  const T t52 = t8 - t22;
+  const T t53 = t9 - t23;
+  const T t54 = -k6 * t52 + k5 * t53;
+  const T t55 = -k6 * t53 - k5 * t52;
+  const T t56 = t10 + t24;
+  const T t57 = t11 + t25;
+  const T t58 = t10 - t24;
+  const T t59 = t11 - t25;
+  const T t60 = -k7 * t58 + k8 * t59;
+  const T t61 = -k7 * t59 - k8 * t58;
+  const T t62 = t12 + t26;
+  const T t63 = t13 + t27;
+  const T t64 = t12 - t26;
+  const T t65 = t13 - t27;
+  const T t66 = -k9 * t64 + k10 * t65;
+  const T t67 = -k9 * t65 - k10 * t64;
+  const T t68 = t32 + t62;
+  const T t69 = t33 + t63;
+  const T t70 = t32 - t62;
+  const T t71 = t33 - t63;
+  const T t72 = t38 + t56;
+  const T t73 = t39 + t57;
+  const T t74 = t38 - t56;
+  const T t75 = t39 - t57;
+  const T t76 = t44 + t50;
+  const T t77 = t45 + t51;
+  const T t78 = t44 - t50;
+  const T t79 = t45 - t51;
+  const T t80 = t28 + t68 + t72 + t76;
+  const T t81 = t29 + t69 + t73 + t77;
+  const T t82 = t28 + k2 * t68 - k6 * t72 - k9 * t76;
+  const T t83 = t29 + k2 * t69 - k6 * t73 - k9 * t77;
+  const T t84 = k3 * t70 + k5 * t74 + k10 * t78;
+  const T t85 = k3 * t71 + k5 * t75 + k10 * t79;
+  const T t86 = t82 + t85;
+  const T t87 = t83 - t84;
+  const T t88 = t82 - t85;
+  const T t89 = t83 + t84;
+  const T t90 = t28 - k6 * t68 - k0 * t72 + k12 * t76;
+  const T t91 = t29 - k6 * t69 - k0 * t73 + k12 * t77;
+  const T t92 = k5 * t70 - k11 * t74 - k8 * t78;
+  const T t93 = k5 * t71 - k11 * t75 - k8 * t79;
+  const T t94 = t90 + t93;
+  const T t95 = t91 - t92;
+  const T t96 = t90 - t93;
+  const T t97 = t91 + t92;
+  const T t98 = t28 - k9 * t68 + k12 * t72 - k6 * t76;
+  const T t99 = t29 - k9 * t69 + k12 * t73 - k6 * t77;
+  const T t100 = k10 * t70 - k8 * t74 + k5 * t78;
+  const T t101 = k10 * t71 - k8 * t75 + k5 * t79;
+  const T t102 = t98 + t101;
+  const T t103 = t99 - t100;
+  const T t104 = t98 - t101;
+  const T t105 = t99 + t100;
+  const T t106 = t36 + t66;
+  const T t107 = t37 + t67;
+  const T t108 = t36 - t66;
+  const T t109 = t37 - t67;
+  const T t110 = t42 + t60;
+  const T t111 = t43 + t61;
+  const T t112 = t42 - t60;
+  const T t113 = t43 - t61;
+  const T t114 = t48 + t54;
+  const T t115 = t49 + t55;
+  const T t116 = t48 - t54;
+  const T t117 = t49 - t55;
+  const T t118 = t30 + t106 + t110 + t114;
+  const T t119 = t31 + t107 + t111 + t115;
+  const T t120 = t30 + k2 * t106 - k6 * t110 - k9 * t114;
+  const T t121 = t31 + k2 * t107 - k6 * t111 - k9 * t115;
+  const T t122 = k3 * t108 + k5 * t112 + k10 * t116;
+  const T t123 = k3 * t109 + k5 * t113 + k10 * t117;
+  const T t124 = t120 + t123;
+  const T t125 = t121 - t122;
+  const T t126 = t120 - t123;
+  const T t127 = t121 + t122;
+  const T t128 = t30 - k6 * t106 - k0 * t110 + k12 * t114;
+  const T t129 = t31 - k6 * t107 - k0 * t111 + k12 * t115;
+  const T t130 = k5 * t108 - k11 * t112 - k8 * t116;
+  const T t131 = k5 * t109 - k11 * t113 - k8 * t117;
+  const T t132 = t128 + t131;
+  const T t133 = t129 - t130;
+  const T t134 = t128 - t131;
+  const T t135 = t129 + t130;
+  const T t136 = t30 - k9 * t106 + k12 * t110 - k6 * t114;
+  const T t137 = t31 - k9 * t107 + k12 * t111 - k6 * t115;
+  const T t138 = k10 * t108 - k8 * t112 + k5 * t116;
+  const T t139 = k10 * t109 - k8 * t113 + k5 * t117;
+  const T t140 = t136 + t139;
+  const T t141 = t137 - t138;
+  const T t142 = t136 - t139;
+  const T t143 = t137 + t138;
+  out[0 * stride_out + 0] = t80;
+  out[0 * stride_out + 1] = t81;
+  out[2 * stride_out + 0] = t118;
+  out[2 * stride_out + 1] = t119;
+  out[4 * stride_out + 0] = t86;
+  out[4 * stride_out + 1] = t87;
+  out[6 * stride_out + 0] = t124;
+  out[6 * stride_out + 1] = t125;
+  out[8 * stride_out + 0] = t94;
+  out[8 * stride_out + 1] = t95;
+  out[10 * stride_out + 0] = t132;
+  out[10 * stride_out + 1] = t133;
+  out[12 * stride_out + 0] = t102;
+  out[12 * stride_out + 1] = t103;
+  out[14 * stride_out + 0] = t140;
+  out[14 * stride_out + 1] = t141;
+  out[16 * stride_out + 0] = t104;
+  out[16 * stride_out + 1] = t105;
+  out[18 * stride_out + 0] = t142;
+  out[18 * stride_out + 1] = t143;
+  out[20 * stride_out + 0] = t96;
+  out[20 * stride_out + 1] = t97;
+  out[22 * stride_out + 0] = t134;
+  out[22 * stride_out + 1] = t135;
+  out[24 * stride_out + 0] = t88;
+  out[24 * stride_out + 1] = t89;
+  out[26 * stride_out + 0] = t126;
+  out[26 * stride_out + 1] = t127;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 15 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_15(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.4999999999999998);
+  constexpr T k1 = static_cast<T>(0.8660254037844387);
+  constexpr T k2 = static_cast<T>(0.9135454576426009);
+  constexpr T k3 = static_cast<T>(0.40673664307580015);
+  constexpr T k4 = static_cast<T>(0.6691306063588582);
+  constexpr T k5 = static_cast<T>(0.7431448254773941);
+  constexpr T k6 = static_cast<T>(0.10452846326765333);
+  constexpr T k7 = static_cast<T>(0.9945218953682734);
+  constexpr T k8 = static_cast<T>(0.30901699437494745);
+  constexpr T k9 = static_cast<T>(0.9510565162951535);
+  constexpr T k10 = static_cast<T>(0.8090169943749473);
+  constexpr T k11 = static_cast<T>(0.5877852522924732);
+  constexpr T k12 = static_cast<T>(0.9781476007338057);
+  constexpr T k13 = static_cast<T>(0.20791169081775907);
+  constexpr T k14 = static_cast<T>(0.30901699437494723);
+  constexpr T k15 = static_cast<T>(0.9510565162951536);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = t10 + t20;
+  const T t31 = t11 + t21;
+  const T t32 = t10 - t20;
+  const T t33 = t11 - t21;
+  const T t34 = t0 + t30;
+  const T t35 = t1 + t31;
+  const T t36 = t0 - k0 * t30;
+  const T t37 = t1 - k0 * t31;
+  const T t38 = k1 * t32;
+  const T t39 = k1 * t33;
+  const T t40 = t36 + t39;
+  const T t41 = t37 - t38;
+  const T t42 = t36 - t39;
+  const T t43 = t37 + t38;
+  const T t44 = t12 + t22;
+  const T t45 = t13 + t23;
+  const T t46 = t12 - t22;
+  const T t47 = t13 - t23;
+  const T t48 = t2 + t44;
+  const T t49 = t3 + t45;
+  const T t50 = t2 - k0 * t44;
+  const T t51 = t3 - k0 * t45;
+  const T t52 = k1 * t46;
+  const T t53 = k1 * t47;
+  const T t54 = t50 + t53;
+  const T t55 = t51 - t52;
+  const T t56 = t50 - t53;
+  const T t57 = t51 + t52;
+  const T t58 = k2 * t54 + k3 * t55;
+  const T t59 = k2 * t55 - k3 * t54;
+  const T t60 = k4 * t56 + k5 * t57;
+  const T t61 = k4 * t57 - k5 * t56;
+  const T t62 = t14 + t24;
+  const T t63 = t15 + t25;
+  const T t64 = t14 - t24;
+  const T t65 = t15 - t25;
+  const T t66 = t4 + t62;
+  const T t67 = t5 + t63;
+  const T t68 = t4 - k0 * t62;
+  const T t69 = t5 - k0 * t63;
+  const T t70 = k1 * t64;
+  const T t71 = k1 * t65;
+  const T t72 = t68 + t71;
+  const T t73 = t69 - t70;
+  const T t74 = t68 - t71;
+  const T t75 = t69 + t70;
+  const T t76 = k4 * t72 + k5 * t73;
+  const T t77 = k4 * t73 - k5 * t72;
+  const T t78 = -k6 * t74 + k7 * t75;
+  const T t79 = -k6 * t75 - k7 * t74;
+  const T t80 = t16 + t26;
+  const T t81 = t17 + t27;
+  const T t82 = t16 - t26;
+  const T t83 = t17 - t27;
+  const T t84 = t6 + t80;
+  const T t85 = t7 + t81;
+  const T t86 = t6 - k0 * t80;
+  const T t87 = t7 - k0 * t81;
+  const T t88 = k1 * t82;
+  const T t89 = k1 * t83;
+  const T t90 = t86 + t89;
+  const T t91 = t87 - t88;
+  const T t92 = t86 - t89;
+  const T t93 = t87 + t88;
+  const T t94 = k8 * t90 + k9 * t91;
+  const T t95 = k8 * t91 - k9 * t90;
+  const T t96 = -k10 * t92 + k11 * t93;
+  const T t97 = -k10 * t93 - k11 * t92;
+  const T t98 = t18 + t28;
+  const T t99 = t19 + t29;
+  const T t100 = t18 - t28;
+  const T t101 = t19 - t29;
+  const T t102 = t8 + t98;
+  const T t103 = t9 + t99;
+  const T t104 = t8 - k0 * t98;
+  const T t105 = t9 - k0 * t99;
+  const T t106 = k1 * t100;
+  const T t107 = k1 * t101;
+  const T t108 = t104 + t107;
+  const T t109 = t105 - t106;
+  const T t110 = t104 - t107;
+  const T t111 = t105 + t106;
+  const T t112 = -k6 * t108 + k7 * t109;
+  const T t113 = -k6 * t109 - k7 * t108;
+  const T t114 = -k12 * t110 - k13 * t111;
+  const T t115 = -k12 * t111 + k13 * t110;
+  const T t116 = t48 + t102;
+  const T t117 = t49 + t103;
+  const T t118 = t48 - t102;
+  const T t119 = t49 - t103;
+  const T t120 = t66 + t84;
+  const T t121 = t67 + t85;
+  const T t122 = t66 - t84;
+  const T t123 = t67 - t85;
+  const T t124 = t34 + t116 + t120;
+  const T t125 = t35 + t117 + t121;
+  const T t126 = t34 + k8 * t116 - k10 * t120;
+  const T t127 = t35 + k8 * t117 - k10 * t121;
+  const T t128 = k9 * t118 + k11 * t122;
+  const T t129 = k9 * t119 + k11 * t123;
+  const T t130 = t126 + t129;
+  const T t131 = t127 - t128;
+  const T t132 = t126 - t129;
+  const T t133 = t127 + t128;
+  const T t134 = t34 - k10 * t116 + k14 * t120;
+  const T t135 = t35 - k10 * t117 + k14 * t121;
+  const T t136 = k11 * t118 - k15 * t122;
+  const T t137 = k11 * t119 - k15 * t123;
+  const T t138 = t134 + t137;
+  const T t139 = t135 - t136;
+  const T t140 = t134 - t137;
+  const T t141 = t135 + t136;
+  const T t142 = t58 + t112;
+  const T t143 = t59 + t113;
+  const T t144 = t58 - t112;
+  const T t145 = t59 - t113;
+  const T t146 = t76 + t94;
+  const T t147 = t77 + t95;
+  const T t148 = t76 - t94;
+  const T t149 = t77 - t95;
+  const T t150 = t40 + t142 + t146;
+  const T t151 = t41 + t143 + t147;
+  const T t152 = t40 + k8 * t142 - k10 * t146;
+  const T t153 = t41 + k8 * t143 - k10 * t147;
+  const T t154 = k9 * t144 + k11 * t148;
+  const T t155 = k9 * t145 + k11 * t149;
+  const T t156 = t152 + t155;
+  const T t157 = t153 - t154;
+  const T t158 = t152 - t155;
+  const T t159 = t153 + t154;
+  const T t160 = t40 - k10 * t142 + k14 * t146;
+  const T t161 = t41 - k10 * t143 + k14 * t147;
+  const T t162 = k11 * t144 - k15 * t148;
+  const T t163 = k11 * t145 - k15 * t149;
+  const T t164 = t160 + t163;
+  const T t165 = t161 - t162;
+  const T t166 = t160 - t163;
+  const T t167 = t161 + t162;
+  const T t168 = t60 + t114;
+  const T t169 = t61 + t115;
+  const T t170 = t60 - t114;
+  const T t171 = t61 - t115;
+  const T t172 = t78 + t96;
+  const T t173 = t79 + t97;
+  const T t174 = t78 - t96;
+  const T t175 = t79 - t97;
+  const T t176 = t42 + t168 + t172;
+  const T t177 = t43 + t169 + t173;
+  const T t178 = t42 + k8 * t168 - k10 * t172;
+  const T t179 = t43 + k8 * t169 - k10 * t173;
+  const T t180 = k9 * t170 + k11 * t174;
+  const T t181 = k9 * t171 + k11 * t175;
+  const T t182 = t178 + t181;
+  const T t183 = t179 - t180;
+  const T t184 = t178 - t181;
+  const T t185 = t179 + t180;
+  const T t186 = t42 - k10 * t168 + k14 * t172;
+  const T t187 = t43 - k10 * t169 + k14 * t173;
+  const T t188 = k11 * t170 - k15 * t174;
+  const T t189 = k11 * t171 - k15 * t175;
+  const T t190 = t186 + t189;
+  const T t191 = t187 - t188;
+  const T t192 = t186 - t189;
+  const T t193 = t187 + t188;
+  out[0 * stride_out + 0] = t124;
+  out[0 * stride_out + 1] = t125;
+  out[2 * stride_out + 0] = t150;
+  out[2 * stride_out + 1] = t151;
+  out[4 * stride_out + 0] = t176;
+  out[4 * stride_out + 1] = t177;
+  out[6 * stride_out + 0] = t130;
+  out[6 * stride_out + 1] = t131;
+  out[8 * stride_out + 0] = t156;
+  out[8 * stride_out + 1] = t157;
+  out[10 * stride_out + 0] = t182;
+  out[10 * stride_out + 1] = t183;
+  out[12 * stride_out + 0] = t138;
+  out[12 * stride_out + 1] = t139;
+  out[14 * stride_out + 0] = t164;
+  out[14 * stride_out + 1] = t165;
+  out[16 * stride_out + 0] = t190;
+  out[16 * stride_out + 1] = t191;
+  out[18 * stride_out + 0] = t140;
+  out[18 * stride_out + 1] = t141;
+  out[20 * stride_out + 0] = t166;
+  out[20 * stride_out + 1] = t167;
+  out[22 * stride_out + 0] = t192;
+  out[22 * stride_out + 1] = t193;
+  out[24 * stride_out + 0] = t132;
+  out[24 * stride_out + 1] = t133;
+  out[26 * stride_out + 0] = t158;
+  out[26 * stride_out + 1] = t159;
+  out[28 * stride_out + 0] = t184;
+  out[28 * stride_out + 1] = t185;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 16 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_16(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9238795325112867);
+  constexpr T k1 = static_cast<T>(0.3826834323650898);
+  constexpr T k2 = static_cast<T>(0.7071067811865476);
+  constexpr T k3 = static_cast<T>(0.38268343236508984);
+  constexpr T k4 = static_cast<T>(0.9238795325112868);
+  constexpr T k5 = static_cast<T>(0.38268343236508967);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = in[30 * stride_in + 0];
+  const T t31 = in[30 * stride_in + 1];
+  const T t32 = t0 + t16;
+  const T t33 = t1 + t17;
+  const T t34 = t0 - t16;
+  const T t35 = t1 - t17;
+  const T t36 = t8 + t24;
+  const T t37 = t9 + t25;
+  const T t38 = t8 - t24;
+  const T t39 = t9 - t25;
+  const T t40 = t39;
+  const T t41 = -t38;
+  const T t42 = t32 + t36;
+  const T t43 = t33 + t37;
+  const T t44 = t32 - t36;
+  const T t45 = t33 - t37;
+  const T t46 = t34 + t40;
+  const T t47 = t35 + t41;
+  const T t48 = t34 - t40;
+  const T t49 = t35 - t41;
+  const T t50 = t2 + t18;
+  const T t51 = t3 + t19;
+  const T t52 = t2 - t18;
+  const T t53 = t3 - t19;
+  const T t54 = t10 + t26;
+  const T t55 = t11 + t27;
+  const T t56 = t10 - t26;
+  const T t57 = t11 - t27;
+  const T t58 = t57;
+  const T t59 = -t56;
+  const T t60 = t50 + t54;
+  const T t61 = t51 + t55;
+  const T t62 = t50 - t54;
+  const T t63 = t51 - t55;
+  const T t64 = t52 + t58;
+  const T t65 = t53 + t59;
+  const T t66 = t52 - t58;
+  const T t67 = t53 - t59;
+  const T t68 = k0 * t64 + k1 * t65;
+  const T t69 = k0 * t65 - k1 * t64;
+  const T t70 = t62 + t63;
+  const T t71 = t63 - t62;
+  const T t72 = k2 * t70;
+  const T t73 = k2 * t71;
+  const T t74 = k3 * t66 + k0 * t67;
+  const T t75 = k3 * t67 - k0 * t66;
+  const T t76 = t4 + t20;
+  const T t77 = t5 + t21;
+  const T t78 = t4 - t20;
+  const T t79 = t5 - t21;
+  const T t80 = t12 + t28;
+  const T t81 = t13 + t29;
+  const T t82 = t12 - t28;
+  const T t83 = t13 - t29;
+  const T t84 = t83;
+  const T t85 = -t82;
+  const T t86 = t76 + t80;
+  const T t87 = t77 + t81;
+  const T t88 = t76 - t80;
+  const T t89 = t77 - t81;
+  const T t90 = t78 + t84;
+  const T t91 = t79 + t85;
+  const T t92 = t78 - t84;
+  const T t93 = t79 - t85;
+  const T t94 = t90 + t91;
+  const T t95 = t91 - t90;
+  const T t96 = k2 * t94;
+  const T t97 = k2 * t95;
+  const T t98 = t89;
+  const T t99 = -t88;
+  const T t100 = -t92 + t93;
+  const T t101 = -t93 - t92;
+  const T t102 = k2 * t100;
+  const T t103 = k2 * t101;
+  const T t104 = t6 + t22;
+  const T t105 = t7 + t23;
+  const T t106 = t6 - t22;
+  const T t107 = t7 - t23;
+  const T t108 = t14 + t30;
+  const T t109 = t15 + t31;
+  const T t110 = t14 - t30;
+  const T t111 = t15 - t31;
+  const T t112 = t111;
+  const T t113 = -t110;
+  const T t114 = t104 + t108;
+  const T t115 = t105 + t109;
+  const T t116 = t104 - t108;
+  const T t117 = t105 - t109;
+  const T t118 = t106 + t112;
+  const T t119 = t107 + t113;
+  const T t120 = t106 - t112;
+  const T t121 = t107 - t113;
+  const T t122 = k3 * t118 + k0 * t119;
+  const T t123 = k3 * t119 - k0 * t118;
+  const T t124 = -t116 + t117;
+  const T t125 = -t117 - t116;
+  const T t126 = k2 * t124;
+  const T t127 = k2 * t125;
+  const T t128 = -k4 * t120 - k5 * t121;
+  const T t129 = -k4 * t121 + k5 * t120;
+  const T t130 = t42 + t86;
+  const T t131 = t43 + t87;
+  const T t132 = t42 - t86;
+  const T t133 = t43 - t87;
+  const T t134 = t60 + t114;
+  const T t135 = t61 + t115;
+  const T t136 = t60 - t114;
+  const T t137 = t61 - t115;
+  const T t138 = t137;
+  const T t139 = -t136;
+  const T t140 = t130 + t134;
+  const T t141 = t131 + t135;
+  const T t142 = t130 - t134;
+  const T t143 = t131 - t135;
+  const T t144 = t132 + t138;
+  const T t145 = t133 + t139;
+  const T t146 = t132 - t138;
+  const T t147 = t133 - t139;
+  const T t148 = t46 + t96;
+  const T t149 = t47 + t97;
+  const T t150 = t46 - t96;
+  const T t151 = t47 - t97;
+  const T t152 = t68 + t122;
+  const T t153 = t69 + t123;
+  const T t154 = t68 - t122;
+  const T t155 = t69 - t123;
+  const T t156 = t155;
+  const T t157 = -t154;
+  const T t158 = t148 + t152;
+  const T t159 = t149 + t153;
+  const T t160 = t148 - t152;
+  const T t161 = t149 - t153;
+  const T t162 = t150 + t156;
+  const T t163 = t151 + t157;
+  const T t164 = t150 - t156;
+  const T t165 = t151 - t157;
+  const T t166 = t44 + t98;
+  const T t167 = t45 + t99;
+  const T t168 = t44 - t98;
+  const T t169 = t45 - t99;
+  const T t170 = t72 + t126;
+  const T t171 = t73 + t127;
+  const T t172 = t72 - t126;
+  const T t173 = t73 - t127;
+  const T t174 = t173;
+  const T t175 = -t172;
+  const T t176 = t166 + t170;
+  const T t177 = t167 + t171;
+  const T t178 = t166 - t170;
+  const T t179 = t167 - t171;
+  const T t180 = t168 + t174;
+  const T t181 = t169 + t175;
+  const T t182 = t168 - t174;
+  const T t183 = t169 - t175;
+  const T t184 = t48 + t102;
+  const T t185 = t49 + t103;
+  const T t186 = t48 - t102;
+  const T t187 = t49 - t103;
+  const T t188 = t74 + t128;
+  const T t189 = t75 + t129;
+  const T t190 = t74 - t128;
+  const T t191 = t75 - t129;
+  const T t192 = t191;
+  const T t193 = -t190;
+  const T t194 = t184 + t188;
+  const T t195 = t185 + t189;
+  const T t196 = t184 - t188;
+  const T t197 = t185 - t189;
+  const T t198 = t186 + t192;
+  const T t199 = t187 + t193;
+  const T t200 = t186 - t192;
+  const T t201 = t187 - t193;
+  out[0 * stride_out + 0] = t140;
+  out[0 * stride_out + 1] = t141;
+  out[2 * stride_out + 0] = t158;
+  out[2 * stride_out + 1] = t159;
+  out[4 * stride_out + 0] = t176;
+  out[4 * stride_out + 1] = t177;
+  out[6 * stride_out + 0] = t194;
+  out[6 * stride_out + 1] = t195;
+  out[8 * stride_out + 0] = t144;
+  out[8 * stride_out + 1] = t145;
+  out[10 * stride_out + 0] = t162;
+  out[10 * stride_out + 1] = t163;
+  out[12 * stride_out + 0] = t180;
+  out[12 * stride_out + 1] = t181;
+  out[14 * stride_out + 0] = t198;
+  out[14 * stride_out + 1] = t199;
+  out[16 * stride_out + 0] = t142;
+  out[16 * stride_out + 1] = t143;
+  out[18 * stride_out + 0] = t160;
+  out[18 * stride_out + 1] = t161;
+  out[20 * stride_out + 0] = t178;
+  out[20 * stride_out + 1] = t179;
+  out[22 * stride_out + 0] = t196;
+  out[22 * stride_out + 1] = t197;
+  out[24 * stride_out + 0] = t146;
+  out[24 * stride_out + 1] = t147;
+  out[26 * stride_out + 0] = t164;
+  out[26 * stride_out + 1] = t165;
+  out[28 * stride_out + 0] = t182;
+  out[28 * stride_out + 1] = t183;
+  out[30 * stride_out + 0] = t200;
+  out[30 * stride_out + 1] = t201;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 17 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_17(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9324722294043558);
+  constexpr T k1 = static_cast<T>(0.3612416661871529);
+  constexpr T k2 = static_cast<T>(0.7390089172206591);
+  constexpr T k3 = static_cast<T>(0.6736956436465572);
+  constexpr T k4 = static_cast<T>(0.4457383557765383);
+  constexpr T k5 = static_cast<T>(0.8951632913550623);
+  constexpr T k6 = static_cast<T>(0.09226835946330202);
+  constexpr T k7 = static_cast<T>(0.9957341762950345);
+  constexpr T k8 = static_cast<T>(0.2736629900720829);
+  constexpr T k9 = static_cast<T>(0.961825643172819);
+  constexpr T k10 = static_cast<T>(0.6026346363792563);
+  constexpr T k11 = static_cast<T>(0.7980172272802396);
+  constexpr T k12 = static_cast<T>(0.850217135729614);
+  constexpr T k13 = static_cast<T>(0.5264321628773561);
+  constexpr T k14 = static_cast<T>(0.9829730996839018);
+  constexpr T k15 = static_cast<T>(0.18374951781657037);
+  constexpr T k16 = static_cast<T>(0.8502171357296141);
+  constexpr T k17 = static_cast<T>(0.5264321628773558);
+  constexpr T k18 = static_cast<T>(0.2736629900720831);
+  constexpr T k19 = static_cast<T>(0.4457383557765377);
+  constexpr T k20 = static_cast<T>(0.8951632913550626);
+  constexpr T k21 = static_cast<T>(0.36124166618715303);
+  constexpr T k22 = static_cast<T>(0.18374951781657012);
+  constexpr T k23 = static_cast<T>(0.7390089172206585);
+  constexpr T k24 = static_cast<T>(0.6736956436465578);
+  constexpr T k25 = static_cast<T>(0.6026346363792572);
+  constexpr T k26 = static_cast<T>(0.7980172272802389);
+  constexpr T k27 = static_cast<T>(0.09226835946330243);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = in[30 * stride_in + 0];
+  const T t31 = in[30 * stride_in + 1];
+  const T t32 = in[32 * stride_in + 0];
+  const T t33 = in[32 * stride_in + 1];
+  const T t34 = t2 + t32;
+  const T t35 = t3 + t33;
+  const T t36 = t2 - t32;
+  const T t37 = t3 - t33;
+  const T t38 = t4 + t30;
+  const T t39 = t5 + t31;
+  const T t40 = t4 - t30;
+  const T t41 = t5 - t31;
+  const T t42 = t6 + t28;
+  const T t43 = t7 + t29;
+  const T t44 = t6 - t28;
+  const T t45 = t7 - t29;
+  const T t46 = t8 + t26;
+  const T t47 = t9 + t27;
+  const T t48 = t8 - t26;
+  const T t49 = t9 - t27;
+  const T t50 = t10 + t24;
+  const T t51 = t11 + t25;
+  const T t52 = t10 - t24;
+  const T t53 = t11 - t25;
+  const T t54 = t12 + t22;
+  const T t55 = t13 + t23;
+  const T t56 = t12 - t22;
+  const T t57 = t13 - t23;
+  const T t58 = t14 + t20;
+  const T t59 = t15 + t21;
+  const T t60 = t14 - t20;
+  const T t61 = t15 - t21;
+  const T t62 = t16 + t18;
+  const T t63 = t17 + t19;
+  const T t64 = t16 - t18;
+  const T t65 = t17 - t19;
+  const T t66 = t0 + t34 + t38 + t42 + t46 + t50 + t54 + t58 + t62;
+  const T t67 = t1 + t35 + t39 + t43 + t47 + t51 + t55 + t59 + t63;
+  const T t68 = t0 + k0 * t34 + k2 * t38 + k4 * t42 + k6 * t46 - k8 * t50 - k10 * t54 - k12 * t58 - k14 * t62;
+  const T t69 = t1 + k0 * t35 + k2 * t39 + k4 * t43 + k6 * t47 - k8 * t51 - k10 * t55 - k12 * t59 - k14 * t63;
+  const T t70 = k1 * t36 + k3 * t40 + k5 * t44 + k7 * t48 + k9 * t52 + k11 * t56 + k13 * t60 + k15 * t64;
+  const T t71 = k1 * t37 + k3 * t41 + k5 * t45 + k7 * t49 + k9 * t53 + k11 * t57 + k13 * t61 + k15 * t65;
+  const T t72 = t68 + t71;
+  const T t73 = t69 - t70;
+  const T t74 = t68 - t71;
+  const T t75 = t69 + t70;
+  const T t76 = t0 + k2 * t34 + k6 * t38 - k10 * t42 - k14 * t46 - k16 * t50 - k18 * t54 + k19 * t58 + k0 * t62;
+  const T t77 = t1 + k2 * t35 + k6 * t39 - k10 * t43 - k14 * t47 - k16 * t51 - k18 * t55 + k19 * t59 + k0 * t63;
+  const T t78 = k3 * t36 + k7 * t40 + k11 * t44 + k15 * t48 - k17 * t52 - k9 * t56 - k20 * t60 - k21 * t64;
+  const T t79 = k3 * t37 + k7 * t41 + k11 * t45 + k15 * t49 - k17 * t53 - k9 * t57 - k20 * t61 - k21 * t65;
+  const T t80 = t76 + t79;
+  const T t81 = t77 - t78;
+  const T t82 = t76 - t79;
+  const T t83 = t77 + t78;
+  const T t84 = t0 + k4 * t34 - k10 * t38 - k14 * t42 - k18 * t46 + k23 * t50 + k0 * t54 + k6 * t58 - k12 * t62;
+  const T t85 = t1 + k4 * t35 - k10 * t39 - k14 * t43 - k18 * t47 + k23 * t51 + k0 * t55 + k6 * t59 - k12 * t63;
+  const T t86 = k5 * t36 + k11 * t40 - k22 * t44 - k9 * t48 - k24 * t52 + k1 * t56 + k7 * t60 + k13 * t64;
+  const T t87 = k5 * t37 + k11 * t41 - k22 * t45 - k9 * t49 - k24 * t53 + k1 * t57 + k7 * t61 + k13 * t65;
+  const T t88 = t84 + t87;
+  const T t89 = t85 - t86;
+  const T t90 = t84 - t87;
+  const T t91 = t85 + t86;
+  const T t92 = t0 + k6 * t34 - k14 * t38 - k18 * t42 + k0 * t46 + k4 * t50 - k12 * t54 - k25 * t58 + k23 * t62;
+  const T t93 = t1 + k6 * t35 - k14 * t39 - k18 * t43 + k0 * t47 + k4 * t51 - k12 * t55 - k25 * t59 + k23 * t63;
+  const T t94 = k7 * t36 + k15 * t40 - k9 * t44 - k21 * t48 + k5 * t52 + k13 * t56 - k26 * t60 - k24 * t64;
+  const T t95 = k7 * t37 + k15 * t41 - k9 * t45 - k21 * t49 + k5 * t53 + k13 * t57 - k26 * t61 - k24 * t65;
+  const T t96 = t92 + t95;
+  const T t97 = t93 - t94;
+  const T t98 = t92 - t95;
+  const T t99 = t93 + t94;
+  const T t100 = t0 - k8 * t34 - k16 * t38 + k23 * t42 + k4 * t46 - k14 * t50 + k27 * t54 + k0 * t58 - k10 * t62;
+  const T t101 = t1 - k8 * t35 - k16 * t39 + k23 * t43 + k4 * t47 - k14 * t51 + k27 * t55 + k0 * t59 - k10 * t63;
+  const T t102 = k9 * t36 - k17 * t40 - k24 * t44 + k5 * t48 + k15 * t52 - k7 * t56 + k1 * t60 + k11 * t64;
+  const T t103 = k9 * t37 - k17 * t41 - k24 * t45 + k5 * t49 + k15 * t53 - k7 * t57 + k1 * t61 + k11 * t65;
+  const T t104 = t100 + t103;
+  const T t105 = t101 - t102;
+  const T t106 = t100 - t103;
+  const T t107 = t101 + t102;
+  const T t108 = t0 - k10 * t34 - k18 * t38 + k0 * t42 - k12 * t46 + k27 * t50 + k2 * t54 - k14 * t58 + k19 * t62;
+  const T t109 = t1 - k10 * t35 - k18 * t39 + k0 * t43 - k12 * t47 + k27 * t51 + k2 * t55 - k14 * t59 + k19 * t63;
+  const T t110 = k11 * t36 - k9 * t40 + k1 * t44 + k13 * t48 - k7 * t52 + k3 * t56 + k15 * t60 - k20 * t64;
+  const T t111 = k11 * t37 - k9 * t41 + k1 * t45 + k13 * t49 - k7 * t53 + k3 * t57 + k15 * t61 - k20 * t65;
+  const T t112 = t108 + t111;
+  const T t113 = t109 - t110;
+  const T t114 = t108 - t111;
+  const T t115 = t109 + t110;
+  const T t116 = t0 - k12 * t34 + k19 * t38 + k6 * t42 - k25 * t46 + k0 * t50 - k14 * t54 + k23 * t58 - k8 * t62;
+  const T t117 = t1 - k12 * t35 + k19 * t39 + k6 * t43 - k25 * t47 + k0 * t51 - k14 * t55 + k23 * t59 - k8 * t63;
+  const T t118 = k13 * t36 - k20 * t40 + k7 * t44 - k26 * t48 + k1 * t52 + k15 * t56 - k24 * t60 + k9 * t64;
+  const T t119 = k13 * t37 - k20 * t41 + k7 * t45 - k26 * t49 + k1 * t53 + k15 * t57 - k24 * t61 + k9 * t65;
+  const T t120 = t116 + t119;
+  const T t121 = t117 - t118;
+  const T t122 = t116 - t119;
+  const T t123 = t117 + t118;
+  const T t124 = t0 - k14 * t34 + k0 * t38 - k12 * t42 + k23 * t46 - k10 * t50 + k19 * t54 - k8 * t58 + k27 * t62;
+  const T t125 = t1 - k14 * t35 + k0 * t39 - k12 * t43 + k23 * t47 - k10 * t51 + k19 * t55 - k8 * t59 + k27 * t63;
+  const T t126 = k15 * t36 - k21 * t40 + k13 * t44 - k24 * t48 + k11 * t52 - k20 * t56 + k9 * t60 - k7 * t64;
+  const T t127 = k15 * t37 - k21 * t41 + k13 * t45 - k24 * t49 + k11 * t53 - k20 * t57 + k9 * t61 - k7 * t65;
+  const T t128 = t124 + t127;
+  const T t129 = t125 - t126;
+  const T t130 = t124 - t127;
+  const T t131 = t125 + t126;
+  out[0 * stride_out + 0] = t66;
+  out[0 * stride_out + 1] = t67;
+  out[2 * stride_out + 0] = t72;
+  out[2 * stride_out + 1] = t73;
+  out[4 * stride_out + 0] = t80;
+  out[4 * stride_out + 1] = t81;
+  out[6 * stride_out + 0] = t88;
+  out[6 * stride_out + 1] = t89;
+  out[8 * stride_out + 0] = t96;
+  out[8 * stride_out + 1] = t97;
+  out[10 * stride_out + 0] = t104;
+  out[10 * stride_out + 1] = t105;
+  out[12 * stride_out + 0] = t112;
+  out[12 * stride_out + 1] = t113;
+  out[14 * stride_out + 0] = t120;
+  out[14 * stride_out + 1] = t121;
+  out[16 * stride_out + 0] = t128;
+  out[16 * stride_out + 1] = t129;
+  out[18 * stride_out + 0] = t130;
+  out[18 * stride_out + 1] = t131;
+  out[20 * stride_out + 0] = t122;
+  out[20 * stride_out + 1] = t123;
+  out[22 * stride_out + 0] = t114;
+  out[22 * stride_out + 1] = t115;
+  out[24 * stride_out + 0] = t106;
+  out[24 * stride_out + 1] = t107;
+  out[26 * stride_out + 0] = t98;
+  out[26 * stride_out + 1] = t99;
+  out[28 * stride_out + 0] = t90;
+  out[28 * stride_out + 1] = t91;
+  out[30 * stride_out + 0] = t82;
+  out[30 * stride_out + 1] = t83;
+  out[32 * stride_out + 0] = t74;
+  out[32 * stride_out + 1] = t75;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 19 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_19(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9458172417006346);
+  constexpr T k1 = static_cast<T>(0.32469946920468346);
+  constexpr T k2 = static_cast<T>(0.7891405093963936);
+  constexpr T k3 = static_cast<T>(0.6142127126896678);
+  constexpr T k4 = static_cast<T>(0.5469481581224269);
+  constexpr T k5 = static_cast<T>(0.8371664782625285);
+  constexpr T k6 = static_cast<T>(0.24548548714079924);
+  constexpr T k7 = static_cast<T>(0.9694002659393304);
+  constexpr T k8 = static_cast<T>(0.08257934547233227);
+  constexpr T k9 = static_cast<T>(0.9965844930066698);
+  constexpr T k10 = static_cast<T>(0.4016954246529694);
+  constexpr T k11 = static_cast<T>(0.9157733266550574);
+  constexpr T k12 = static_cast<T>(0.6772815716257409);
+  constexpr T k13 = static_cast<T>(0.7357239106731318);
+  constexpr T k14 = static_cast<T>(0.879473751206489);
+  constexpr T k15 = static_cast<T>(0.4759473930370737);
+  constexpr T k16 = static_cast<T>(0.9863613034027223);
+  constexpr T k17 = static_cast<T>(0.16459459028073403);
+  constexpr T k18 = static_cast<T>(0.9863613034027224);
+  constexpr T k19 = static_cast<T>(0.16459459028073378);
+  constexpr T k20 = static_cast<T>(0.6772815716257411);
+  constexpr T k21 = static_cast<T>(0.7357239106731316);
+  constexpr T k22 = static_cast<T>(0.08257934547233274);
+  constexpr T k23 = static_cast<T>(0.5469481581224266);
+  constexpr T k24 = static_cast<T>(0.8371664782625288);
+  constexpr T k25 = static_cast<T>(0.32469946920468373);
+  constexpr T k26 = static_cast<T>(0.2454854871407988);
+  constexpr T k27 = static_cast<T>(0.9694002659393305);
+  constexpr T k28 = static_cast<T>(0.40169542465296904);
+  constexpr T k29 = static_cast<T>(0.9157733266550576);
+  constexpr T k30 = static_cast<T>(0.7891405093963939);
+  constexpr T k31 = static_cast<T>(0.6142127126896674);
+  constexpr T k32 = static_cast<T>(0.8794737512064893);
+  constexpr T k33 = static_cast<T>(0.4759473930370731);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = in[30 * stride_in + 0];
+  const T t31 = in[30 * stride_in + 1];
+  const T t32 = in[32 * stride_in + 0];
+  const T t33 = in[32 * stride_in + 1];
+  const T t34 = in[34 * stride_in + 0];
+  const T t35 = in[34 * stride_in + 1];
+  const T t36 = in[36 * stride_in + 0];
+  const T t37 = in[36 * stride_in + 1];
+  const T t38 = t2 + t36;
+  const T t39 = t3 + t37;
+  const T t40 = t2 - t36;
+  const T t41 = t3 - t37;
+  const T t42 = t4 + t34;
+  const T t43 = t5 + t35;
+  const T t44 = t4 - t34;
+  const T t45 = t5 - t35;
+  const T t46 = t6 + t32;
+  const T t47 = t7 + t33;
+  const T t48 = t6 - t32;
+  const T t49 = t7 - t33;
+  const T t50 = t8 + t30;
+  const T t51 = t9 + t31;
+  const T t52 = t8 - t30;
+  const T t53 = t9 - t31;
+  const T t54 = t10 + t28;
+  const T t55 = t11 + t29;
+  const T t56 = t10 - t28;
+  const T t57 = t11 - t29;
+  const T t58 = t12 + t26;
+  const T t59 = t13 + t27;
+  const T t60 = t12 - t26;
+  const T t61 = t13 - t27;
+  const T t62 = t14 + t24;
+  const T t63 = t15 + t25;
+  const T t64 = t14 - t24;
+  const T t65 = t15 - t25;
+  const T t66 = t16 + t22;
+  const T t67 = t17 + t23;
+  const T t68 = t16 - t22;
+  const T t69 = t17 - t23;
+  const T t70 = t18 + t20;
+  const T t71 = t19 + t21;
+  const T t72 = t18 - t20;
+  const T t73 = t19 - t21;
+  const T t74 = t0 + t38 + t42 + t46 + t50 + t54 + t58 + t62 + t66 + t70;
+  const T t75 = t1 + t39 + t43 + t47 + t51 + t55 + t59 + t63 + t67 + t71;
+  const T t76 = t0 + k0 * t38 + k2 * t42 + k4 * t46 + k6 * t50 - k8 * t54 - k10 * t58 - k12 * t62 - k14 * t66
+      - k16 * t70;
+  const T t77 = t1 + k0 * t39 + k2 * t43 + k4 * t47 + k6 * t51 - k8 * t55 - k10 * t59 - k12 * t63 - k14 * t67
+      - k16 * t71;
+  const T t78 = k1 * t40 + k3 * t44 + k5 * t48 + k7 * t52 + k9 * t56 + k11 * t60 + k13 * t64 + k15 * t68 + k17 * t72;
+  const T t79 = k1 * t41 + k3 * t45 + k5 * t49 + k7 * t53 + k9 * t57 + k11 * t61 + k13 * t65 + k15 * t69 + k17 * t73;
+  const T t80 = t76 + t79;
+  const T t81 = t77 - t78;
+  const T t82 = t76 - t79;
+  const T t83 = t77 + t78;
+  const T t84 = t0 + k2 * t38 + k6 * t42 - k10 * t46 - k14 * t50 - k18 * t54 - k20 * t58 - k22 * t62 + k23 * t66
+      + k0 * t70;
+  const T t85 = t1 + k2 * t39 + k6 * t43 - k10 * t47 - k14 * t51 - k18 * t55 - k20 * t59 - k22 * t63 + k23 * t67
+      + k0 * t71;
+  const T t86 = k3 * t40 + k7 * t44 + k11 * t48 + k15 * t52 - k19 * t56 - k21 * t60 - k9 * t64 - k24 * t68 - k25 * t72;
+  const T t87 = k3 * t41 + k7 * t45 + k11 * t49 + k15 * t53 - k19 * t57 - k21 * t61 - k9 * t65 - k24 * t69 - k25 * t73;
+  const T t88 = t84 + t87;
+  const T t89 = t85 - t86;
+  const T t90 = t84 - t87;
+  const T t91 = t85 + t86;
+  const T t92 = t0 + k4 * t38 - k10 * t42 - k16 * t46 - k20 * t50 + k26 * t54 + k0 * t58 + k2 * t62 - k8 * t66
+      - k14 * t70;
+  const T t93 = t1 + k4 * t39 - k10 * t43 - k16 * t47 - k20 * t51 + k26 * t55 + k0 * t59 + k2 * t63 - k8 * t67
+      - k14 * t71;
+  const T t94 = k5 * t40 + k11 * t44 + k17 * t48 - k21 * t52 - k27 * t56 - k25 * t60 + k3 * t64 + k9 * t68 + k15 * t72;
+  const T t95 = k5 * t41 + k11 * t45 + k17 * t49 - k21 * t53 - k27 * t57 - k25 * t61 + k3 * t65 + k9 * t69 + k15 * t73;
+  const T t96 = t92 + t95;
+  const T t97 = t93 - t94;
+  const T t98 = t92 - t95;
+  const T t99 = t93 + t94;
+  const T t100 = t0 + k6 * t38 - k14 * t42 - k20 * t46 + k23 * t50 + k0 * t54 - k8 * t58 - k16 * t62 - k28 * t66
+      + k30 * t70;
+  const T t101 = t1 + k6 * t39 - k14 * t43 - k20 * t47 + k23 * t51 + k0 * t55 - k8 * t59 - k16 * t63 - k28 * t67
+      + k30 * t71;
+  const T t102 = k7 * t40 + k15 * t44 - k21 * t48 - k24 * t52 + k1 * t56 + k9 * t60 + k17 * t64 - k29 * t68 - k31 * t72;
+  const T t103 = k7 * t41 + k15 * t45 - k21 * t49 - k24 * t53 + k1 * t57 + k9 * t61 + k17 * t65 - k29 * t69 - k31 * t73;
+  const T t104 = t100 + t103;
+  const T t105 = t101 - t102;
+  const T t106 = t100 - t103;
+  const T t107 = t101 + t102;
+  const T t108 = t0 - k8 * t38 - k18 * t42 + k26 * t46 + k0 * t50 - k10 * t54 - k32 * t58 + k23 * t62 + k2 * t66
+      - k12 * t70;
+  const T t109 = t1 - k8 * t39 - k18 * t43 + k26 * t47 + k0 * t51 - k10 * t55 - k32 * t59 + k23 * t63 + k2 * t67
+      - k12 * t71;
+  const T t110 = k9 * t40 - k19 * t44 - k27 * t48 + k1 * t52 + k11 * t56 - k33 * t60 - k24 * t64 + k3 * t68 + k13 * t72;
+  const T t111 = k9 * t41 - k19 * t45 - k27 * t49 + k1 * t53 + k11 * t57 - k33 * t61 - k24 * t65 + k3 * t69 + k13 * t73;
+  const T t112 = t108 + t111;
+  const T t113 = t109 - t110;
+  const T t114 = t108 - t111;
+  const T t115 = t109 + t110;
+  const T t116 = t0 - k10 * t38 - k20 * t42 + k0 * t46 - k8 * t50 - k32 * t54 + k30 * t58 + k6 * t62 - k18 * t66
+      + k23 * t70;
+  const T t117 = t1 - k10 * t39 - k20 * t43 + k0 * t47 - k8 * t51 - k32 * t55 + k30 * t59 + k6 * t63 - k18 * t67
+      + k23 * t71;
+  const T t118 = k11 * t40 - k21 * t44 - k25 * t48 + k9 * t52 - k33 * t56 - k31 * t60 + k7 * t64 - k19 * t68
+      - k24 * t72;
+  const T t119 = k11 * t41 - k21 * t45 - k25 * t49 + k9 * t53 - k33 * t57 - k31 * t61 + k7 * t65 - k19 * t69
+      - k24 * t73;
+  const T t120 = t116 + t119;
+  const T t121 = t117 - t118;
+  const T t122 = t116 - t119;
+  const T t123 = t117 + t118;
+  const T t124 = t0 - k12 * t38 - k22 * t42 + k2 * t46 - k16 * t50 + k23 * t54 + k6 * t58 - k32 * t62 + k0 * t66
+      - k10 * t70;
+  const T t125 = t1 - k12 * t39 - k22 * t43 + k2 * t47 - k16 * t51 + k23 * t55 + k6 * t59 - k32 * t63 + k0 * t67
+      - k10 * t71;
+  const T t126 = k13 * t40 - k9 * t44 + k3 * t48 + k17 * t52 - k24 * t56 + k7 * t60 - k33 * t64 - k25 * t68 + k11 * t72;
+  const T t127 = k13 * t41 - k9 * t45 + k3 * t49 + k17 * t53 - k24 * t57 + k7 * t61 - k33 * t65 - k25 * t69 + k11 * t73;
+  const T t128 = t124 + t127;
+  const T t129 = t125 - t126;
+  const T t130 = t124 - t127;
+  const T t131 = t125 + t126;
+  const T t132 = t0 - k14 * t38 + k23 * t42 - k8 * t46 - k28 * t50 + k2 * t54 - k18 * t58 + k0 * t62 - k12 * t66
+      + k26 * t70;
+  const T t133 = t1 - k14 * t39 + k23 * t43 - k8 * t47 - k28 * t51 + k2 * t55 - k18 * t59 + k0 * t63 - k12 * t67
+      + k26 * t71;
+  const T t134 = k15 * t40 - k24 * t44 + k9 * t48 - k29 * t52 + k3 * t56 - k19 * t60 - k25 * t64 + k13 * t68
+      - k27 * t72;
+  const T t135 = k15 * t41 - k24 * t45 + k9 * t49 - k29 * t53 + k3 * t57 - k19 * t61 - k25 * t65 + k13 * t69
+      - k27 * t73;
+  const T t136 = t132 + t135;
+  const T t137 = t133 - t134;
+  const T t138 = t132 - t135;
+  const T t139 = t133 + t134;
+  const T t140 = t0 - k16 * t38 + k0 * t42 - k14 * t46 + k30 * t50 - k12 * t54 + k23 * t58 - k10 * t62 + k26 * t66
+      - k8 * t70;
+  const T t141 = t1 - k16 * t39 + k0 * t43 - k14 * t47 + k30 * t51 - k12 * t55 + k23 * t59 - k10 * t63 + k26 * t67
+      - k8 * t71;
+  const T t142 = k17 * t40 - k25 * t44 + k15 * t48 - k31 * t52 + k13 * t56 - k24 * t60 + k11 * t64 - k27 * t68
+      + k9 * t72;
+  const T t143 = k17 * t41 - k25 * t45 + k15 * t49 - k31 * t53 + k13 * t57 - k24 * t61 + k11 * t65 - k27 * t69
+      + k9 * t73;
+  const T t144 = t140 + t143;
+  const T t145 = t141 - t142;
+  const T t146 = t140 - t143;
+  const T t147 = t141 + t142;
+  out[0 * stride_out + 0] = t74;
+  out[0 * stride_out + 1] = t75;
+  out[2 * stride_out + 0] = t80;
+  out[2 * stride_out + 1] = t81;
+  out[4 * stride_out + 0] = t88;
+  out[4 * stride_out + 1] = t89;
+  out[6 * stride_out + 0] = t96;
+  out[6 * stride_out + 1] = t97;
+  out[8 * stride_out + 0] = t104;
+  out[8 * stride_out + 1] = t105;
+  out[10 * stride_out + 0] = t112;
+  out[10 * stride_out + 1] = t113;
+  out[12 * stride_out + 0] = t120;
+  out[12 * stride_out + 1] = t121;
+  out[14 * stride_out + 0] = t128;
+  out[14 * stride_out + 1] = t129;
+  out[16 * stride_out + 0] = t136;
+  out[16 * stride_out + 1] = t137;
+  out[18 * stride_out + 0] = t144;
+  out[18 * stride_out + 1] = t145;
+  out[20 * stride_out + 0] = t146;
+  out[20 * stride_out + 1] = t147;
+  out[22 * stride_out + 0] = t138;
+  out[22 * stride_out + 1] = t139;
+  out[24 * stride_out + 0] = t130;
+  out[24 * stride_out + 1] = t131;
+  out[26 * stride_out + 0] = t122;
+  out[26 * stride_out + 1] = t123;
+  out[28 * stride_out + 0] = t114;
+  out[28 * stride_out + 1] = t115;
+  out[30 * stride_out + 0] = t106;
+  out[30 * stride_out + 1] = t107;
+  out[32 * stride_out + 0] = t98;
+  out[32 * stride_out + 1] = t99;
+  out[34 * stride_out + 0] = t90;
+  out[34 * stride_out + 1] = t91;
+  out[36 * stride_out + 0] = t82;
+  out[36 * stride_out + 1] = t83;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 23 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_23(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9629172873477992);
+  constexpr T k1 = static_cast<T>(0.2697967711570243);
+  constexpr T k2 = static_cast<T>(0.8544194045464886);
+  constexpr T k3 = static_cast<T>(0.5195839500354336);
+  constexpr T k4 = static_cast<T>(0.6825531432186541);
+  constexpr T k5 = static_cast<T>(0.730835964278124);
+  constexpr T k6 = static_cast<T>(0.4600650377311522);
+  constexpr T k7 = static_cast<T>(0.8878852184023752);
+  constexpr T k8 = static_cast<T>(0.20345601305263375);
+  constexpr T k9 = static_cast<T>(0.9790840876823229);
+  constexpr T k10 = static_cast<T>(0.06824241336467088);
+  constexpr T k11 = static_cast<T>(0.9976687691905392);
+  constexpr T k12 = static_cast<T>(0.33487961217098616);
+  constexpr T k13 = static_cast<T>(0.9422609221188205);
+  constexpr T k14 = static_cast<T>(0.5766803221148671);
+  constexpr T k15 = static_cast<T>(0.8169698930104421);
+  constexpr T k16 = static_cast<T>(0.7757112907044197);
+  constexpr T k17 = static_cast<T>(0.631087944326053);
+  constexpr T k18 = static_cast<T>(0.917211301505453);
+  constexpr T k19 = static_cast<T>(0.3984010898462414);
+  constexpr T k20 = static_cast<T>(0.9906859460363306);
+  constexpr T k21 = static_cast<T>(0.1361666490962471);
+  constexpr T k22 = static_cast<T>(0.9906859460363308);
+  constexpr T k23 = static_cast<T>(0.1361666490962464);
+  constexpr T k24 = static_cast<T>(0.7757112907044198);
+  constexpr T k25 = static_cast<T>(0.6310879443260528);
+  constexpr T k26 = static_cast<T>(0.3348796121709864);
+  constexpr T k27 = static_cast<T>(0.9422609221188204);
+  constexpr T k28 = static_cast<T>(0.2034560130526333);
+  constexpr T k29 = static_cast<T>(0.979084087682323);
+  constexpr T k30 = static_cast<T>(0.6825531432186542);
+  constexpr T k31 = static_cast<T>(0.962917287347799);
+  constexpr T k32 = static_cast<T>(0.2697967711570252);
+  constexpr T k33 = static_cast<T>(0.5766803221148672);
+  constexpr T k34 = static_cast<T>(0.816969893010442);
+  constexpr T k35 = static_cast<T>(0.9172113015054529);
+  constexpr T k36 = static_cast<T>(0.39840108984624156);
+  constexpr T k37 = static_cast<T>(0.06824241336467046);
+  constexpr T k38 = static_cast<T>(0.9976687691905393);
+  constexpr T k39 = static_cast<T>(0.4600650377311516);
+  constexpr T k40 = static_cast<T>(0.8878852184023756);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = in[30 * stride_in + 0];
+  const T t31 = in[30 * stride_in + 1];
+  const T t32 = in[32 * stride_in + 0];
+  const T t33 = in[32 * stride_in + 1];
+  const T t34 = in[34 * stride_in + 0];
+  const T t35 = in[34 * stride_in + 1];
+  const T t36 = in[36 * stride_in + 0];
+  const T t37 = in[36 * stride_in + 1];
+  const T t38 = in[38 * stride_in + 0];
+  const T t39 = in[38 * stride_in + 1];
+  const T t40 = in[40 * stride_in + 0];
+  const T t41 = in[40 * stride_in + 1];
+  const T t42 = in[42 * stride_in + 0];
+  const T t43 = in[42 * stride_in + 1];
+  const T t44 = in[44 * stride_in + 0];
+  const T t45 = in[44 * stride_in + 1];
+  const T t46 = t2 + t44;
+  const T t47 = t3 + t45;
+  const T t48 = t2 - t44;
+  const T t49 = t3 - t45;
+  const T t50 = t4 + t42;
+  const T t51 = t5 + t43;
+  const T t52 = t4 - t42;
+  const T t53 = t5 - t43;
+  const T t54 = t6 + t40;
+  const T t55 = t7 + t41;
+  const T t56 = t6 - t40;
+  const T t57 = t7 - t41;
+  const T t58 = t8 + t38;
+  const T t59 = t9 + t39;
+  const T t60 = t8 - t38;
+  const T t61 = t9 - t39;
+  const T t62 = t10 + t36;
+  const T t63 = t11 + t37;
+  const T t64 = t10 - t36;
+  const T t65 = t11 - t37;
+  const T t66 = t12 + t34;
+  const T t67 = t13 + t35;
+  const T t68 = t12 - t34;
+  const T t69 = t13 - t35;
+  const T t70 = t14 + t32;
+  const T t71 = t15 + t33;
+  const T t72 = t14 - t32;
+  const T t73 = t15 - t33;
+  const T t74 = t16 + t30;
+  const T t75 = t17 + t31;
+  const T t76 = t16 - t30;
+  const T t77 = t17 - t31;
+  const T t78 = t18 + t28;
+  const T t79 = t19 + t29;
+  const T t80 = t18 - t28;
+  const T t81 = t19 - t29;
+  const T t82 = t20 + t26;
+  const T t83 = t21 + t27;
+  const T t84 = t20 - t26;
+  const T t85 = t21 - t27;
+  const T t86 = t22 + t24;
+  const T t87 = t23 + t25;
+  const T t88 = t22 - t24;
+  const T t89 = t23 - t25;
+  const T t90 = t0 + t46 + t50 + t54 + t58 + t62 + t66 + t70 + t74 + t78 + t82 + t86;
+  const T t91 = t1 + t47 + t51 + t55 + t59 + t63 + t67 + t71 + t75 + t79 + t83 + t87;
+  const T t92 = t0 + k0 * t46 + k2 * t50 + k4 * t54 + k6 * t58 + k8 * t62 - k10 * t66 - k12 * t70 - k14 * t74
+      - k16 * t78 - k18 * t82 - k20 * t86;
+  const T t93 = t1 + k0 * t47 + k2 * t51 + k4 * t55 + k6 * t59 + k8 * t63 - k10 * t67 - k12 * t71 - k14 * t75
+      - k16 * t79 - k18 * t83 - k20 * t87;
+  const T t94 = k1 * t48 + k3 * t52 + k5 * t56 + k7 * t60 + k9 * t64 + k11 * t68 + k13 * t72 + k15 * t76 + k17 * t80
+      + k19 * t84 + k21 * t88;
+  const T t95 = k1 * t49 + k3 * t53 + k5 * t57 + k7 * t61 + k9 * t65 + k11 * t69 + k13 * t73 + k15 * t77 + k17 * t81
+      + k19 * t85 + k21 * t89;
+  const T t96 = t92 + t95;
+  const T t97 = t93 - t94;
+  const T t98 = t92 - t95;
+  const T t99 = t93 + t94;
+  const T t100 = t0 + k2 * t46 + k6 * t50 - k10 * t54 - k14 * t58 - k18 * t62 - k22 * t66 - k24 * t70 - k26 * t74
+      + k28 * t78 + k30 * t82 + k31 * t86;
+  const T t101 = t1 + k2 * t47 + k6 * t51 - k10 * t55 - k14 * t59 - k18 * t63 - k22 * t67 - k24 * t71 - k26 * t75
+      + k28 * t79 + k30 * t83 + k31 * t87;
+  const T t102 = k3 * t48 + k7 * t52 + k11 * t56 + k15 * t60 + k19 * t64 - k23 * t68 - k25 * t72 - k27 * t76
+      - k29 * t80 - k5 * t84 - k32 * t88;
+  const T t103 = k3 * t49 + k7 * t53 + k11 * t57 + k15 * t61 + k19 * t65 - k23 * t69 - k25 * t73 - k27 * t77
+      - k29 * t81 - k5 * t85 - k32 * t89;
+  const T t104 = t100 + t103;
+  const T t105 = t101 - t102;
+  const T t106 = t100 - t103;
+  const T t107 = t101 + t102;
+  const T t108 = t0 + k4 * t46 - k10 * t50 - k16 * t54 - k22 * t58 - k33 * t62 + k28 * t66 + k2 * t70 + k0 * t74
+      + k6 * t78 - k12 * t82 - k18 * t86;
+  const T t109 = t1 + k4 * t47 - k10 * t51 - k16 * t55 - k22 * t59 - k33 * t63 + k28 * t67 + k2 * t71 + k0 * t75
+      + k6 * t79 - k12 * t83 - k18 * t87;
+  const T t110 = k5 * t48 + k11 * t52 + k17 * t56 - k23 * t60 - k34 * t64 - k29 * t68 - k3 * t72 + k1 * t76
+      + k7 * t80 + k13 * t84 + k19 * t88;
+  const T t111 = k5 * t49 + k11 * t53 + k17 * t57 - k23 * t61 - k34 * t65 - k29 * t69 - k3 * t73 + k1 * t77
+      + k7 * t81 + k13 * t85 + k19 * t89;
+  const T t112 = t108 + t111;
+  const T t113 = t109 - t110;
+  const T t114 = t108 - t111;
+  const T t115 = t109 + t110;
+  const T t116 = t0 + k6 * t46 - k14 * t50 - k22 * t54 - k26 * t58 + k30 * t62 + k0 * t66 + k8 * t70 - k16 * t74
+      - k35 * t78 - k37 * t82 + k2 * t86;
+  const T t117 = t1 + k6 * t47 - k14 * t51 - k22 * t55 - k26 * t59 + k30 * t63 + k0 * t67 + k8 * t71 - k16 * t75
+      - k35 * t79 - k37 * t83 + k2 * t87;
+  const T t118 = k7 * t48 + k15 * t52 - k23 * t56 - k27 * t60 - k5 * t64 + k1 * t68 + k9 * t72 + k17 * t76
+      - k36 * t80 - k38 * t84 - k3 * t88;
+  const T t119 = k7 * t49 + k15 * t53 - k23 * t57 - k27 * t61 - k5 * t65 + k1 * t69 + k9 * t73 + k17 * t77
+      - k36 * t81 - k38 * t85 - k3 * t89;
+  const T t120 = t116 + t119;
+  const T t121 = t117 - t118;
+  const T t122 = t116 - t119;
+  const T t123 = t117 + t118;
+  const T t124 = t0 + k8 * t46 - k18 * t50 - k33 * t54 + k30 * t58 + k2 * t62 - k12 * t66 - k22 * t70 - k37 * t74
+      + k31 * t78 + k6 * t82 - k16 * t86;
+  const T t125 = t1 + k8 * t47 - k18 * t51 - k33 * t55 + k30 * t59 + k2 * t63 - k12 * t67 - k22 * t71 - k37 * t75
+      + k31 * t79 + k6 * t83 - k16 * t87;
+  const T t126 = k9 * t48 + k19 * t52 - k34 * t56 - k5 * t60 + k3 * t64 + k13 * t68 - k23 * t72 - k38 * t76
+      - k32 * t80 + k7 * t84 + k17 * t88;
+  const T t127 = k9 * t49 + k19 * t53 - k34 * t57 - k5 * t61 + k3 * t65 + k13 * t69 - k23 * t73 - k38 * t77
+      - k32 * t81 + k7 * t85 + k17 * t89;
+  const T t128 = t124 + t127;
+  const T t129 = t125 - t126;
+  const T t130 = t124 - t127;
+  const T t131 = t125 + t126;
+  const T t132 = t0 - k10 * t46 - k22 * t50 + k28 * t54 + k0 * t58 - k12 * t62 - k35 * t66 + k39 * t70 + k2 * t74
+      - k14 * t78 - k24 * t82 + k30 * t86;
+  const T t133 = t1 - k10 * t47 - k22 * t51 + k28 * t55 + k0 * t59 - k12 * t63 - k35 * t67 + k39 * t71 + k2 * t75
+      - k14 * t79 - k24 * t83 + k30 * t87;
+  const T t134 = k11 * t48 - k23 * t52 - k29 * t56 + k1 * t60 + k13 * t64 - k36 * t68 - k40 * t72 + k3 * t76
+      + k15 * t80 - k25 * t84 - k5 * t88;
+  const T t135 = k11 * t49 - k23 * t53 - k29 * t57 + k1 * t61 + k13 * t65 - k36 * t69 - k40 * t73 + k3 * t77
+      + k15 * t81 - k25 * t85 - k5 * t89;
+  const T t136 = t132 + t135;
+  const T t137 = t133 - t134;
+  const T t138 = t132 - t135;
+  const T t139 = t133 + t134;
+  const T t140 = t0 - k12 * t46 - k24 * t50 + k2 * t54 + k8 * t58 - k22 * t62 + k39 * t66 + k4 * t70 - k18 * t74
+      - k37 * t78 + k0 * t82 - k14 * t86;
+  const T t141 = t1 - k12 * t47 - k24 * t51 + k2 * t55 + k8 * t59 - k22 * t63 + k39 * t67 + k4 * t71 - k18 * t75
+      - k37 * t79 + k0 * t83 - k14 * t87;
+  const T t142 = k13 * t48 - k25 * t52 - k3 * t56 + k9 * t60 - k23 * t64 - k40 * t68 + k5 * t72 + k19 * t76
+      - k38 * t80 + k1 * t84 + k15 * t88;
+  const T t143 = k13 * t49 - k25 * t53 - k3 * t57 + k9 * t61 - k23 * t65 - k40 * t69 + k5 * t73 + k19 * t77
+      - k38 * t81 + k1 * t85 + k15 * t89;
+  const T t144 = t140 + t143;
+  const T t145 = t141 - t142;
+  const T t146 = t140 - t143;
+  const T t147 = t141 + t142;
+  const T t148 = t0 - k14 * t46 - k26 * t50 + k0 * t54 - k16 * t58 - k37 * t62 + k2 * t66 - k18 * t70 + k28 * t74
+      + k4 * t78 - k20 * t82 + k39 * t86;
+  const T t149 = t1 - k14 * t47 - k26 * t51 + k0 * t55 - k16 * t59 - k37 * t63 + k2 * t67 - k18 * t71 + k28 * t75
+      + k4 * t79 - k20 * t83 + k39 * t87;
+  const T t150 = k15 * t48 - k27 * t52 + k1 * t56 + k17 * t60 - k38 * t64 + k3 * t68 + k19 * t72 - k29 * t76
+      + k5 * t80 + k21 * t84 - k40 * t88;
+  const T t151 = k15 * t49 - k27 * t53 + k1 * t57 + k17 * t61 - k38 * t65 + k3 * t69 + k19 * t73 - k29 * t77
+      + k5 * t81 + k21 * t85 - k40 * t89;
+  const T t152 = t148 + t151;
+  const T t153 = t149 - t150;
+  const T t154 = t148 - t151;
+  const T t155 = t149 + t150;
+  const T t156 = t0 - k16 * t46 + k28 * t50 + k6 * t54 - k35 * t58 + k31 * t62 - k14 * t66 - k37 * t70 + k4 * t74
+      - k22 * t78 + k2 * t82 - k12 * t86;
+  const T t157 = t1 - k16 * t47 + k28 * t51 + k6 * t55 - k35 * t59 + k31 * t63 - k14 * t67 - k37 * t71 + k4 * t75
+      - k22 * t79 + k2 * t83 - k12 * t87;
+  const T t158 = k17 * t48 - k29 * t52 + k7 * t56 - k36 * t60 - k32 * t64 + k15 * t68 - k38 * t72 + k5 * t76
+      - k23 * t80 - k3 * t84 + k13 * t88;
+  const T t159 = k17 * t49 - k29 * t53 + k7 * t57 - k36 * t61 - k32 * t65 + k15 * t69 - k38 * t73 + k5 * t77
+      - k23 * t81 - k3 * t85 + k13 * t89;
+  const T t160 = t156 + t159;
+  const T t161 = t157 - t158;
+  const T t162 = t156 - t159;
+  const T t163 = t157 + t158;
+  const T t164 = t0 - k18 * t46 + k30 * t50 - k12 * t54 - k37 * t58 + k6 * t62 - k24 * t66 + k0 * t70 - k20 * t74
+      + k2 * t78 - k14 * t82 + k28 * t86;
+  const T t165 = t1 - k18 * t47 + k30 * t51 - k12 * t55 - k37 * t59 + k6 * t63 - k24 * t67 + k0 * t71 - k20 * t75
+      + k2 * t79 - k14 * t83 + k28 * t87;
+  const T t166 = k19 * t48 - k5 * t52 + k13 * t56 - k38 * t60 + k7 * t64 - k25 * t68 + k1 * t72 + k21 * t76
+      - k3 * t80 + k15 * t84 - k29 * t88;
+  const T t167 = k19 * t49 - k5 * t53 + k13 * t57 - k38 * t61 + k7 * t65 - k25 * t69 + k1 * t73 + k21 * t77
+      - k3 * t81 + k15 * t85 - k29 * t89;
+  const T t168 = t164 + t167;
+  const T t169 = t165 - t166;
+  const T t170 = t164 - t167;
+  const T t171 = t165 + t166;
+  const T t172 = t0 - k20 * t46 + k31 * t50 - k18 * t54 + k2 * t58 - k16 * t62 + k30 * t66 - k14 * t70 + k39 * t74
+      - k12 * t78 + k28 * t82 - k10 * t86;
+  const T t173 = t1 - k20 * t47 + k31 * t51 - k18 * t55 + k2 * t59 - k16 * t63 + k30 * t67 - k14 * t71 + k39 * t75
+      - k12 * t79 + k28 * t83 - k10 * t87;
+  const T t174 = k21 * t48 - k32 * t52 + k19 * t56 - k3 * t60 + k17 * t64 - k5 * t68 + k15 * t72 - k40 * t76
+      + k13 * t80 - k29 * t84 + k11 * t88;
+  const T t175 = k21 * t49 - k32 * t53 + k19 * t57 - k3 * t61 + k17 * t65 - k5 * t69 + k15 * t73 - k40 * t77
+      + k13 * t81 - k29 * t85 + k11 * t89;
+  const T t176 = t172 + t175;
+  const T t177 = t173 - t174;
+  const T t178 = t172 - t175;
+  const T t179 = t173 + t174;
+  out[0 * stride_out + 0] = t90;
+  out[0 * stride_out + 1] = t91;
+  out[2 * stride_out + 0] = t96;
+  out[2 * stride_out + 1] = t97;
+  out[4 * stride_out + 0] = t104;
+  out[4 * stride_out + 1] = t105;
+  out[6 * stride_out + 0] = t112;
+  out[6 * stride_out + 1] = t113;
+  out[8 * stride_out + 0] = t120;
+  out[8 * stride_out + 1] = t121;
+  out[10 * stride_out + 0] = t128;
+  out[10 * stride_out + 1] = t129;
+  out[12 * stride_out + 0] = t136;
+  out[12 * stride_out + 1] = t137;
+  out[14 * stride_out + 0] = t144;
+  out[14 * stride_out + 1] = t145;
+  out[16 * stride_out + 0] = t152;
+  out[16 * stride_out + 1] = t153;
+  out[18 * stride_out + 0] = t160;
+  out[18 * stride_out + 1] = t161;
+  out[20 * stride_out + 0] = t168;
+  out[20 * stride_out + 1] = t169;
+  out[22 * stride_out + 0] = t176;
+  out[22 * stride_out + 1] = t177;
+  out[24 * stride_out + 0] = t178;
+  out[24 * stride_out + 1] = t179;
+  out[26 * stride_out + 0] = t170;
+  out[26 * stride_out + 1] = t171;
+  out[28 * stride_out + 0] = t162;
+  out[28 * stride_out + 1] = t163;
+  out[30 * stride_out + 0] = t154;
+  out[30 * stride_out + 1] = t155;
+  out[32 * stride_out + 0] = t146;
+  out[32 * stride_out + 1] = t147;
+  out[34 * stride_out + 0] = t138;
+  out[34 * stride_out + 1] = t139;
+  out[36 * stride_out + 0] = t130;
+  out[36 * stride_out + 1] = t131;
+  out[38 * stride_out + 0] = t122;
+  out[38 * stride_out + 1] = t123;
+  out[40 * stride_out + 0] = t114;
+  out[40 * stride_out + 1] = t115;
+  out[42 * stride_out + 0] = t106;
+  out[42 * stride_out + 1] = t107;
+  out[44 * stride_out + 0] = t98;
+  out[44 * stride_out + 1] = t99;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 29 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_29(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9766205557100867);
+  constexpr T k1 = static_cast<T>(0.21497044021102407);
+  constexpr T k2 = static_cast<T>(0.907575419670957);
+  constexpr T k3 = static_cast<T>(0.4198891015602646);
+  constexpr T k4 = static_cast<T>(0.7960930657056438);
+  constexpr T k5 = static_cast<T>(0.6051742151937652);
+  constexpr T k6 = static_cast<T>(0.6473862847818277);
+  constexpr T k7 = static_cast<T>(0.7621620551276365);
+  constexpr T k8 = static_cast<T>(0.46840844069979015);
+  constexpr T k9 = static_cast<T>(0.8835120444460229);
+  constexpr T k10 = static_cast<T>(0.26752833852922075);
+  constexpr T k11 = static_cast<T>(0.963549992519223);
+  constexpr T k12 = static_cast<T>(0.05413890858541761);
+  constexpr T k13 = static_cast<T>(0.9985334138511238);
+  constexpr T k14 = static_cast<T>(0.16178199655276473);
+  constexpr T k15 = static_cast<T>(0.9868265225415261);
+  constexpr T k16 = static_cast<T>(0.37013815533991423);
+  constexpr T k17 = static_cast<T>(0.9289767198167915);
+  constexpr T k18 = static_cast<T>(0.5611870653623823);
+  constexpr T k19 = static_cast<T>(0.8276889981568906);
+  constexpr T k20 = static_cast<T>(0.7259954919231306);
+  constexpr T k21 = static_cast<T>(0.6876994588534235);
+  constexpr T k22 = static_cast<T>(0.8568571761675893);
+  constexpr T k23 = static_cast<T>(0.5155538571770216);
+  constexpr T k24 = static_cast<T>(0.9476531711828025);
+  constexpr T k25 = static_cast<T>(0.3193015301359798);
+  constexpr T k26 = static_cast<T>(0.9941379571543596);
+  constexpr T k27 = static_cast<T>(0.10811901842394192);
+  constexpr T k28 = static_cast<T>(0.31930153013597995);
+  constexpr T k29 = static_cast<T>(0.7259954919231311);
+  constexpr T k30 = static_cast<T>(0.6876994588534231);
+  constexpr T k31 = static_cast<T>(0.37013815533991445);
+  constexpr T k32 = static_cast<T>(0.9289767198167914);
+  constexpr T k33 = static_cast<T>(0.0541389085854167);
+  constexpr T k34 = static_cast<T>(0.9985334138511239);
+  constexpr T k35 = static_cast<T>(0.4684084406997903);
+  constexpr T k36 = static_cast<T>(0.8835120444460228);
+  constexpr T k37 = static_cast<T>(0.796093065705644);
+  constexpr T k38 = static_cast<T>(0.6051742151937649);
+  constexpr T k39 = static_cast<T>(0.21497044021102438);
+  constexpr T k40 = static_cast<T>(0.9941379571543597);
+  constexpr T k41 = static_cast<T>(0.10811901842394124);
+  constexpr T k42 = static_cast<T>(0.16178199655276476);
+  constexpr T k43 = static_cast<T>(0.9075754196709569);
+  constexpr T k44 = static_cast<T>(0.41988910156026493);
+  constexpr T k45 = static_cast<T>(0.5611870653623825);
+  constexpr T k46 = static_cast<T>(0.8276889981568905);
+  constexpr T k47 = static_cast<T>(0.2675283385292201);
+  constexpr T k48 = static_cast<T>(0.9635499925192231);
+  constexpr T k49 = static_cast<T>(0.6473862847818279);
+  constexpr T k50 = static_cast<T>(0.7621620551276362);
+  constexpr T k51 = static_cast<T>(0.8568571761675892);
+  constexpr T k52 = static_cast<T>(0.5155538571770218);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = in[30 * stride_in + 0];
+  const T t31 = in[30 * stride_in + 1];
+  const T t32 = in[32 * stride_in + 0];
+  const T t33 = in[32 * stride_in + 1];
+  const T t34 = in[34 * stride_in + 0];
+  const T t35 = in[34 * stride_in + 1];
+  const T t36 = in[36 * stride_in + 0];
+  const T t37 = in[36 * stride_in + 1];
+  const T t38 = in[38 * stride_in + 0];
+  const T t39 = in[38 * stride_in + 1];
+  const T t40 = in[40 * stride_in + 0];
+  const T t41 = in[40 * stride_in + 1];
+  const T t42 = in[42 * stride_in + 0];
+  const T t43 = in[42 * stride_in + 1];
+  const T t44 = in[44 * stride_in + 0];
+  const T t45 = in[44 * stride_in + 1];
+  const T t46 = in[46 * stride_in + 0];
+  const T t47 = in[46 * stride_in + 1];
+  const T t48 = in[48 * stride_in + 0];
+  const T t49 = in[48 * stride_in + 1];
+  const T t50 = in[50 * stride_in + 0];
+  const T t51 = in[50 * stride_in + 1];
+  const T t52 = in[52 * stride_in + 0];
+  const T t53 = in[52 * stride_in + 1];
+  const T t54 = in[54 * stride_in + 0];
+  const T t55 = in[54 * stride_in + 1];
+  const T t56 = in[56 * stride_in + 0];
+  const T t57 = in[56 * stride_in + 1];
+  const T t58 = t2 + t56;
+  const T t59 = t3 + t57;
+  const T t60 = t2 - t56;
+  const T t61 = t3 - t57;
+  const T t62 = t4 + t54;
+  const T t63 = t5 + t55;
+  const T t64 = t4 - t54;
+  const T t65 = t5 - t55;
+  const T t66 = t6 + t52;
+  const T t67 = t7 + t53;
+  const T t68 = t6 - t52;
+  const T t69 = t7 - t53;
+  const T t70 = t8 + t50;
+  const T t71 = t9 + t51;
+  const T t72 = t8 - t50;
+  const T t73 = t9 - t51;
+  const T t74 = t10 + t48;
+  const T t75 = t11 + t49;
+  const T t76 = t10 - t48;
+  const T t77 = t11 - t49;
+  const T t78 = t12 + t46;
+  const T t79 = t13 + t47;
+  const T t80 = t12 - t46;
+  const T t81 = t13 - t47;
+  const T t82 = t14 + t44;
+  const T t83 = t15 + t45;
+  const T t84 = t14 - t44;
+  const T t85 = t15 - t45;
+  const T t86 = t16 + t42;
+  const T t87 = t17 + t43;
+  const T t88 = t16 - t42;
+  const T t89 = t17 - t43;
+  const T t90 = t18 + t40;
+  const T t91 = t19 + t41;
+  const T t92 = t18 - t40;
+  const T t93 = t19 - t41;
+  const T t94 = t20 + t38;
+  const T t95 = t21 + t39;
+  const T t96 = t20 - t38;
+  const T t97 = t21 - t39;
+  const T t98 = t22 + t36;
+  const T t99 = t23 + t37;
+  const T t100 = t22 - t36;
+  const T t101 = t23 - t37;
+  const T t102 = t24 + t34;
+  const T t103 = t25 + t35;
+  const T t104 = t24 - t34;
+  const T t105 = t25 - t35;
+  const T t106 = t26 + t32;
+  const T t107 = t27 + t33;
+  const T t108 = t26 - t32;
+  const T t109 = t27 - t33;
+  const T t110 = t28 + t30;
+  const T t111 = t29 + t31;
+  const T t112 = t28 - t30;
+  const T t113 = t29 - t31;
+  const T t114 = t0 + t58 + t62 + t66 + t70 + t74 + t78 + t82 + t86 + t90 + t94 + t98 + t102 + t106 + t110;
+  const T t115 = t1 + t59 + t63 + t67 + t71 + t75 + t79 + t83 + t87 + t91 + t95 + t99 + t103 + t107 + t111;
+  const T t116 = t0 + k0 * t58 + k2 * t62 + k4 * t66 + k6 * t70 + k8 * t74 + k10 * t78 + k12 * t82 - k14 * t86
+      - k16 * t90 - k18 * t94 - k20 * t98 - k22 * t102 - k24 * t106 - k26 * t110;
+  const T t117 = t1 + k0 * t59 + k2 * t63 + k4 * t67 + k6 * t71 + k8 * t75 + k10 * t79 + k12 * t83 - k14 * t87
+      - k16 * t91 - k18 * t95 - k20 * t99 - k22 * t103 - k24 * t107 - k26 * t111;
+  const T t118 = k1 * t60 + k3 * t64 + k5 * t68 + k7 * t72 + k9 * t76 + k11 * t80 + k13 * t84 + k15 * t88 + k17 * t92
+      + k19 * t96 + k21 * t100 + k23 * t104 + k25 * t108 + k27 * t112;
+  const T t119 = k1 * t61 + k3 * t65 + k5 * t69 + k7 * t73 + k9 * t77 + k11 * t81 + k13 * t85 + k15 * t89 + k17 * t93
+      + k19 * t97 + k21 * t101 + k23 * t105 + k25 * t109 + k27 * t113;
+  const T t120 = t116 + t119;
+  const T t121 = t117 - t118;
+  const T t122 = t116 - t119;
+  const T t123 = t117 + t118;
+  const T t124 = t0 + k2 * t58 + k6 * t62 + k10 * t66 - k14 * t70 - k18 * t74 - k22 * t78 - k26 * t82 - k24 * t86
+      - k29 * t90 - k31 * t94 + k33 * t98 + k35 * t102 + k37 * t106 + k0 * t110;
+  const T t125 = t1 + k2 * t59 + k6 * t63 + k10 * t67 - k14 * t71 - k18 * t75 - k22 * t79 - k26 * t83 - k24 * t87
+      - k29 * t91 - k31 * t95 + k33 * t99 + k35 * t103 + k37 * t107 + k0 * t111;
+  const T t126 = k3 * t60 + k7 * t64 + k11 * t68 + k15 * t72 + k19 * t76 + k23 * t80 + k27 * t84 - k28 * t88
+      - k30 * t92 - k32 * t96 - k34 * t100 - k36 * t104 - k38 * t108 - k39 * t112;
+  const T t127 = k3 * t61 + k7 * t65 + k11 * t69 + k15 * t73 + k19 * t77 + k23 * t81 + k27 * t85 - k28 * t89
+      - k30 * t93 - k32 * t97 - k34 * t101 - k36 * t105 - k38 * t109 - k39 * t113;
+  const T t128 = t124 + t127;
+  const T t129 = t125 - t126;
+  const T t130 = t124 - t127;
+  const T t131 = t125 + t126;
+  const T t132 = t0 + k4 * t58 + k10 * t62 - k16 * t66 - k22 * t70 - k40 * t74 - k29 * t78 - k42 * t82 + k35 * t86
+      + k43 * t90 + k0 * t94 + k6 * t98 + k12 * t102 - k18 * t106 - k24 * t110;
+  const T t133 = t1 + k4 * t59 + k10 * t63 - k16 * t67 - k22 * t71 - k40 * t75 - k29 * t79 - k42 * t83 + k35 * t87
+      + k43 * t91 + k0 * t95 + k6 * t99 + k12 * t103 - k18 * t107 - k24 * t111;
+  const T t134 = k5 * t60 + k11 * t64 + k17 * t68 + k23 * t72 - k41 * t76 - k30 * t80 - k15 * t84 - k36 * t88
+      - k44 * t92 + k1 * t96 + k7 * t100 + k13 * t104 + k19 * t108 + k25 * t112;
+  const T t135 = k5 * t61 + k11 * t65 + k17 * t69 + k23 * t73 - k41 * t77 - k30 * t81 - k15 * t85 - k36 * t89
+      - k44 * t93 + k1 * t97 + k7 * t101 + k13 * t105 + k19 * t109 + k25 * t113;
+  const T t136 = t132 + t135;
+  const T t137 = t133 - t134;
+  const T t138 = t132 - t135;
+  const T t139 = t133 + t134;
+  const T t140 = t0 + k6 * t58 - k14 * t62 - k22 * t66 - k24 * t70 - k31 * t74 + k35 * t78 + k0 * t82 + k4 * t86
+      + k12 * t90 - k20 * t94 - k40 * t98 - k45 * t102 + k47 * t106 + k43 * t110;
+  const T t141 = t1 + k6 * t59 - k14 * t63 - k22 * t67 - k24 * t71 - k31 * t75 + k35 * t79 + k0 * t83 + k4 * t87
+      + k12 * t91 - k20 * t95 - k40 * t99 - k45 * t103 + k47 * t107 + k43 * t111;
+  const T t142 = k7 * t60 + k15 * t64 + k23 * t68 - k28 * t72 - k32 * t76 - k36 * t80 - k39 * t84 + k5 * t88
+      + k13 * t92 + k21 * t96 - k41 * t100 - k46 * t104 - k48 * t108 - k44 * t112;
+  const T t143 = k7 * t61 + k15 * t65 + k23 * t69 - k28 * t73 - k32 * t77 - k36 * t81 - k39 * t85 + k5 * t89
+      + k13 * t93 + k21 * t97 - k41 * t101 - k46 * t105 - k48 * t109 - k44 * t113;
+  const T t144 = t140 + t143;
+  const T t145 = t141 - t142;
+  const T t146 = t140 - t143;
+  const T t147 = t141 + t142;
+  const T t148 = t0 + k8 * t58 - k18 * t62 - k40 * t66 - k31 * t70 + k49 * t74 + k0 * t78 + k10 * t82 - k20 * t86
+      - k24 * t90 - k42 * t94 + k37 * t98 + k2 * t102 + k12 * t106 - k22 * t110;
+  const T t149 = t1 + k8 * t59 - k18 * t63 - k40 * t67 - k31 * t71 + k49 * t75 + k0 * t79 + k10 * t83 - k20 * t87
+      - k24 * t91 - k42 * t95 + k37 * t99 + k2 * t103 + k12 * t107 - k22 * t111;
+  const T t150 = k9 * t60 + k19 * t64 - k41 * t68 - k32 * t72 - k50 * t76 + k1 * t80 + k11 * t84 + k21 * t88
+      - k28 * t92 - k15 * t96 - k38 * t100 + k3 * t104 + k13 * t108 + k23 * t112;
+  const T t151 = k9 * t61 + k19 * t65 - k41 * t69 - k32 * t73 - k50 * t77 + k1 * t81 + k11 * t85 + k21 * t89
+      - k28 * t93 - k15 * t97 - k38 * t101 + k3 * t105 + k13 * t109 + k23 * t113;
+  const T t152 = t148 + t151;
+  const T t153 = t149 - t150;
+  const T t154 = t148 - t151;
+  const T t155 = t149 + t150;
+  const T t156 = t0 + k10 * t58 - k22 * t62 - k29 * t66 + k35 * t70 + k0 * t74 + k12 * t78 - k24 * t82 - k45 * t86
+      + k49 * t90 + k2 * t94 - k14 * t98 - k26 * t102 - k31 * t106 + k37 * t110;
+  const T t157 = t1 + k10 * t59 - k22 * t63 - k29 * t67 + k35 * t71 + k0 * t75 + k12 * t79 - k24 * t83 - k45 * t87
+      + k49 * t91 + k2 * t95 - k14 * t99 - k26 * t103 - k31 * t107 + k37 * t111;
+  const T t158 = k11 * t60 + k23 * t64 - k30 * t68 - k36 * t72 + k1 * t76 + k13 * t80 + k25 * t84 - k46 * t88
+      - k50 * t92 + k3 * t96 + k15 * t100 + k27 * t104 - k32 * t108 - k38 * t112;
+  const T t159 = k11 * t61 + k23 * t65 - k30 * t69 - k36 * t73 + k1 * t77 + k13 * t81 + k25 * t85 - k46 * t89
+      - k50 * t93 + k3 * t97 + k15 * t101 + k27 * t105 - k32 * t109 - k38 * t113;
+  const T t160 = t156 + t159;
+  const T t161 = t157 - t158;
+  const T t162 = t156 - t159;
+  const T t163 = t157 + t158;
+  const T t164 = t0 + k12 * t58 - k26 * t62 - k42 * t66 + k0 * t70 + k10 * t74 - k24 * t78 - k31 * t82 + k43 * t86
+      + k8 * t90 - k22 * t94 - k45 * t98 + k37 * t102 + k6 * t106 - k20 * t110;
+  const T t165 = t1 + k12 * t59 - k26 * t63 - k42 * t67 + k0 * t71 + k10 * t75 - k24 * t79 - k31 * t83 + k43 * t87
+      + k8 * t91 - k22 * t95 - k45 * t99 + k37 * t103 + k6 * t107 - k20 * t111;
+  const T t166 = k13 * t60 + k27 * t64 - k15 * t68 - k39 * t72 + k11 * t76 + k25 * t80 - k32 * t84 - k44 * t88
+      + k9 * t92 + k23 * t96 - k46 * t100 - k38 * t104 + k7 * t108 + k21 * t112;
+  const T t167 = k13 * t61 + k27 * t65 - k15 * t69 - k39 * t73 + k11 * t77 + k25 * t81 - k32 * t85 - k44 * t89
+      + k9 * t93 + k23 * t97 - k46 * t101 - k38 * t105 + k7 * t109 + k21 * t113;
+  const T t168 = t164 + t167;
+  const T t169 = t165 - t166;
+  const T t170 = t164 - t167;
+  const T t171 = t165 + t166;
+  const T t172 = t0 - k14 * t58 - k24 * t62 + k35 * t66 + k4 * t70 - k20 * t74 - k45 * t78 + k43 * t82 + k10 * t86
+      - k26 * t90 + k33 * t94 + k0 * t98 - k16 * t102 - k51 * t106 + k49 * t110;
+  const T t173 = t1 - k14 * t59 - k24 * t63 + k35 * t67 + k4 * t71 - k20 * t75 - k45 * t79 + k43 * t83 + k10 * t87
+      - k26 * t91 + k33 * t95 + k0 * t99 - k16 * t103 - k51 * t107 + k49 * t111;
+  const T t174 = k15 * t60 - k28 * t64 - k36 * t68 + k5 * t72 + k21 * t76 - k46 * t80 - k44 * t84 + k11 * t88
+      + k27 * t92 - k34 * t96 + k1 * t100 + k17 * t104 - k52 * t108 - k50 * t112;
+  const T t175 = k15 * t61 - k28 * t65 - k36 * t69 + k5 * t73 + k21 * t77 - k46 * t81 - k44 * t85 + k11 * t89
+      + k27 * t93 - k34 * t97 + k1 * t101 + k17 * t105 - k52 * t109 - k50 * t113;
+  const T t176 = t172 + t175;
+  const T t177 = t173 - t174;
+  const T t178 = t172 - t175;
+  const T t179 = t173 + t174;
+  const T t180 = t0 - k16 * t58 - k29 * t62 + k43 * t66 + k12 * t70 - k24 * t74 + k49 * t78 + k8 * t82 - k26 * t86
+      + k47 * t90 + k4 * t94 - k22 * t98 - k42 * t102 + k0 * t106 - k18 * t110;
+  const T t181 = t1 - k16 * t59 - k29 * t63 + k43 * t67 + k12 * t71 - k24 * t75 + k49 * t79 + k8 * t83 - k26 * t87
+      + k47 * t91 + k4 * t95 - k22 * t99 - k42 * t103 + k0 * t107 - k18 * t111;
+  const T t182 = k17 * t60 - k30 * t64 - k44 * t68 + k13 * t72 - k28 * t76 - k50 * t80 + k9 * t84 + k27 * t88
+      - k48 * t92 + k5 * t96 + k23 * t100 - k15 * t104 + k1 * t108 + k19 * t112;
+  const T t183 = k17 * t61 - k30 * t65 - k44 * t69 + k13 * t73 - k28 * t77 - k50 * t81 + k9 * t85 + k27 * t89
+      - k48 * t93 + k5 * t97 + k23 * t101 - k15 * t105 + k1 * t109 + k19 * t113;
+  const T t184 = t180 + t183;
+  const T t185 = t181 - t182;
+  const T t186 = t180 - t183;
+  const T t187 = t181 + t182;
+  const T t188 = t0 - k18 * t58 - k31 * t62 + k0 * t66 - k20 * t70 - k42 * t74 + k2 * t78 - k22 * t82 + k33 * t86
+      + k4 * t90 - k24 * t94 + k47 * t98 + k6 * t102 - k26 * t106 + k35 * t110;
+  const T t189 = t1 - k18 * t59 - k31 * t63 + k0 * t67 - k20 * t71 - k42 * t75 + k2 * t79 - k22 * t83 + k33 * t87
+      + k4 * t91 - k24 * t95 + k47 * t99 + k6 * t103 - k26 * t107 + k35 * t111;
+  const T t190 = k19 * t60 - k32 * t64 + k1 * t68 + k21 * t72 - k15 * t76 + k3 * t80 + k23 * t84 - k34 * t88
+      + k5 * t92 + k25 * t96 - k48 * t100 + k7 * t104 + k27 * t108 - k36 * t112;
+  const T t191 = k19 * t61 - k32 * t65 + k1 * t69 + k21 * t73 - k15 * t77 + k3 * t81 + k23 * t85 - k34 * t89
+      + k5 * t93 + k25 * t97 - k48 * t101 + k7 * t105 + k27 * t109 - k36 * t113;
+  const T t192 = t188 + t191;
+  const T t193 = t189 - t190;
+  const T t194 = t188 - t191;
+  const T t195 = t189 + t190;
+  const T t196 = t0 - k20 * t58 + k33 * t62 + k6 * t66 - k40 * t70 + k37 * t74 - k14 * t78 - k45 * t82 + k0 * t86
+      - k22 * t90 + k47 * t94 + k8 * t98 - k24 * t102 + k43 * t106 - k16 * t110;
+  const T t197 = t1 - k20 * t59 + k33 * t63 + k6 * t67 - k40 * t71 + k37 * t75 - k14 * t79 - k45 * t83 + k0 * t87
+      - k22 * t91 + k47 * t95 + k8 * t99 - k24 * t103 + k43 * t107 - k16 * t111;
+  const T t198 = k21 * t60 - k34 * t64 + k7 * t68 - k41 * t72 - k38 * t76 + k15 * t80 - k46 * t84 + k1 * t88
+      + k23 * t92 - k48 * t96 + k9 * t100 - k28 * t104 - k44 * t108 + k17 * t112;
+  const T t199 = k21 * t61 - k34 * t65 + k7 * t69 - k41 * t73 - k38 * t77 + k15 * t81 - k46 * t85 + k1 * t89
+      + k23 * t93 - k48 * t97 + k9 * t101 - k28 * t105 - k44 * t109 + k17 * t113;
+  const T t200 = t196 + t199;
+  const T t201 = t197 - t198;
+  const T t202 = t196 - t199;
+  const T t203 = t197 + t198;
+  const T t204 = t0 - k22 * t58 + k35 * t62 + k12 * t66 - k45 * t70 + k2 * t74 - k26 * t78 + k37 * t82 - k16 * t86
+      - k42 * t90 + k6 * t94 - k24 * t98 + k0 * t102 - k20 * t106 + k47 * t110;
+  const T t205 = t1 - k22 * t59 + k35 * t63 + k12 * t67 - k45 * t71 + k2 * t75 - k26 * t79 + k37 * t83 - k16 * t87
+      - k42 * t91 + k6 * t95 - k24 * t99 + k0 * t103 - k20 * t107 + k47 * t111;
+  const T t206 = k23 * t60 - k36 * t64 + k13 * t68 - k46 * t72 + k3 * t76 + k27 * t80 - k38 * t84 + k17 * t88
+      - k15 * t92 + k7 * t96 - k28 * t100 - k39 * t104 + k21 * t108 - k48 * t112;
+  const T t207 = k23 * t61 - k36 * t65 + k13 * t69 - k46 * t73 + k3 * t77 + k27 * t81 - k38 * t85 + k17 * t89
+      - k15 * t93 + k7 * t97 - k28 * t101 - k39 * t105 + k21 * t109 - k48 * t113;
+  const T t208 = t204 + t207;
+  const T t209 = t205 - t206;
+  const T t210 = t204 - t207;
+  const T t211 = t205 + t206;
+  const T t212 = t0 - k24 * t58 + k37 * t62 - k18 * t66 + k47 * t70 + k12 * t74 - k31 * t78 + k6 * t82 - k51 * t86
+      + k0 * t90 - k26 * t94 + k43 * t98 - k20 * t102 + k35 * t106 - k14 * t110;
+  const T t213 = t1 - k24 * t59 + k37 * t63 - k18 * t67 + k47 * t71 + k12 * t75 - k31 * t79 + k6 * t83 - k51 * t87
+      + k0 * t91 - k26 * t95 + k43 * t99 - k20 * t103 + k35 * t107 - k14 * t111;
+  const T t214 = k25 * t60 - k38 * t64 + k19 * t68 - k48 * t72 + k13 * t76 - k32 * t80 + k7 * t84 - k52 * t88
+      + k1 * t92 + k27 * t96 - k44 * t100 + k21 * t104 - k36 * t108 + k15 * t112;
+  const T t215 = k25 * t61 - k38 * t65 + k19 * t69 - k48 * t73 + k13 * t77 - k32 * t81 + k7 * t85 - k52 * t89
+      + k1 * t93 + k27 * t97 - k44 * t101 + k21 * t105 - k36 * t109 + k15 * t113;
+  const T t216 = t212 + t215;
+  const T t217 = t213 - t214;
+  const T t218 = t212 - t215;
+  const T t219 = t213 + t214;
+  const T t220 = t0 - k26 * t58 + k0 * t62 - k24 * t66 + k43 * t70 - k22 * t74 + k37 * t78 - k20 * t82 + k49 * t86
+      - k18 * t90 + k35 * t94 - k16 * t98 + k47 * t102 - k14 * t106 + k33 * t110;
+  const T t221 = t1 - k26 * t59 + k0 * t63 - k24 * t67 + k43 * t71 - k22 * t75 + k37 * t79 - k20 * t83 + k49 * t87
+      - k18 * t91 + k35 * t95 - k16 * t99 + k47 * t103 - k14 * t107 + k33 * t111;
+  const T t222 = k27 * t60 - k39 * t64 + k25 * t68 - k44 * t72 + k23 * t76 - k38 * t80 + k21 * t84 - k50 * t88
+      + k19 * t92 - k36 * t96 + k17 * t100 - k48 * t104 + k15 * t108 - k34 * t112;
+  const T t223 = k27 * t61 - k39 * t65 + k25 * t69 - k44 * t73 + k23 * t77 - k38 * t81 + k21 * t85 - k50 * t89
+      + k19 * t93 - k36 * t97 + k17 * t101 - k48 * t105 + k15 * t109 - k34 * t113;
+  const T t224 = t220 + t223;
+  const T t225 = t221 - t222;
+  const T t226 = t220 - t223;
+  const T t227 = t221 + t222;
+  out[0 * stride_out + 0] = t114;
+  out[0 * stride_out + 1] = t115;
+  out[2 * stride_out + 0] = t120;
+  out[2 * stride_out + 1] = t121;
+  out[4 * stride_out + 0] = t128;
+  out[4 * stride_out + 1] = t129;
+  out[6 * stride_out + 0] = t136;
+  out[6 * stride_out + 1] = t137;
+  out[8 * stride_out + 0] = t144;
+  out[8 * stride_out + 1] = t145;
+  out[10 * stride_out + 0] = t152;
+  out[10 * stride_out + 1] = t153;
+  out[12 * stride_out + 0] = t160;
+  out[12 * stride_out + 1] = t161;
+  out[14 * stride_out + 0] = t168;
+  out[14 * stride_out + 1] = t169;
+  out[16 * stride_out + 0] = t176;
+  out[16 * stride_out + 1] = t177;
+  out[18 * stride_out + 0] = t184;
+  out[18 * stride_out + 1] = t185;
+  out[20 * stride_out + 0] = t192;
+  out[20 * stride_out + 1] = t193;
+  out[22 * stride_out + 0] = t200;
+  out[22 * stride_out + 1] = t201;
+  out[24 * stride_out + 0] = t208;
+  out[24 * stride_out + 1] = t209;
+  out[26 * stride_out + 0] = t216;
+  out[26 * stride_out + 1] = t217;
+  out[28 * stride_out + 0] = t224;
+  out[28 * stride_out + 1] = t225;
+  out[30 * stride_out + 0] = t226;
+  out[30 * stride_out + 1] = t227;
+  out[32 * stride_out + 0] = t218;
+  out[32 * stride_out + 1] = t219;
+  out[34 * stride_out + 0] = t210;
+  out[34 * stride_out + 1] = t211;
+  out[36 * stride_out + 0] = t202;
+  out[36 * stride_out + 1] = t203;
+  out[38 * stride_out + 0] = t194;
+  out[38 * stride_out + 1] = t195;
+  out[40 * stride_out + 0] = t186;
+  out[40 * stride_out + 1] = t187;
+  out[42 * stride_out + 0] = t178;
+  out[42 * stride_out + 1] = t179;
+  out[44 * stride_out + 0] = t170;
+  out[44 * stride_out + 1] = t171;
+  out[46 * stride_out + 0] = t162;
+  out[46 * stride_out + 1] = t163;
+  out[48 * stride_out + 0] = t154;
+  out[48 * stride_out + 1] = t155;
+  out[50 * stride_out + 0] = t146;
+  out[50 * stride_out + 1] = t147;
+  out[52 * stride_out + 0] = t138;
+  out[52 * stride_out + 1] = t139;
+  out[54 * stride_out + 0] = t130;
+  out[54 * stride_out + 1] = t131;
+  out[56 * stride_out + 0] = t122;
+  out[56 * stride_out + 1] = t123;
+  // clang-format on
+}
+
+/**
+ * Calculates DFT of size 31 using straight-line code. Can work in or out of place.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft_31(const T* in, T* out, Idx stride_in, Idx stride_out) {
+  // clang-format off
+  constexpr T k0 = static_cast<T>(0.9795299412524945);
+  constexpr T k1 = static_cast<T>(0.20129852008866006);
+  constexpr T k2 = static_cast<T>(0.9189578116202306);
+  constexpr T k3 = static_cast<T>(0.39435585511331855);
+  constexpr T k4 = static_cast<T>(0.8207634412072763);
+  constexpr T k5 = static_cast<T>(0.5712682150947923);
+  constexpr T k6 = static_cast<T>(0.6889669190756866);
+  constexpr T k7 = static_cast<T>(0.7247927872291199);
+  constexpr T k8 = static_cast<T>(0.5289640103269624);
+  constexpr T k9 = static_cast<T>(0.8486442574947509);
+  constexpr T k10 = static_cast<T>(0.3473052528448203);
+  constexpr T k11 = static_cast<T>(0.9377521321470804);
+  constexpr T k12 = static_cast<T>(0.1514277775045767);
+  constexpr T k13 = static_cast<T>(0.9884683243281114);
+  constexpr T k14 = static_cast<T>(0.05064916883871264);
+  constexpr T k15 = static_cast<T>(0.9987165071710528);
+  constexpr T k16 = static_cast<T>(0.2506525322587204);
+  constexpr T k17 = static_cast<T>(0.9680771188662043);
+  constexpr T k18 = static_cast<T>(0.4403941515576344);
+  constexpr T k19 = static_cast<T>(0.8978045395707416);
+  constexpr T k20 = static_cast<T>(0.6121059825476626);
+  constexpr T k21 = static_cast<T>(0.7907757369376989);
+  constexpr T k22 = static_cast<T>(0.7587581226927909);
+  constexpr T k23 = static_cast<T>(0.6513724827222223);
+  constexpr T k24 = static_cast<T>(0.8743466161445821);
+  constexpr T k25 = static_cast<T>(0.48530196253108104);
+  constexpr T k26 = static_cast<T>(0.9541392564000488);
+  constexpr T k27 = static_cast<T>(0.29936312297335804);
+  constexpr T k28 = static_cast<T>(0.994869323391895);
+  constexpr T k29 = static_cast<T>(0.10116832198743272);
+  constexpr T k30 = static_cast<T>(0.9948693233918952);
+  constexpr T k31 = static_cast<T>(0.10116832198743204);
+  constexpr T k32 = static_cast<T>(0.8743466161445822);
+  constexpr T k33 = static_cast<T>(0.4853019625310808);
+  constexpr T k34 = static_cast<T>(0.6121059825476627);
+  constexpr T k35 = static_cast<T>(0.7907757369376986);
+  constexpr T k36 = static_cast<T>(0.2506525322587213);
+  constexpr T k37 = static_cast<T>(0.9680771188662041);
+  constexpr T k38 = static_cast<T>(0.15142777750457667);
+  constexpr T k39 = static_cast<T>(0.848644257494751);
+  constexpr T k40 = static_cast<T>(0.5712682150947924);
+  constexpr T k41 = static_cast<T>(0.9795299412524943);
+  constexpr T k42 = static_cast<T>(0.20129852008866114);
+  constexpr T k43 = static_cast<T>(0.44039415155763423);
+  constexpr T k44 = static_cast<T>(0.8978045395707417);
+  constexpr T k45 = static_cast<T>(0.6889669190756865);
+  constexpr T k46 = static_cast<T>(0.72479278722912);
+  constexpr T k47 = static_cast<T>(0.2993631229733582);
+  constexpr T k48 = static_cast<T>(0.3943558551133187);
+  constexpr T k49 = static_cast<T>(0.7587581226927911);
+  constexpr T k50 = static_cast<T>(0.651372482722222);
+  constexpr T k51 = static_cast<T>(0.05064916883871355);
+  const T t0 = in[0 * stride_in + 0];
+  const T t1 = in[0 * stride_in + 1];
+  const T t2 = in[2 * stride_in + 0];
+  const T t3 = in[2 * stride_in + 1];
+  const T t4 = in[4 * stride_in + 0];
+  const T t5 = in[4 * stride_in + 1];
+  const T t6 = in[6 * stride_in + 0];
+  const T t7 = in[6 * stride_in + 1];
+  const T t8 = in[8 * stride_in + 0];
+  const T t9 = in[8 * stride_in + 1];
+  const T t10 = in[10 * stride_in + 0];
+  const T t11 = in[10 * stride_in + 1];
+  const T t12 = in[12 * stride_in + 0];
+  const T t13 = in[12 * stride_in + 1];
+  const T t14 = in[14 * stride_in + 0];
+  const T t15 = in[14 * stride_in + 1];
+  const T t16 = in[16 * stride_in + 0];
+  const T t17 = in[16 * stride_in + 1];
+  const T t18 = in[18 * stride_in + 0];
+  const T t19 = in[18 * stride_in + 1];
+  const T t20 = in[20 * stride_in + 0];
+  const T t21 = in[20 * stride_in + 1];
+  const T t22 = in[22 * stride_in + 0];
+  const T t23 = in[22 * stride_in + 1];
+  const T t24 = in[24 * stride_in + 0];
+  const T t25 = in[24 * stride_in + 1];
+  const T t26 = in[26 * stride_in + 0];
+  const T t27 = in[26 * stride_in + 1];
+  const T t28 = in[28 * stride_in + 0];
+  const T t29 = in[28 * stride_in + 1];
+  const T t30 = in[30 * stride_in + 0];
+  const T t31 = in[30 * stride_in + 1];
+  const T t32 = in[32 * stride_in + 0];
+  const T t33 = in[32 * stride_in + 1];
+  const T t34 = in[34 * stride_in + 0];
+  const T t35 = in[34 * stride_in + 1];
+  const T t36 = in[36 * stride_in + 0];
+  const T t37 = in[36 * stride_in + 1];
+  const T t38 = in[38 * stride_in + 0];
+  const T t39 = in[38 * stride_in + 1];
+  const T t40 = in[40 * stride_in + 0];
+  const T t41 = in[40 * stride_in + 1];
+  const T t42 = in[42 * stride_in + 0];
+  const T t43 = in[42 * stride_in + 1];
+  const T t44 = in[44 * stride_in + 0];
+  const T t45 = in[44 * stride_in + 1];
+  const T t46 = in[46 * stride_in + 0];
+  const T t47 = in[46 * stride_in + 1];
+  const T t48 = in[48 * stride_in + 0];
+  const T t49 = in[48 * stride_in + 1];
+  const T t50 = in[50 * stride_in + 0];
+  const T t51 = in[50 * stride_in + 1];
+  const T t52 = in[52 * stride_in + 0];
+  const T t53 = in[52 * stride_in + 1];
+  const T t54 = in[54 * stride_in + 0];
+  const T t55 = in[54 * stride_in + 1];
+  const T t56 = in[56 * stride_in + 0];
+  const T t57 = in[56 * stride_in + 1];
+  const T t58 = in[58 * stride_in + 0];
+  const T t59 = in[58 * stride_in + 1];
+  const T t60 = in[60 * stride_in + 0];
+  const T t61 = in[60 * stride_in + 1];
+  const T t62 = t2 + t60;
+  const T t63 = t3 + t61;
+  const T t64 = t2 - t60;
+  const T t65 = t3 - t61;
+  const T t66 = t4 + t58;
+  const T t67 = t5 + t59;
+  const T t68 = t4 - t58;
+  const T t69 = t5 - t59;
+  const T t70 = t6 + t56;
+  const T t71 = t7 + t57;
+  const T t72 = t6 - t56;
+  const T t73 = t7 - t57;
+  const T t74 = t8 + t54;
+  const T t75 = t9 + t55;
+  const T t76 = t8 - t54;
+  const T t77 = t9 - t55;
+  const T t78 = t10 + t52;
+  const T t79 = t11 + t53;
+  const T t80 = t10 - t52;
+  const T t81 = t11 - t53;
+  const T t82 = t12 + t50;
+  const T t83 = t13 + t51;
+  const T t84 = t12 - t50;
+  const T t85 = t13 - t51;
+  const T t86 = t14 + t48;
+  const T t87 = t15 + t49;
+  const T t88 = t14 - t48;
+  const T t89 = t15 - t49;
+  const T t90 = t16 + t46;
+  const T t91 = t17 + t47;
+  const T t92 = t16 - t46;
+  const T t93 = t17 - t47;
+  const T t94 = t18 + t44;
+  const T t95 = t19 + t45;
+  const T t96 = t18 - t44;
+  const T t97 = t19 - t45;
+  const T t98 = t20 + t42;
+  const T t99 = t21 + t43;
+  const T t100 = t20 - t42;
+  const T t101 = t21 - t43;
+  const T t102 = t22 + t40;
+  const T t103 = t23 + t41;
+  const T t104 = t22 - t40;
+  const T t105 = t23 - t41;
+  const T t106 = t24 + t38;
+  const T t107 = t25 + t39;
+  const T t108 = t24 - t38;
+  const T t109 = t25 - t39;
+  const T t110 = t26 + t36;
+  const T t111 = t27 + t37;
+  const T t112 = t26 - t36;
+  const T t113 = t27 - t37;
+  const T t114 = t28 + t34;
+  const T t115 = t29 + t35;
+  const T t116 = t28 - t34;
+  const T t117 = t29 - t35;
+  const T t118 = t30 + t32;
+  const T t119 = t31 + t33;
+  const T t120 = t30 - t32;
+  const T t121 = t31 - t33;
+  const T t122 = t0 + t62 + t66 + t70 + t74 + t78 + t82 + t86 + t90 + t94 + t98 + t102 + t106 + t110 + t114 + t118;
+  const T t123 = t1 + t63 + t67 + t71 + t75 + t79 + t83 + t87 + t91 + t95 + t99 + t103 + t107 + t111 + t115 + t119;
+  const T t124 = t0 + k0 * t62 + k2 * t66 + k4 * t70 + k6 * t74 + k8 * t78 + k10 * t82 + k12 * t86 - k14 * t90
+      - k16 * t94 - k18 * t98 - k20 * t102 - k22 * t106 - k24 * t110 - k26 * t114 - k28 * t118;
+  const T t125 = t1 + k0 * t63 + k2 * t67 + k4 * t71 + k6 * t75 + k8 * t79 + k10 * t83 + k12 * t87 - k14 * t91
+      - k16 * t95 - k18 * t99 - k20 * t103 - k22 * t107 - k24 * t111 - k26 * t115 - k28 * t119;
+  const T t126 = k1 * t64 + k3 * t68 + k5 * t72 + k7 * t76 + k9 * t80 + k11 * t84 + k13 * t88 + k15 * t92 + k17 * t96
+      + k19 * t100 + k21 * t104 + k23 * t108 + k25 * t112 + k27 * t116 + k29 * t120;
+  const T t127 = k1 * t65 + k3 * t69 + k5 * t73 + k7 * t77 + k9 * t81 + k11 * t85 + k13 * t89 + k15 * t93 + k17 * t97
+      + k19 * t101 + k21 * t105 + k23 * t109 + k25 * t113 + k27 * t117 + k29 * t121;
+  const T t128 = t124 + t127;
+  const T t129 = t125 - t126;
+  const T t130 = t124 - t127;
+  const T t131 = t125 + t126;
+  const T t132 = t0 + k2 * t62 + k6 * t66 + k10 * t70 - k14 * t74 - k18 * t78 - k22 * t82 - k26 * t86 - k30 * t90
+      - k32 * t94 - k34 * t98 - k36 * t102 + k38 * t106 + k8 * t110 + k4 * t114 + k41 * t118;
+  const T t133 = t1 + k2 * t63 + k6 * t67 + k10 * t71 - k14 * t75 - k18 * t79 - k22 * t83 - k26 * t87 - k30 * t91
+      - k32 * t95 - k34 * t99 - k36 * t103 + k38 * t107 + k8 * t111 + k4 * t115 + k41 * t119;
+  const T t134 = k3 * t64 + k7 * t68 + k11 * t72 + k15 * t76 + k19 * t80 + k23 * t84 + k27 * t88 - k31 * t92
+      - k33 * t96 - k35 * t100 - k37 * t104 - k13 * t108 - k39 * t112 - k40 * t116 - k42 * t120;
+  const T t135 = k3 * t65 + k7 * t69 + k11 * t73 + k15 * t77 + k19 * t81 + k23 * t85 + k27 * t89 - k31 * t93
+      - k33 * t97 - k35 * t101 - k37 * t105 - k13 * t109 - k39 * t113 - k40 * t117 - k42 * t121;
+  const T t136 = t132 + t135;
+  const T t137 = t133 - t134;
+  const T t138 = t132 - t135;
+  const T t139 = t133 + t134;
+  const T t140 = t0 + k4 * t62 + k10 * t66 - k16 * t70 - k22 * t74 - k28 * t78 - k32 * t82 - k43 * t86 + k38 * t90
+      + k45 * t94 + k41 * t98 + k2 * t102 + k8 * t106 - k14 * t110 - k20 * t114 - k26 * t118;
+  const T t141 = t1 + k4 * t63 + k10 * t67 - k16 * t71 - k22 * t75 - k28 * t79 - k32 * t83 - k43 * t87 + k38 * t91
+      + k45 * t95 + k41 * t99 + k2 * t103 + k8 * t107 - k14 * t111 - k20 * t115 - k26 * t119;
+  const T t142 = k5 * t64 + k11 * t68 + k17 * t72 + k23 * t76 + k29 * t80 - k33 * t84 - k44 * t88 - k13 * t92
+      - k46 * t96 - k42 * t100 + k3 * t104 + k9 * t108 + k15 * t112 + k21 * t116 + k27 * t120;
+  const T t143 = k5 * t65 + k11 * t69 + k17 * t73 + k23 * t77 + k29 * t81 - k33 * t85 - k44 * t89 - k13 * t93
+      - k46 * t97 - k42 * t101 + k3 * t105 + k9 * t109 + k15 * t113 + k21 * t117 + k27 * t121;
+  const T t144 = t140 + t143;
+  const T t145 = t141 - t142;
+  const T t146 = t140 - t143;
+  const T t147 = t141 + t142;
+  const T t148 = t0 + k6 * t62 - k14 * t66 - k22 * t70 - k30 * t74 - k34 * t78 + k38 * t82 + k4 * t86 + k0 * t90
+      + k8 * t94 - k16 * t98 - k24 * t102 - k26 * t106 - k43 * t110 + k10 * t114 + k2 * t118;
+  const T t149 = t1 + k6 * t63 - k14 * t67 - k22 * t71 - k30 * t75 - k34 * t79 + k38 * t83 + k4 * t87 + k0 * t91
+      + k8 * t95 - k16 * t99 - k24 * t103 - k26 * t107 - k43 * t111 + k10 * t115 + k2 * t119;
+  const T t150 = k7 * t64 + k15 * t68 + k23 * t72 - k31 * t76 - k35 * t80 - k13 * t84 - k40 * t88 + k1 * t92
+      + k9 * t96 + k17 * t100 + k25 * t104 - k47 * t108 - k44 * t112 - k11 * t116 - k48 * t120;
+  const T t151 = k7 * t65 + k15 * t69 + k23 * t73 - k31 * t77 - k35 * t81 - k13 * t85 - k40 * t89 + k1 * t93
+      + k9 * t97 + k17 * t101 + k25 * t105 - k47 * t109 - k44 * t113 - k11 * t117 - k48 * t121;
+  const T t152 = t148 + t151;
+  const T t153 = t149 - t150;
+  const T t154 = t148 - t151;
+  const T t155 = t149 + t150;
+  const T t156 = t0 + k8 * t62 - k18 * t66 - k28 * t70 - k34 * t74 + k10 * t78 + k41 * t82 + k6 * t86 - k16 * t90
+      - k26 * t94 - k49 * t98 + k38 * t102 + k2 * t106 + k4 * t110 - k14 * t114 - k24 * t118;
+  const T t157 = t1 + k8 * t63 - k18 * t67 - k28 * t71 - k34 * t75 + k10 * t79 + k41 * t83 + k6 * t87 - k16 * t91
+      - k26 * t95 - k49 * t99 + k38 * t103 + k2 * t107 + k4 * t111 - k14 * t115 - k24 * t119;
+  const T t158 = k9 * t64 + k19 * t68 + k29 * t72 - k35 * t76 - k11 * t80 - k42 * t84 + k7 * t88 + k17 * t92
+      + k27 * t96 - k50 * t100 - k13 * t104 - k48 * t108 + k5 * t112 + k15 * t116 + k25 * t120;
+  const T t159 = k9 * t65 + k19 * t69 + k29 * t73 - k35 * t77 - k11 * t81 - k42 * t85 + k7 * t89 + k17 * t93
+      + k27 * t97 - k50 * t101 - k13 * t105 - k48 * t109 + k5 * t113 + k15 * t117 + k25 * t121;
+  const T t160 = t156 + t159;
+  const T t161 = t157 - t158;
+  const T t162 = t156 - t159;
+  const T t163 = t157 + t158;
+  const T t164 = t0 + k10 * t62 - k22 * t66 - k32 * t70 + k38 * t74 + k41 * t78 + k8 * t82 - k20 * t86 - k26 * t90
+      - k51 * t94 + k2 * t98 + k6 * t102 - k18 * t106 - k30 * t110 - k36 * t114 + k4 * t118;
+  const T t165 = t1 + k10 * t63 - k22 * t67 - k32 * t71 + k38 * t75 + k41 * t79 + k8 * t83 - k20 * t87 - k26 * t91
+      - k51 * t95 + k2 * t99 + k6 * t103 - k18 * t107 - k30 * t111 - k36 * t115 + k4 * t119;
+  const T t166 = k11 * t64 + k23 * t68 - k33 * t72 - k13 * t76 - k42 * t80 + k9 * t84 + k21 * t88 - k47 * t92
+      - k15 * t96 - k48 * t100 + k7 * t104 + k19 * t108 - k31 * t112 - k37 * t116 - k40 * t120;
+  const T t167 = k11 * t65 + k23 * t69 - k33 * t73 - k13 * t77 - k42 * t81 + k9 * t85 + k21 * t89 - k47 * t93
+      - k15 * t97 - k48 * t101 + k7 * t105 + k19 * t109 - k31 * t113 - k37 * t117 - k40 * t121;
+  const T t168 = t164 + t167;
+  const T t169 = t165 - t166;
+  const T t170 = t164 - t167;
+  const T t171 = t165 + t166;
+  const T t172 = t0 + k12 * t62 - k26 * t66 - k43 * t70 + k4 * t74 + k6 * t78 - k20 * t82 - k32 * t86 + k10 * t90
+      + k0 * t94 - k14 * t98 - k28 * t102 - k36 * t106 + k2 * t110 + k8 * t114 - k22 * t118;
+  const T t173 = t1 + k12 * t63 - k26 * t67 - k43 * t71 + k4 * t75 + k6 * t79 - k20 * t83 - k32 * t87 + k10 * t91
+      + k0 * t95 - k14 * t99 - k28 * t103 - k36 * t107 + k2 * t111 + k8 * t115 - k22 * t119;
+  const T t174 = k13 * t64 + k27 * t68 - k44 * t72 - k40 * t76 + k7 * t80 + k21 * t84 - k33 * t88 - k11 * t92
+      + k1 * t96 + k15 * t100 + k29 * t104 - k37 * t108 - k48 * t112 + k9 * t116 + k23 * t120;
+  const T t175 = k13 * t65 + k27 * t69 - k44 * t73 - k40 * t77 + k7 * t81 + k21 * t85 - k33 * t89 - k11 * t93
+      + k1 * t97 + k15 * t101 + k29 * t105 - k37 * t109 - k48 * t113 + k9 * t117 + k23 * t121;
+  const T t176 = t172 + t175;
+  const T t177 = t173 - t174;
+  const T t178 = t172 - t175;
+  const T t179 = t173 + t174;
+  const T t180 = t0 - k14 * t62 - k30 * t66 + k38 * t70 + k0 * t74 - k16 * t78 - k26 * t82 + k10 * t86 + k2 * t90
+      - k18 * t94 - k32 * t98 + k8 * t102 + k4 * t106 - k20 * t110 - k49 * t114 + k45 * t118;
+  const T t181 = t1 - k14 * t63 - k30 * t67 + k38 * t71 + k0 * t75 - k16 * t79 - k26 * t83 + k10 * t87 + k2 * t91
+      - k18 * t95 - k32 * t99 + k8 * t103 + k4 * t107 - k20 * t111 - k49 * t115 + k45 * t119;
+  const T t182 = k15 * t64 - k31 * t68 - k13 * t72 + k1 * t76 + k17 * t80 - k47 * t84 - k11 * t88 + k3 * t92
+      + k19 * t96 - k33 * t100 - k39 * t104 + k5 * t108 + k21 * t112 - k50 * t116 - k46 * t120;
+  const T t183 = k15 * t65 - k31 * t69 - k13 * t73 + k1 * t77 + k17 * t81 - k47 * t85 - k11 * t89 + k3 * t93
+      + k19 * t97 - k33 * t101 - k39 * t105 + k5 * t109 + k21 * t113 - k50 * t117 - k46 * t121;
+  const T t184 = t180 + t183;
+  const T t185 = t181 - t182;
+  const T t186 = t180 - t183;
+  const T t187 = t181 + t182;
+  const T t188 = t0 - k16 * t62 - k32 * t66 + k45 * t70 + k8 * t74 - k26 * t78 - k51 * t82 + k0 * t86 - k18 * t90
+      - k49 * t94 + k4 * t98 + k10 * t102 - k28 * t106 + k38 * t110 + k2 * t114 - k20 * t118;
+  const T t189 = t1 - k16 * t63 - k32 * t67 + k45 * t71 + k8 * t75 - k26 * t79 - k51 * t83 + k0 * t87 - k18 * t91
+      - k49 * t95 + k4 * t99 + k10 * t103 - k28 * t107 + k38 * t111 + k2 * t115 - k20 * t119;
+  const T t190 = k17 * t64 - k33 * t68 - k46 * t72 + k9 * t76 + k27 * t80 - k15 * t84 + k1 * t88 + k19 * t92
+      - k50 * t96 - k40 * t100 + k11 * t104 + k29 * t108 - k13 * t112 + k3 * t116 + k21 * t120;
+  const T t191 = k17 * t65 - k33 * t69 - k46 * t73 + k9 * t77 + k27 * t81 - k15 * t85 + k1 * t89 + k19 * t93
+      - k50 * t97 - k40 * t101 + k11 * t105 + k29 * t109 - k13 * t113 + k3 * t117 + k21 * t121;
+  const T t192 = t188 + t191;
+  const T t193 = t189 - t190;
+  const T t194 = t188 - t191;
+  const T t195 = t189 + t190;
+  const T t196 = t0 - k18 * t62 - k34 * t66 + k41 * t70 - k16 * t74 - k49 * t78 + k2 * t82 - k14 * t86 - k32 * t90
+      + k4 * t94 + k12 * t98 - k26 * t102 + k45 * t106 + k10 * t110 - k30 * t114 + k8 * t118;
+  const T t197 = t1 - k18 * t63 - k34 * t67 + k41 * t71 - k16 * t75 - k49 * t79 + k2 * t83 - k14 * t87 - k32 * t91
+      + k4 * t95 + k12 * t99 - k26 * t103 + k45 * t107 + k10 * t111 - k30 * t115 + k8 * t119;
+  const T t198 = k19 * t64 - k35 * t68 - k42 * t72 + k17 * t76 - k50 * t80 - k48 * t84 + k15 * t88 - k33 * t92
+      - k40 * t96 + k13 * t100 - k47 * t104 - k46 * t108 + k11 * t112 - k31 * t116 - k39 * t120;
+  const T t199 = k19 * t65 - k35 * t69 - k42 * t73 + k17 * t77 - k50 * t81 - k48 * t85 + k15 * t89 - k33 * t93
+      - k40 * t97 + k13 * t101 - k47 * t105 - k46 * t109 + k11 * t113 - k31 * t117 - k39 * t121;
+  const T t200 = t196 + t199;
+  const T t201 = t197 - t198;
+  const T t202 = t196 - t199;
+  const T t203 = t197 + t198;
+  const T t204 = t0 - k20 * t62 - k36 * t66 + k2 * t70 - k24 * t74 + k38 * t78 + k6 * t82 - k28 * t86 + k8 * t90
+      + k10 * t94 - k26 * t98 + k4 * t102 - k14 * t106 - k49 * t110 + k41 * t114 - k18 * t118;
+  const T t205 = t1 - k20 * t63 - k36 * t67 + k2 * t71 - k24 * t75 + k38 * t79 + k6 * t83 - k28 * t87 + k8 * t91
+      + k10 * t95 - k26 * t99 + k4 * t103 - k14 * t107 - k49 * t111 + k41 * t115 - k18 * t119;
+  const T t206 = k21 * t64 - k37 * t68 + k3 * t72 + k25 * t76 - k13 * t80 + k7 * t84 + k29 * t88 - k39 * t92
+      + k11 * t96 - k47 * t100 - k40 * t104 + k15 * t108 - k50 * t112 - k42 * t116 + k19 * t120;
+  const T t207 = k21 * t65 - k37 * t69 + k3 * t73 + k25 * t77 - k13 * t81 + k7 * t85 + k29 * t89 - k39 * t93
+      + k11 * t97 - k47 * t101 - k40 * t105 + k15 * t109 - k50 * t113 - k42 * t117 + k19 * t121;
+  const T t208 = t204 + t207;
+  const T t209 = t205 - t206;
+  const T t210 = t204 - t207;
+  const T t211 = t205 + t206;
+  const T t212 = t0 - k22 * t62 + k38 * t66 + k8 * t70 - k26 * t74 + k2 * t78 - k18 * t82 - k36 * t86 + k4 * t90
+      - k28 * t94 + k45 * t98 - k14 * t102 - k34 * t106 + k0 * t110 - k24 * t114 + k10 * t118;
+  const T t213 = t1 - k22 * t63 + k38 * t67 + k8 * t71 - k26 * t75 + k2 * t79 - k18 * t83 - k36 * t87 + k4 * t91
+      - k28 * t95 + k45 * t99 - k14 * t103 - k34 * t107 + k0 * t111 - k24 * t115 + k10 * t119;
+  const T t214 = k23 * t64 - k13 * t68 + k9 * t72 - k47 * t76 - k48 * t80 + k19 * t84 - k37 * t88 + k5 * t92
+      + k29 * t96 - k46 * t100 + k15 * t104 - k35 * t108 + k1 * t112 + k25 * t116 - k11 * t120;
+  const T t215 = k23 * t65 - k13 * t69 + k9 * t73 - k47 * t77 - k48 * t81 + k19 * t85 - k37 * t89 + k5 * t93
+      + k29 * t97 - k46 * t101 + k15 * t105 - k35 * t109 + k1 * t113 + k25 * t117 - k11 * t121;
+  const T t216 = t212 + t215;
+  const T t217 = t213 - t214;
+  const T t218 = t212 - t215;
+  const T t219 = t213 + t214;
+  const T t220 = t0 - k24 * t62 + k8 * t66 - k14 * t70 - k43 * t74 + k4 * t78 - k30 * t82 + k2 * t86 - k20 * t90
+      + k38 * t94 + k10 * t98 - k49 * t102 + k0 * t106 - k26 * t110 + k45 * t114 - k16 * t118;
+  const T t221 = t1 - k24 * t63 + k8 * t67 - k14 * t71 - k43 * t75 + k4 * t79 - k30 * t83 + k2 * t87 - k20 * t91
+      + k38 * t95 + k10 * t99 - k49 * t103 + k0 * t107 - k26 * t111 + k45 * t115 - k16 * t119;
+  const T t222 = k25 * t64 - k39 * t68 + k15 * t72 - k44 * t76 + k5 * t80 - k31 * t84 - k48 * t88 + k21 * t92
+      - k13 * t96 + k11 * t100 - k50 * t104 + k1 * t108 + k27 * t112 - k46 * t116 + k17 * t120;
+  const T t223 = k25 * t65 - k39 * t69 + k15 * t73 - k44 * t77 + k5 * t81 - k31 * t85 - k48 * t89 + k21 * t93
+      - k13 * t97 + k11 * t101 - k50 * t105 + k1 * t109 + k27 * t113 - k46 * t117 + k17 * t121;
+  const T t224 = t220 + t223;
+  const T t225 = t221 - t222;
+  const T t226 = t220 - t223;
+  const T t227 = t221 + t222;
+  const T t228 = t0 - k26 * t62 + k4 * t66 - k20 * t70 + k10 * t74 - k14 * t78 - k36 * t82 + k8 * t86 - k49 * t90
+      + k2 * t94 - k30 * t98 + k41 * t102 - k24 * t106 + k45 * t110 - k18 * t114 + k38 * t118;
+  const T t229 = t1 - k26 * t63 + k4 * t67 - k20 * t71 + k10 * t75 - k14 * t79 - k36 * t83 + k8 * t87 - k49 * t91
+      + k2 * t95 - k30 * t99 + k41 * t103 - k24 * t107 + k45 * t111 - k18 * t115 + k38 * t119;
+  const T t230 = k27 * t64 - k40 * t68 + k21 * t72 - k11 * t76 + k15 * t80 - k37 * t84 + k9 * t88 - k50 * t92
+      + k3 * t96 - k31 * t100 - k42 * t104 + k25 * t108 - k46 * t112 + k19 * t116 - k13 * t120;
+  const T t231 = k27 * t65 - k40 * t69 + k21 * t73 - k11 * t77 + k15 * t81 - k37 * t85 + k9 * t89 - k50 * t93
+      + k3 * t97 - k31 * t101 - k42 * t105 + k25 * t109 - k46 * t113 + k19 * t117 - k13 * t121;
+  const T t232 = t228 + t231;
+  const T t233 = t229 - t230;
+  const T t234 = t228 - t231;
+  const T t235 = t229 + t230;
+  const T t236 = t0 - k28 * t62 + k41 * t66 - k26 * t70 + k2 * t74 - k24 * t78 + k4 * t82 - k22 * t86 + k45 * t90
+      - k20 * t94 + k8 * t98 - k18 * t102 + k10 * t106 - k16 * t110 + k38 * t114 - k14 * t118;
+  const T t237 = t1 - k28 * t63 + k41 * t67 - k26 * t71 + k2 * t75 - k24 * t79 + k4 * t83 - k22 * t87 + k45 * t91
+      - k20 * t95 + k8 * t99 - k18 * t103 + k10 * t107 - k16 * t111 + k38 * t115 - k14 * t119;
+  const T t238 = k29 * t64 - k42 * t68 + k27 * t72 - k48 * t76 + k25 * t80 - k40 * t84 + k23 * t88 - k46 * t92
+      + k21 * t96 - k39 * t100 + k19 * t104 - k11 * t108 + k17 * t112 - k13 * t116 + k15 * t120;
+  const T t239 = k29 * t65 - k42 * t69 + k27 * t73 - k48 * t77 + k25 * t81 - k40 * t85 + k23 * t89 - k46 * t93
+      + k21 * t97 - k39 * t101 + k19 * t105 - k11 * t109 + k17 * t113 - k13 * t117 + k15 * t121;
+  const T t240 = t236 + t239;
+  const T t241 = t237 - t238;
+  const T t242 = t236 - t239;
+  const T t243 = t237 + t238;
+  out[0 * stride_out + 0] = t122;
+  out[0 * stride_out + 1] = t123;
+  out[2 * stride_out + 0] = t128;
+  out[2 * stride_out + 1] = t129;
+  out[4 * stride_out + 0] = t136;
+  out[4 * stride_out + 1] = t137;
+  out[6 * stride_out + 0] = t144;
+  out[6 * stride_out + 1] = t145;
+  out[8 * stride_out + 0] = t152;
+  out[8 * stride_out + 1] = t153;
+  out[10 * stride_out + 0] = t160;
+  out[10 * stride_out + 1] = t161;
+  out[12 * stride_out + 0] = t168;
+  out[12 * stride_out + 1] = t169;
+  out[14 * stride_out + 0] = t176;
+  out[14 * stride_out + 1] = t177;
+  out[16 * stride_out + 0] = t184;
+  out[16 * stride_out + 1] = t185;
+  out[18 * stride_out + 0] = t192;
+  out[18 * stride_out + 1] = t193;
+  out[20 * stride_out + 0] = t200;
+  out[20 * stride_out + 1] = t201;
+  out[22 * stride_out + 0] = t208;
+  out[22 * stride_out + 1] = t209;
+  out[24 * stride_out + 0] = t216;
+  out[24 * stride_out + 1] = t217;
+  out[26 * stride_out + 0] = t224;
+  out[26 * stride_out + 1] = t225;
+  out[28 * stride_out + 0] = t232;
+  out[28 * stride_out + 1] = t233;
+  out[30 * stride_out + 0] = t240;
+  out[30 * stride_out + 1] = t241;
+  out[32 * stride_out + 0] = t242;
+  out[32 * stride_out + 1] = t243;
+  out[34 * stride_out + 0] = t234;
+  out[34 * stride_out + 1] = t235;
+  out[36 * stride_out + 0] = t226;
+  out[36 * stride_out + 1] = t227;
+  out[38 * stride_out + 0] = t218;
+  out[38 * stride_out + 1] = t219;
+  out[40 * stride_out + 0] = t210;
+  out[40 * stride_out + 1] = t211;
+  out[42 * stride_out + 0] = t202;
+  out[42 * stride_out + 1] = t203;
+  out[44 * stride_out + 0] = t194;
+  out[44 * stride_out + 1] = t195;
+  out[46 * stride_out + 0] = t186;
+  out[46 * stride_out + 1] = t187;
+  out[48 * stride_out + 0] = t178;
+  out[48 * stride_out + 1] = t179;
+  out[50 * stride_out + 0] = t170;
+  out[50 * stride_out + 1] = t171;
+  out[52 * stride_out + 0] = t162;
+  out[52 * stride_out + 1] = t163;
+  out[54 * stride_out + 0] = t154;
+  out[54 * stride_out + 1] = t155;
+  out[56 * stride_out + 0] = t146;
+  out[56 * stride_out + 1] = t147;
+  out[58 * stride_out + 0] = t138;
+  out[58 * stride_out + 1] = t139;
+  out[60 * stride_out + 0] = t130;
+  out[60 * stride_out + 1] = t131;
+  // clang-format on
+}
+
+/**
+ * Checks whether there is a codelet for the given size.
+ *
+ * @param fft_size size of the DFT transform
+ * @return true if `codelet_dft` can compute the DFT of this size
+ */
+PORTFFT_INLINE constexpr bool has_codelet(Idx fft_size) {
+  switch (fft_size) {
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 19:
+    case 23:
+    case 29:
+    case 31:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * Calculates DFT using the codelet for its size. Can work in or out of place. Does nothing if `has_codelet(fft_size)`
+ * is false.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param in pointer to input
+ * @param out pointer to output
+ * @param fft_size size of the DFT transform
+ * @param stride_in stride (in complex values) between complex values in `in`
+ * @param stride_out stride (in complex values) between complex values in `out`
+ */
+template <typename T>
+PORTFFT_INLINE void codelet_dft(const T* in, T* out, Idx fft_size, Idx stride_in, Idx stride_out) {
+  switch (fft_size) {
+    case 2:
+      codelet_dft_2(in, out, stride_in, stride_out);
+      break;
+    case 3:
+      codelet_dft_3(in, out, stride_in, stride_out);
+      break;
+    case 4:
+      codelet_dft_4(in, out, stride_in, stride_out);
+      break;
+    case 5:
+      codelet_dft_5(in, out, stride_in, stride_out);
+      break;
+    case 6:
+      codelet_dft_6(in, out, stride_in, stride_out);
+      break;
+    case 7:
+      codelet_dft_7(in, out, stride_in, stride_out);
+      break;
+    case 8:
+      codelet_dft_8(in, out, stride_in, stride_out);
+      break;
+    case 9:
+      codelet_dft_9(in, out, stride_in, stride_out);
+      break;
+    case 10:
+      codelet_dft_10(in, out, stride_in, stride_out);
+      break;
+    case 11:
+      codelet_dft_11(in, out, stride_in, stride_out);
+      break;
+    case 12:
+      codelet_dft_12(in, out, stride_in, stride_out);
+      break;
+    case 13:
+      codelet_dft_13(in, out, stride_in, stride_out);
+      break;
+    case 14:
+      codelet_dft_14(in, out, stride_in, stride_out);
+      break;
+    case 15:
+      codelet_dft_15(in, out, stride_in, stride_out);
+      break;
+    case 16:
+      codelet_dft_16(in, out, stride_in, stride_out);
+      break;
+    case 17:
+      codelet_dft_17(in, out, stride_in, stride_out);
+      break;
+    case 19:
+      codelet_dft_19(in, out, stride_in, stride_out);
+      break;
+    case 23:
+      codelet_dft_23(in, out, stride_in, stride_out);
+      break;
+    case 29:
+      codelet_dft_29(in, out, stride_in, stride_out);
+      break;
+    case 31:
+      codelet_dft_31(in, out, stride_in, stride_out);
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace portfft::detail
+
+#endif
@@ -116,6 +116,7 @@ PORTFFT_INLINE inline IdxGlobal get_outer_batch_offset(const IdxGlobal* factors,
  *
  * @tparam Scalar  Scalar type
  * @tparam SubgroupSize Subgroup size
+ * @tparam TIn type of the real values stored in the input. Converted to `Scalar` on load.
  * @param input input pointer
  * @param output output pointer
  * @param input_imag input pointer for imaginary data
@@ -131,8 +132,8 @@ PORTFFT_INLINE inline IdxGlobal get_outer_batch_offset(const IdxGlobal* factors,
  * @param global_data global data
  * @param kh kernel handler
  */
-template <typename Scalar, Idx SubgroupSize>
-PORTFFT_INLINE void dispatch_level(const Scalar* input, Scalar* output, const Scalar* input_imag, Scalar* output_imag,
+template <typename Scalar, Idx SubgroupSize, typename TIn>
+PORTFFT_INLINE void dispatch_level(const TIn* input, Scalar* output, const TIn* input_imag, Scalar* output_imag,
                                    const Scalar* implementation_twiddles, const Scalar* store_modifier_data,
                                    Scalar* input_loc, Scalar* twiddles_loc, const IdxGlobal* factors,
                                    const IdxGlobal* inner_batches, const IdxGlobal* inclusive_scan,
@@ -155,13 +156,15 @@ PORTFFT_INLINE void dispatch_level(const Scalar* input, Scalar* output, const Sc
     } else if (level == detail::level::SUBGROUP) {
       subgroup_impl<SubgroupSize, Scalar>(input + outer_batch_offset, output + outer_batch_offset,
                                           input_imag + outer_batch_offset, output_imag + outer_batch_offset, input_loc,
-                                          twiddles_loc, batch_size, implementation_twiddles, global_data, kh,
-                                          static_cast<const Scalar*>(nullptr), store_modifier_data);
+                                          twiddles_loc, static_cast<Scalar*>(nullptr), batch_size,
+                                          implementation_twiddles, global_data, kh, static_cast<const Scalar*>(nullptr),
+                                          store_modifier_data);
     } else if (level == detail::level::WORKGROUP) {
       workgroup_impl<SubgroupSize, Scalar>(input + outer_batch_offset, output + outer_batch_offset,
                                            input_imag + outer_batch_offset, output_imag + outer_batch_offset, input_loc,
-                                           twiddles_loc, batch_size, implementation_twiddles, global_data, kh,
-                                           static_cast<Scalar*>(nullptr), store_modifier_data);
+                                           twiddles_loc, static_cast<Scalar*>(nullptr), batch_size,
+                                           implementation_twiddles, global_data, kh, static_cast<Scalar*>(nullptr),
+                                           store_modifier_data);
     }
     sycl::group_barrier(global_data.it.get_group());
   }
@@ -171,7 +174,7 @@ PORTFFT_INLINE void dispatch_level(const Scalar* input, Scalar* output, const Sc
  * Prepares the launch of transposition at a particular level
  * @tparam Scalar Scalar type
  * @tparam Domain Domain of the FFT
- * @tparam TOut Output type
+ * @tparam TOut Output type. Its real values may be of a reduced precision storage type.
  * @param kd_struct kernel data struct
  * @param input input pointer
  * @param output output usm/buffer
@@ -195,6 +198,7 @@ sycl::event transpose_level(const typename committed_descriptor_impl<Scalar, Dom
                             complex_storage storage) {
   PORTFFT_LOG_FUNCTION_ENTRY();
   constexpr detail::memory Mem = std::is_pointer_v<TOut> ? detail::memory::USM : detail::memory::BUFFER;
+  using StorageScalar = detail::get_storage_scalar_t<TOut>;
   const IdxGlobal vec_size = storage == complex_storage::INTERLEAVED_COMPLEX ? 2 : 1;
   std::vector<sycl::event> transpose_events;
   IdxGlobal ld_input = kd_struct.factors.at(1);
@@ -205,7 +209,7 @@ sycl::event transpose_level(const typename committed_descriptor_impl<Scalar, Dom
        batch_in_l2 < num_batches_in_l2 && (static_cast<IdxGlobal>(batch_in_l2) + batch_start) < n_transforms;
        batch_in_l2++) {
     transpose_events.push_back(queue.submit([&](sycl::handler& cgh) {
-      auto out_acc_or_usm = detail::get_access<Scalar>(output, cgh);
+      auto out_acc_or_usm = detail::get_access(output, cgh);
       sycl::local_accessor<Scalar, 2> loc({16, 16 * static_cast<std::size_t>(vec_size)}, cgh);
       if (static_cast<Idx>(events.size()) < num_batches_in_l2) {
         cgh.depends_on(events);
@@ -226,7 +230,7 @@ sycl::event transpose_level(const typename committed_descriptor_impl<Scalar, Dom
           detail::round_up_to_multiple(static_cast<std::size_t>(ld_input), static_cast<std::size_t>(16));
       PORTFFT_LOG_TRACE("Launching transpose kernel with global_size", ld_output_rounded, ld_input_rounded,
                         "local_size", 16, 16);
-      cgh.parallel_for<detail::transpose_kernel<Scalar, Mem>>(
+      cgh.parallel_for<detail::transpose_kernel<Scalar, Mem, StorageScalar>>(
           sycl::nd_range<2>({ld_output_rounded, ld_input_rounded}, {16, 16}),
           [=
 #ifdef PORTFFT_KERNEL_LOG
@@ -307,6 +311,7 @@ std::vector<sycl::event> compute_level(
     sycl::queue& queue) {
   PORTFFT_LOG_FUNCTION_ENTRY();
   constexpr detail::memory Mem = std::is_pointer_v<TIn> ? detail::memory::USM : detail::memory::BUFFER;
+  using StorageScalar = detail::get_storage_scalar_t<TIn>;
   IdxGlobal local_range = kd_struct.local_range;
   IdxGlobal global_range = kd_struct.global_range;
   IdxGlobal batch_size = kd_struct.batch_size;
@@ -334,8 +339,8 @@ std::vector<sycl::event> compute_level(
     events.push_back(queue.submit([&](sycl::handler& cgh) {
       sycl::local_accessor<Scalar, 1> loc_for_input(local_memory_for_input, cgh);
       sycl::local_accessor<Scalar, 1> loc_for_twiddles(loc_mem_for_twiddles, cgh);
-      auto in_acc_or_usm = detail::get_access<const Scalar>(input, cgh);
-      auto in_imag_acc_or_usm = detail::get_access<const Scalar>(input_imag, cgh);
+      auto in_acc_or_usm = detail::get_access(input, cgh);
+      auto in_imag_acc_or_usm = detail::get_access(input_imag, cgh);
       cgh.use_kernel_bundle(kd_struct.exec_bundle);
       if (static_cast<Idx>(dependencies.size()) < num_batches_in_l2) {
         cgh.depends_on(dependencies);
@@ -359,7 +364,7 @@ std::vector<sycl::event> compute_level(
 #endif
       PORTFFT_LOG_TRACE("Launching kernel for global implementation with global_size", global_range, "local_size",
                         local_range);
-      cgh.parallel_for<global_kernel<Scalar, Domain, Mem, SubgroupSize>>(
+      cgh.parallel_for<global_kernel<Scalar, Domain, Mem, SubgroupSize, StorageScalar>>(
           sycl::nd_range<1>(sycl::range<1>(static_cast<std::size_t>(global_range)),
                             sycl::range<1>(static_cast<std::size_t>(local_range))),
           [=
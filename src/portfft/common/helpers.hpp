@@ -196,6 +196,41 @@ PORTFFT_INLINE void conjugate_inplace(T* priv, Idx num_complex) {
     priv[2 * i + 1] *= -1;
   }
 }
+
+/**
+ * Multiplies complex data in an array in place with real window values (expected to be used on private memory)
+ * @tparam T Scalar type
+ * @param priv pointer to the data
+ * @param window pointer to the window value of the first complex number
+ * @param num_complex number of complex numbers to multiply
+ */
+template <typename T>
+PORTFFT_INLINE void apply_window_inplace(T* priv, const T* window, Idx num_complex) {
+  PORTFFT_UNROLL
+  for (Idx i = 0; i < num_complex; i++) {
+    priv[2 * i] *= window[i];
+    priv[2 * i + 1] *= window[i];
+  }
+}
+
+/**
+ * Calculates the offset of the first element of a transform when the transforms form two batch dimensions: batches
+ * of `batches_per_outer_batch` transforms `distance` apart, with consecutive such batches `outer_distance` apart.
+ *
+ * @param batch index of the transform
+ * @param distance distance between the transforms of the inner batch dimension
+ * @param outer_distance distance between the batches of the outer batch dimension
+ * @param batches_per_outer_batch number of transforms in each batch of the outer batch dimension, 0 for a single batch
+ * dimension
+ * @return offset of the first element of the transform in elements
+ */
+PORTFFT_INLINE inline IdxGlobal get_batch_offset(IdxGlobal batch, IdxGlobal distance, IdxGlobal outer_distance,
+                                                 IdxGlobal batches_per_outer_batch) {
+  if (batches_per_outer_batch == 0) {
+    return distance * batch;
+  }
+  return distance * (batch % batches_per_outer_batch) + outer_distance * (batch / batches_per_outer_batch);
+}
 }  // namespace portfft::detail
 
 #endif
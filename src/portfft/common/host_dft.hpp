@@ -23,7 +23,13 @@
 
 #include "portfft/common/helpers.hpp"
 #include "portfft/defines.hpp"
+
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace portfft {
 namespace detail {
@@ -51,58 +57,107 @@ void host_naive_dft(std::complex<T>* input, std::complex<T>* output, std::size_t
 }
 
 /**
- * Host implementation of the cooley tukey algorithm. Handles prime values using the naive implementation
+ * Calculates the twiddles used by `host_fft`: `twiddles[k] = exp(-2*pi*i*k/fft_size)` for `0 <= k < fft_size`, in
+ * double precision. Only the first octant is evaluated with std::cos and std::sin, the rest is obtained by symmetry.
+ * @param twiddles pointer to `fft_size` values to fill
+ * @param fft_size DFT size
+ */
+inline void host_fft_twiddles(std::complex<double>* twiddles, std::size_t fft_size) {
+  for (std::size_t k = 0; k < fft_size; k++) {
+    // exp(-2*pi*i*k/n) with the angle reduced to [0, pi/4] by swapping and negating the sine and cosine
+    std::size_t octant_k = 8 * k;
+    std::size_t octant = octant_k / fft_size;
+    std::size_t rem = octant_k - octant * fft_size;
+    bool reflect = octant % 2 == 1;
+    double angle = M_PI / 4 * static_cast<double>(reflect ? fft_size - rem : rem) / static_cast<double>(fft_size);
+    double c = std::cos(angle);
+    double s = std::sin(angle);
+    if (reflect) {
+      std::swap(c, s);
+    }
+    // c + i*s is exp(i*theta) for theta = pi/2 * (octant / 2) + angle, rotate by the quadrant
+    switch (octant / 2) {
+      case 0:
+        break;
+      case 1:
+        std::tie(c, s) = std::make_pair(-s, c);
+        break;
+      case 2:
+        std::tie(c, s) = std::make_pair(-c, -s);
+        break;
+      default:
+        std::tie(c, s) = std::make_pair(s, -c);
+        break;
+    }
+    twiddles[k] = std::complex<double>(c, -s);
+  }
+}
+
+/**
+ * Host FFT of any size. It is computed iteratively in double precision with the self-sorting Stockham algorithm, one
+ * pass per prime factor of the size, so it takes O(fft_size * sum of prime factors) operations. The twiddles are
+ * calculated once and shared by all the passes and the only allocation is a single workspace.
  * @tparam T Scalar type for std::complex
  * @param input pointer of type std::complex<T> containing the input values
- * @param output otuput pointer of type std::complex<T> containing the output values
+ * @param output output pointer of type std::complex<T> containing the output values
  * @param fft_size DFT size
  */
 template <typename T>
-void host_cooley_tukey(std::complex<T>* input, std::complex<T>* output, std::size_t fft_size) {
-  std::size_t n = detail::factorize(fft_size);
-  if (n == 1 || fft_size <= 8) {
-    host_naive_dft(input, output, fft_size);
-    return;
-  }
-
-  std::size_t m = fft_size / n;
-  std::size_t scratch_size = n > m ? n : m;
-  std::vector<std::complex<T>> scratch_space(scratch_size);
-  std::vector<std::complex<T>> scratch_space2(scratch_size);
-  std::vector<std::complex<T>> output_buffer(fft_size);
-
-  for (std::size_t i = 0; i < m; i++) {
-    for (std::size_t j = 0; j < n; j++) {
-      scratch_space[j] = input[j * m + i];
+void host_fft(const std::complex<T>* input, std::complex<T>* output, std::size_t fft_size) {
+  using complex_t = std::complex<double>;
+  std::size_t max_radix = 1;
+  for (std::size_t remaining = fft_size, radix = 2; remaining > 1; radix++) {
+    if (radix * radix > remaining) {
+      radix = remaining;
     }
-    host_cooley_tukey(scratch_space.data(), scratch_space2.data(), n);
-    for (std::size_t j = 0; j < n; j++) {
-      output[j * m + i] = scratch_space2[j];
+    for (; remaining % radix == 0; remaining /= radix) {
+      max_radix = std::max(max_radix, radix);
     }
   }
-
-  for (std::size_t i = 0; i < n; i++) {
-    for (std::size_t j = 0; j < m; j++) {
-      // Not using sycl::cospi / sycl::sinpi as std::cos/std::sin provides better accuracy in float and double tests
-      double theta = -2 * M_PI * static_cast<double>(i * j) / static_cast<double>(n * m);
-      output[i * m + j] *= std::complex<T>(static_cast<T>(std::cos(theta)), static_cast<T>(std::sin(theta)));
-    }
+  // twiddles, two buffers the passes alternate between and the values of one butterfly
+  std::vector<complex_t> workspace(3 * fft_size + max_radix);
+  complex_t* twiddles = workspace.data();
+  complex_t* x = twiddles + fft_size;
+  complex_t* y = x + fft_size;
+  complex_t* butterfly = y + fft_size;
+  host_fft_twiddles(twiddles, fft_size);
+  for (std::size_t i = 0; i < fft_size; i++) {
+    x[i] = complex_t(static_cast<double>(input[i].real()), static_cast<double>(input[i].imag()));
   }
 
-  for (std::size_t i = 0; i < n; i++) {
-    for (std::size_t j = 0; j < m; j++) {
-      scratch_space[j] = output[i * m + j];
+  // Each pass splits DFTs of size `n` into `radix` DFTs of size `n / radix`, with `stride` interleaved DFTs.
+  std::size_t stride = 1;
+  for (std::size_t n = fft_size, radix = 2; n > 1;) {
+    if (radix * radix > n) {
+      radix = n;
     }
-    host_cooley_tukey(scratch_space.data(), scratch_space2.data(), m);
-    for (std::size_t j = 0; j < m; j++) {
-      output_buffer[i * m + j] = scratch_space2[j];
+    if (n % radix != 0) {
+      radix++;
+      continue;
     }
+    std::size_t m = n / radix;
+    std::size_t radix_twiddle_step = fft_size / radix;
+    std::size_t twiddle_step = fft_size / n;
+    for (std::size_t p = 0; p < m; p++) {
+      for (std::size_t q = 0; q < stride; q++) {
+        for (std::size_t t = 0; t < radix; t++) {
+          butterfly[t] = x[q + stride * (p + t * m)];
+        }
+        for (std::size_t u = 0; u < radix; u++) {
+          complex_t sum = butterfly[0];
+          for (std::size_t t = 1; t < radix; t++) {
+            sum += butterfly[t] * twiddles[(radix_twiddle_step * t * u) % fft_size];
+          }
+          y[q + stride * (radix * p + u)] = sum * twiddles[twiddle_step * p * u];
+        }
+      }
+    }
+    std::swap(x, y);
+    stride *= radix;
+    n = m;
   }
-
   for (std::size_t i = 0; i < fft_size; i++) {
-    std::size_t j = i / n;
-    std::size_t k = i % n;
-    output[i] = output_buffer[k * m + j];
+    output[i] = std::complex<T>(static_cast<T>(x[i].real()), static_cast<T>(x[i].imag()));
   }
 }
 }  // namespace detail
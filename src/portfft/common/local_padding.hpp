@@ -0,0 +1,231 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMON_LOCAL_PADDING_HPP
+#define PORTFFT_COMMON_LOCAL_PADDING_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "helpers.hpp"
+#include "logging.hpp"
+#include "memory_views.hpp"
+#include "portfft/defines.hpp"
+
+namespace portfft::detail {
+
+class local_bank_calibration_kernel;
+
+/**
+ * Counts the local memory accesses serialized by bank conflicts when `n_banks` consecutive work-items each read the
+ * element in the same column of consecutive rows of a row-major matrix, for each column. Each bank is assumed to be 4
+ * bytes wide and to serve one 4 byte word per access.
+ *
+ * @tparam Scalar type of the elements of the matrix
+ * @param row_size number of elements in each row
+ * @param n_banks number of banks in local memory
+ * @param bank_lines_per_pad padding of the matrix as in `pad_local`, 0 for no padding
+ * @return the number of serialized accesses, summed over the columns
+ */
+template <typename Scalar>
+Idx count_column_bank_conflicts(Idx row_size, Idx n_banks, Idx bank_lines_per_pad) {
+  constexpr Idx WordsPerElement = std::max(Idx(1), static_cast<Idx>(sizeof(Scalar)) / 4);
+  // the pattern of conflicts repeats along the row, so a few bank lines of columns are enough to compare paddings
+  Idx n_columns = std::min(row_size, 4 * n_banks);
+  std::vector<Idx> accesses_per_bank(static_cast<std::size_t>(n_banks));
+  Idx res = 0;
+  for (Idx column = 0; column < n_columns; column++) {
+    std::fill(accesses_per_bank.begin(), accesses_per_bank.end(), 0);
+    for (Idx lane = 0; lane < n_banks; lane++) {
+      Idx idx = pad_local(lane * row_size + column, bank_lines_per_pad, n_banks);
+      for (Idx word = 0; word < WordsPerElement; word++) {
+        accesses_per_bank[static_cast<std::size_t>((idx * WordsPerElement + word) % n_banks)]++;
+      }
+    }
+    res += *std::max_element(accesses_per_bank.begin(), accesses_per_bank.end());
+  }
+  return res;
+}
+
+/**
+ * Chooses the padding of local memory for a layout in which consecutive work-items access elements `row_size` apart,
+ * such as each work-item reading its own row of a row-major matrix or a group of work-items reading a column of it.
+ * Padding options are compared by simulating the bank conflicts. Of the options with the fewest conflicts, the one
+ * with the least padding is chosen. This handles rows that are a multiple of the bank line as well as rows that are
+ * a fraction of it, like half a bank line, where padding every bank line spreads the rows sharing a line over the
+ * banks.
+ *
+ * @tparam Scalar type of the elements stored in local memory
+ * @param row_size distance between the elements accessed by consecutive work-items, in elements
+ * @param n_banks number of banks in local memory, 0 if it is not banked
+ * @return bank lines per pad to use with `pad_local` and `padded_view`, 0 for no padding
+ */
+template <typename Scalar>
+Idx choose_bank_lines_per_pad(Idx row_size, Idx n_banks) {
+  if (n_banks <= 0 || row_size <= 0) {
+    return 0;
+  }
+  Idx row_lines = divide_ceil(row_size, n_banks);
+  std::vector<Idx> candidates;
+  for (Idx bank_lines_per_pad = 1; bank_lines_per_pad <= std::min(row_lines, Idx(16)); bank_lines_per_pad++) {
+    candidates.push_back(bank_lines_per_pad);
+  }
+  for (Idx bank_lines_per_pad = 32; bank_lines_per_pad < row_lines; bank_lines_per_pad *= 2) {
+    candidates.push_back(bank_lines_per_pad);
+  }
+  if (row_lines > 16) {
+    candidates.push_back(row_lines);
+  }
+  Idx best = 0;
+  Idx best_conflicts = count_column_bank_conflicts<Scalar>(row_size, n_banks, 0);
+  for (Idx bank_lines_per_pad : candidates) {
+    Idx conflicts = count_column_bank_conflicts<Scalar>(row_size, n_banks, bank_lines_per_pad);
+    // no padding is preferred on ties, then the padding with the most bank lines between pads
+    if (conflicts < best_conflicts || (conflicts == best_conflicts && best != 0 && bank_lines_per_pad > best)) {
+      best = bank_lines_per_pad;
+      best_conflicts = conflicts;
+    }
+  }
+  return best;
+}
+
+/**
+ * Measures the number of local memory banks of a device. A single subgroup-sized workgroup reads local memory with
+ * power of two strides between its work-items. The time grows with the stride until it reaches the number of banks,
+ * when all the work-items access the same bank, and stays constant for larger strides.
+ *
+ * @param queue queue for the device to measure
+ * @return the number of 4 byte wide banks, 0 if the device does not show any bank conflicts
+ */
+inline Idx measure_local_banks(sycl::queue& queue) {
+  PORTFFT_LOG_FUNCTION_ENTRY();
+  constexpr Idx NLanes = 32;
+  constexpr Idx MaxStride = 128;
+  constexpr Idx NElements = NLanes * MaxStride;
+  constexpr Idx NIterations = 4096;
+  constexpr Idx NRepetitions = 3;
+  sycl::device dev = queue.get_device();
+  if (!dev.has(sycl::aspect::queue_profiling) ||
+      dev.get_info<sycl::info::device::local_mem_size>() < NElements * sizeof(float) ||
+      dev.get_info<sycl::info::device::max_work_group_size>() < static_cast<std::size_t>(NLanes)) {
+    PORTFFT_LOG_WARNING("Can not measure the number of local memory banks, assuming", PORTFFT_N_LOCAL_BANKS);
+    return PORTFFT_N_LOCAL_BANKS;
+  }
+  sycl::queue profiling_queue(queue.get_context(), dev, sycl::property::queue::enable_profiling());
+  float* out = sycl::malloc_device<float>(NLanes, profiling_queue);
+  std::vector<double> times;
+  for (Idx stride = 1; stride <= MaxStride; stride *= 2) {
+    double best_time = std::numeric_limits<double>::max();
+    for (Idx repetition = 0; repetition < NRepetitions; repetition++) {
+      sycl::event event = profiling_queue.submit([&](sycl::handler& cgh) {
+        sycl::local_accessor<float, 1> loc(static_cast<std::size_t>(NElements), cgh);
+        cgh.parallel_for<local_bank_calibration_kernel>(
+            sycl::nd_range<1>{{static_cast<std::size_t>(NLanes)}, {static_cast<std::size_t>(NLanes)}},
+            [=](sycl::nd_item<1> it) {
+              Idx local_id = static_cast<Idx>(it.get_local_linear_id());
+              // zeros the compiler can not see through, so the loads below depend on each other
+              float zero = static_cast<float>(it.get_local_range(0) - static_cast<std::size_t>(NLanes));
+              for (Idx i = local_id; i < NElements; i += NLanes) {
+                loc[static_cast<std::size_t>(i)] = zero;
+              }
+              sycl::group_barrier(it.get_group());
+              float sum = 0;
+              Idx idx = local_id * stride;
+              for (Idx i = 0; i < NIterations; i++) {
+                float val = loc[static_cast<std::size_t>(idx)];
+                sum += val;
+                // all the work-items move to the next column, keeping the stride between them
+                idx = (idx + 1 + static_cast<Idx>(val)) % NElements;
+              }
+              out[local_id] = sum;
+            });
+      });
+      event.wait();
+      auto start = event.get_profiling_info<sycl::info::event_profiling::command_start>();
+      auto end = event.get_profiling_info<sycl::info::event_profiling::command_end>();
+      best_time = std::min(best_time, static_cast<double>(end - start));
+    }
+    times.push_back(best_time);
+  }
+  sycl::free(out, profiling_queue);
+  PORTFFT_LOG_TRACE("Local memory access times for power of two strides:", times);
+
+  constexpr double ConflictThreshold = 1.5;
+  constexpr double PlateauThreshold = 1.1;
+  if (times.back() < ConflictThreshold * times.front()) {
+    return 0;
+  }
+  for (std::size_t i = 0; i + 1 < times.size(); i++) {
+    if (times[i] > ConflictThreshold * times.front() && times[i + 1] < PlateauThreshold * times[i]) {
+      return Idx(1) << i;
+    }
+  }
+  return MaxStride;
+}
+
+/**
+ * Gets the number of local memory banks of the device of the queue. When PORTFFT_CALIBRATE_LOCAL_BANKS is enabled it
+ * is measured the first time a device is used and cached for later calls, otherwise it is PORTFFT_N_LOCAL_BANKS.
+ * Measurements of different devices run concurrently; calls for a device that is being measured wait for it.
+ *
+ * @param queue queue for the device
+ * @return the number of 4 byte wide banks, 0 if local memory is not banked
+ */
+inline Idx get_local_banks(sycl::queue& queue) {
+#if PORTFFT_CALIBRATE_LOCAL_BANKS
+  struct cache_entry {
+    std::once_flag measured;
+    Idx n_banks = 0;
+  };
+  static std::mutex mutex;
+  static std::unordered_map<sycl::device, std::shared_ptr<cache_entry>> cache;
+  std::shared_ptr<cache_entry> entry;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<cache_entry>& cached = cache[queue.get_device()];
+    if (!cached) {
+      cached = std::make_shared<cache_entry>();
+    }
+    entry = cached;
+  }
+  // if the measurement throws, the next call for the device measures again
+  std::call_once(entry->measured, [&]() {
+    entry->n_banks = measure_local_banks(queue);
+    if (entry->n_banks != PORTFFT_N_LOCAL_BANKS) {
+      PORTFFT_LOG_WARNING("Measured", entry->n_banks, "local memory banks, which differs from PORTFFT_N_LOCAL_BANKS =",
+                          PORTFFT_N_LOCAL_BANKS);
+    }
+  });
+  return entry->n_banks;
+#else
+  static_cast<void>(queue);
+  return PORTFFT_N_LOCAL_BANKS;
+#endif
+}
+
+}  // namespace portfft::detail
+
+#endif  // PORTFFT_COMMON_LOCAL_PADDING_HPP
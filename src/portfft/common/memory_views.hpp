@@ -63,23 +63,26 @@ struct offset_view {
 };
 
 /**
- * If Pad is true, transforms an index into local memory to skip one element for every PORTFFT_N_LOCAL_BANKS *
- * bank_lines_per_pad elements. Padding in this way avoids bank conflicts when accessing elements with a stride that is
- * multiple of (or has any common divisor greater than 1 with) the number of local banks. Does nothing if Pad is false.
+ * If Pad is true, transforms an index into local memory to skip one element for every n_banks * bank_lines_per_pad
+ * elements. Padding in this way avoids bank conflicts when accessing elements with a stride that is multiple of (or has
+ * any common divisor greater than 1 with) the number of local banks. Does nothing if Pad is false, bank_lines_per_pad
+ * is 0 or n_banks is 0, for local memory that is not banked.
  *
  * Can also be used to transform size of a local allocation to account for padding indices in it this way.
  *
  * @tparam Pad whether to do padding
  * @tparam T input type to the function
  * @param local_idx index to transform
- * @param bank_lines_per_pad A padding space will be added after every `bank_lines_per_pad` groups of
- * `PORTFFT_N_LOCAL_BANKS` banks.
+ * @param bank_lines_per_pad A padding space will be added after every `bank_lines_per_pad` groups of `n_banks` banks.
+ * @param n_banks number of banks in local memory
  * @return transformed local_idx
  */
 template <detail::pad Pad = detail::pad::DO_PAD, typename T>
-PORTFFT_INLINE T pad_local(T local_idx, T bank_lines_per_pad) {
+PORTFFT_INLINE T pad_local(T local_idx, T bank_lines_per_pad, T n_banks = static_cast<T>(PORTFFT_N_LOCAL_BANKS)) {
   if constexpr (Pad == detail::pad::DO_PAD) {
-    local_idx += local_idx / (PORTFFT_N_LOCAL_BANKS * bank_lines_per_pad);
+    if (bank_lines_per_pad != 0 && n_banks != 0) {
+      local_idx += local_idx / (n_banks * bank_lines_per_pad);
+    }
   }
   return local_idx;
 }
@@ -95,22 +98,23 @@ struct padded_view {
 
   ParentT parent;
   Idx bank_lines_per_pad;
+  Idx n_banks;
 
   // Constructor: Create a view of a pointer or another view.
-  constexpr padded_view(ParentT parent, Idx bank_lines_per_pad) noexcept
-      : parent(parent), bank_lines_per_pad(bank_lines_per_pad){};
+  constexpr padded_view(ParentT parent, Idx bank_lines_per_pad, Idx n_banks = PORTFFT_N_LOCAL_BANKS) noexcept
+      : parent(parent), bank_lines_per_pad(bank_lines_per_pad), n_banks(n_banks){};
 
   /// Is this view contiguous?
   PORTFFT_INLINE constexpr bool is_contiguous() const noexcept {
-    return is_contiguous_view(parent) && bank_lines_per_pad == 0;
+    return is_contiguous_view(parent) && (bank_lines_per_pad == 0 || n_banks == 0);
   }
 
   // Index into the view.
   PORTFFT_INLINE constexpr reference operator[](Idx i) const {
-    if (bank_lines_per_pad == 0) {
+    if (bank_lines_per_pad == 0 || n_banks == 0) {
       return parent[i];
     }
-    return parent[pad_local<pad::DO_PAD>(i, bank_lines_per_pad)];
+    return parent[pad_local<pad::DO_PAD>(i, bank_lines_per_pad, n_banks)];
   }
 };
 
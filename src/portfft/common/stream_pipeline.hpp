@@ -0,0 +1,333 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMON_STREAM_PIPELINE_HPP
+#define PORTFFT_COMMON_STREAM_PIPELINE_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "portfft/common/exceptions.hpp"
+#include "portfft/common/logging.hpp"
+#include "portfft/defines.hpp"
+#include "portfft/utils.hpp"
+
+namespace portfft::detail {
+
+/**
+ * Streams chunks of data in host memory through a ring of slots of device memory. The upload of each chunk, on its own
+ * in-order queue, and its download, on another one, overlap with the computation of the other chunks in flight. The
+ * computations of all the chunks run one after the other, as the plans computing them share their scratch memory.
+ * The events of the slots are kept between runs, so a run can start while the chunks of the previous one are still in
+ * flight.
+ *
+ * @tparam T type of the values streamed
+ */
+template <typename T>
+class stream_pipeline {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param queue queue of the device the slots are allocated on
+   * @param ring_size number of chunks in flight, each with its own slot of device memory
+   */
+  stream_pipeline(sycl::queue& queue, std::size_t ring_size)
+      : queue(queue),
+        upload_queue(queue.get_context(), queue.get_device(), sycl::property_list{sycl::property::queue::in_order()}),
+        download_queue(queue.get_context(), queue.get_device(),
+                       sycl::property_list{sycl::property::queue::in_order()}),
+        device_in(ring_size),
+        device_out(ring_size),
+        staging_in(ring_size),
+        staging_out(ring_size),
+        uploads(ring_size),
+        computes(ring_size),
+        downloads(ring_size) {
+    if (ring_size == 0) {
+      throw invalid_configuration("The ring of a stream needs at least one slot");
+    }
+  }
+
+  stream_pipeline(const stream_pipeline&) = delete;
+  stream_pipeline& operator=(const stream_pipeline&) = delete;
+
+  ~stream_pipeline() {
+    // copies on these queues are the last users of the slots
+    upload_queue.wait();
+    download_queue.wait();
+  }
+
+  /**
+   * Get the number of chunks in flight.
+   */
+  std::size_t get_ring_size() const noexcept { return device_in.size(); }
+
+  /**
+   * Get the number of values each slot can hold.
+   */
+  std::size_t get_buffer_size() const noexcept { return buffer_size; }
+
+  /**
+   * Get the device memory the input of the chunk in a slot is uploaded to.
+   *
+   * @param slot index of the slot
+   */
+  T* get_device_in(std::size_t slot) const noexcept { return device_in[slot].get(); }
+
+  /**
+   * Get the device memory the output of the chunk in a slot is downloaded from.
+   *
+   * @param slot index of the slot
+   */
+  T* get_device_out(std::size_t slot) const noexcept { return device_out[slot].get(); }
+
+  /**
+   * Get the pinned host memory the input of the chunk in a slot is gathered in, null without staging memory.
+   *
+   * @param slot index of the slot
+   */
+  T* get_staging_in(std::size_t slot) const noexcept { return staging_in[slot].get(); }
+
+  /**
+   * Get the pinned host memory the output of the chunk in a slot is downloaded to, null without staging memory.
+   *
+   * @param slot index of the slot
+   */
+  T* get_staging_out(std::size_t slot) const noexcept { return staging_out[slot].get(); }
+
+  /**
+   * Get the queue to submit the uploads to.
+   */
+  sycl::queue& get_upload_queue() noexcept { return upload_queue; }
+
+  /**
+   * Get the queue to submit the downloads to.
+   */
+  sycl::queue& get_download_queue() noexcept { return download_queue; }
+
+  /**
+   * Waits for the chunks in flight.
+   */
+  void wait() {
+    sycl::event::wait(uploads);
+    sycl::event::wait(downloads);
+  }
+
+  /**
+   * Makes sure each slot can hold `n_elements` values, and has pinned host staging memory if `staging` is set. Growing
+   * the slots waits for the chunks in flight.
+   *
+   * @param n_elements number of values each slot must hold
+   * @param staging whether pinned host memory is needed as well
+   */
+  void reserve(std::size_t n_elements, bool staging) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const bool has_staging = staging_in.front() != nullptr;
+    if (n_elements <= buffer_size && (has_staging || !staging)) {
+      return;
+    }
+    n_elements = std::max(n_elements, buffer_size);
+    staging = staging || has_staging;
+    PORTFFT_LOG_TRACE("Allocating", 2 * get_ring_size(), "streaming buffers of", n_elements, "values");
+    wait();
+    auto make_shared_host = [this, n_elements]() {
+      return std::shared_ptr<T>(sycl::malloc_host<T>(n_elements, queue), [captured_queue = queue](T* ptr) {
+        if (ptr != nullptr) {
+          sycl::free(ptr, captured_queue);
+        }
+      });
+    };
+    for (std::size_t slot = 0; slot < get_ring_size(); slot++) {
+      device_in[slot] = make_shared<T>(n_elements, queue);
+      device_out[slot] = make_shared<T>(n_elements, queue);
+      if (staging) {
+        staging_in[slot] = make_shared_host();
+        staging_out[slot] = make_shared_host();
+      }
+    }
+    buffer_size = n_elements;
+  }
+
+  /**
+   * Submits chunks to the slots without waiting on the host. The ordering is expressed by events only.
+   *
+   * @tparam UploadF type of the upload function
+   * @tparam ComputeF type of the compute function
+   * @tparam DownloadF type of the download function
+   * @param n_chunks number of chunks
+   * @param upload function (chunk, slot, dependencies) -> sycl::event uploading the input of a chunk to
+   * `get_device_in(slot)`
+   * @param compute function (chunk, slot, dependencies) -> sycl::event computing `get_device_out(slot)`. The
+   * dependencies include the computation of the previous chunk.
+   * @param download function (chunk, slot, dependencies) -> sycl::event downloading `get_device_out(slot)`
+   * @param dependencies events that must complete before the input is read
+   * @return the events of the downloads
+   */
+  template <typename UploadF, typename ComputeF, typename DownloadF>
+  std::vector<sycl::event> submit(std::size_t n_chunks, UploadF&& upload, ComputeF&& compute, DownloadF&& download,
+                                  const std::vector<sycl::event>& dependencies) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    std::vector<sycl::event> res;
+    for (std::size_t chunk = 0; chunk < n_chunks; chunk++) {
+      // later chunks depend on the dependencies through the computation of the chunk before them in the slot
+      res.push_back(submit_chunk(chunk, upload, compute, download,
+                                 chunk < get_ring_size() ? dependencies : std::vector<sycl::event>{}));
+    }
+    return res;
+  }
+
+  /**
+   * Pushes chunks through the slots, with host work before the upload and after the download of each chunk, for
+   * example gathering the input into and scattering the output from the staging memory of the slot. While the device
+   * works on a chunk the host finishes the earlier ones. Returns once all the chunks are finished.
+   *
+   * @tparam UploadF type of the upload function
+   * @tparam ComputeF type of the compute function
+   * @tparam DownloadF type of the download function
+   * @tparam FinishF type of the finish function
+   * @param n_chunks number of chunks
+   * @param upload function (chunk, slot, dependencies) -> sycl::event uploading the input of a chunk to
+   * `get_device_in(slot)`. It is only called once the previous upload from the same slot completed.
+   * @param compute function (chunk, slot, dependencies) -> sycl::event computing `get_device_out(slot)`. The
+   * dependencies include the computation of the previous chunk.
+   * @param download function (chunk, slot, dependencies) -> sycl::event downloading `get_device_out(slot)`
+   * @param finish function (chunk, slot) doing the host work once the download of a chunk completed
+   */
+  template <typename UploadF, typename ComputeF, typename DownloadF, typename FinishF>
+  void run_staged(std::size_t n_chunks, UploadF&& upload, ComputeF&& compute, DownloadF&& download,
+                  FinishF&& finish) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const std::size_t ring_size = get_ring_size();
+    // the first chunk not finished yet
+    std::size_t finished = 0;
+    for (std::size_t chunk = 0; chunk < n_chunks; chunk++) {
+      const std::size_t slot = chunk % ring_size;
+      uploads[slot].wait();
+      submit_chunk(chunk, upload, compute, download, {});
+      // the chunk submitted next reuses the slot of the oldest chunk in flight, finish it before it is overwritten
+      if (chunk + 1 >= ring_size) {
+        downloads[finished % ring_size].wait();
+        finish(finished, finished % ring_size);
+        finished++;
+      }
+    }
+    for (; finished < n_chunks; finished++) {
+      downloads[finished % ring_size].wait();
+      finish(finished, finished % ring_size);
+    }
+  }
+
+ private:
+  sycl::queue queue;
+  sycl::queue upload_queue;
+  sycl::queue download_queue;
+  std::vector<std::shared_ptr<T>> device_in;
+  std::vector<std::shared_ptr<T>> device_out;
+  std::vector<std::shared_ptr<T>> staging_in;
+  std::vector<std::shared_ptr<T>> staging_out;
+  // number of values each of the buffers can hold
+  std::size_t buffer_size = 0;
+  // last upload, computation and download of each slot
+  std::vector<sycl::event> uploads;
+  std::vector<sycl::event> computes;
+  std::vector<sycl::event> downloads;
+  // last computation of any slot
+  sycl::event last_compute;
+
+  /**
+   * Submits the upload, computation and download of a chunk.
+   *
+   * @tparam UploadF type of the upload function
+   * @tparam ComputeF type of the compute function
+   * @tparam DownloadF type of the download function
+   * @param chunk index of the chunk
+   * @param upload upload function, as in `submit`
+   * @param compute compute function, as in `submit`
+   * @param download download function, as in `submit`
+   * @param dependencies events that must complete before the input of the chunk is read
+   * @return the event of the download
+   */
+  template <typename UploadF, typename ComputeF, typename DownloadF>
+  sycl::event submit_chunk(std::size_t chunk, UploadF& upload, ComputeF& compute, DownloadF& download,
+                           std::vector<sycl::event> dependencies) {
+    const std::size_t slot = chunk % get_ring_size();
+    // the input memory of the slot is free once the computation of the chunk using it before has read it
+    dependencies.push_back(computes[slot]);
+    uploads[slot] = upload(chunk, slot, dependencies);
+    // and the output memory once it has been copied back to the host
+    computes[slot] = compute(chunk, slot, std::vector<sycl::event>{uploads[slot], downloads[slot], last_compute});
+    last_compute = computes[slot];
+    downloads[slot] = download(chunk, slot, std::vector<sycl::event>{computes[slot]});
+    return downloads[slot];
+  }
+};
+
+/**
+ * Chooses the number of transforms per chunk of a stream from the throughput of the plan. Chunks of doubling numbers of
+ * transforms are computed on the device until doubling no longer reduces the time per transform by more than 10%, as
+ * smaller chunks give more overlap of the copies with the computation.
+ *
+ * @tparam PrepareF type of the prepare function
+ * @tparam ComputeF type of the compute function
+ * @param max_chunk largest number of transforms per chunk
+ * @param prepare function (n_transforms) making device data for a chunk of `n_transforms` transforms available to
+ * `compute`, not timed
+ * @param compute function (n_transforms) -> sycl::event computing a chunk of `n_transforms` transforms
+ * @return number of transforms per chunk
+ */
+template <typename PrepareF, typename ComputeF>
+std::size_t tune_chunk_transforms(std::size_t max_chunk, PrepareF&& prepare, ComputeF&& compute) {
+  PORTFFT_LOG_FUNCTION_ENTRY();
+  max_chunk = std::max(max_chunk, std::size_t(1));
+  using clock = std::chrono::steady_clock;
+  double best_time_per_transform = std::numeric_limits<double>::max();
+  std::size_t res = 1;
+  for (std::size_t candidate = 1;; candidate = std::min(2 * candidate, max_chunk)) {
+    prepare(candidate);
+    // the first run is not timed, it may include one-time launch overheads
+    compute(candidate).wait();
+    auto start = clock::now();
+    compute(candidate).wait();
+    double time_per_transform =
+        std::chrono::duration<double>(clock::now() - start).count() / static_cast<double>(candidate);
+    PORTFFT_LOG_TRACE("Chunk of", candidate, "transforms took", time_per_transform, "s per transform");
+    if (time_per_transform > 0.9 * best_time_per_transform) {
+      break;
+    }
+    best_time_per_transform = time_per_transform;
+    res = candidate;
+    if (candidate == max_chunk) {
+      break;
+    }
+  }
+  PORTFFT_LOG_TRACE("Chose chunks of", res, "transforms for streaming");
+  return res;
+}
+
+}  // namespace portfft::detail
+
+#endif  // PORTFFT_COMMON_STREAM_PIPELINE_HPP
@@ -30,6 +30,7 @@
 #include "portfft/enums.hpp"
 #include "twiddle.hpp"
 #include "twiddle_calc.hpp"
+#include "twiddle_tables.hpp"
 #include "workitem.hpp"
 
 namespace portfft {
@@ -217,25 +218,134 @@ PORTFFT_INLINE void cross_sg_dft(T& real, T& imag, Idx fft_size, Idx stride, syc
   }
 }
 
+// Relative cost of exchanging one complex value between work-items of a subgroup, in units of the complex
+// multiply-adds counted by `dft_ops_per_value`
+constexpr IdxGlobal SgShuffleCost = 4;
+// Relative cost of loading one twiddle from local memory, in the same units as `SgShuffleCost`
+constexpr IdxGlobal SgTwiddleLoadCost = 2;
+
 /**
- * Factorizes a number into two factors, so that one of them will maximal below
- or equal to subgroup size.
+ * An entry of the tuning table overriding the subgroup factor chosen by the cost model in `factorize_sg`.
+ */
+struct sg_factor_tuning_entry {
+  IdxGlobal fft_size;
+  Idx sg_size;
+  Idx factor_sg;
+};
+
+/*
+Tuning table for `factorize_sg`. Entries can be supplied at compile time by defining PORTFFT_SG_FACTOR_TUNING_TABLE
+as a comma separated list of `{fft_size, sg_size, factor_sg}` triples. The last entry only terminates the table.
+*/
+constexpr sg_factor_tuning_entry SgFactorTuningTable[] = {
+#ifdef PORTFFT_SG_FACTOR_TUNING_TABLE
+    PORTFFT_SG_FACTOR_TUNING_TABLE,
+#endif
+    {0, 0, 0}};
+
+/**
+ * Estimates the number of complex multiply-adds per value of a DFT of size N, as computed by `wi_dft` or
+ * `cross_sg_dft`.
+ * @tparam T type of the size
+ * @param N size of the DFT
+ * @return the estimated number of operations per value
+ */
+template <typename T>
+PORTFFT_INLINE constexpr T dft_ops_per_value(T N) {
+  T f0 = factorize(N);
+  if (f0 < 2) {
+    return N == 2 ? 1 : N;
+  }
+  // the two factors and the twiddle multiplication inbetween
+  return dft_ops_per_value(f0) + dft_ops_per_value(N / f0) + 1;
+}
+
+/**
+ * Counts the subgroup shuffles each work-item does in `cross_sg_dft` of size N.
+ * @tparam T type of the size
+ * @param N size of the DFT
+ * @return the number of shuffles per work-item
+ */
+template <typename T>
+PORTFFT_INLINE constexpr T cross_sg_shuffles(T N) {
+  if (N < 2) {
+    return 0;
+  }
+  T f0 = factorize(N);
+  if (f0 < 2) {
+    // naive DFT reads values from all the work-items of the DFT, except for the xor permute of size 2
+    return N == 2 ? 1 : N;
+  }
+  // the two factors and the transposition inbetween
+  return cross_sg_shuffles(f0) + cross_sg_shuffles(N / f0) + 1;
+}
+
+/**
+ * Factorizes a number into two factors, the first of which is computed across the work-items of a subgroup and must
+ * not exceed the subgroup size.
+ *
+ * If there is an entry for N and sg_size in `SgFactorTuningTable`, its factor is used. Otherwise every divisor of N not
+ * larger than sg_size, whose other factor fits in the registers of a work-item, is scored by the time a subgroup needs
+ * per DFT: the arithmetic, subgroup shuffles and twiddle loads each work-item does, divided by the number of DFTs the
+ * subgroup computes at once (work-items left over when the factor does not divide sg_size are idle) and scaled by
+ * the register usage of a work-item once it exceeds a quarter of PORTFFT_REGISTERS_PER_WI, as higher register usage
+ * reduces occupancy. The cheapest divisor is returned, preferring larger ones on ties. If no divisor fits in the
+ * registers, the largest one is returned.
+ *
+ * The result is used both for choosing the implementation and for the kernels, which get it through specialization
+ * constants, so it only needs to be computed on the host.
+ *
+ * @tparam Scalar type of the real scalar used for the computation
  * @tparam T type of the number to factorize
  * @param N the number to factorize
  * @param sg_size subgroup size
  * @return the factor below or equal to subgroup size
  */
-template <typename T>
+template <typename Scalar, typename T>
 PORTFFT_INLINE constexpr T factorize_sg(T N, Idx sg_size) {
   if constexpr (PORTFFT_SLOW_SG_SHUFFLES) {
     return 1;
   } else {
-    for (T i = static_cast<T>(sg_size); i > 1; i--) {
-      if (N % i == 0) {
-        return i;
+    for (const sg_factor_tuning_entry& entry : SgFactorTuningTable) {
+      if (entry.fft_size == static_cast<IdxGlobal>(N) && entry.sg_size == sg_size && entry.factor_sg > 0 &&
+          entry.factor_sg <= sg_size && N % static_cast<T>(entry.factor_sg) == 0) {
+        return static_cast<T>(entry.factor_sg);
       }
     }
-    return 1;
+    const IdxGlobal full_occupancy_registers = PORTFFT_REGISTERS_PER_WI / 4;
+    const IdxGlobal ops_per_value = static_cast<IdxGlobal>(dft_ops_per_value(N));
+    T largest = 1;
+    T best = 0;
+    IdxGlobal best_cost = 0;
+    IdxGlobal best_ffts_per_sg = 1;
+    for (T factor_sg = static_cast<T>(sg_size); factor_sg >= 1; factor_sg--) {
+      if (N % factor_sg != 0) {
+        continue;
+      }
+      if (largest == 1) {
+        largest = factor_sg;
+      }
+      T factor_wi = N / factor_sg;
+      if (!fits_in_wi<Scalar>(factor_wi)) {
+        continue;
+      }
+      // number of 32 bit registers holding the values and temporaries of a work-item
+      IdxGlobal registers =
+          static_cast<IdxGlobal>(factor_wi + wi_temps(factor_wi)) * 2 * static_cast<IdxGlobal>(sizeof(Scalar)) / 4;
+      IdxGlobal ops_per_wi =
+          static_cast<IdxGlobal>(factor_wi) *
+          (ops_per_value + SgShuffleCost * static_cast<IdxGlobal>(cross_sg_shuffles(factor_sg)) +
+           (factor_sg > 1 ? SgTwiddleLoadCost : 0));
+      IdxGlobal cost = ops_per_wi * (registers > full_occupancy_registers ? registers : full_occupancy_registers);
+      IdxGlobal ffts_per_sg = static_cast<IdxGlobal>(sg_size / static_cast<Idx>(factor_sg));
+      // compares cost / ffts_per_sg without rounding
+      if (best == 0 || cost * best_ffts_per_sg < best_cost * ffts_per_sg) {
+        best = factor_sg;
+        best_cost = cost;
+        best_ffts_per_sg = ffts_per_sg;
+      }
+    }
+    return best == 0 ? largest : best;
   }
 }
 
@@ -249,7 +359,7 @@ PORTFFT_INLINE constexpr T factorize_sg(T N, Idx sg_size) {
  */
 template <typename Scalar>
 constexpr bool fits_in_sg(IdxGlobal N, Idx sg_size) {
-  IdxGlobal factor_sg = factorize_sg(N, sg_size);
+  IdxGlobal factor_sg = factorize_sg<Scalar>(N, sg_size);
   IdxGlobal factor_wi = N / factor_sg;
   return fits_in_wi<Scalar>(factor_wi);
 }
@@ -332,6 +442,8 @@ void sg_calc_twiddles(Idx factor_sg, Idx factor_wi, Idx n, Idx k, T* sg_twiddles
  * sycl::vec<T, 2>
  * @param store_modifier_data Global memory pointer containing the store modifier data, assumed aligned to at least
  * sycl::vec<T, 2>
+ * @param store_modifier_table_bits 0 if the store modifiers are stored densely, otherwise they are twiddle tables for
+ * `n_transforms * factor_sg * factor_wi` twiddles and this is the number of bits indexing their fine table
  * @param twiddles_loc_view View of the local memory containing the twiddles
  * @param scale_factor Value of the scale factor
  * @param modifier_start_offset offset to be applied to the load/store modifier pointers
@@ -347,9 +459,10 @@ PORTFFT_INLINE void sg_cooley_tukey(T* priv, T* private_scratch, detail::element
                                     detail::complex_conjugate conjugate_on_load,
                                     detail::complex_conjugate conjugate_on_store,
                                     detail::apply_scale_factor scale_factor_applied, const T* load_modifier_data,
-                                    const T* store_modifier_data, LocView& twiddles_loc_view, T scale_factor,
-                                    IdxGlobal modifier_start_offset, Idx id_of_wi_in_fft, Idx factor_sg, Idx factor_wi,
-                                    bool wi_working, detail::global_data_struct<1>& global_data) {
+                                    const T* store_modifier_data, Idx store_modifier_table_bits,
+                                    LocView& twiddles_loc_view, T scale_factor, IdxGlobal modifier_start_offset,
+                                    Idx id_of_wi_in_fft, Idx factor_sg, Idx factor_wi, bool wi_working,
+                                    detail::global_data_struct<1>& global_data) {
   using vec2_t = sycl::vec<T, 2>;
   vec2_t modifier_vec;
   if (conjugate_on_load == detail::complex_conjugate::APPLIED) {
@@ -378,10 +491,17 @@ PORTFFT_INLINE void sg_cooley_tukey(T* priv, T* private_scratch, detail::element
   if (apply_store_modifier == detail::elementwise_multiply::APPLIED) {
     if (wi_working) {
       global_data.log_message(__func__, "Applying store modifiers");
+      const IdxGlobal batch = modifier_start_offset / (2 * factor_sg * factor_wi);
       PORTFFT_UNROLL
       for (Idx j = 0; j < factor_wi; j++) {
-        modifier_vec = *reinterpret_cast<const vec2_t*>(
-            &store_modifier_data[modifier_start_offset + 2 * j * factor_sg + 2 * id_of_wi_in_fft]);
+        if (store_modifier_table_bits != 0) {
+          modifier_vec = get_twiddle_from_tables(
+              store_modifier_data, batch * static_cast<IdxGlobal>(j * factor_sg + id_of_wi_in_fft),
+              store_modifier_table_bits);
+        } else {
+          modifier_vec = *reinterpret_cast<const vec2_t*>(
+              &store_modifier_data[modifier_start_offset + 2 * j * factor_sg + 2 * id_of_wi_in_fft]);
+        }
         detail::multiply_complex(priv[2 * j], priv[2 * j + 1], modifier_vec[0], modifier_vec[1], priv[2 * j],
                                  priv[2 * j + 1]);
       }
@@ -33,7 +33,8 @@
 namespace portfft {
 
 /**
- * Copy data. Each workitem does the copy independently.
+ * Copy data. Each workitem does the copy independently. If the source and destination element types differ (for
+ * example reduced precision storage in global memory), the values are converted.
  *
  * There is no requirement that any of the arguments are the same between workitems in a workgroup/subgroup.
  *
@@ -61,7 +62,7 @@ PORTFFT_INLINE void copy_wi(detail::global_data_struct<1> global_data, ViewSrc s
     for (Idx j = 0; j < VectorSize; j++) {
       global_data.log_message(__func__, "from", &src_start[j] - detail::get_raw_pointer(src), "to",
                               &dst_start[j] - detail::get_raw_pointer(dst), "value", src_start[j]);
-      dst_start[j] = src_start[j];
+      dst_start[j] = static_cast<detail::get_element_remove_cv_t<ViewDst>>(src_start[j]);
     }
   }
 }
@@ -361,7 +362,7 @@ PORTFFT_INLINE Idx vec_aligned_group_block_copy(detail::global_data_struct<1> gl
       vec_t to_store;
       PORTFFT_UNROLL
       for (Idx j = 0; j < ChunkSize; j++) {
-        to_store[static_cast<int>(j)] = local[index_transform(j, loop_idx)];
+        to_store[static_cast<int>(j)] = static_cast<real_t>(local[index_transform(j, loop_idx)]);
       }
       *reinterpret_cast<vec_t*>(&global[global_offset + wi_offset + block_size * loop_idx]) = to_store;
     }
@@ -374,7 +375,9 @@ PORTFFT_INLINE Idx vec_aligned_group_block_copy(detail::global_data_struct<1> gl
 
 /**
  * Copies data from global memory to local memory. Expects the value of most input arguments to be the
- * same for work-items in the group described by template parameter "Level".
+ * same for work-items in the group described by template parameter "Level". The global memory may hold a
+ * narrower storage type (`sycl::half` or bfloat16, or for input `std::int16_t` or `std::int8_t`) than the local
+ * memory, in which case values are converted during the copy.
  *
  * @tparam Level Which level (subgroup or workgroup) does the transfer.
  * @tparam SubgroupSize size of the subgroup
@@ -393,8 +396,12 @@ PORTFFT_INLINE void global_local_contiguous_copy(detail::global_data_struct<1> g
                                                  LocalViewT local, Idx total_num_elems, IdxGlobal global_offset = 0,
                                                  Idx local_offset = 0) {
   using real_t = get_element_remove_cv_t<GlobalViewT>;
-  static_assert(std::is_floating_point_v<real_t>, "Expecting floating-point data type");
-  static_assert(std::is_same_v<real_t, get_element_remove_cv_t<LocalViewT>>, "Type mismatch between global and local");
+  using local_real_t = get_element_remove_cv_t<LocalViewT>;
+  static_assert(is_storage_scalar_v<real_t>, "Unsupported storage type in global memory");
+  static_assert(std::is_floating_point_v<local_real_t>, "Expecting floating-point data type in local memory");
+  static_assert(sizeof(real_t) <= sizeof(local_real_t), "Global data type can not be wider than the local one");
+  static_assert(!std::is_integral_v<real_t> || TransferDirection == transfer_direction::GLOBAL_TO_LOCAL,
+                "Integer storage is only supported for the input");
   const char* func_name = __func__;
   global_data.log_message_scoped<Level>(func_name, "global_offset", global_offset, "local_offset", local_offset);
   static constexpr Idx ChunkSizeRaw = PORTFFT_VEC_LOAD_BYTES / sizeof(real_t);
@@ -418,12 +425,21 @@ PORTFFT_INLINE void global_local_contiguous_copy(detail::global_data_struct<1> g
   total_num_elems -= unaligned_elements;
 
 #ifdef PORTFFT_USE_SG_TRANSFERS
-  // Unaligned subgroup copies cause issues when writing to buffers in some circumstances for unknown reasons.
-  Idx copied_by_sg = impl::subgroup_block_copy<TransferDirection, Level, ChunkSize, SubgroupSize>(
-      global_data, global, global_offset, local, local_offset, total_num_elems);
-  local_offset += copied_by_sg;
-  global_offset += copied_by_sg;
-  total_num_elems -= copied_by_sg;
+  // Subgroup block loads/stores can not convert the data, so reduced precision storage uses vector copies instead.
+  if constexpr (std::is_same_v<real_t, local_real_t>) {
+    // Unaligned subgroup copies cause issues when writing to buffers in some circumstances for unknown reasons.
+    Idx copied_by_sg = impl::subgroup_block_copy<TransferDirection, Level, ChunkSize, SubgroupSize>(
+        global_data, global, global_offset, local, local_offset, total_num_elems);
+    local_offset += copied_by_sg;
+    global_offset += copied_by_sg;
+    total_num_elems -= copied_by_sg;
+  } else {
+    Idx block_copied_elements = impl::vec_aligned_group_block_copy<TransferDirection, Level, ChunkSize>(
+        global_data, global, global_offset, local, local_offset, total_num_elems);
+    local_offset += block_copied_elements;
+    global_offset += block_copied_elements;
+    total_num_elems -= block_copied_elements;
+  }
 #else
   // Each workitem loads a chunk of consecutive elements. Chunks loaded by a group are consecutive.
   Idx block_copied_elements = impl::vec_aligned_group_block_copy<TransferDirection, Level, ChunkSize>(
@@ -445,7 +461,8 @@ PORTFFT_INLINE void global_local_contiguous_copy(detail::global_data_struct<1> g
 }  // namespace detail
 
 /**
- * Copies data from global memory to local memory.
+ * Copies data from global memory to local memory. If the global memory holds a reduced precision storage type, the
+ * values are converted to the type of the local memory.
  *
  * @tparam Level Which level (subgroup or workgroup) does the transfer.
  * @tparam SubgroupSize size of the subgroup
@@ -467,7 +484,8 @@ PORTFFT_INLINE void global2local(detail::global_data_struct<1> global_data, Glob
 }
 
 /**
- * Copies data from local memory to global memory.
+ * Copies data from local memory to global memory. If the global memory holds a reduced precision storage type, the
+ * values are converted to it.
  *
  * @tparam Level Which level (subgroup or workgroup) does the transfer.
  * @tparam SubgroupSize size of the subgroup
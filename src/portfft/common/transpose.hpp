@@ -33,6 +33,7 @@ namespace detail {
  *
  * @tparam VecSize Size of each matrix element
  * @tparam T Scalar input type
+ * @tparam TOut Scalar output type. If it differs from `T`, values are converted when they are stored.
  * @param N Number of input rows
  * @param M Number of input columns
  * @param tile_size Tile Size
@@ -41,8 +42,8 @@ namespace detail {
  * @param loc 2D local memory accessor of size {tile_size, VecSize * tile_size}
  * @param global_data global data for the kernel
  */
-template <int VecSize = 2, typename T>
-PORTFFT_INLINE inline void generic_transpose(IdxGlobal N, IdxGlobal M, Idx tile_size, const T* input, T* output,
+template <int VecSize = 2, typename T, typename TOut>
+PORTFFT_INLINE inline void generic_transpose(IdxGlobal N, IdxGlobal M, Idx tile_size, const T* input, TOut* output,
                                              const sycl::local_accessor<T, 2>& loc,
                                              detail::global_data_struct<2> global_data) {
   static_assert(VecSize <= 2, "VecSize must be either 1 or 2.");
@@ -88,7 +89,14 @@ PORTFFT_INLINE inline void generic_transpose(IdxGlobal N, IdxGlobal M, Idx tile_
         if constexpr (VecSize > 1) {
           priv[1] = loc[global_data.it.get_local_id(1)][VecSize * global_data.it.get_local_id(0) + 1];
         }
-        priv.store(0, detail::get_global_multi_ptr(&output[VecSize * i_transposed * N + VecSize * j_transposed]));
+        if constexpr (std::is_same_v<T, TOut>) {
+          priv.store(0, detail::get_global_multi_ptr(&output[VecSize * i_transposed * N + VecSize * j_transposed]));
+        } else {
+          PORTFFT_UNROLL
+          for (int k = 0; k < VecSize; k++) {
+            output[VecSize * i_transposed * N + VecSize * j_transposed + k] = static_cast<TOut>(priv[k]);
+          }
+        }
         global_data.log_message(__func__, "stored data", priv, "from local index: ", global_data.it.get_local_id(1),
                                 ", ", VecSize * global_data.it.get_local_id(0), " and storing it to global index: ",
                                 VecSize * i_transposed * N + VecSize * j_transposed);
@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <complex>
+#include <utility>
 
 namespace portfft {
 namespace detail {
@@ -40,6 +41,44 @@ std::complex<T> calculate_twiddle(TIndex n, TIndex total) {
   return {sycl::cospi(theta), sycl::sinpi(theta)};
 }
 
+/**
+ * Calculates a twiddle factor, reducing the angle exactly before any floating point computation. `n` is reduced modulo
+ * `total` and the angle is split into a multiple of pi/2 and a remainder of at most pi/4 using integer arithmetic.
+ * The rounding error of the remainder is proportional to it rather than to `n / total`, so the result is accurate in
+ * type `T` even for twiddles of large transforms and without double precision support on the device.
+ *
+ * @tparam T floating point type to use
+ * @tparam TIndex Index type
+ * @param n which twiddle factor to calculate
+ * @param total total number of twiddles
+ */
+template <typename T, typename TIndex>
+std::complex<T> calculate_twiddle_reduced(TIndex n, TIndex total) {
+  TIndex r = n % total;
+  // 2 * pi * r / total = pi / 2 * (quadrant + x / total), with 0 <= x < total
+  TIndex quadrant = 4 * r / total;
+  TIndex x = 4 * r - quadrant * total;
+  // angles over pi / 4 in the quadrant are calculated from their distance to pi / 2
+  bool reflect = 2 * x > total;
+  T half_turns = static_cast<T>(reflect ? total - x : x) / static_cast<T>(2 * total);
+  T cos_part = sycl::cospi(half_turns);
+  T sin_part = sycl::sinpi(half_turns);
+  if (reflect) {
+    std::swap(cos_part, sin_part);
+  }
+  // rotate by the quadrant and conjugate, as the twiddle is exp(-2 * pi * i * r / total)
+  switch (quadrant) {
+    case 0:
+      return {cos_part, -sin_part};
+    case 1:
+      return {-sin_part, -cos_part};
+    case 2:
+      return {-cos_part, sin_part};
+    default:
+      return {sin_part, cos_part};
+  }
+}
+
 }  // namespace detail
 }  // namespace portfft
 
@@ -0,0 +1,118 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMON_TWIDDLE_TABLES_HPP
+#define PORTFFT_COMMON_TWIDDLE_TABLES_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <complex>
+
+#include "helpers.hpp"
+#include "logging.hpp"
+#include "portfft/defines.hpp"
+#include "twiddle_calc.hpp"
+
+namespace portfft::detail {
+
+/*
+Twiddles w^e = exp(-2*pi*i*e/n_twiddles) for 0 <= e < n_twiddles can be stored in two tables of about
+sqrt(n_twiddles) entries each instead of one of n_twiddles entries. The exponent is split into its low and high bits,
+e = e_lo + 2^bits * e_hi, and w^e = w^e_lo * w^(2^bits * e_hi). The fine table holds w^e_lo for 0 <= e_lo < 2^bits
+and is followed by the coarse table holding w^(2^bits * e_hi) for 0 <= e_hi < ceil(n_twiddles / 2^bits). Both tables
+store interleaved complex values.
+*/
+
+/**
+ * Calculates the number of bits of the exponent used to index the fine table of the twiddle tables. The fine table has
+ * the smallest power of two number of entries that is not smaller than the square root of the number of twiddles.
+ *
+ * @param n_twiddles number of twiddles represented by the tables
+ * @return the number of bits
+ */
+PORTFFT_INLINE constexpr Idx twiddle_table_bits(IdxGlobal n_twiddles) {
+  Idx bits = 0;
+  while ((IdxGlobal(1) << (2 * bits)) < n_twiddles) {
+    bits++;
+  }
+  return bits;
+}
+
+/**
+ * Calculates the number of complex values in both the twiddle tables.
+ *
+ * @param n_twiddles number of twiddles represented by the tables
+ * @return the number of complex values
+ */
+inline IdxGlobal twiddle_tables_size(IdxGlobal n_twiddles) {
+  IdxGlobal fine_size = IdxGlobal(1) << twiddle_table_bits(n_twiddles);
+  return fine_size + divide_ceil(n_twiddles, fine_size);
+}
+
+/**
+ * Gets a twiddle from the twiddle tables.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param tables pointer to the tables in global memory, assumed aligned to at least sycl::vec<T, 2>
+ * @param exponent exponent of the twiddle, must be less than the number of twiddles the tables were calculated for
+ * @param table_bits number of bits indexing the fine table, as returned by `twiddle_table_bits`
+ * @return the twiddle
+ */
+template <typename T>
+PORTFFT_INLINE sycl::vec<T, 2> get_twiddle_from_tables(const T* tables, IdxGlobal exponent, Idx table_bits) {
+  const IdxGlobal fine_size = IdxGlobal(1) << table_bits;
+  const sycl::vec<T, 2> fine = *reinterpret_cast<const sycl::vec<T, 2>*>(&tables[2 * (exponent & (fine_size - 1))]);
+  const sycl::vec<T, 2> coarse =
+      *reinterpret_cast<const sycl::vec<T, 2>*>(&tables[2 * (fine_size + (exponent >> table_bits))]);
+  sycl::vec<T, 2> res;
+  multiply_complex(fine[0], fine[1], coarse[0], coarse[1], res[0], res[1]);
+  return res;
+}
+
+/**
+ * Launches a kernel calculating the twiddle tables.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param queue queue to submit the kernel to
+ * @param n_twiddles number of twiddles to be represented by the tables
+ * @param tables pointer to global memory for `2 * twiddle_tables_size(n_twiddles)` scalars
+ * @return event of the kernel
+ */
+template <typename T>
+sycl::event calculate_twiddle_tables(sycl::queue& queue, IdxGlobal n_twiddles, T* tables) {
+  PORTFFT_LOG_FUNCTION_ENTRY();
+  const Idx table_bits = twiddle_table_bits(n_twiddles);
+  const IdxGlobal fine_size = IdxGlobal(1) << table_bits;
+  const IdxGlobal tables_size = twiddle_tables_size(n_twiddles);
+  PORTFFT_LOG_TRACE("Launching twiddle tables calculation kernel with global size", tables_size);
+  return queue.submit([&](sycl::handler& cgh) {
+    cgh.parallel_for(sycl::range<1>(static_cast<std::size_t>(tables_size)), [=](sycl::item<1> it) {
+      IdxGlobal idx = static_cast<IdxGlobal>(it.get_id(0));
+      IdxGlobal exponent = idx < fine_size ? idx : (idx - fine_size) << table_bits;
+      std::complex<T> twiddle = calculate_twiddle_reduced<T>(exponent, n_twiddles);
+      tables[2 * idx] = twiddle.real();
+      tables[2 * idx + 1] = twiddle.imag();
+    });
+  });
+}
+
+}  // namespace portfft::detail
+
+#endif  // PORTFFT_COMMON_TWIDDLE_TABLES_HPP
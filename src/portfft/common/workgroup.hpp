@@ -30,28 +30,6 @@
 
 namespace portfft {
 
-/**
- * Calculate the number of groups or bank lines of PORTFFT_N_LOCAL_BANKS between each padding in local memory,
- * specifically for reducing bank conflicts when reading values from the columns of a 2D data layout. e.g. If there are
- * 64 complex elements in a row, then the consecutive values in the same column are 128 floats apart. There are 32
- * banks, each the size of a float, so we only want a padding float every 128/32=4 bank lines to read along the column
- * without bank conflicts.
- *
- * @tparam T Input type to the function
- * @param row_size the size in bytes of the row. 32 std::complex<float> values would probably have a size of 256 bytes.
- * @return the number of groups of PORTFFT_N_LOCAL_BANKS between each padding in local memory.
- */
-template <typename T>
-constexpr T bank_lines_per_pad_wg(T row_size) {
-  constexpr T BankLineSize = sizeof(float) * PORTFFT_N_LOCAL_BANKS;
-  if (row_size % BankLineSize == 0) {
-    return row_size / BankLineSize;
-  }
-  // There is room for improvement here. E.G if row_size was half of BankLineSize then maybe you would still want 1
-  // pad every bank group.
-  return 1;
-}
-
 namespace detail {
 /**
  * Calculate all dfts in one dimension of the data stored in local memory.
@@ -67,8 +45,11 @@ namespace detail {
  * @param batch_num_in_local Id of the local memory batch to work on
  * @param load_modifier_data Pointer to the load modifier data in global Memory
  * @param store_modifier_data Pointer to the store modifier data in global Memory
+ * @param store_modifier_table_bits 0 if the store modifiers are stored densely, otherwise they are twiddle tables and
+ * this is the number of bits indexing their fine table
  * @param batch_num_in_kernel Absolute batch from which batches loaded in local memory will be computed
  * @param dft_size Size of each DFT to calculate
+ * @param fact_sg Number of work-items in a subgroup working on each DFT, as chosen by `factorize_sg` on the host
  * @param stride_within_dft Stride between elements of each DFT - also the number of the DFTs in the inner dimension
  * @param ndfts_in_outer_dimension Number of DFTs in outer dimension
  * @param storage complex storage: interleaved or split
@@ -83,9 +64,9 @@ namespace detail {
 template <Idx SubgroupSize, typename LocalT, typename T>
 __attribute__((always_inline)) inline void dimension_dft(
     LocalT loc, T* loc_twiddles, const T* wg_twiddles, T scaling_factor, Idx max_num_batches_in_local_mem,
-    Idx batch_num_in_local, const T* load_modifier_data, const T* store_modifier_data, IdxGlobal batch_num_in_kernel,
-    Idx dft_size, Idx stride_within_dft, Idx ndfts_in_outer_dimension, complex_storage storage,
-    detail::layout input_layout, detail::elementwise_multiply multiply_on_load,
+    Idx batch_num_in_local, const T* load_modifier_data, const T* store_modifier_data, Idx store_modifier_table_bits,
+    IdxGlobal batch_num_in_kernel, Idx dft_size, Idx fact_sg, Idx stride_within_dft, Idx ndfts_in_outer_dimension,
+    complex_storage storage, detail::layout input_layout, detail::elementwise_multiply multiply_on_load,
     detail::elementwise_multiply multiply_on_store, detail::apply_scale_factor apply_scale_factor,
     detail::complex_conjugate conjugate_on_load, detail::complex_conjugate conjugate_on_store,
     global_data_struct<1> global_data) {
@@ -94,8 +75,6 @@ __attribute__((always_inline)) inline void dimension_dft(
                                  "ndfts_in_outer_dimension", ndfts_in_outer_dimension, "max_num_batches_in_local_mem",
                                  max_num_batches_in_local_mem, "batch_num_in_local", batch_num_in_local);
   const Idx outer_stride = dft_size * stride_within_dft;
-  // the number of work-items involved in every subgroup fft
-  const Idx fact_sg = detail::factorize_sg(dft_size, SubgroupSize);
   // the number of values held in by a work-item in a row subgroup dft
   const Idx fact_wi = dft_size / fact_sg;
 
@@ -237,12 +216,16 @@ __attribute__((always_inline)) inline void dimension_dft(
         // Store modifier data layout in global memory - n_transforms x N x FactorSG x FactorWI
         PORTFFT_UNROLL
         for (Idx idx = 0; idx < fact_wi; idx++) {
-          IdxGlobal base_offset =
-              2 * (batch_num_in_kernel + static_cast<IdxGlobal>(batch_num_in_local)) *
-                  static_cast<IdxGlobal>(dft_size) +
-              static_cast<IdxGlobal>(2 * j * fact_wi * fact_sg + 2 * idx * fact_sg + 2 * wi_id_in_fft);
-          const sycl::vec<T, 2> priv_modifier =
-              *reinterpret_cast<const sycl::vec<T, 2>*>(&store_modifier_data[base_offset]);
+          IdxGlobal batch = batch_num_in_kernel + static_cast<IdxGlobal>(batch_num_in_local);
+          Idx element = j * fact_wi * fact_sg + idx * fact_sg + wi_id_in_fft;
+          sycl::vec<T, 2> priv_modifier;
+          if (store_modifier_table_bits != 0) {
+            priv_modifier = get_twiddle_from_tables(store_modifier_data, batch * static_cast<IdxGlobal>(element),
+                                                    store_modifier_table_bits);
+          } else {
+            IdxGlobal base_offset = 2 * batch * static_cast<IdxGlobal>(dft_size) + static_cast<IdxGlobal>(2 * element);
+            priv_modifier = *reinterpret_cast<const sycl::vec<T, 2>*>(&store_modifier_data[base_offset]);
+          }
           multiply_complex(priv[2 * idx], priv[2 * idx + 1], priv_modifier[0], priv_modifier[1], priv[2 * idx],
                            priv[2 * idx + 1]);
         }
@@ -308,9 +291,13 @@ __attribute__((always_inline)) inline void dimension_dft(
  * @param batch_num_in_kernel Absolute batch from which batches loaded in local memory will be computed
  * @param load_modifier_data Pointer to the load modifier data in global Memory
  * @param store_modifier_data Pointer to the store modifier data in global Memory
+ * @param store_modifier_table_bits 0 if the store modifiers are stored densely, otherwise they are twiddle tables and
+ * this is the number of bits indexing their fine table
  * @param fft_size Problem Size
  * @param N Smaller factor of the Problem size
  * @param M Larger factor of the problem size
+ * @param factor_sg_n Number of work-items in a subgroup working on each DFT of size N
+ * @param factor_sg_m Number of work-items in a subgroup working on each DFT of size M
  * @param storage complex storage: interleaved or split
  * @param input_layout the layout of the input data of the transforms
  * @param multiply_on_load Whether the input data is multiplied with some data array before fft computation.
@@ -323,8 +310,9 @@ __attribute__((always_inline)) inline void dimension_dft(
 template <Idx SubgroupSize, typename LocalT, typename T>
 PORTFFT_INLINE void wg_dft(LocalT loc, T* loc_twiddles, const T* wg_twiddles, T scaling_factor,
                            Idx max_num_batches_in_local_mem, Idx batch_num_in_local, IdxGlobal batch_num_in_kernel,
-                           const T* load_modifier_data, const T* store_modifier_data, Idx fft_size, Idx N, Idx M,
-                           complex_storage storage, detail::layout input_layout,
+                           const T* load_modifier_data, const T* store_modifier_data, Idx store_modifier_table_bits,
+                           Idx fft_size, Idx N, Idx M,
+                           Idx factor_sg_n, Idx factor_sg_m, complex_storage storage, detail::layout input_layout,
                            detail::elementwise_multiply multiply_on_load,
                            detail::elementwise_multiply multiply_on_store,
                            detail::apply_scale_factor apply_scale_factor, detail::complex_conjugate conjugate_on_load,
@@ -335,15 +323,15 @@ PORTFFT_INLINE void wg_dft(LocalT loc, T* loc_twiddles, const T* wg_twiddles, T
   // column-wise DFTs
   detail::dimension_dft<SubgroupSize, LocalT, T>(
       loc, loc_twiddles + (2 * M), nullptr, 1, max_num_batches_in_local_mem, batch_num_in_local, load_modifier_data,
-      store_modifier_data, batch_num_in_kernel, N, M, 1, storage, input_layout, multiply_on_load,
-      detail::elementwise_multiply::NOT_APPLIED, detail::apply_scale_factor::NOT_APPLIED, conjugate_on_load,
-      detail::complex_conjugate::NOT_APPLIED, global_data);
+      store_modifier_data, store_modifier_table_bits, batch_num_in_kernel, N, factor_sg_n, M, 1, storage, input_layout,
+      multiply_on_load, detail::elementwise_multiply::NOT_APPLIED, detail::apply_scale_factor::NOT_APPLIED,
+      conjugate_on_load, detail::complex_conjugate::NOT_APPLIED, global_data);
   sycl::group_barrier(global_data.it.get_group());
   // row-wise DFTs, including twiddle multiplications and scaling
   detail::dimension_dft<SubgroupSize, LocalT, T>(
       loc, loc_twiddles, wg_twiddles, scaling_factor, max_num_batches_in_local_mem, batch_num_in_local,
-      load_modifier_data, store_modifier_data, batch_num_in_kernel, M, 1, N, storage, input_layout,
-      detail::elementwise_multiply::NOT_APPLIED, multiply_on_store, apply_scale_factor,
+      load_modifier_data, store_modifier_data, store_modifier_table_bits, batch_num_in_kernel, M, factor_sg_m, 1, N,
+      storage, input_layout, detail::elementwise_multiply::NOT_APPLIED, multiply_on_store, apply_scale_factor,
       detail::complex_conjugate::NOT_APPLIED, conjugate_on_store, global_data);
   global_data.log_message_global(__func__, "exited");
 }
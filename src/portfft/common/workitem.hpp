@@ -23,6 +23,7 @@
 
 #include <sycl/sycl.hpp>
 
+#include "codelets.hpp"
 #include "helpers.hpp"
 #include "portfft/defines.hpp"
 #include "portfft/enums.hpp"
@@ -41,7 +42,10 @@ static constexpr Idx MaxComplexPerWI = 56;
 
 /*
 `wi_dft` calculates a DFT by a workitem on values that are already loaded into its private memory.
-It calls either `cooley_tukey_dft` (for composite sizes) or `naive_dft` (for prime sizes).
+It calls `codelet_dft` (for sizes with a generated codelet), `cooley_tukey_dft` (for other composite sizes) or
+`naive_dft` (for other prime sizes).
+
+`codelet_dft` calculates DFT of a small size using straight-line code generated by scripts/generate_codelets.py.
 
 `cooley_tukey_dft` calculates DFT of a composite size by one workitem. It calls `wi_dft` for each of the factors and
 does twiddle multiplication in-between. Transposition is handled by calling `wi_dft` with different input and output
@@ -202,7 +206,9 @@ PORTFFT_INLINE void wi_dft(const T* in, T* out, Idx fft_size, Idx stride_in, Idx
   const Idx f0 = detail::factorize(fft_size);
   constexpr Idx MaxRecursionLevel = detail::int_log2(detail::MaxComplexPerWI) - 1;
   if constexpr (RecursionLevel < MaxRecursionLevel) {
-    if (fft_size == 2) {
+    if (PORTFFT_WI_CODELETS && detail::has_codelet(fft_size)) {
+      detail::codelet_dft(in, out, fft_size, stride_in, stride_out);
+    } else if (fft_size == 2) {
       T a = in[0 * stride_in + 0] + in[2 * stride_in + 0];
       T b = in[0 * stride_in + 1] + in[2 * stride_in + 1];
       T c = in[0 * stride_in + 0] - in[2 * stride_in + 0];
@@ -35,6 +35,22 @@
 #define PORTFFT_N_LOCAL_BANKS 32
 #endif
 
+#ifndef PORTFFT_WI_CODELETS
+#define PORTFFT_WI_CODELETS 1
+#endif
+
+#ifndef PORTFFT_CALIBRATE_LOCAL_BANKS
+#define PORTFFT_CALIBRATE_LOCAL_BANKS 1
+#endif
+
+#ifndef PORTFFT_LOCAL_DOUBLE_BUFFERING
+#define PORTFFT_LOCAL_DOUBLE_BUFFERING 1
+#endif
+
+#ifndef PORTFFT_GLOBAL_TWIDDLE_TABLES
+#define PORTFFT_GLOBAL_TWIDDLE_TABLES 0
+#endif
+
 #ifndef PORTFFT_UNROLL
 #define PORTFFT_UNROLL _Pragma("clang loop unroll(full)")
 #endif
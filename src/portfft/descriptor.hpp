@@ -24,13 +24,17 @@
 #include <sycl/sycl.hpp>
 
 #include <complex>
+#include <future>
 #include <numeric>
 #include <vector>
 
 #include "committed_descriptor.hpp"
+#include "committed_sharded_descriptor.hpp"
+#include "committed_streaming_descriptor.hpp"
 #include "defines.hpp"
 #include "descriptor_validation.hpp"
 #include "enums.hpp"
+#include "wisdom.hpp"
 
 namespace portfft {
 
@@ -67,6 +71,12 @@ struct descriptor {
    * backward_scale set to 1 will result in the data being scaled by the product of the lengths.
    */
   Scalar backward_scale = 1;
+  /**
+   * A scaling factor applied to integer input values when they are converted to Scalar, for example to normalize raw
+   * samples from an analog-to-digital converter. Only used by the compute_xxxward functions taking integer input, in
+   * addition to forward_scale or backward_scale. Default value is 1.
+   */
+  Scalar integer_input_scale = 1;
   /**
    * The number of transforms or batches that will be solved with each call to compute_xxxward. Default value
    * is 1.
@@ -127,6 +137,41 @@ struct descriptor {
    * to use for FFT computation. The default value is 0.
    */
   std::size_t backward_offset = 0;
+  /**
+   * The numbers of batches of each additional batch dimension, ordered from outermost to innermost. The transforms
+   * described by `number_of_transforms` and the distances form the innermost batch dimension and are repeated for every
+   * index of these dimensions, so a call computes number_of_transforms times the product of these counts transforms.
+   * The default value is empty, for a single batch dimension.
+   */
+  std::vector<std::size_t> outer_batch_counts;
+  /**
+   * The number of elements between the first value of consecutive batches of each dimension of `outer_batch_counts` in
+   * the forward domain. Must have the same size as `outer_batch_counts`. For outer distances [o1,...,ok], the element
+   * at index [i1,i2,...,id] of batch b of the outer batch [c1,...,ck] is located at
+   * elems[s0 + o1*c1 + ... + ok*ck + m*b + s1*i1 + s2*i2 + ... + sd*id]. For example, the transforms along the middle
+   * dimension of an [A][N][B] array use strides {B}, a distance of 1, B transforms, outer counts {A} and outer
+   * distances {N*B}.
+   */
+  std::vector<std::size_t> forward_outer_distances;
+  /**
+   * The number of elements between the first value of consecutive batches of each dimension of `outer_batch_counts` in
+   * the backward domain. Must have the same size as `outer_batch_counts`.
+   */
+  std::vector<std::size_t> backward_outer_distances;
+  /**
+   * Whether the batches of the forward domain may overlap, so that a batched transform with a forward_distance smaller
+   * than the length computes the frames of a short-time Fourier transform straight from the signal. Only supported for
+   * out-of-place 1D transforms. As a backward transform would write to the overlapping batches, only forward transforms
+   * can be computed. Default value is false.
+   */
+  bool overlapping_forward_batches = false;
+  /**
+   * A real window the input of each forward transform is multiplied by as it is loaded: element i of every batch is
+   * multiplied by forward_window[i]. Must be empty or have lengths[0] values and is only supported for 1D transforms
+   * computed by the workitem or subgroup implementations. Backward transforms are not windowed. Default value is
+   * empty, for no window.
+   */
+  std::vector<Scalar> forward_window;
   // TODO: add TRANSPOSE, WORKSPACE and ORDERING if we determine they make sense
 
   /**
@@ -155,6 +200,66 @@ struct descriptor {
     return {*this, queue};
   }
 
+  /**
+   * Commits the descriptor, applying the plan decisions recorded in wisdom for the device and the shape of the
+   * descriptor. Without such a recorded plan this is the same as `commit(queue)`.
+   *
+   * @param queue queue to use for computations
+   * @param plan_wisdom wisdom exported from a committed descriptor with `committed_descriptor::export_wisdom`
+   * @return committed_descriptor<Scalar, Domain>
+   */
+  committed_descriptor<Scalar, Domain> commit(sycl::queue& queue, const wisdom& plan_wisdom) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    detail::validate::validate_descriptor(*this);
+    return {*this, queue, &plan_wisdom};
+  }
+
+  /**
+   * Commits the descriptor on another thread. The calling thread can keep submitting work, including to the same queue,
+   * while the kernels are built and the twiddles are computed.
+   *
+   * @param queue queue to use for computations
+   * @return future of the committed_descriptor<Scalar, Domain>, rethrowing any exception thrown while committing
+   */
+  std::future<committed_descriptor<Scalar, Domain>> commit_async(sycl::queue& queue) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    detail::validate::validate_descriptor(*this);
+    // the descriptor is copied, it may be modified or destroyed before the commit completes
+    return std::async(std::launch::async, [desc = *this, queue]() mutable -> committed_descriptor<Scalar, Domain> {
+      return {desc, queue};
+    });
+  }
+
+  /**
+   * Commits the descriptor for computing FFTs of data in host memory, which does not need to fit in device memory.
+   *
+   * @param queue queue to use for computations
+   * @param device_memory_budget number of bytes of device memory the data and the plans may use, 0 for half of the
+   * global memory of the device
+   * @param ring_size number of chunks in flight, each with its own device memory within the budget
+   * @return committed_streaming_descriptor<Scalar, Domain>
+   */
+  committed_streaming_descriptor<Scalar, Domain> commit_streaming(sycl::queue& queue,
+                                                                  std::size_t device_memory_budget = 0,
+                                                                  std::size_t ring_size = 2) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    detail::validate::validate_descriptor(*this);
+    return {*this, queue, device_memory_budget, ring_size};
+  }
+
+  /**
+   * Commits the descriptor for several queues, for example on the sub-devices of a partitioned device. The batch is
+   * split between the queues proportionally to the throughput measured for each of them.
+   *
+   * @param queues queues to use for computations, all sharing a context
+   * @return committed_sharded_descriptor<Scalar, Domain>
+   */
+  committed_sharded_descriptor<Scalar, Domain> commit(const std::vector<sycl::queue>& queues) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    detail::validate::validate_descriptor(*this);
+    return {*this, queues};
+  }
+
   /**
    * Get the flattened length of an FFT for a single batch, ignoring strides and distance.
    */
@@ -170,7 +275,7 @@ struct descriptor {
    * @param dir direction
    */
   std::size_t get_input_count(direction dir) const noexcept {
-    return get_buffer_count(get_strides(dir), get_distance(dir), get_offset(dir));
+    return get_buffer_count(get_strides(dir), get_distance(dir), get_outer_distances(dir), get_offset(dir));
   }
 
   /**
@@ -218,6 +323,32 @@ struct descriptor {
     return dir == direction::FORWARD ? forward_distance : backward_distance;
   }
 
+  /**
+   * Return the outer distances for a given direction
+   *
+   * @param dir direction
+   */
+  const std::vector<std::size_t>& get_outer_distances(direction dir) const noexcept {
+    return dir == direction::FORWARD ? forward_outer_distances : backward_outer_distances;
+  }
+
+  /**
+   * Return a mutable reference to the outer distances for a given direction
+   *
+   * @param dir direction
+   */
+  std::vector<std::size_t>& get_outer_distances(direction dir) noexcept {
+    return dir == direction::FORWARD ? forward_outer_distances : backward_outer_distances;
+  }
+
+  /**
+   * Get the number of transforms computed by each call to compute_xxxward, including the outer batch dimensions.
+   */
+  std::size_t get_total_transforms() const noexcept {
+    return std::accumulate(outer_batch_counts.begin(), outer_batch_counts.end(), number_of_transforms,
+                           std::multiplies<std::size_t>());
+  }
+
   /**
    * Return the offset for a given direction
    *
@@ -253,16 +384,21 @@ struct descriptor {
  private:
   /**
    * Compute the number of elements required for a buffer with the descriptor's length, number of transforms and the
-   * given strides and distance.
+   * given strides and distances.
    * The number of elements is the same irrespective of the FFT domain.
    *
    * @param strides buffer's strides
    * @param distance buffer's distance
+   * @param outer_distances buffer's distances of the outer batch dimensions
+   * @param offset buffer's offset
    */
   std::size_t get_buffer_count(const std::vector<std::size_t>& strides, std::size_t distance,
-                               std::size_t offset) const noexcept {
+                               const std::vector<std::size_t>& outer_distances, std::size_t offset) const noexcept {
     // Compute the last element that can be accessed
     std::size_t last_elt_idx = (number_of_transforms - 1) * distance;
+    for (std::size_t i = 0; i < outer_batch_counts.size() && i < outer_distances.size(); ++i) {
+      last_elt_idx += (outer_batch_counts[i] - 1) * outer_distances[i];
+    }
     for (std::size_t i = 0; i < lengths.size(); ++i) {
       last_elt_idx += (lengths[i] - 1) * strides[i];
     }
@@ -211,11 +211,15 @@ inline void strides_distance_1d_check(const std::vector<std::size_t>& lengths, s
  * @param strides the strides between elements in a domain
  * @param distance the distance between batches in a domain
  * @param domain_str a string with the name of the domain being validated
+ * @param allow_overlap whether batches may overlap, for data that is only read
  */
 inline void strides_distance_check(const std::vector<std::size_t>& lengths, std::size_t number_of_transforms,
                                    const std::vector<std::size_t>& strides, std::size_t distance,
-                                   const std::string_view domain_str) {
+                                   const std::string_view domain_str, bool allow_overlap = false) {
   validate_strides_distance_basic(lengths, number_of_transforms, strides, distance, domain_str);
+  if (allow_overlap) {
+    return;
+  }
   if (lengths.size() > 1) {
     strides_distance_multidim_check(lengths, number_of_transforms, strides, distance, domain_str);
   } else {
@@ -233,11 +237,12 @@ inline void strides_distance_check(const std::vector<std::size_t>& lengths, std:
  * @param backward_strides the strides between elements in the backward domain
  * @param forward_distance the distance between batches in the forward domain
  * @param backward_distance the distance between batches in the backward domain
+ * @param overlapping_forward_batches whether the batches of the forward domain may overlap
  */
 inline void validate_strides_distance(placement place, const std::vector<std::size_t>& lengths,
                                       std::size_t number_of_transforms, const std::vector<std::size_t>& forward_strides,
                                       const std::vector<std::size_t>& backward_strides, std::size_t forward_distance,
-                                      std::size_t backward_distance) {
+                                      std::size_t backward_distance, bool overlapping_forward_batches = false) {
   if (place == placement::IN_PLACE) {
     if (forward_strides != backward_strides) {
       throw invalid_configuration("Invalid forward and backward strides must match for in-place configurations");
@@ -247,11 +252,117 @@ inline void validate_strides_distance(placement place, const std::vector<std::si
     }
     strides_distance_check(lengths, number_of_transforms, forward_strides, forward_distance, "forward");
   } else {
-    strides_distance_check(lengths, number_of_transforms, forward_strides, forward_distance, "forward");
+    strides_distance_check(lengths, number_of_transforms, forward_strides, forward_distance, "forward",
+                           overlapping_forward_batches);
     strides_distance_check(lengths, number_of_transforms, backward_strides, backward_distance, "backward");
   }
 }
 
+/**
+ * Throw an exception if the outer batch dimensions of a domain are invalid or would make batches overlap.
+ *
+ * @param lengths the dimensions of the transform
+ * @param number_of_transforms the number of batches of the innermost batch dimension
+ * @param strides the strides between elements in a domain
+ * @param distance the distance between batches in a domain
+ * @param outer_batch_counts the number of batches of each outer batch dimension
+ * @param outer_distances the distances between batches of each outer batch dimension in a domain
+ * @param domain_str a string with the name of the domain being validated
+ */
+inline void outer_batches_check(const std::vector<std::size_t>& lengths, std::size_t number_of_transforms,
+                                const std::vector<std::size_t>& strides, std::size_t distance,
+                                const std::vector<std::size_t>& outer_batch_counts,
+                                const std::vector<std::size_t>& outer_distances, const std::string_view domain_str) {
+  if (outer_distances.size() != outer_batch_counts.size()) {
+    throw invalid_configuration("Mismatching ", domain_str, " outer distances length got ", outer_distances.size(),
+                                " expected ", outer_batch_counts.size());
+  }
+  // The batches described by the lengths, strides, distance and number_of_transforms are a block spanning `extent`
+  // elements. Like for the multi-dimensional check, the outer batch dimensions are sorted from fastest to slowest
+  // moving and each of them must step over the whole block of the previous one. Outer batches interleaved with the
+  // inner ones are rejected, even if their elements would not collide.
+  std::size_t extent = (number_of_transforms - 1) * distance + 1;
+  for (std::size_t i = 0; i < lengths.size(); ++i) {
+    extent += (lengths[i] - 1) * strides[i];
+  }
+  std::vector<std::size_t> indices;
+  for (std::size_t i = 0; i < outer_batch_counts.size(); ++i) {
+    if (outer_batch_counts[i] == 0) {
+      throw invalid_configuration("Invalid outer_batch_counts[", i, "]=", outer_batch_counts[i], ", must be positive");
+    }
+    if (outer_batch_counts[i] > 1) {
+      indices.push_back(i);
+    }
+  }
+  std::sort(indices.begin(), indices.end(),
+            [&](std::size_t a, std::size_t b) { return outer_distances[a] < outer_distances[b]; });
+  for (std::size_t i : indices) {
+    if (outer_distances[i] < extent) {
+      throw invalid_configuration("Domain ", domain_str, ": outer distance[", i, "]=", outer_distances[i],
+                                  " is not large enough to avoid overlap");
+    }
+    extent = outer_distances[i] * (outer_batch_counts[i] - 1) + extent;
+  }
+}
+
+/**
+ * Throw an exception if the outer batch dimensions are invalid for either domain.
+ *
+ * @param place where the result is written with respect to where it is read (in-place vs not in-place)
+ * @param lengths the dimensions of the transform
+ * @param number_of_transforms the number of batches of the innermost batch dimension
+ * @param forward_strides the strides between elements in the forward domain
+ * @param backward_strides the strides between elements in the backward domain
+ * @param forward_distance the distance between batches in the forward domain
+ * @param backward_distance the distance between batches in the backward domain
+ * @param outer_batch_counts the number of batches of each outer batch dimension
+ * @param forward_outer_distances the distances between batches of each outer batch dimension in the forward domain
+ * @param backward_outer_distances the distances between batches of each outer batch dimension in the backward domain
+ */
+inline void validate_outer_batches(placement place, const std::vector<std::size_t>& lengths,
+                                   std::size_t number_of_transforms, const std::vector<std::size_t>& forward_strides,
+                                   const std::vector<std::size_t>& backward_strides, std::size_t forward_distance,
+                                   std::size_t backward_distance, const std::vector<std::size_t>& outer_batch_counts,
+                                   const std::vector<std::size_t>& forward_outer_distances,
+                                   const std::vector<std::size_t>& backward_outer_distances) {
+  if (place == placement::IN_PLACE && forward_outer_distances != backward_outer_distances) {
+    throw invalid_configuration("Invalid forward and backward outer distances must match for in-place configurations");
+  }
+  outer_batches_check(lengths, number_of_transforms, forward_strides, forward_distance, outer_batch_counts,
+                      forward_outer_distances, "forward");
+  outer_batches_check(lengths, number_of_transforms, backward_strides, backward_distance, outer_batch_counts,
+                      backward_outer_distances, "backward");
+}
+
+/**
+ * Throw an exception if overlapping forward batches or the forward window are requested for an unsupported
+ * configuration.
+ *
+ * @param place where the result is written with respect to where it is read (in-place vs not in-place)
+ * @param lengths the dimensions of the transform
+ * @param overlapping_forward_batches whether the batches of the forward domain may overlap
+ * @param forward_window_size the number of values of the window applied to the input of forward transforms
+ */
+inline void validate_overlap_and_window(placement place, const std::vector<std::size_t>& lengths,
+                                        bool overlapping_forward_batches, std::size_t forward_window_size) {
+  if (overlapping_forward_batches) {
+    if (place == placement::IN_PLACE) {
+      throw invalid_configuration("Overlapping forward batches are only supported for out-of-place transforms");
+    }
+    if (lengths.size() != 1) {
+      throw unsupported_configuration("Overlapping forward batches are only supported for 1D transforms");
+    }
+  }
+  if (forward_window_size != 0) {
+    if (lengths.size() != 1) {
+      throw unsupported_configuration("A forward window is only supported for 1D transforms");
+    }
+    if (forward_window_size != lengths[0]) {
+      throw invalid_configuration("Invalid forward window size ", forward_window_size, ", expected ", lengths[0]);
+    }
+  }
+}
+
 /**
  * @brief Check as much as possible if a given descriptor is valid and supported for the current capabilties of portFFT.
  * @details The descriptor can still later be deemed unsupported if it is not immediately obvious. If the descriptor is
@@ -274,8 +385,14 @@ void validate_descriptor(const Descriptor& params) {
   }
 
   validate_lengths(params.lengths);
+  validate_overlap_and_window(params.placement, params.lengths, params.overlapping_forward_batches,
+                              params.forward_window.size());
   validate_strides_distance(params.placement, params.lengths, params.number_of_transforms, params.forward_strides,
-                            params.backward_strides, params.forward_distance, params.backward_distance);
+                            params.backward_strides, params.forward_distance, params.backward_distance,
+                            params.overlapping_forward_batches);
+  validate_outer_batches(params.placement, params.lengths, params.number_of_transforms, params.forward_strides,
+                         params.backward_strides, params.forward_distance, params.backward_distance,
+                         params.outer_batch_counts, params.forward_outer_distances, params.backward_outer_distances);
   validate_layout<typename Descriptor::Scalar>(params.lengths, portfft::detail::get_layout(params, direction::FORWARD),
                                                portfft::detail::get_layout(params, direction::BACKWARD));
 }
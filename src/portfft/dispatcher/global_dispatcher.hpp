@@ -27,6 +27,7 @@
 
 #include "portfft/common/global.hpp"
 #include "portfft/common/subgroup_ct.hpp"
+#include "portfft/common/twiddle_tables.hpp"
 #include "portfft/defines.hpp"
 #include "portfft/enums.hpp"
 #include "portfft/specialization_constant.hpp"
@@ -36,7 +37,7 @@ namespace detail {
 
 /**
  * Helper function to obtain the global and local range for kernel corresponding to the factor
- * @param fft_size length of the factor
+ * @param factors factorization of the factor used by the kernel, as in `kernel_data_struct::factors`
  * @param num_batches number of corresposing batches
  * @param level The implementation for the factor
  * @param n_compute_units compute_units available
@@ -44,8 +45,9 @@ namespace detail {
  * @param n_sgs_in_wg Number of subgroups in a workgroup.
  * @return std::pair containing global and local range
  */
-inline std::pair<IdxGlobal, IdxGlobal> get_launch_params(IdxGlobal fft_size, IdxGlobal num_batches, detail::level level,
-                                                         Idx n_compute_units, Idx subgroup_size, Idx n_sgs_in_wg) {
+inline std::pair<IdxGlobal, IdxGlobal> get_launch_params(const std::vector<Idx>& factors, IdxGlobal num_batches,
+                                                         detail::level level, Idx n_compute_units, Idx subgroup_size,
+                                                         Idx n_sgs_in_wg) {
   PORTFFT_LOG_FUNCTION_ENTRY();
   IdxGlobal n_available_sgs = 8 * n_compute_units * 64;
   IdxGlobal wg_size = n_sgs_in_wg * subgroup_size;
@@ -55,7 +57,7 @@ inline std::pair<IdxGlobal, IdxGlobal> get_launch_params(IdxGlobal fft_size, Idx
     return std::make_pair(std::min(n_wgs_required * wg_size, n_available_sgs), wg_size);
   }
   if (level == detail::level::SUBGROUP) {
-    IdxGlobal n_ffts_per_sg = static_cast<IdxGlobal>(subgroup_size) / detail::factorize_sg(fft_size, subgroup_size);
+    IdxGlobal n_ffts_per_sg = static_cast<IdxGlobal>(subgroup_size / factors.at(1));
     IdxGlobal n_ffts_per_wg = n_ffts_per_sg * n_sgs_in_wg;
     IdxGlobal n_wgs_required = divide_ceil(num_batches, n_ffts_per_wg);
     return std::make_pair(std::min(n_wgs_required * wg_size, n_available_sgs), wg_size);
@@ -67,22 +69,18 @@ inline std::pair<IdxGlobal, IdxGlobal> get_launch_params(IdxGlobal fft_size, Idx
 }
 
 /**
- * Transposes A into B, for complex inputs only
- * @param a Input pointer
- * @param b Output pointer
- * @param lda leading dimension of `a`
- * @param ldb leading dimension of `b`
- * @param num_elements Total number of complex values in the matrix
+ * Helper function to determine the number of scalars used for the twiddles multiplied with the output of a factor,
+ * before the next factor. With PORTFFT_GLOBAL_TWIDDLE_TABLES these are the twiddle tables from
+ * `calculate_twiddle_tables`, otherwise all the twiddles are stored.
+ * @param n_batches number of batches of the factor
+ * @param factor_size length of the factor
+ * @return number of scalars
  */
-template <typename T>
-void complex_transpose(const T* a, T* b, IdxGlobal lda, IdxGlobal ldb, IdxGlobal num_elements) {
-  PORTFFT_LOG_FUNCTION_ENTRY();
-  for (IdxGlobal i = 0; i < num_elements; i++) {
-    IdxGlobal j = i / ldb;
-    IdxGlobal k = i % ldb;
-    b[2 * i] = a[2 * k * lda + 2 * j];
-    b[2 * i + 1] = a[2 * k * lda + 2 * j + 1];
+inline IdxGlobal inter_factor_twiddles_size(IdxGlobal n_batches, IdxGlobal factor_size) {
+  if (PORTFFT_GLOBAL_TWIDDLE_TABLES) {
+    return 2 * twiddle_tables_size(n_batches * factor_size);
   }
+  return 2 * n_batches * factor_size;
 }
 
 /**
@@ -128,7 +126,7 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
     IdxGlobal mem_required_for_twiddles = 0;
     // First calculate mem required for twiddles between factors;
     for (std::size_t i = 0; i < factors_idx_global.size() - 1; i++) {
-      mem_required_for_twiddles += 2 * factors_idx_global.at(i) * sub_batches.at(i);
+      mem_required_for_twiddles += detail::inter_factor_twiddles_size(sub_batches.at(i), factors_idx_global.at(i));
     }
     // Now calculate mem required for twiddles per implementation
     std::size_t counter = 0;
@@ -142,63 +140,69 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
       }
       counter++;
     }
-    std::vector<Scalar> host_memory(static_cast<std::size_t>(mem_required_for_twiddles));
-    std::vector<Scalar> scratch_space(static_cast<std::size_t>(mem_required_for_twiddles));
-    PORTFFT_LOG_TRACE("Allocating global memory for twiddles for workgroup implementation. Allocation size",
+    PORTFFT_LOG_TRACE("Allocating global memory for twiddles for global implementation. Allocation size",
                       mem_required_for_twiddles);
-    Scalar* device_twiddles =
-        sycl::malloc_device<Scalar>(static_cast<std::size_t>(mem_required_for_twiddles), desc.queue);
+    Scalar* device_twiddles = sycl::aligned_alloc_device<Scalar>(
+        alignof(sycl::vec<Scalar, PORTFFT_VEC_LOAD_BYTES / sizeof(Scalar)>),
+        static_cast<std::size_t>(mem_required_for_twiddles), desc.queue);
 
-    // Helper Lambda to calculate twiddles
-    auto calculate_twiddles = [](IdxGlobal N, IdxGlobal M, IdxGlobal& offset, Scalar* ptr) {
-      for (IdxGlobal i = 0; i < N; i++) {
-        for (IdxGlobal j = 0; j < M; j++) {
-          double theta = -2 * M_PI * static_cast<double>(i * j) / static_cast<double>(N * M);
-          ptr[offset++] = static_cast<Scalar>(std::cos(theta));
-          ptr[offset++] = static_cast<Scalar>(std::sin(theta));
-        }
-      }
+    // only wait for the twiddle kernels, the queue may be computing with another committed descriptor
+    std::vector<sycl::event> events;
+    // Helper Lambda to launch a kernel calculating N * M interleaved complex twiddles exp(-2*pi*i*n*m/(N*M))
+    auto calculate_twiddles = [&desc, &events](IdxGlobal N, IdxGlobal M, IdxGlobal& offset, Scalar* ptr) {
+      PORTFFT_LOG_TRACE("Launching twiddle calculation kernel for global implementation with global size", N, M);
+      Scalar* res = ptr + offset;
+      events.push_back(desc.queue.submit([&](sycl::handler& cgh) {
+        cgh.parallel_for(sycl::range<2>({static_cast<std::size_t>(N), static_cast<std::size_t>(M)}),
+                         [=](sycl::item<2> it) {
+                           IdxGlobal n = static_cast<IdxGlobal>(it.get_id(0));
+                           IdxGlobal m = static_cast<IdxGlobal>(it.get_id(1));
+                           std::complex<Scalar> twiddle = detail::calculate_twiddle_reduced<Scalar>(n * m, N * M);
+                           res[2 * (n * M + m)] = twiddle.real();
+                           res[2 * (n * M + m) + 1] = twiddle.imag();
+                         });
+      }));
+      offset += 2 * N * M;
     };
 
     IdxGlobal offset = 0;
     // calculate twiddles to be multiplied between factors
     for (std::size_t i = 0; i < factors_idx_global.size() - 1; i++) {
-      calculate_twiddles(sub_batches.at(i), factors_idx_global.at(i), offset, host_memory.data());
+      if (PORTFFT_GLOBAL_TWIDDLE_TABLES) {
+        events.push_back(detail::calculate_twiddle_tables(desc.queue, sub_batches.at(i) * factors_idx_global.at(i),
+                                                          device_twiddles + offset));
+        offset += detail::inter_factor_twiddles_size(sub_batches.at(i), factors_idx_global.at(i));
+      } else {
+        calculate_twiddles(sub_batches.at(i), factors_idx_global.at(i), offset, device_twiddles);
+      }
     }
     // Now calculate per twiddles.
-    counter = 0;
     for (const auto& kernel_data : kernels) {
       if (kernel_data.level == detail::level::SUBGROUP) {
-        for (Idx i = 0; i < kernel_data.factors.at(1); i++) {
-          for (Idx j = 0; j < kernel_data.factors.at(0); j++) {
-            double theta = -2 * M_PI * static_cast<double>(i * j) /
-                           static_cast<double>(kernel_data.factors.at(0) * kernel_data.factors.at(1));
-            auto twiddle =
-                std::complex<Scalar>(static_cast<Scalar>(std::cos(theta)), static_cast<Scalar>(std::sin(theta)));
-            host_memory[static_cast<std::size_t>(offset + static_cast<IdxGlobal>(j * kernel_data.factors.at(1) + i))] =
-                twiddle.real();
-            host_memory[static_cast<std::size_t>(
-                offset + static_cast<IdxGlobal>((j + kernel_data.factors.at(0)) * kernel_data.factors.at(1) + i))] =
-                twiddle.imag();
-          }
-        }
-        offset += 2 * kernel_data.factors.at(0) * kernel_data.factors.at(1);
+        Idx factor_wi = kernel_data.factors.at(0);
+        Idx factor_sg = kernel_data.factors.at(1);
+        Scalar* res = device_twiddles + offset;
+        PORTFFT_LOG_TRACE("Launching twiddle calculation kernel for subgroup factor of global implementation",
+                          factor_sg, factor_wi);
+        events.push_back(desc.queue.submit([&](sycl::handler& cgh) {
+          cgh.parallel_for(sycl::range<2>({static_cast<std::size_t>(factor_sg), static_cast<std::size_t>(factor_wi)}),
+                           [=](sycl::item<2> it) {
+                             Idx n = static_cast<Idx>(it.get_id(0));
+                             Idx k = static_cast<Idx>(it.get_id(1));
+                             sg_calc_twiddles(factor_sg, factor_wi, n, k, res);
+                           });
+        }));
+        offset += 2 * factor_wi * factor_sg;
       } else if (kernel_data.level == detail::level::WORKGROUP) {
         Idx factor_n = kernel_data.factors.at(0) * kernel_data.factors.at(1);
         Idx factor_m = kernel_data.factors.at(2) * kernel_data.factors.at(3);
         calculate_twiddles(static_cast<IdxGlobal>(kernel_data.factors.at(0)),
-                           static_cast<IdxGlobal>(kernel_data.factors.at(1)), offset, host_memory.data());
+                           static_cast<IdxGlobal>(kernel_data.factors.at(1)), offset, device_twiddles);
         calculate_twiddles(static_cast<IdxGlobal>(kernel_data.factors.at(2)),
-                           static_cast<IdxGlobal>(kernel_data.factors.at(3)), offset, host_memory.data());
-        // Calculate wg twiddles and transpose them
+                           static_cast<IdxGlobal>(kernel_data.factors.at(3)), offset, device_twiddles);
         calculate_twiddles(static_cast<IdxGlobal>(factor_n), static_cast<IdxGlobal>(factor_m), offset,
-                           host_memory.data());
-        for (Idx j = 0; j < factor_n; j++) {
-          detail::complex_transpose(host_memory.data() + offset + 2 * j * factor_n, scratch_space.data(), factor_m,
-                                    factor_n, factor_n * factor_m);
-        }
+                           device_twiddles);
       }
-      counter++;
     }
 
     // Rearrage the twiddles between factors for optimal access patters in shared memory
@@ -222,15 +226,15 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
               layout::PACKED);
         }
         auto [global_range, local_range] =
-            detail::get_launch_params(factors_idx_global.at(counter), sub_batches.at(counter), detail::level::WORKITEM,
+            detail::get_launch_params(kernel_data.factors, sub_batches.at(counter), detail::level::WORKITEM,
                                       desc.n_compute_units, kernel_data.used_sg_size, num_sgs_in_wg);
         kernel_data.global_range = global_range;
         kernel_data.local_range = local_range;
       } else if (kernel_data.level == detail::level::SUBGROUP) {
         Idx num_sgs_in_wg = PORTFFT_SGS_IN_WG;
         // See comments in subgroup_dispatcher for layout requirements.
-        IdxGlobal factor_sg = detail::factorize_sg(factors_idx_global.at(counter), kernel_data.used_sg_size);
-        IdxGlobal factor_wi = factors_idx_global.at(counter) / factor_sg;
+        IdxGlobal factor_wi = kernel_data.factors.at(0);
+        IdxGlobal factor_sg = kernel_data.factors.at(1);
         if (counter < kernels.size() - 1) {
           kernel_data.local_mem_required = desc.num_scalars_in_local_mem(
               detail::level::SUBGROUP, static_cast<std::size_t>(factors_idx_global.at(counter)),
@@ -243,14 +247,14 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
               layout::PACKED);
         }
         auto [global_range, local_range] =
-            detail::get_launch_params(factors_idx_global.at(counter), sub_batches.at(counter), detail::level::SUBGROUP,
+            detail::get_launch_params(kernel_data.factors, sub_batches.at(counter), detail::level::SUBGROUP,
                                       desc.n_compute_units, kernel_data.used_sg_size, num_sgs_in_wg);
         kernel_data.global_range = global_range;
         kernel_data.local_range = local_range;
       }
       counter++;
     }
-    desc.queue.copy(host_memory.data(), device_twiddles, static_cast<std::size_t>(mem_required_for_twiddles)).wait();
+    sycl::event::wait(events);
     return device_twiddles;
   }
 };
@@ -258,7 +262,7 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
 template <typename Scalar, domain Domain>
 template <typename Dummy>
 struct committed_descriptor_impl<Scalar, Domain>::set_spec_constants_struct::inner<detail::level::GLOBAL, Dummy> {
-  static void execute(committed_descriptor_impl& /*desc*/, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
+  static void execute(committed_descriptor_impl& desc, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
                       Idx length, const std::vector<Idx>& factors, detail::level level, Idx factor_num,
                       Idx num_factors) {
     PORTFFT_LOG_FUNCTION_ENTRY();
@@ -268,15 +272,26 @@ struct committed_descriptor_impl<Scalar, Domain>::set_spec_constants_struct::inn
     in_bundle.template set_specialization_constant<detail::GlobalSpecConstNumFactors>(num_factors);
     PORTFFT_LOG_TRACE("GlobalSpecConstLevelNum:", factor_num);
     in_bundle.template set_specialization_constant<detail::GlobalSpecConstLevelNum>(factor_num);
+    PORTFFT_LOG_TRACE("GlobalSpecConstTwiddleTables:", PORTFFT_GLOBAL_TWIDDLE_TABLES);
+    in_bundle.template set_specialization_constant<detail::GlobalSpecConstTwiddleTables>(
+        static_cast<bool>(PORTFFT_GLOBAL_TWIDDLE_TABLES));
+    // the padding must match the one `num_scalars_in_local_mem` sized the local memory of the sub-kernel for
+    Idx bank_lines_per_pad = 0;
     if (level == detail::level::WORKITEM || level == detail::level::WORKGROUP) {
       PORTFFT_LOG_TRACE("SpecConstFftSize:", length);
       in_bundle.template set_specialization_constant<detail::SpecConstFftSize>(length);
+      if (level == detail::level::WORKITEM) {
+        bank_lines_per_pad = desc.bank_lines_per_pad(2 * length);
+      }
     } else if (level == detail::level::SUBGROUP) {
+      bank_lines_per_pad = desc.bank_lines_per_pad(2 * factors[0]);
       PORTFFT_LOG_TRACE("SubgroupFactorWISpecConst:", factors[0]);
       in_bundle.template set_specialization_constant<detail::SubgroupFactorWISpecConst>(factors[0]);
       PORTFFT_LOG_TRACE("SubgroupFactorSGSpecConst:", factors[1]);
       in_bundle.template set_specialization_constant<detail::SubgroupFactorSGSpecConst>(factors[1]);
     }
+    PORTFFT_LOG_TRACE("SpecConstBankLinesPerPad:", bank_lines_per_pad);
+    in_bundle.template set_specialization_constant<detail::SpecConstBankLinesPerPad>(bank_lines_per_pad);
   }
 };
 
@@ -299,15 +314,17 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
   static sycl::event execute(committed_descriptor_impl& desc, const TIn& in, TOut& out, const TIn& in_imag,
                              TOut& out_imag, const std::vector<sycl::event>& dependencies, IdxGlobal n_transforms,
                              IdxGlobal input_offset, IdxGlobal output_offset, dimension_struct& dimension_data,
-                             direction compute_direction, layout /*input_layout*/) {
+                             direction compute_direction, layout /*input_layout*/,
+                             const batch_pointers_struct& /*batch_pointers*/) {
     PORTFFT_LOG_FUNCTION_ENTRY();
+    desc.allocate_scratch();
     complex_storage storage = desc.params.complex_storage;
     const IdxGlobal vec_size = storage == complex_storage::INTERLEAVED_COMPLEX ? 2 : 1;
     const auto& kernels =
         compute_direction == direction::FORWARD ? dimension_data.forward_kernels : dimension_data.backward_kernels;
     const Scalar* twiddles_ptr = static_cast<const Scalar*>(kernels.at(0).twiddles_forward.get());
     const IdxGlobal* factors_and_scan = static_cast<const IdxGlobal*>(dimension_data.factors_and_scan.get());
-    std::size_t num_batches = desc.params.number_of_transforms;
+    std::size_t num_batches = static_cast<std::size_t>(n_transforms);
     std::size_t max_batches_in_l2 = static_cast<std::size_t>(dimension_data.num_batches_in_l2);
     std::size_t imag_offset = dimension_data.length * max_batches_in_l2;
     IdxGlobal initial_impl_twiddle_offset = 0;
@@ -320,7 +337,8 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
       cgh.host_task([&]() {});
     });
     for (std::size_t i = 0; i < static_cast<std::size_t>(num_factors - 1); i++) {
-      initial_impl_twiddle_offset += 2 * kernels.at(i).batch_size * static_cast<IdxGlobal>(kernels.at(i).length);
+      initial_impl_twiddle_offset += detail::inter_factor_twiddles_size(kernels.at(i).batch_size,
+                                                                        static_cast<IdxGlobal>(kernels.at(i).length));
     }
     for (std::size_t i = 0; i < num_batches; i += max_batches_in_l2) {
       PORTFFT_LOG_TRACE("Global implementation working on batches", i, "through", i + max_batches_in_l2, "out of",
@@ -337,7 +355,8 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
           dimension_data.num_factors, storage, {event}, desc.queue);
       detail::dump_device(desc.queue, "after factor 0:", desc.scratch_ptr_1.get(),
                           desc.params.number_of_transforms * dimension_data.length * 2, l2_events);
-      intermediate_twiddles_offset += 2 * kernel0.batch_size * static_cast<IdxGlobal>(kernel0.length);
+      intermediate_twiddles_offset +=
+          detail::inter_factor_twiddles_size(kernel0.batch_size, static_cast<IdxGlobal>(kernel0.length));
       impl_twiddle_offset += detail::increment_twiddle_offset(kernel0.level, static_cast<Idx>(kernel0.length));
       for (std::size_t factor_num = 1; factor_num < static_cast<std::size_t>(dimension_data.num_factors);
            factor_num++) {
@@ -352,7 +371,8 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
             impl_twiddle_offset, 0, committed_size, static_cast<Idx>(max_batches_in_l2),
             static_cast<IdxGlobal>(num_batches), static_cast<IdxGlobal>(i), dimension_data.num_factors, storage,
             l2_events, desc.queue);
-        intermediate_twiddles_offset += 2 * current_kernel.batch_size * static_cast<IdxGlobal>(current_kernel.length);
+        intermediate_twiddles_offset += detail::inter_factor_twiddles_size(
+            current_kernel.batch_size, static_cast<IdxGlobal>(current_kernel.length));
         impl_twiddle_offset +=
             detail::increment_twiddle_offset(current_kernel.level, static_cast<Idx>(current_kernel.length));
         detail::dump_device(desc.queue, "after factor:", desc.scratch_ptr_1.get(),
@@ -389,6 +409,7 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
             vec_size * static_cast<IdxGlobal>(i) * committed_size + output_offset, desc.queue, {event}, storage);
       }
     }
+    desc.last_scratch_event = event;
     return event;
   }
 };
@@ -0,0 +1,312 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_DISPATCHER_MULTI_DIM_DISPATCHER_HPP
+#define PORTFFT_DISPATCHER_MULTI_DIM_DISPATCHER_HPP
+
+#include <algorithm>
+
+#include "portfft/common/helpers.hpp"
+#include "portfft/common/logging.hpp"
+#include "portfft/common/memory_views.hpp"
+#include "portfft/common/transfers.hpp"
+#include "portfft/common/workitem.hpp"
+#include "portfft/defines.hpp"
+#include "portfft/descriptor.hpp"
+#include "portfft/enums.hpp"
+#include "portfft/specialization_constant.hpp"
+#include "portfft/utils.hpp"
+
+namespace portfft {
+namespace detail {
+/**
+ * Calculates the global size needed for given problem.
+ *
+ * @param n_transforms number of transforms
+ * @param subgroup_size size of subgroup used by the compute kernel
+ * @param num_sgs_per_wg number of subgroups in a workgroup
+ * @param n_compute_units number of compute units on target device
+ * @return Number of workitems that need to be launched
+ */
+inline IdxGlobal get_global_size_multi_dim(IdxGlobal n_transforms, Idx subgroup_size, Idx num_sgs_per_wg,
+                                           Idx n_compute_units) {
+  PORTFFT_LOG_FUNCTION_ENTRY();
+  Idx maximum_n_sgs = 8 * n_compute_units * 64;
+  Idx maximum_n_wgs = maximum_n_sgs / num_sgs_per_wg;
+  Idx wg_size = subgroup_size * num_sgs_per_wg;
+  return static_cast<IdxGlobal>(wg_size) * sycl::min(static_cast<IdxGlobal>(maximum_n_wgs), n_transforms);
+}
+
+/**
+ * Implementation of multi-dimensional FFT for sizes where each dimension can be done by independent work items and the
+ * whole transform fits in local memory. Each workgroup loads a whole transform into local memory, computes all the
+ * dimensions in it, starting with the innermost one, and stores the result back to global memory.
+ *
+ * @tparam SubgroupSize size of the subgroup
+ * @tparam T type of the scalar used for computations
+ * @tparam TIn type of the real values stored in the input. Converted to `T` on load.
+ * @tparam TOut type of the real values stored in the output. Converted from `T` on store.
+ * @param input pointer to global memory containing input data. If complex storage (from
+ * `SpecConstComplexStorage`) is split, this is just the real part of data.
+ * @param output pointer to global memory for output data. If complex storage (from
+ * `SpecConstComplexStorage`) is split, this is just the real part of data.
+ * @param input_imag pointer to global memory containing imaginary part of the input data if complex storage
+ * (from `SpecConstComplexStorage`) is split. Otherwise unused.
+ * @param output_imag pointer to global memory containing imaginary part of the input data if complex storage
+ * (from `SpecConstComplexStorage`) is split. Otherwise unused.
+ * @param loc local memory pointer. Size requirement is determined by `num_scalars_in_local_mem_struct`.
+ * @param n_transforms number of FT transforms to do in one call
+ * @param global_data global data for the kernel
+ * @param kh kernel handler associated with the kernel launch
+ */
+template <Idx SubgroupSize, typename T, typename TIn, typename TOut>
+PORTFFT_INLINE void multi_dim_impl(const TIn* input, TOut* output, const TIn* input_imag, TOut* output_imag, T* loc,
+                                   IdxGlobal n_transforms, global_data_struct<1> global_data,
+                                   sycl::kernel_handler& kh) {
+  complex_storage storage = kh.get_specialization_constant<detail::SpecConstComplexStorage>();
+  detail::apply_scale_factor apply_scale_factor = kh.get_specialization_constant<detail::SpecConstApplyScaleFactor>();
+  detail::complex_conjugate conjugate_on_load = kh.get_specialization_constant<detail::SpecConstConjugateOnLoad>();
+  detail::complex_conjugate conjugate_on_store = kh.get_specialization_constant<detail::SpecConstConjugateOnStore>();
+
+  T scaling_factor = kh.get_specialization_constant<detail::get_spec_constant_scale<T>()>();
+  detail::fold_integer_input_scale<TIn>(kh, apply_scale_factor, scaling_factor);
+
+  const Idx fft_size = kh.get_specialization_constant<detail::SpecConstFftSize>();
+  const IdxGlobal input_distance = kh.get_specialization_constant<detail::SpecConstInputDistance>();
+  const IdxGlobal output_distance = kh.get_specialization_constant<detail::SpecConstOutputDistance>();
+  const Idx lengths[MaxFusedDimensions] = {kh.get_specialization_constant<detail::SpecConstMultiDimLength0>(),
+                                           kh.get_specialization_constant<detail::SpecConstMultiDimLength1>(),
+                                           kh.get_specialization_constant<detail::SpecConstMultiDimLength2>()};
+
+  global_data.log_message_global(__func__, "entered", "fft_size", fft_size, "n_transforms", n_transforms);
+
+  const bool interleaved_storage = storage == complex_storage::INTERLEAVED_COMPLEX;
+  const Idx n_reals = 2 * fft_size;
+  const IdxGlobal input_distance_in_reals = interleaved_storage ? 2 * input_distance : input_distance;
+  const IdxGlobal output_distance_in_reals = interleaved_storage ? 2 * output_distance : output_distance;
+
+  // the outermost dimension that needs computing - leading dimensions of length 1 are skipped
+  Idx last_dim = 0;
+  while (last_dim < MaxFusedDimensions - 1 && lengths[last_dim] == 1) {
+    last_dim++;
+  }
+
+  T wi_private_scratch[2 * wi_temps(detail::MaxComplexPerWI)];
+  T priv[2 * MaxComplexPerWI];
+  detail::strided_view priv_real_view{priv, 2};
+  detail::strided_view priv_imag_view{priv, 2, 1};
+  const Idx n_local_banks = kh.get_specialization_constant<detail::SpecConstNumLocalBanks>();
+  const Idx bank_lines_per_pad = kh.get_specialization_constant<detail::SpecConstBankLinesPerPad>();
+  auto loc_view = detail::padded_view(loc, bank_lines_per_pad, n_local_banks);
+
+  const Idx local_id = static_cast<Idx>(global_data.it.get_local_id(0));
+  const Idx local_size = static_cast<Idx>(global_data.it.get_local_range(0));
+  const IdxGlobal n_workgroups = static_cast<IdxGlobal>(global_data.it.get_group_range(0));
+
+  for (IdxGlobal i = static_cast<IdxGlobal>(global_data.it.get_group(0)); i < n_transforms; i += n_workgroups) {
+    if (interleaved_storage) {
+      global_data.log_message_global(__func__, "loading data from global to local memory");
+      global2local<level::WORKGROUP, SubgroupSize>(global_data, input, loc_view, n_reals, input_distance_in_reals * i);
+    } else {
+      global_data.log_message_global(__func__, "loading real and imaginary data from global to local memory");
+      global2local<level::WORKGROUP, SubgroupSize>(global_data, input, loc_view, fft_size, input_distance_in_reals * i);
+      global2local<level::WORKGROUP, SubgroupSize>(global_data, input_imag, loc_view, fft_size,
+                                                   input_distance_in_reals * i, fft_size);
+    }
+    sycl::group_barrier(global_data.it.get_group());
+    global_data.log_dump_local("input data loaded in local memory:", loc, n_reals);
+
+    Idx inner_size = 1;
+    for (Idx dim = MaxFusedDimensions - 1; dim >= last_dim; dim--) {
+      const Idx length = lengths[dim];
+      const bool is_first_pass = dim == MaxFusedDimensions - 1;
+      const bool is_last_pass = dim == last_dim;
+      for (Idx fft_idx = local_id; fft_idx < fft_size / length; fft_idx += local_size) {
+        // index of the first element of this fft - one fft for every combination of the indices in other dimensions
+        const Idx first = (fft_idx / inner_size) * length * inner_size + fft_idx % inner_size;
+        if (interleaved_storage) {
+          detail::strided_view loc_fft_view{loc_view, inner_size, 2 * first};
+          copy_wi<2>(global_data, loc_fft_view, priv, length);
+        } else {
+          detail::strided_view loc_real_view{loc_view, inner_size, first};
+          detail::strided_view loc_imag_view{loc_view, inner_size, fft_size + first};
+          copy_wi(global_data, loc_real_view, priv_real_view, length);
+          copy_wi(global_data, loc_imag_view, priv_imag_view, length);
+        }
+        if (is_first_pass && conjugate_on_load == detail::complex_conjugate::APPLIED) {
+          conjugate_inplace(priv, length);
+        }
+        wi_dft<0>(priv, priv, length, 1, 1, wi_private_scratch);
+        if (is_last_pass) {
+          if (conjugate_on_store == detail::complex_conjugate::APPLIED) {
+            conjugate_inplace(priv, length);
+          }
+          if (apply_scale_factor == detail::apply_scale_factor::APPLIED) {
+            PORTFFT_UNROLL
+            for (Idx idx = 0; idx < 2 * length; idx += 2) {
+              priv[idx] *= scaling_factor;
+              priv[idx + 1] *= scaling_factor;
+            }
+          }
+        }
+        if (interleaved_storage) {
+          detail::strided_view loc_fft_view{loc_view, inner_size, 2 * first};
+          copy_wi<2>(global_data, priv, loc_fft_view, length);
+        } else {
+          detail::strided_view loc_real_view{loc_view, inner_size, first};
+          detail::strided_view loc_imag_view{loc_view, inner_size, fft_size + first};
+          copy_wi(global_data, priv_real_view, loc_real_view, length);
+          copy_wi(global_data, priv_imag_view, loc_imag_view, length);
+        }
+      }
+      inner_size *= length;
+      sycl::group_barrier(global_data.it.get_group());
+    }
+    global_data.log_dump_local("computed data in local memory:", loc, n_reals);
+
+    if (interleaved_storage) {
+      global_data.log_message_global(__func__, "storing data from local to global memory");
+      local2global<level::WORKGROUP, SubgroupSize>(global_data, loc_view, output, n_reals, 0,
+                                                   output_distance_in_reals * i);
+    } else {
+      global_data.log_message_global(__func__, "storing real and imaginary data from local to global memory");
+      local2global<level::WORKGROUP, SubgroupSize>(global_data, loc_view, output, fft_size, 0,
+                                                   output_distance_in_reals * i);
+      local2global<level::WORKGROUP, SubgroupSize>(global_data, loc_view, output_imag, fft_size, fft_size,
+                                                   output_distance_in_reals * i);
+    }
+    sycl::group_barrier(global_data.it.get_group());
+  }
+  global_data.log_message_global(__func__, "exited");
+}
+
+template <typename Scalar, domain Domain>
+template <Idx SubgroupSize, typename TIn, typename TOut>
+template <typename Dummy>
+struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize, TIn,
+                                                                    TOut>::inner<detail::level::MULTI_DIM, Dummy> {
+  static sycl::event execute(committed_descriptor_impl& desc, const TIn& in, TOut& out, const TIn& in_imag,
+                             TOut& out_imag, const std::vector<sycl::event>& dependencies, IdxGlobal n_transforms,
+                             IdxGlobal input_offset, IdxGlobal output_offset, dimension_struct& dimension_data,
+                             direction compute_direction, layout input_layout,
+                             const batch_pointers_struct& /*batch_pointers*/) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    constexpr detail::memory Mem = std::is_pointer_v<TOut> ? detail::memory::USM : detail::memory::BUFFER;
+    using StorageScalar = detail::get_storage_scalar_t<TIn>;
+    auto& kernel_data = compute_direction == direction::FORWARD ? dimension_data.forward_kernels.at(0)
+                                                                : dimension_data.backward_kernels.at(0);
+    const auto& launch = kernel_data.get_launch_params(input_layout);
+    std::size_t local_elements = launch.local_elements;
+    std::size_t global_size = static_cast<std::size_t>(detail::get_global_size_multi_dim(
+        n_transforms, SubgroupSize, launch.num_sgs_per_wg, desc.n_compute_units));
+
+    return desc.queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+      cgh.use_kernel_bundle(kernel_data.exec_bundle);
+      auto in_acc_or_usm = detail::get_access(in, cgh);
+      auto out_acc_or_usm = detail::get_access(out, cgh);
+      auto in_imag_acc_or_usm = detail::get_access(in_imag, cgh);
+      auto out_imag_acc_or_usm = detail::get_access(out_imag, cgh);
+      sycl::local_accessor<Scalar, 1> loc(static_cast<std::size_t>(local_elements), cgh);
+#ifdef PORTFFT_KERNEL_LOG
+      sycl::stream s{1024 * 16 * 8, 1024, cgh};
+#endif
+      PORTFFT_LOG_TRACE("Launching multi-dimensional kernel with global_size", global_size, "local_size",
+                        SubgroupSize * launch.num_sgs_per_wg, "local memory allocation of size", local_elements);
+      cgh.parallel_for<detail::multi_dim_kernel<Scalar, Domain, Mem, SubgroupSize, StorageScalar>>(
+          sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(SubgroupSize * launch.num_sgs_per_wg)}},
+          [=
+#ifdef PORTFFT_KERNEL_LOG
+               ,
+           global_logging_config = detail::global_logging_config
+#endif
+      ](sycl::nd_item<1> it, sycl::kernel_handler kh) PORTFFT_REQD_SUBGROUP_SIZE(SubgroupSize) {
+            detail::global_data_struct global_data{
+#ifdef PORTFFT_KERNEL_LOG
+                s, global_logging_config,
+#endif
+                it};
+            global_data.log_message_global("Running multi-dimensional kernel");
+            detail::multi_dim_impl<SubgroupSize>(&in_acc_or_usm[0] + input_offset, &out_acc_or_usm[0] + output_offset,
+                                                 &in_imag_acc_or_usm[0] + input_offset,
+                                                 &out_imag_acc_or_usm[0] + output_offset, &loc[0], n_transforms,
+                                                 global_data, kh);
+            global_data.log_message_global("Exiting multi-dimensional kernel");
+          });
+    });
+  }
+};
+
+template <typename Scalar, domain Domain>
+template <typename Dummy>
+struct committed_descriptor_impl<Scalar, Domain>::set_spec_constants_struct::inner<detail::level::MULTI_DIM, Dummy> {
+  static void execute(committed_descriptor_impl& desc, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
+                      Idx length, const std::vector<Idx>& factors, detail::level /*level*/, Idx /*factor_num*/,
+                      Idx /*num_factors*/) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    // lengths are aligned to the innermost dimension, unused outer dimensions have length 1
+    Idx lengths[MaxFusedDimensions] = {1, 1, 1};
+    std::copy(factors.begin(), factors.end(), lengths + MaxFusedDimensions - static_cast<Idx>(factors.size()));
+    PORTFFT_LOG_TRACE("SpecConstFftSize:", length);
+    in_bundle.template set_specialization_constant<detail::SpecConstFftSize>(length);
+    PORTFFT_LOG_TRACE("SpecConstMultiDimLengths:", lengths[0], lengths[1], lengths[2]);
+    in_bundle.template set_specialization_constant<detail::SpecConstMultiDimLength0>(lengths[0]);
+    in_bundle.template set_specialization_constant<detail::SpecConstMultiDimLength1>(lengths[1]);
+    in_bundle.template set_specialization_constant<detail::SpecConstMultiDimLength2>(lengths[2]);
+    // work-items computing the innermost dimension each load a row of it from local memory
+    Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * factors.back());
+    PORTFFT_LOG_TRACE("SpecConstBankLinesPerPad:", bank_lines_per_pad);
+    in_bundle.template set_specialization_constant<detail::SpecConstBankLinesPerPad>(bank_lines_per_pad);
+  }
+};
+
+template <typename Scalar, domain Domain>
+template <typename Dummy>
+struct committed_descriptor_impl<Scalar, Domain>::num_scalars_in_local_mem_struct::inner<detail::level::MULTI_DIM,
+                                                                                         Dummy> {
+  static std::size_t execute(committed_descriptor_impl& desc, std::size_t length, Idx used_sg_size,
+                             const std::vector<Idx>& factors, Idx& num_sgs_per_wg, layout /*input_layout*/) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    // enough workitems for the dimension with the most ffts to compute them all at once
+    Idx max_ffts_per_pass = 1;
+    for (Idx factor : factors) {
+      max_ffts_per_pass = std::max(max_ffts_per_pass, static_cast<Idx>(length) / factor);
+    }
+    num_sgs_per_wg = std::min(Idx(PORTFFT_SGS_IN_WG), divide_ceil(max_ffts_per_pass, used_sg_size));
+    const Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * factors.back());
+    return static_cast<std::size_t>(
+        detail::pad_local(2 * static_cast<Idx>(length), bank_lines_per_pad, desc.n_local_banks));
+  }
+};
+
+template <typename Scalar, domain Domain>
+template <typename Dummy>
+struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inner<detail::level::MULTI_DIM, Dummy> {
+  static Scalar* execute(committed_descriptor_impl& /*desc*/, dimension_struct& /*dimension_data*/,
+                         std::vector<kernel_data_struct>& /*kernels*/) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return nullptr;
+  }
+};
+
+}  // namespace detail
+}  // namespace portfft
+
+#endif  // PORTFFT_DISPATCHER_MULTI_DIM_DISPATCHER_HPP
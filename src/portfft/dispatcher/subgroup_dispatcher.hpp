@@ -32,6 +32,7 @@
 #include "portfft/descriptor.hpp"
 #include "portfft/enums.hpp"
 #include "portfft/specialization_constant.hpp"
+#include "portfft/utils.hpp"
 
 #include <memory>
 
@@ -66,6 +67,8 @@ IdxGlobal get_global_size_subgroup(IdxGlobal n_transforms, Idx factor_sg, Idx su
  *
  * @tparam SubgroupSize size of the subgroup
  * @tparam T type of the scalar used for computations
+ * @tparam TIn type of the real values stored in the input. Converted to `T` on load.
+ * @tparam TOut type of the real values stored in the output. Converted from `T` on store.
  * @param input pointer to global memory containing input data. If complex storage (from
  * `SpecConstComplexStorage`) is split, this is just the real part of data.
  * @param output pointer to global memory for output data. If complex storage (from
@@ -77,30 +80,41 @@ IdxGlobal get_global_size_subgroup(IdxGlobal n_transforms, Idx factor_sg, Idx su
  * @param loc pointer to local memory. Size requirement is determined by `num_scalars_in_local_mem_struct`.
  * @param loc_twiddles pointer to local memory for twiddle factors. Must have enough space for `2 * FactorWI * FactorSG`
  * values
+ * @param loc_prefetch pointer to a second local memory allocation of the same size as `loc`, into which the next
+ * batches are loaded while the current ones are computed. Only used by the Cooley-Tukey algorithm. nullptr disables the
+ * prefetching.
  * @param n_transforms number of FFT transforms to do in one call
  * @param global_data global data for the kernel
  * @param kh kernel handler associated with the kernel launch
  * @param twiddles pointer containing twiddles
  * @param load_modifier_data Pointer to the load modifier data in global Memory
  * @param store_modifier_data Pointer to the store modifier data in global Memory
+ * @param input_batch_ptrs Pointer to an array in global memory with the input pointer of each transform, null if the
+ * transforms are at `input`. Only used with packed, interleaved complex input.
+ * @param output_batch_ptrs Pointer to an array in global memory with the output pointer of each transform, null if the
+ * transforms are at `output`. Only used with packed, interleaved complex output.
+ * @param window Pointer to the real values in global memory the input of each transform is multiplied by, null for no
+ * window. Only used by the Cooley-Tukey algorithm.
  */
-template <Idx SubgroupSize, typename T>
-PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag, T* output_imag, T* loc,
-                                  T* loc_twiddles, IdxGlobal n_transforms, const T* twiddles,
+template <Idx SubgroupSize, typename T, typename TIn, typename TOut>
+PORTFFT_INLINE void subgroup_impl(const TIn* input, TOut* output, const TIn* input_imag, TOut* output_imag, T* loc,
+                                  T* loc_twiddles, T* loc_prefetch, IdxGlobal n_transforms, const T* twiddles,
                                   global_data_struct<1> global_data, sycl::kernel_handler& kh,
-                                  const T* load_modifier_data = nullptr, const T* store_modifier_data = nullptr) {
+                                  const T* load_modifier_data = nullptr, const T* store_modifier_data = nullptr,
+                                  const T* const* input_batch_ptrs = nullptr, T* const* output_batch_ptrs = nullptr,
+                                  const T* window = nullptr) {
   const complex_storage storage = kh.get_specialization_constant<detail::SpecConstComplexStorage>();
   const detail::elementwise_multiply multiply_on_load =
       kh.get_specialization_constant<detail::SpecConstMultiplyOnLoad>();
   const detail::elementwise_multiply multiply_on_store =
       kh.get_specialization_constant<detail::SpecConstMultiplyOnStore>();
-  const detail::apply_scale_factor apply_scale_factor =
-      kh.get_specialization_constant<detail::SpecConstApplyScaleFactor>();
+  detail::apply_scale_factor apply_scale_factor = kh.get_specialization_constant<detail::SpecConstApplyScaleFactor>();
   const detail::complex_conjugate conjugate_on_load =
       kh.get_specialization_constant<detail::SpecConstConjugateOnLoad>();
   const detail::complex_conjugate conjugate_on_store =
       kh.get_specialization_constant<detail::SpecConstConjugateOnStore>();
-  const T scaling_factor = kh.get_specialization_constant<detail::get_spec_constant_scale<T>()>();
+  T scaling_factor = kh.get_specialization_constant<detail::get_spec_constant_scale<T>()>();
+  detail::fold_integer_input_scale<TIn>(kh, apply_scale_factor, scaling_factor);
 
   const Idx factor_wi = kh.get_specialization_constant<SubgroupFactorWISpecConst>();
   const Idx factor_sg = kh.get_specialization_constant<SubgroupFactorSGSpecConst>();
@@ -108,8 +122,15 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
   const IdxGlobal output_stride = kh.get_specialization_constant<detail::SpecConstOutputStride>();
   const IdxGlobal input_distance = kh.get_specialization_constant<detail::SpecConstInputDistance>();
   const IdxGlobal output_distance = kh.get_specialization_constant<detail::SpecConstOutputDistance>();
+  const IdxGlobal batches_per_outer_batch = kh.get_specialization_constant<detail::SpecConstBatchesPerOuterBatch>();
+  const IdxGlobal input_outer_distance = kh.get_specialization_constant<detail::SpecConstInputOuterDistance>();
+  const IdxGlobal output_outer_distance = kh.get_specialization_constant<detail::SpecConstOutputOuterDistance>();
   const Idx committed_length = kh.get_specialization_constant<detail::SpecConstCommittedLength>();
   detail::fft_algorithm algorithm = kh.get_specialization_constant<detail::SpecConstFFTAlgorithm>();
+  const Idx store_modifier_table_bits =
+      kh.get_specialization_constant<detail::GlobalSpecConstTwiddleTables>()
+          ? twiddle_table_bits(n_transforms * static_cast<IdxGlobal>(factor_wi * factor_sg))
+          : 0;
 
   global_data.log_message_global(__func__, "entered", "FactorWI", factor_wi, "FactorSG", factor_sg, "n_transforms",
                                  n_transforms);
@@ -144,10 +165,17 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
   // round up so the whole work-group enters the loop and can be used for synchronization
   IdxGlobal rounded_up_n_ffts = round_up_to_multiple(n_transforms, static_cast<IdxGlobal>(n_ffts_per_wg));
 
-  const bool is_input_batch_interleaved = input_stride == n_transforms && input_distance == 1;
-  const bool is_output_batch_interleaved = output_stride == n_transforms && output_distance == 1;
-  const bool is_input_packed = input_stride == 1 && input_distance == committed_length;
-  const bool is_output_packed = output_stride == 1 && output_distance == committed_length;
+  // The transforms of a subgroup can span two outer batches, so with outer batches each transform is copied between
+  // global and local memory on its own. Only set for the Cooley-Tukey algorithm.
+  const bool has_outer_batches = batches_per_outer_batch != 0;
+  const bool is_input_batch_interleaved = input_stride == n_transforms && input_distance == 1 && !has_outer_batches;
+  const bool is_output_batch_interleaved = output_stride == n_transforms && output_distance == 1 && !has_outer_batches;
+  const bool is_input_packed = input_stride == 1 && input_distance == committed_length && !has_outer_batches;
+  const bool is_output_packed = output_stride == 1 && output_distance == committed_length && !has_outer_batches;
+  // The frames of a subgroup overlap, as in a short-time Fourier transform. The span of signal they cover is loaded to
+  // local memory once and each work-item reads its part of a frame from there.
+  const bool is_input_overlapping =
+      input_stride == 1 && input_distance < committed_length && !is_input_batch_interleaved && !has_outer_batches;
 
   IdxGlobal id_of_fft_in_kernel;
   IdxGlobal n_ffts_in_kernel;
@@ -159,18 +187,110 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
     n_ffts_in_kernel = n_sgs_in_kernel * n_ffts_per_sg;
   }
 
-  constexpr Idx BankLinesPerPad = 1;
-  auto loc_view = detail::padded_view(loc, BankLinesPerPad);
+  const Idx n_local_banks = kh.get_specialization_constant<detail::SpecConstNumLocalBanks>();
+  const Idx bank_lines_per_pad = kh.get_specialization_constant<detail::SpecConstBankLinesPerPad>();
+  auto loc_view = detail::padded_view(loc, bank_lines_per_pad, n_local_banks);
+  auto loc_prefetch_view = detail::padded_view(loc_prefetch, bank_lines_per_pad, n_local_banks);
 
   global_data.log_message_global(__func__, "loading sg twiddles from global to local memory");
   global2local<level::WORKGROUP, SubgroupSize>(global_data, twiddles, loc_twiddles, n_reals_per_fft);
   sycl::group_barrier(global_data.it.get_group());
   global_data.log_dump_local("twiddles in local memory:", loc_twiddles, n_reals_per_fft);
 
+  // number of batches loaded into local memory at once in the batch interleaved codepath, starting from batch `i`
+  auto get_num_batches_in_local_mem = [&](IdxGlobal i) {
+    if (i + static_cast<IdxGlobal>(local_size) / 2 < n_transforms) {
+      return local_size / 2;
+    }
+    return static_cast<Idx>(n_transforms - i);
+  };
+  // loads the batches starting from batch `i` into local memory `loc_slot` in the batch interleaved codepath
+  auto load_batch_interleaved = [&](auto loc_slot, IdxGlobal i) {
+    Idx max_num_batches_local_mem = n_sgs_in_wg * SubgroupSize / 2;
+    Idx num_batches_in_local_mem = get_num_batches_in_local_mem(i);
+    Idx local_imag_offset = factor_wi * factor_sg * max_num_batches_local_mem;
+    global_data.log_message_global(__func__, "loading transposed data from global to local memory");
+    // load / store in a transposed manner
+    if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+      local_global_strided_copy<detail::level::WORKGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
+          input, loc_slot, {2 * n_transforms, static_cast<IdxGlobal>(1)}, {2 * max_num_batches_local_mem, 1}, 2 * i, 0,
+          {committed_length, 2 * num_batches_in_local_mem}, global_data);
+    } else {
+      local_global_strided_copy<detail::level::WORKGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
+          input, input_imag, loc_slot, {n_transforms, static_cast<IdxGlobal>(1)}, {max_num_batches_local_mem, 1}, i, 0,
+          local_imag_offset, {committed_length, num_batches_in_local_mem}, global_data);
+    }
+  };
+  // loads `n_ffts` batches starting from batch `first_fft` into the part of local memory `loc_slot` used by this
+  // subgroup in the Cooley-Tukey, not batch interleaved codepath
+  auto load_packed_cooley_tukey = [&](auto loc_slot, IdxGlobal first_fft, Idx n_ffts) {
+    Idx local_imag_offset = n_cplx_per_sg * n_sgs_in_wg;
+    const IdxGlobal n_io_reals_per_fft = storage == complex_storage::INTERLEAVED_COMPLEX ? n_reals_per_fft : fft_size;
+    const Idx n_io_reals_per_sg = storage == complex_storage::INTERLEAVED_COMPLEX ? n_reals_per_sg : n_cplx_per_sg;
+    const Idx local_offset = subgroup_id * n_io_reals_per_sg;
+    global_data.log_message_global(__func__, "loading non-transposed data from global to local memory");
+    if (is_input_packed) {
+      IdxGlobal global_ptr_offset = static_cast<IdxGlobal>(n_io_reals_per_fft) * first_fft;
+      if (storage == complex_storage::INTERLEAVED_COMPLEX && input_batch_ptrs != nullptr) {
+        global_data.log_message_global(__func__, "loading packed data of separate transforms to local memory");
+        for (Idx j = 0; j < n_ffts; j++) {
+          global2local<level::SUBGROUP, SubgroupSize>(global_data, input_batch_ptrs[first_fft + j], loc_slot,
+                                                      n_reals_per_fft, 0,
+                                                      subgroup_id * n_reals_per_sg + j * n_reals_per_fft);
+        }
+      } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+        local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, SubgroupSize>(
+            input, loc_slot, global_ptr_offset, subgroup_id * n_reals_per_sg, n_ffts * n_reals_per_fft, global_data);
+      } else {
+        local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, SubgroupSize>(
+            input, input_imag, loc_slot, global_ptr_offset, subgroup_id * n_cplx_per_sg, local_imag_offset,
+            n_ffts * fft_size, global_data);
+      }
+    } else if (is_input_overlapping) {
+      const Idx n_span_complex = static_cast<Idx>(input_distance) * (n_ffts - 1) + fft_size;
+      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+        local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, SubgroupSize>(
+            input, loc_slot, input_distance * 2 * first_fft, local_offset, 2 * n_span_complex, global_data);
+      } else {
+        local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, SubgroupSize>(
+            input, input_imag, loc_slot, input_distance * first_fft, local_offset, local_imag_offset, n_span_complex,
+            global_data);
+      }
+    } else if (has_outer_batches) {
+      global_data.log_message_global(__func__, "loading data of outer batches from global memory to local");
+      for (Idx j = 0; j < n_ffts; j++) {
+        const IdxGlobal batch_offset =
+            get_batch_offset(first_fft + j, input_distance, input_outer_distance, batches_per_outer_batch);
+        if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+          local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
+              input, loc_slot, {input_stride * 2, 1}, {2, 1}, 2 * batch_offset,
+              local_offset + j * 2 * committed_length, {committed_length, 2}, global_data);
+        } else {
+          local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 1, 1, 1>(
+              input, input_imag, loc_slot, {input_stride}, {1}, batch_offset, local_offset + j * committed_length,
+              local_imag_offset, {committed_length}, global_data);
+        }
+      }
+    } else {
+      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+        global_data.log_message_global(__func__, "storing data from unpacked global memory to local");
+        local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 3, 3, 3>(
+            input, loc_slot, {input_distance * 2, input_stride * 2, 1}, {committed_length * 2, 2, 1},
+            input_distance * 2 * first_fft, local_offset, {n_ffts, committed_length, 2}, global_data);
+      } else {
+        local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
+            input, input_imag, loc_slot, {input_distance, input_stride}, {committed_length, 1},
+            input_distance * first_fft, local_offset, local_imag_offset, {n_ffts, committed_length}, global_data);
+      }
+    }
+  };
+
+  bool prefetched = false;
   for (IdxGlobal i = static_cast<IdxGlobal>(id_of_fft_in_kernel); i < rounded_up_n_ffts;
        i += static_cast<IdxGlobal>(n_ffts_in_kernel)) {
     bool working = subgroup_local_id < max_wis_working && i < n_transforms;
     Idx n_ffts_worked_on_by_sg = sycl::min(static_cast<Idx>(n_transforms - i) + id_of_fft_in_sg, n_ffts_per_sg);
+    const IdxGlobal next_i = i + static_cast<IdxGlobal>(n_ffts_in_kernel);
 
     if (is_input_batch_interleaved) {
       /**
@@ -185,33 +305,26 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
        */
       // TODO should we make sure that: max_num_batches_local_mem >= n_ffts_per_wg ?
       Idx max_num_batches_local_mem = n_sgs_in_wg * SubgroupSize / 2;
-      Idx num_batches_in_local_mem = [=]() {
-        if (i + static_cast<IdxGlobal>(local_size) / 2 < n_transforms) {
-          return local_size / 2;
-        }
-        return static_cast<Idx>(n_transforms - i);
-      }();
+      Idx num_batches_in_local_mem = get_num_batches_in_local_mem(i);
       Idx rounded_up_ffts_in_local = detail::round_up_to_multiple(num_batches_in_local_mem, n_ffts_per_sg);
       Idx local_imag_offset = factor_wi * factor_sg * max_num_batches_local_mem;
 
       const bool store_directly_from_private =
           SubgroupSize == factor_sg && is_output_packed && algorithm == detail::fft_algorithm::COOLEY_TUKEY;
 
-      global_data.log_message_global(__func__, "loading transposed data from global to local memory");
-      // load / store in a transposed manner
-      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-        local_global_strided_copy<detail::level::WORKGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
-            input, loc_view, {2 * n_transforms, static_cast<IdxGlobal>(1)}, {2 * max_num_batches_local_mem, 1}, 2 * i,
-            0, {committed_length, 2 * num_batches_in_local_mem}, global_data);
-      } else {
-        local_global_strided_copy<detail::level::WORKGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
-            input, input_imag, loc_view, {n_transforms, static_cast<IdxGlobal>(1)}, {max_num_batches_local_mem, 1}, i,
-            0, local_imag_offset, {committed_length, num_batches_in_local_mem}, global_data);
+      if (!prefetched) {
+        load_batch_interleaved(loc_view, i);
+        sycl::group_barrier(global_data.it.get_group());
       }
-
-      sycl::group_barrier(global_data.it.get_group());
       global_data.log_dump_local("data loaded to local memory:", loc_view,
                                  n_reals_per_wi * factor_sg * max_num_batches_local_mem);
+      // The next batches are loaded into the other local memory slot while these ones are computed. It was last read
+      // before the barrier ending the previous iteration and is next read after the barriers of this one.
+      prefetched = loc_prefetch != nullptr && next_i < n_transforms;
+      if (prefetched) {
+        global_data.log_message_global(__func__, "prefetching the next batches");
+        load_batch_interleaved(loc_prefetch_view, next_i);
+      }
 
       const Idx first_fft_in_local_for_wi =
           static_cast<Idx>(global_data.sg.get_group_id()) * n_ffts_per_sg + id_of_fft_in_sg;
@@ -238,10 +351,14 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
         IdxGlobal modifier_offset =
             static_cast<IdxGlobal>(n_reals_per_fft) * (i + static_cast<IdxGlobal>(fft_idx_in_local));
         if (algorithm == detail::fft_algorithm::COOLEY_TUKEY) {
+          if (window != nullptr && working_inner) {
+            apply_window_inplace(priv, window + id_of_wi_in_fft * factor_wi, factor_wi);
+          }
           sg_cooley_tukey<SubgroupSize>(priv, wi_private_scratch, multiply_on_load, multiply_on_store,
                                         conjugate_on_load, conjugate_on_store, apply_scale_factor, load_modifier_data,
-                                        store_modifier_data, loc_twiddles, scaling_factor, modifier_offset,
-                                        id_of_wi_in_fft, factor_sg, factor_wi, working_inner, global_data);
+                                        store_modifier_data, store_modifier_table_bits, loc_twiddles, scaling_factor,
+                                        modifier_offset, id_of_wi_in_fft, factor_sg, factor_wi, working_inner,
+                                        global_data);
         } else {
           sg_bluestein_batch_interleaved<SubgroupSize>(
               priv, wi_private_scratch, loc_view, load_modifier_data, store_modifier_data, loc_twiddles,
@@ -337,37 +454,23 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
       const Idx n_io_reals_per_sg = storage == complex_storage::INTERLEAVED_COMPLEX ? n_reals_per_sg : n_cplx_per_sg;
       const Idx local_offset = subgroup_id * n_io_reals_per_sg;
 
-      global_data.log_message_global(__func__, "loading non-transposed data from global to local memory");
       if (algorithm == detail::fft_algorithm::COOLEY_TUKEY) {
-        if (is_input_packed) {
-          IdxGlobal global_ptr_offset =
-              static_cast<IdxGlobal>(n_io_reals_per_fft) * (i - static_cast<IdxGlobal>(id_of_fft_in_sg));
-          if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-            local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, SubgroupSize>(
-                input, loc_view, global_ptr_offset, subgroup_id * n_reals_per_sg,
-                n_ffts_worked_on_by_sg * n_reals_per_fft, global_data);
-          } else {
-            local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, SubgroupSize>(
-                input, input_imag, loc_view, global_ptr_offset, subgroup_id * n_cplx_per_sg, local_imag_offset,
-                n_ffts_worked_on_by_sg * fft_size, global_data);
-          }
-        } else {
-          if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-            global_data.log_message_global(__func__, "storing data from unpacked global memory to local");
-            local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 3, 3, 3>(
-                input, loc_view, {input_distance * 2, input_stride * 2, 1}, {committed_length * 2, 2, 1},
-                input_distance * 2 * (i - static_cast<IdxGlobal>(id_of_fft_in_sg)), local_offset,
-                {n_ffts_worked_on_by_sg, committed_length, 2}, global_data);
-          } else {
-            local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::GLOBAL_TO_LOCAL, 2, 2, 2>(
-                input, input_imag, loc_view, {input_distance, input_stride}, {committed_length, 1},
-                input_distance * (i - static_cast<IdxGlobal>(id_of_fft_in_sg)), local_offset, local_imag_offset,
-                {n_ffts_worked_on_by_sg, committed_length}, global_data);
-          }
+        if (!prefetched) {
+          load_packed_cooley_tukey(loc_view, i - static_cast<IdxGlobal>(id_of_fft_in_sg), n_ffts_worked_on_by_sg);
         }
       } else {
+        global_data.log_message_global(__func__, "loading non-transposed data from global to local memory");
         if (is_input_packed) {
-          if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+          if (storage == complex_storage::INTERLEAVED_COMPLEX && input_batch_ptrs != nullptr) {
+            // each transform is copied to the start of its padded slot in local memory
+            const IdxGlobal first_fft = i - static_cast<IdxGlobal>(id_of_fft_in_sg);
+            auto local_view_offset = 2 * factor_sg * factor_wi * subgroup_id * n_ffts_per_sg;
+            for (Idx j = 0; j < n_ffts_worked_on_by_sg; j++) {
+              global2local<level::SUBGROUP, SubgroupSize>(global_data, input_batch_ptrs[first_fft + j], loc_view,
+                                                          2 * committed_length, 0,
+                                                          local_view_offset + 2 * j * factor_sg * factor_wi);
+            }
+          } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
             auto global_ptr_offset = 2 * committed_length * (i - static_cast<IdxGlobal>(id_of_fft_in_sg));
             auto local_view_offset = 2 * factor_sg * factor_wi * subgroup_id * n_ffts_per_sg;
             subgroup_impl_bluestein_local_global_packed_copy<SubgroupSize, detail::transfer_direction::GLOBAL_TO_LOCAL>(
@@ -391,23 +494,41 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
 
       if (working) {
         global_data.log_message_global(__func__, "loading non-transposed data from local to private memory");
+        // the frames of overlapping input start `input_distance` apart in local memory
+        const Idx local_wi_offset =
+            (is_input_overlapping ? id_of_fft_in_sg * static_cast<Idx>(input_distance) : id_of_fft_in_sg * fft_size) +
+            id_of_wi_in_fft * factor_wi;
         if (storage == complex_storage::INTERLEAVED_COMPLEX) {
           local_private_strided_copy<1, Idx>(loc_view, priv,
-                                             {{1}, {subgroup_id * n_reals_per_sg + subgroup_local_id * n_reals_per_wi}},
-                                             factor_wi, detail::transfer_direction::LOCAL_TO_PRIVATE, global_data);
+                                             {{1}, {subgroup_id * n_reals_per_sg + 2 * local_wi_offset}}, factor_wi,
+                                             detail::transfer_direction::LOCAL_TO_PRIVATE, global_data);
         } else {
           local_private_strided_copy<1, Idx>(
-              loc_view, loc_view, priv, {{1}, {subgroup_id * n_cplx_per_sg + subgroup_local_id * factor_wi}},
-              {{1}, {subgroup_id * n_cplx_per_sg + subgroup_local_id * factor_wi + local_imag_offset}}, factor_wi,
+              loc_view, loc_view, priv, {{1}, {subgroup_id * n_cplx_per_sg + local_wi_offset}},
+              {{1}, {subgroup_id * n_cplx_per_sg + local_wi_offset + local_imag_offset}}, factor_wi,
               detail::transfer_direction::LOCAL_TO_PRIVATE, global_data);
         }
         global_data.log_dump_private("data loaded in registers:", priv, n_reals_per_wi);
       }
       sycl::group_barrier(global_data.sg);
+      // The next batches are loaded into the other local memory slot while these ones are computed. It was last read
+      // before the barrier above and is next read after the barrier following the load in the next iteration.
+      Idx n_ffts_worked_on_by_sg_next =
+          sycl::min(static_cast<Idx>(sycl::max(n_transforms - next_i, IdxGlobal(0))) + id_of_fft_in_sg, n_ffts_per_sg);
+      prefetched = loc_prefetch != nullptr && algorithm == detail::fft_algorithm::COOLEY_TUKEY &&
+                   next_i - static_cast<IdxGlobal>(id_of_fft_in_sg) < n_transforms;
+      if (prefetched) {
+        global_data.log_message_global(__func__, "prefetching the next batches");
+        load_packed_cooley_tukey(loc_prefetch_view, next_i - static_cast<IdxGlobal>(id_of_fft_in_sg),
+                                 n_ffts_worked_on_by_sg_next);
+      }
       if (algorithm == detail::fft_algorithm::COOLEY_TUKEY) {
+        if (window != nullptr && working) {
+          apply_window_inplace(priv, window + id_of_wi_in_fft * factor_wi, factor_wi);
+        }
         sg_cooley_tukey<SubgroupSize>(priv, wi_private_scratch, multiply_on_load, multiply_on_store, conjugate_on_load,
                                       conjugate_on_store, apply_scale_factor, load_modifier_data, store_modifier_data,
-                                      loc_twiddles, scaling_factor,
+                                      store_modifier_table_bits, loc_twiddles, scaling_factor,
                                       static_cast<IdxGlobal>(fft_size) * (i - static_cast<IdxGlobal>(id_of_fft_in_sg)),
                                       id_of_wi_in_fft, factor_sg, factor_wi, working, global_data);
       } else {
@@ -436,7 +557,14 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
           global_data.log_message_global(__func__,
                                          "storing transposed data from private to global memory (FactorSG == "
                                          "SubgroupSize) and packed layout");
-          if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+          if (storage == complex_storage::INTERLEAVED_COMPLEX && output_batch_ptrs != nullptr) {
+            // a subgroup computes a single transform when FactorSG == SubgroupSize
+            T* transform_output = output_batch_ptrs[i];
+            local_private_strided_copy<1, IdxGlobal>(
+                transform_output, priv,
+                {{static_cast<IdxGlobal>(factor_sg)}, {static_cast<IdxGlobal>(2 * id_of_wi_in_fft)}}, factor_wi,
+                detail::transfer_direction::PRIVATE_TO_GLOBAL, global_data);
+          } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
             IdxGlobal output_offset = i * static_cast<IdxGlobal>(n_reals_per_sg) +
                                       static_cast<IdxGlobal>(id_of_fft_in_sg * n_reals_per_fft) +
                                       static_cast<IdxGlobal>(id_of_wi_in_fft * 2);
@@ -493,7 +621,13 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
         if (algorithm == detail::fft_algorithm::COOLEY_TUKEY) {
           if (is_output_packed) {
             const IdxGlobal global_output_offset = n_io_reals_per_fft * (i - static_cast<IdxGlobal>(id_of_fft_in_sg));
-            if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+            if (storage == complex_storage::INTERLEAVED_COMPLEX && output_batch_ptrs != nullptr) {
+              const IdxGlobal first_fft = i - static_cast<IdxGlobal>(id_of_fft_in_sg);
+              for (Idx j = 0; j < n_ffts_worked_on_by_sg; j++) {
+                local2global<level::SUBGROUP, SubgroupSize>(global_data, loc_view, output_batch_ptrs[first_fft + j],
+                                                            n_reals_per_fft, local_offset + j * n_reals_per_fft, 0);
+              }
+            } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
               local_global_packed_copy<level::SUBGROUP, detail::transfer_direction::LOCAL_TO_GLOBAL, SubgroupSize>(
                   output, loc_view, global_output_offset, local_offset, n_ffts_worked_on_by_sg * n_reals_per_fft,
                   global_data);
@@ -502,6 +636,22 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
                   output, output_imag, loc_view, global_output_offset, local_offset, local_imag_offset,
                   n_ffts_worked_on_by_sg * fft_size, global_data);
             }
+          } else if (has_outer_batches) {
+            const IdxGlobal first_fft = i - static_cast<IdxGlobal>(id_of_fft_in_sg);
+            global_data.log_message_global(__func__, "storing data of outer batches from local to global memory");
+            for (Idx j = 0; j < n_ffts_worked_on_by_sg; j++) {
+              const IdxGlobal batch_offset =
+                  get_batch_offset(first_fft + j, output_distance, output_outer_distance, batches_per_outer_batch);
+              if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+                local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::LOCAL_TO_GLOBAL, 2, 2, 2>(
+                    output, loc_view, {output_stride * 2, 1}, {2, 1}, 2 * batch_offset,
+                    local_offset + j * 2 * committed_length, {committed_length, 2}, global_data);
+              } else {
+                local_global_strided_copy<level::SUBGROUP, detail::transfer_direction::LOCAL_TO_GLOBAL, 1, 1, 1>(
+                    output, output_imag, loc_view, {output_stride}, {1}, batch_offset,
+                    local_offset + j * committed_length, local_imag_offset, {committed_length}, global_data);
+              }
+            }
           } else {
             if (storage == complex_storage::INTERLEAVED_COMPLEX) {
               const IdxGlobal global_output_offset =
@@ -520,7 +670,15 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
           }
         } else {
           if (is_output_packed) {
-            if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+            if (storage == complex_storage::INTERLEAVED_COMPLEX && output_batch_ptrs != nullptr) {
+              const IdxGlobal first_fft = i - static_cast<IdxGlobal>(id_of_fft_in_sg);
+              auto loc_view_offset = 2 * factor_sg * factor_wi * subgroup_id * n_ffts_per_sg;
+              for (Idx j = 0; j < n_ffts_worked_on_by_sg; j++) {
+                local2global<level::SUBGROUP, SubgroupSize>(global_data, loc_view, output_batch_ptrs[first_fft + j],
+                                                            2 * committed_length,
+                                                            loc_view_offset + 2 * j * factor_sg * factor_wi, 0);
+              }
+            } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
               auto global_ptr_offset = 2 * committed_length * (i - static_cast<IdxGlobal>(id_of_fft_in_sg));
               auto loc_view_offset = 2 * factor_sg * factor_wi * subgroup_id * n_ffts_per_sg;
               subgroup_impl_bluestein_local_global_packed_copy<SubgroupSize,
@@ -543,6 +701,9 @@ PORTFFT_INLINE void subgroup_impl(const T* input, T* output, const T* input_imag
         sycl::group_barrier(global_data.sg);
       }
     }
+    if (prefetched) {
+      std::swap(loc_view, loc_prefetch_view);
+    }
   }
   global_data.log_message_global(__func__, "exited");
 }
@@ -600,20 +761,34 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
   static sycl::event execute(committed_descriptor_impl& desc, const TIn& in, TOut& out, const TIn& in_imag,
                              TOut& out_imag, const std::vector<sycl::event>& dependencies, IdxGlobal n_transforms,
                              IdxGlobal input_offset, IdxGlobal output_offset, dimension_struct& dimension_data,
-                             direction compute_direction, layout input_layout) {
+                             direction compute_direction, layout input_layout,
+                             const batch_pointers_struct& batch_pointers) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     constexpr detail::memory Mem = std::is_pointer_v<TOut> ? detail::memory::USM : detail::memory::BUFFER;
+    using StorageScalar = detail::get_storage_scalar_t<TIn>;
     auto& kernel_data = compute_direction == direction::FORWARD ? dimension_data.forward_kernels.at(0)
                                                                 : dimension_data.backward_kernels.at(0);
     Scalar* twiddles = kernel_data.twiddles_forward.get();
+    const Scalar* window = compute_direction == direction::FORWARD ? desc.core->forward_window.get() : nullptr;
     Idx factor_sg = kernel_data.factors[1];
-    std::size_t local_elements =
-        num_scalars_in_local_mem_struct::template inner<detail::level::SUBGROUP, Dummy>::execute(
-            desc, kernel_data.length, kernel_data.used_sg_size, kernel_data.factors, kernel_data.num_sgs_per_wg,
-            input_layout);
+    const auto& launch = kernel_data.get_launch_params(input_layout);
+    std::size_t local_elements = launch.local_elements;
     std::size_t global_size = static_cast<std::size_t>(detail::get_global_size_subgroup<Scalar>(
-        n_transforms, factor_sg, SubgroupSize, kernel_data.num_sgs_per_wg, desc.n_compute_units));
+        n_transforms, factor_sg, SubgroupSize, launch.num_sgs_per_wg, desc.n_compute_units));
     std::size_t twiddle_elements = 2 * kernel_data.length;
+    // the second slot for the data is placed after the first one. Bluestein relies on zero padding in local memory, so
+    // it does not prefetch.
+    std::size_t prefetch_offset = detail::round_up_to_multiple(local_elements, detail::local_slot_alignment<Scalar>());
+    IdxGlobal n_transforms_per_iteration =
+        static_cast<IdxGlobal>(global_size) / static_cast<IdxGlobal>(SubgroupSize * launch.num_sgs_per_wg) *
+        static_cast<IdxGlobal>(input_layout == layout::BATCH_INTERLEAVED
+                                   ? SubgroupSize * launch.num_sgs_per_wg / 2
+                                   : launch.num_sgs_per_wg * (SubgroupSize / factor_sg));
+    bool prefetch = dimension_data.algorithm == detail::fft_algorithm::COOLEY_TUKEY &&
+                    detail::use_local_prefetch<Scalar>(prefetch_offset + local_elements + twiddle_elements,
+                                                       desc.local_memory_size, n_transforms,
+                                                       n_transforms_per_iteration);
+    std::size_t loc_size = prefetch ? prefetch_offset + local_elements : local_elements;
     return desc.queue.submit([&](sycl::handler& cgh) {
       cgh.depends_on(dependencies);
       cgh.use_kernel_bundle(kernel_data.exec_bundle);
@@ -621,17 +796,17 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
       auto out_acc_or_usm = detail::get_access(out, cgh);
       auto in_imag_acc_or_usm = detail::get_access(in_imag, cgh);
       auto out_imag_acc_or_usm = detail::get_access(out_imag, cgh);
-      sycl::local_accessor<Scalar, 1> loc(local_elements, cgh);
+      sycl::local_accessor<Scalar, 1> loc(loc_size, cgh);
       sycl::local_accessor<Scalar, 1> loc_twiddles(twiddle_elements, cgh);
       auto fft_size = dimension_data.length;
 #ifdef PORTFFT_KERNEL_LOG
       sycl::stream s{1024 * 16 * 16, 1024 * 8, cgh};
 #endif
       PORTFFT_LOG_TRACE("Launching subgroup kernel with global_size", global_size, "local_size",
-                        SubgroupSize * kernel_data.num_sgs_per_wg, "local memory allocation of size", local_elements,
-                        "local memory allocation for twiddles of size", twiddle_elements);
-      cgh.parallel_for<detail::subgroup_kernel<Scalar, Domain, Mem, SubgroupSize>>(
-          sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(SubgroupSize * kernel_data.num_sgs_per_wg)}},
+                        SubgroupSize * launch.num_sgs_per_wg, "local memory allocation of size", loc_size,
+                        "local memory allocation for twiddles of size", twiddle_elements, "prefetching", prefetch);
+      cgh.parallel_for<detail::subgroup_kernel<Scalar, Domain, Mem, SubgroupSize, StorageScalar>>(
+          sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(SubgroupSize * launch.num_sgs_per_wg)}},
           [=
 #ifdef PORTFFT_KERNEL_LOG
                ,
@@ -644,12 +819,16 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
 #endif
                 it};
             global_data.log_message_global("Running subgroup kernel");
+            batch_pointers_struct kernel_batch_pointers = batch_pointers;
+            const IdxGlobal kernel_n_transforms = kernel_batch_pointers.resolve_range(n_transforms);
             detail::fft_algorithm algorithm = kh.get_specialization_constant<detail::SpecConstFFTAlgorithm>();
             if (algorithm == detail::fft_algorithm::COOLEY_TUKEY) {
               detail::subgroup_impl<SubgroupSize>(&in_acc_or_usm[0] + input_offset, &out_acc_or_usm[0] + output_offset,
                                                   &in_imag_acc_or_usm[0] + input_offset,
                                                   &out_imag_acc_or_usm[0] + output_offset, &loc[0], &loc_twiddles[0],
-                                                  n_transforms, twiddles, global_data, kh);
+                                                  prefetch ? &loc[0] + prefetch_offset : nullptr,
+                                                  kernel_n_transforms, twiddles, global_data, kh, nullptr, nullptr,
+                                                  kernel_batch_pointers.inputs, kernel_batch_pointers.outputs, window);
             } else {
               auto loc_ptr = &loc[0];
               for (auto idx = global_data.it.get_local_id(0); idx < local_elements;
@@ -660,8 +839,9 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
               detail::subgroup_impl<SubgroupSize>(&in_acc_or_usm[0] + input_offset, &out_acc_or_usm[0] + output_offset,
                                                   &in_imag_acc_or_usm[0] + input_offset,
                                                   &out_imag_acc_or_usm[0] + output_offset, loc_ptr, &loc_twiddles[0],
-                                                  n_transforms, twiddles, global_data, kh, twiddles + 2 * fft_size,
-                                                  twiddles + 4 * fft_size);
+                                                  static_cast<Scalar*>(nullptr), kernel_n_transforms, twiddles,
+                                                  global_data, kh, twiddles + 2 * fft_size, twiddles + 4 * fft_size,
+                                                  kernel_batch_pointers.inputs, kernel_batch_pointers.outputs);
             }
             global_data.log_message_global("Exiting subgroup kernel");
           });
@@ -672,10 +852,14 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
 template <typename Scalar, domain Domain>
 template <typename Dummy>
 struct committed_descriptor_impl<Scalar, Domain>::set_spec_constants_struct::inner<detail::level::SUBGROUP, Dummy> {
-  static void execute(committed_descriptor_impl& /*desc*/, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
+  static void execute(committed_descriptor_impl& desc, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
                       Idx /*length*/, const std::vector<Idx>& factors, detail::level /*level*/, Idx /*factor_num*/,
                       Idx /*num_factors*/) {
     PORTFFT_LOG_FUNCTION_ENTRY();
+    // each work-item loads the factor_wi consecutive values it works on from local memory
+    Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * factors[0]);
+    PORTFFT_LOG_TRACE("SpecConstBankLinesPerPad:", bank_lines_per_pad);
+    in_bundle.template set_specialization_constant<detail::SpecConstBankLinesPerPad>(bank_lines_per_pad);
     PORTFFT_LOG_TRACE("SubgroupFactorWISpecConst:", factors[0]);
     in_bundle.template set_specialization_constant<detail::SubgroupFactorWISpecConst>(factors[0]);
     PORTFFT_LOG_TRACE("SubgroupFactorSGSpecConst:", factors[1]);
@@ -692,24 +876,28 @@ struct committed_descriptor_impl<Scalar, Domain>::num_scalars_in_local_mem_struc
     PORTFFT_LOG_FUNCTION_ENTRY();
     Idx dft_length = static_cast<Idx>(length);
     Idx twiddle_bytes = 2 * dft_length * static_cast<Idx>(sizeof(Scalar));
+    const Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * factors[0]);
     if (input_layout == detail::layout::BATCH_INTERLEAVED) {
-      Idx padded_fft_bytes = detail::pad_local(2 * dft_length, Idx(1)) * static_cast<Idx>(sizeof(Scalar));
+      Idx padded_fft_bytes =
+          detail::pad_local(2 * dft_length, bank_lines_per_pad, desc.n_local_banks) * static_cast<Idx>(sizeof(Scalar));
       Idx max_batches_in_local_mem = (desc.local_memory_size - twiddle_bytes) / padded_fft_bytes;
       Idx batches_per_sg = used_sg_size / 2;
       Idx num_sgs_required =
           std::min(Idx(PORTFFT_SGS_IN_WG), std::max(Idx(1), max_batches_in_local_mem / batches_per_sg));
       num_sgs_per_wg = num_sgs_required;
       Idx num_batches_in_local_mem = used_sg_size * num_sgs_per_wg / 2;
-      return static_cast<std::size_t>(detail::pad_local(2 * dft_length * num_batches_in_local_mem, 1));
+      return static_cast<std::size_t>(
+          detail::pad_local(2 * dft_length * num_batches_in_local_mem, bank_lines_per_pad, desc.n_local_banks));
     }
 
     Idx factor_sg = factors[1];
     Idx n_ffts_per_sg = used_sg_size / factor_sg;
-    Idx num_scalars_per_sg = detail::pad_local(2 * dft_length * n_ffts_per_sg, 1);
+    Idx num_scalars_per_sg = detail::pad_local(2 * dft_length * n_ffts_per_sg, bank_lines_per_pad, desc.n_local_banks);
     Idx max_n_sgs = (desc.local_memory_size - twiddle_bytes) / static_cast<Idx>(sizeof(Scalar)) / num_scalars_per_sg;
     num_sgs_per_wg = std::min(Idx(PORTFFT_SGS_IN_WG), std::max(Idx(1), max_n_sgs));
     // recalculate padding since `num_scalars_per_sg` is a floored value
-    Idx res = detail::pad_local(2 * dft_length * n_ffts_per_sg * num_sgs_per_wg, 1);
+    Idx res =
+        detail::pad_local(2 * dft_length * n_ffts_per_sg * num_sgs_per_wg, bank_lines_per_pad, desc.n_local_banks);
     return static_cast<std::size_t>(res);
   }
 };
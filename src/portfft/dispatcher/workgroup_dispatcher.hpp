@@ -30,6 +30,7 @@
 #include "portfft/descriptor.hpp"
 #include "portfft/enums.hpp"
 #include "portfft/specialization_constant.hpp"
+#include "portfft/utils.hpp"
 
 namespace portfft {
 namespace detail {
@@ -73,6 +74,8 @@ IdxGlobal get_global_size_workgroup(IdxGlobal n_transforms, Idx subgroup_size, I
  *
  * @tparam SubgroupSize size of the subgroup
  * @tparam T Scalar type
+ * @tparam TIn type of the real values stored in the input. Converted to `T` on load.
+ * @tparam TOut type of the real values stored in the output. Converted from `T` on store.
  *
  * @param input pointer to global memory containing input data. If complex storage (from
  * `SpecConstComplexStorage`) is split, this is just the real part of data.
@@ -84,6 +87,8 @@ IdxGlobal get_global_size_workgroup(IdxGlobal n_transforms, Idx subgroup_size, I
  * storage (from `SpecConstComplexStorage`) is split. Otherwise unused.
  * @param loc Pointer to local memory. Size requirement is determined by `num_scalars_in_local_mem_struct`.
  * @param loc_twiddles pointer to local allocation for subgroup level twiddles
+ * @param loc_prefetch Pointer to a second local memory allocation of the same size as the one for the data in `loc`,
+ * into which the next batches are loaded while the current ones are computed. nullptr disables the prefetching.
  * @param n_transforms number of fft batches
  * @param global_data global data for the kernel
  * @param kh kernel handler associated with the kernel launch
@@ -91,9 +96,9 @@ IdxGlobal get_global_size_workgroup(IdxGlobal n_transforms, Idx subgroup_size, I
  * @param load_modifier_data Pointer to the load modifier data in global Memory
  * @param store_modifier_data Pointer to the store modifier data in global Memory
  */
-template <Idx SubgroupSize, typename T>
-PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_imag, T* output_imag, T* loc,
-                                   T* loc_twiddles, IdxGlobal n_transforms, const T* twiddles,
+template <Idx SubgroupSize, typename T, typename TIn, typename TOut>
+PORTFFT_INLINE void workgroup_impl(const TIn* input, TOut* output, const TIn* input_imag, TOut* output_imag, T* loc,
+                                   T* loc_twiddles, T* loc_prefetch, IdxGlobal n_transforms, const T* twiddles,
                                    global_data_struct<1> global_data, sycl::kernel_handler& kh,
                                    const T* load_modifier_data = nullptr, const T* store_modifier_data = nullptr) {
   complex_storage storage = kh.get_specialization_constant<detail::SpecConstComplexStorage>();
@@ -103,10 +108,15 @@ PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_ima
   detail::complex_conjugate conjugate_on_load = kh.get_specialization_constant<detail::SpecConstConjugateOnLoad>();
   detail::complex_conjugate conjugate_on_store = kh.get_specialization_constant<detail::SpecConstConjugateOnStore>();
   T scaling_factor = kh.get_specialization_constant<detail::get_spec_constant_scale<T>()>();
+  detail::fold_integer_input_scale<TIn>(kh, apply_scale_factor, scaling_factor);
 
   const Idx fft_size = kh.get_specialization_constant<detail::SpecConstFftSize>();
   const IdxGlobal input_distance = kh.get_specialization_constant<detail::SpecConstInputDistance>();
   const IdxGlobal output_distance = kh.get_specialization_constant<detail::SpecConstOutputDistance>();
+  const Idx store_modifier_table_bits =
+      kh.get_specialization_constant<detail::GlobalSpecConstTwiddleTables>()
+          ? twiddle_table_bits(n_transforms * static_cast<IdxGlobal>(fft_size))
+          : 0;
 
   const bool input_batch_interleaved = input_distance == 1;
   const bool output_batch_interleaved = output_distance == 1;
@@ -117,10 +127,14 @@ PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_ima
 
   Idx factor_n = detail::factorize(fft_size);
   Idx factor_m = fft_size / factor_n;
+  const Idx factor_sg_n = kh.get_specialization_constant<detail::WorkgroupFactorSGNSpecConst>();
+  const Idx factor_sg_m = kh.get_specialization_constant<detail::WorkgroupFactorSGMSpecConst>();
   const Idx vec_size = storage == complex_storage::INTERLEAVED_COMPLEX ? 2 : 1;
   const T* wg_twiddles = twiddles + 2 * (factor_m + factor_n);
-  const Idx bank_lines_per_pad = bank_lines_per_pad_wg(2 * static_cast<Idx>(sizeof(T)) * factor_m);
-  auto loc_view = padded_view(loc, bank_lines_per_pad);
+  const Idx n_local_banks = kh.get_specialization_constant<detail::SpecConstNumLocalBanks>();
+  const Idx bank_lines_per_pad = kh.get_specialization_constant<detail::SpecConstBankLinesPerPad>();
+  auto loc_view = padded_view(loc, bank_lines_per_pad, n_local_banks);
+  auto loc_prefetch_view = padded_view(loc_prefetch, bank_lines_per_pad, n_local_banks);
 
   global_data.log_message_global(__func__, "loading sg twiddles from global to local memory");
   global2local<level::WORKGROUP, SubgroupSize>(global_data, twiddles, loc_twiddles, 2 * (factor_m + factor_n));
@@ -134,9 +148,8 @@ PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_ima
       static_cast<IdxGlobal>(num_workgroups) * static_cast<IdxGlobal>(max_num_batches_in_local_mem);
   Idx local_imag_offset = fft_size * max_num_batches_in_local_mem;
 
-  for (IdxGlobal batch_start_idx = first_batch_start; batch_start_idx < n_transforms;
-       batch_start_idx += num_batches_in_kernel) {
-    IdxGlobal offset = static_cast<IdxGlobal>(vec_size * fft_size) * batch_start_idx;
+  // loads the batches starting from `batch_start_idx` into local memory `loc_slot`
+  auto load_batches = [&](auto loc_slot, IdxGlobal batch_start_idx) {
     if (input_batch_interleaved) {
       /**
        * In the transposed case, the data is laid out in the local memory column-wise, viewing it as a FFT_Size x
@@ -148,26 +161,59 @@ PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_ima
       global_data.log_message_global(__func__, "loading transposed data from global to local memory");
       if (storage == complex_storage::INTERLEAVED_COMPLEX) {
         detail::md_view input_view{input, std::array{2 * n_transforms, static_cast<IdxGlobal>(1)}, 2 * batch_start_idx};
-        detail::md_view loc_md_view{loc_view, std::array{2 * max_num_batches_in_local_mem, 1}};
+        detail::md_view loc_md_view{loc_slot, std::array{2 * max_num_batches_in_local_mem, 1}};
         copy_group<level::WORKGROUP>(global_data, input_view, loc_md_view,
                                      std::array{fft_size, 2 * num_batches_in_local_mem});
       } else {  // storage == complex_storage::SPLIT_COMPLEX
         detail::md_view input_real_view{input, std::array{n_transforms, static_cast<IdxGlobal>(1)}, batch_start_idx};
         detail::md_view input_imag_view{input_imag, std::array{n_transforms, static_cast<IdxGlobal>(1)},
                                         batch_start_idx};
-        detail::md_view loc_real_view{loc_view, std::array{max_num_batches_in_local_mem, 1}};
-        detail::md_view loc_imag_view{loc_view, std::array{max_num_batches_in_local_mem, 1}, local_imag_offset};
+        detail::md_view loc_real_view{loc_slot, std::array{max_num_batches_in_local_mem, 1}};
+        detail::md_view loc_imag_view{loc_slot, std::array{max_num_batches_in_local_mem, 1}, local_imag_offset};
         copy_group<level::WORKGROUP>(global_data, input_real_view, loc_real_view,
                                      std::array{fft_size, num_batches_in_local_mem});
         copy_group<level::WORKGROUP>(global_data, input_imag_view, loc_imag_view,
                                      std::array{fft_size, num_batches_in_local_mem});
       }
+    } else {  // packed input layout
+      IdxGlobal offset = static_cast<IdxGlobal>(vec_size * fft_size) * batch_start_idx;
+      global_data.log_message_global(__func__, "loading non-transposed data from global to local memory");
+      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+        global2local<level::WORKGROUP, SubgroupSize>(global_data, input, loc_slot, 2 * fft_size, offset);
+      } else {
+        global2local<level::WORKGROUP, SubgroupSize>(global_data, input, loc_slot, fft_size, offset);
+        global2local<level::WORKGROUP, SubgroupSize>(global_data, input_imag, loc_slot, fft_size, offset,
+                                                     local_imag_offset);
+      }
+    }
+  };
+
+  bool prefetched = false;
+  for (IdxGlobal batch_start_idx = first_batch_start; batch_start_idx < n_transforms;
+       batch_start_idx += num_batches_in_kernel) {
+    IdxGlobal offset = static_cast<IdxGlobal>(vec_size * fft_size) * batch_start_idx;
+    if (!prefetched) {
+      load_batches(loc_view, batch_start_idx);
       sycl::group_barrier(global_data.it.get_group());
+    }
+    // The next batches are loaded into the other local memory slot while these ones are computed. No barrier is
+    // needed: the slot was last read before the barrier ending the previous iteration and is next read after the
+    // barriers of this one.
+    const IdxGlobal next_batch_start_idx = batch_start_idx + num_batches_in_kernel;
+    prefetched = loc_prefetch != nullptr && next_batch_start_idx < n_transforms;
+    if (prefetched) {
+      global_data.log_message_global(__func__, "prefetching the next batches");
+      load_batches(loc_prefetch_view, next_batch_start_idx);
+    }
+    if (input_batch_interleaved) {
+      const Idx num_batches_in_local_mem =
+          std::min(max_num_batches_in_local_mem, static_cast<Idx>(n_transforms - batch_start_idx));
       for (Idx sub_batch = 0; sub_batch < num_batches_in_local_mem; sub_batch++) {
         wg_dft<SubgroupSize>(loc_view, loc_twiddles, wg_twiddles, scaling_factor, max_num_batches_in_local_mem,
-                             sub_batch, batch_start_idx, load_modifier_data, store_modifier_data, fft_size, factor_n,
-                             factor_m, storage, layout::BATCH_INTERLEAVED, multiply_on_load, multiply_on_store,
-                             apply_scale_factor, conjugate_on_load, conjugate_on_store, global_data);
+                             sub_batch, batch_start_idx, load_modifier_data, store_modifier_data,
+                             store_modifier_table_bits, fft_size, factor_n, factor_m, factor_sg_n, factor_sg_m, storage,
+                             layout::BATCH_INTERLEAVED, multiply_on_load, multiply_on_store, apply_scale_factor,
+                             conjugate_on_load, conjugate_on_store, global_data);
         sycl::group_barrier(global_data.it.get_group());
       }
       if (!output_batch_interleaved) {
@@ -219,19 +265,11 @@ PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_ima
       }
       sycl::group_barrier(global_data.it.get_group());
     } else {  // packed input layout
-      global_data.log_message_global(__func__, "loading non-transposed data from global to local memory");
-      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-        global2local<level::WORKGROUP, SubgroupSize>(global_data, input, loc_view, 2 * fft_size, offset);
-      } else {
-        global2local<level::WORKGROUP, SubgroupSize>(global_data, input, loc_view, fft_size, offset);
-        global2local<level::WORKGROUP, SubgroupSize>(global_data, input_imag, loc_view, fft_size, offset,
-                                                     local_imag_offset);
-      }
-      sycl::group_barrier(global_data.it.get_group());
       wg_dft<SubgroupSize>(loc_view, loc_twiddles, wg_twiddles, scaling_factor, max_num_batches_in_local_mem, 0,
-                           batch_start_idx, load_modifier_data, store_modifier_data, fft_size, factor_n, factor_m,
-                           storage, layout::PACKED, multiply_on_load, multiply_on_store, apply_scale_factor,
-                           conjugate_on_load, conjugate_on_store, global_data);
+                           batch_start_idx, load_modifier_data, store_modifier_data, store_modifier_table_bits,
+                           fft_size, factor_n, factor_m, factor_sg_n, factor_sg_m, storage, layout::PACKED,
+                           multiply_on_load, multiply_on_store, apply_scale_factor, conjugate_on_load,
+                           conjugate_on_store, global_data);
       sycl::group_barrier(global_data.it.get_group());
       global_data.log_message_global(__func__, "storing non-transposed data from local to global memory");
       // transposition for WG CT
@@ -267,6 +305,9 @@ PORTFFT_INLINE void workgroup_impl(const T* input, T* output, const T* input_ima
       }
       sycl::group_barrier(global_data.it.get_group());
     }
+    if (prefetched) {
+      std::swap(loc_view, loc_prefetch_view);
+    }
   }
   global_data.log_message_global(__func__, "exited");
 }
@@ -279,24 +320,31 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
   static sycl::event execute(committed_descriptor_impl& desc, const TIn& in, TOut& out, const TIn& in_imag,
                              TOut& out_imag, const std::vector<sycl::event>& dependencies, IdxGlobal n_transforms,
                              IdxGlobal input_offset, IdxGlobal output_offset, dimension_struct& dimension_data,
-                             direction compute_direction, layout input_layout) {
+                             direction compute_direction, layout input_layout,
+                             const batch_pointers_struct& /*batch_pointers*/) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     auto& kernel_data = compute_direction == direction::FORWARD ? dimension_data.forward_kernels.at(0)
                                                                 : dimension_data.backward_kernels.at(0);
     Idx num_batches_in_local_mem =
         input_layout == layout::BATCH_INTERLEAVED ? kernel_data.used_sg_size * PORTFFT_SGS_IN_WG / 2 : 1;
     constexpr detail::memory Mem = std::is_pointer_v<TOut> ? detail::memory::USM : detail::memory::BUFFER;
+    using StorageScalar = detail::get_storage_scalar_t<TIn>;
     Scalar* twiddles = kernel_data.twiddles_forward.get();
-    std::size_t local_elements =
-        num_scalars_in_local_mem_struct::template inner<detail::level::WORKGROUP, Dummy>::execute(
-            desc, kernel_data.length, kernel_data.used_sg_size, kernel_data.factors, kernel_data.num_sgs_per_wg,
-            input_layout);
+    const auto& launch = kernel_data.get_launch_params(input_layout);
+    std::size_t local_elements = launch.local_elements;
     std::size_t global_size = static_cast<std::size_t>(detail::get_global_size_workgroup<Scalar>(
-        n_transforms, SubgroupSize, kernel_data.num_sgs_per_wg, desc.n_compute_units, input_layout));
-    const Idx bank_lines_per_pad =
-        bank_lines_per_pad_wg(2 * static_cast<Idx>(sizeof(Scalar)) * kernel_data.factors[2] * kernel_data.factors[3]);
-    std::size_t sg_twiddles_offset = static_cast<std::size_t>(
-        detail::pad_local(2 * static_cast<Idx>(kernel_data.length) * num_batches_in_local_mem, bank_lines_per_pad));
+        n_transforms, SubgroupSize, launch.num_sgs_per_wg, desc.n_compute_units, input_layout));
+    const Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * kernel_data.factors[2] * kernel_data.factors[3]);
+    std::size_t sg_twiddles_offset = static_cast<std::size_t>(detail::pad_local(
+        2 * static_cast<Idx>(kernel_data.length) * num_batches_in_local_mem, bank_lines_per_pad, desc.n_local_banks));
+    // the second slot for the data is placed after the twiddles
+    std::size_t prefetch_offset = detail::round_up_to_multiple(local_elements, detail::local_slot_alignment<Scalar>());
+    IdxGlobal n_transforms_per_iteration = static_cast<IdxGlobal>(global_size) /
+                                           static_cast<IdxGlobal>(SubgroupSize * PORTFFT_SGS_IN_WG) *
+                                           static_cast<IdxGlobal>(num_batches_in_local_mem);
+    bool prefetch = detail::use_local_prefetch<Scalar>(prefetch_offset + sg_twiddles_offset, desc.local_memory_size,
+                                                        n_transforms, n_transforms_per_iteration);
+    std::size_t loc_size = prefetch ? prefetch_offset + sg_twiddles_offset : local_elements;
     return desc.queue.submit([&](sycl::handler& cgh) {
       cgh.depends_on(dependencies);
       cgh.use_kernel_bundle(kernel_data.exec_bundle);
@@ -304,13 +352,14 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
       auto out_acc_or_usm = detail::get_access(out, cgh);
       auto in_imag_acc_or_usm = detail::get_access(in_imag, cgh);
       auto out_imag_acc_or_usm = detail::get_access(out_imag, cgh);
-      sycl::local_accessor<Scalar, 1> loc(local_elements, cgh);
+      sycl::local_accessor<Scalar, 1> loc(loc_size, cgh);
 #ifdef PORTFFT_KERNEL_LOG
       sycl::stream s{1024 * 16 * 8 * 2, 1024, cgh};
 #endif
       PORTFFT_LOG_TRACE("Launching workgroup kernel with global_size", global_size, "local_size",
-                        SubgroupSize * kernel_data.num_sgs_per_wg, "local memory allocation of size", local_elements);
-      cgh.parallel_for<detail::workgroup_kernel<Scalar, Domain, Mem, SubgroupSize>>(
+                        SubgroupSize * launch.num_sgs_per_wg, "local memory allocation of size", loc_size,
+                        "prefetching", prefetch);
+      cgh.parallel_for<detail::workgroup_kernel<Scalar, Domain, Mem, SubgroupSize, StorageScalar>>(
           sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(SubgroupSize * PORTFFT_SGS_IN_WG)}},
           [=
 #ifdef PORTFFT_KERNEL_LOG
@@ -327,7 +376,9 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
             detail::workgroup_impl<SubgroupSize>(&in_acc_or_usm[0] + input_offset, &out_acc_or_usm[0] + output_offset,
                                                  &in_imag_acc_or_usm[0] + input_offset,
                                                  &out_imag_acc_or_usm[0] + output_offset, &loc[0],
-                                                 &loc[0] + sg_twiddles_offset, n_transforms, twiddles, global_data, kh);
+                                                 &loc[0] + sg_twiddles_offset,
+                                                 prefetch ? &loc[0] + prefetch_offset : nullptr, n_transforms,
+                                                 twiddles, global_data, kh);
             global_data.log_message_global("Exiting workgroup kernel");
           });
     });
@@ -337,12 +388,20 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
 template <typename Scalar, domain Domain>
 template <typename Dummy>
 struct committed_descriptor_impl<Scalar, Domain>::set_spec_constants_struct::inner<detail::level::WORKGROUP, Dummy> {
-  static void execute(committed_descriptor_impl& /*desc*/, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
-                      Idx length, const std::vector<Idx>& /*factors*/, detail::level /*level*/, Idx /*factor_num*/,
+  static void execute(committed_descriptor_impl& desc, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
+                      Idx length, const std::vector<Idx>& factors, detail::level /*level*/, Idx /*factor_num*/,
                       Idx /*num_factors*/) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     PORTFFT_LOG_TRACE("SpecConstFftSize:", length);
     in_bundle.template set_specialization_constant<detail::SpecConstFftSize>(length);
+    // the columns of the factor_n x factor_m matrix in local memory are accessed with a stride of a row
+    Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * factors[2] * factors[3]);
+    PORTFFT_LOG_TRACE("SpecConstBankLinesPerPad:", bank_lines_per_pad);
+    in_bundle.template set_specialization_constant<detail::SpecConstBankLinesPerPad>(bank_lines_per_pad);
+    PORTFFT_LOG_TRACE("WorkgroupFactorSGNSpecConst:", factors[1]);
+    in_bundle.template set_specialization_constant<detail::WorkgroupFactorSGNSpecConst>(factors[1]);
+    PORTFFT_LOG_TRACE("WorkgroupFactorSGMSpecConst:", factors[3]);
+    in_bundle.template set_specialization_constant<detail::WorkgroupFactorSGMSpecConst>(factors[3]);
   }
 };
 
@@ -350,7 +409,7 @@ template <typename Scalar, domain Domain>
 template <typename Dummy>
 struct committed_descriptor_impl<Scalar, Domain>::num_scalars_in_local_mem_struct::inner<detail::level::WORKGROUP,
                                                                                          Dummy> {
-  static std::size_t execute(committed_descriptor_impl& /*desc*/, std::size_t length, Idx used_sg_size,
+  static std::size_t execute(committed_descriptor_impl& desc, std::size_t length, Idx used_sg_size,
                              const std::vector<Idx>& factors, Idx& /*num_sgs_per_wg*/, layout input_layout) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     std::size_t n = static_cast<std::size_t>(factors[0]) * static_cast<std::size_t>(factors[1]);
@@ -359,7 +418,8 @@ struct committed_descriptor_impl<Scalar, Domain>::num_scalars_in_local_mem_struc
     Idx num_batches_in_local_mem = detail::get_num_batches_in_local_mem_workgroup(
         input_layout == layout::BATCH_INTERLEAVED, used_sg_size * PORTFFT_SGS_IN_WG);
     return detail::pad_local(static_cast<std::size_t>(2 * num_batches_in_local_mem) * length,
-                             bank_lines_per_pad_wg(2 * static_cast<std::size_t>(sizeof(Scalar)) * m)) +
+                             static_cast<std::size_t>(desc.bank_lines_per_pad(2 * static_cast<Idx>(m))),
+                             static_cast<std::size_t>(desc.n_local_banks)) +
            2 * (m + n);
   }
 };
@@ -382,7 +442,9 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
     PORTFFT_LOG_TRACE("Allocating global memory for twiddles for workgroup implementation. Allocation size", res_size);
     Scalar* res = sycl::aligned_alloc_device<Scalar>(
         alignof(sycl::vec<Scalar, PORTFFT_VEC_LOAD_BYTES / sizeof(Scalar)>), res_size, desc.queue);
-    desc.queue.submit([&](sycl::handler& cgh) {
+    // only wait for these kernels, the queue may be computing with another committed descriptor
+    std::vector<sycl::event> events;
+    events.push_back(desc.queue.submit([&](sycl::handler& cgh) {
       PORTFFT_LOG_TRACE(
           "Launching twiddle calculation kernel for factor 1 of workgroup implementation with global size", factor_sg_n,
           factor_wi_n);
@@ -392,8 +454,8 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
                          Idx k = static_cast<Idx>(it.get_id(1));
                          sg_calc_twiddles(factor_sg_n, factor_wi_n, n, k, res + (2 * m));
                        });
-    });
-    desc.queue.submit([&](sycl::handler& cgh) {
+    }));
+    events.push_back(desc.queue.submit([&](sycl::handler& cgh) {
       PORTFFT_LOG_TRACE(
           "Launching twiddle calculation kernel for factor 2 of workgroup implementation with global size", factor_sg_m,
           factor_wi_m);
@@ -403,8 +465,8 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
                          Idx k = static_cast<Idx>(it.get_id(1));
                          sg_calc_twiddles(factor_sg_m, factor_wi_m, n, k, res);
                        });
-    });
-    desc.queue.submit([&](sycl::handler& cgh) {
+    }));
+    events.push_back(desc.queue.submit([&](sycl::handler& cgh) {
       PORTFFT_LOG_TRACE("Launching twiddle calculation kernel for workgroup implementation with global size", n,
                         factor_wi_m, factor_sg_m);
       cgh.parallel_for(sycl::range<3>({static_cast<std::size_t>(n), static_cast<std::size_t>(factor_wi_m),
@@ -420,8 +482,8 @@ struct committed_descriptor_impl<Scalar, Domain>::calculate_twiddles_struct::inn
                          res[index] = twiddle.real();
                          res[index + 1] = twiddle.imag();
                        });
-    });
-    desc.queue.wait();
+    }));
+    sycl::event::wait(events);
     return res;
   }
 };
@@ -25,11 +25,13 @@
 #include "portfft/common/logging.hpp"
 #include "portfft/common/memory_views.hpp"
 #include "portfft/common/transfers.hpp"
+#include "portfft/common/twiddle_tables.hpp"
 #include "portfft/common/workitem.hpp"
 #include "portfft/defines.hpp"
 #include "portfft/descriptor.hpp"
 #include "portfft/enums.hpp"
 #include "portfft/specialization_constant.hpp"
+#include "portfft/utils.hpp"
 
 namespace portfft {
 namespace detail {
@@ -74,11 +76,35 @@ PORTFFT_INLINE void apply_modifier(Idx num_elements, PrivT priv, const T* modifi
   }
 }
 
+/**
+ * Utility function for applying twiddles calculated from twiddle tables as store modifiers in workitem impl. Element
+ * `j` of the transform `batch` is multiplied by the twiddle with exponent `batch * j`.
+ *
+ * @tparam PrivT Private view type
+ * @tparam T Type of pointer for the twiddle tables in global memory
+ * @param num_elements Num complex values per workitem
+ * @param priv private memory array
+ * @param tables global pointer to the twiddle tables
+ * @param batch index of the transform
+ * @param table_bits number of bits indexing the fine table
+ */
+template <typename PrivT, typename T>
+PORTFFT_INLINE void apply_modifier_from_tables(Idx num_elements, PrivT priv, const T* tables, IdxGlobal batch,
+                                               Idx table_bits) {
+  PORTFFT_UNROLL
+  for (Idx j = 0; j < num_elements; j++) {
+    sycl::vec<T, 2> modifier_vec = get_twiddle_from_tables(tables, batch * j, table_bits);
+    multiply_complex(priv[2 * j], priv[2 * j + 1], modifier_vec[0], modifier_vec[1], priv[2 * j], priv[2 * j + 1]);
+  }
+}
+
 /**
  * Implementation of FFT for sizes that can be done by independent work items.
  *
  * @tparam SubgroupSize size of the subgroup
  * @tparam T type of the scalar used for computations
+ * @tparam TIn type of the real values stored in the input. Converted to `T` on load.
+ * @tparam TOut type of the real values stored in the output. Converted from `T` on store.
  * @param input pointer to global memory containing input data. If complex storage (from
  * `SpecConstComplexStorage`) is split, this is just the real part of data.
  * @param output pointer to global memory for output data. If complex storage (from
@@ -95,31 +121,52 @@ PORTFFT_INLINE void apply_modifier(Idx num_elements, PrivT priv, const T* modifi
  * @param store_modifier_data Pointer to the store modifier data in global memory
  * @param loc_load_modifier Pointer to load modifier data in local memory
  * @param loc_store_modifier Pointer to store modifier data in local memory
+ * @param input_batch_ptrs Pointer to an array in global memory with the input pointer of each transform, null if the
+ * transforms are at `input`. Only used with packed, interleaved complex input.
+ * @param output_batch_ptrs Pointer to an array in global memory with the output pointer of each transform, null if the
+ * transforms are at `output`. Only used with packed, interleaved complex output.
+ * @param window Pointer to `fft_size` real values in global memory the input of each transform is multiplied by, null
+ * for no window
  */
-template <Idx SubgroupSize, typename T>
-PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag, T* output_imag, T* loc,
+template <Idx SubgroupSize, typename T, typename TIn, typename TOut>
+PORTFFT_INLINE void workitem_impl(const TIn* input, TOut* output, const TIn* input_imag, TOut* output_imag, T* loc,
                                   IdxGlobal n_transforms, global_data_struct<1> global_data, sycl::kernel_handler& kh,
                                   const T* load_modifier_data = nullptr, const T* store_modifier_data = nullptr,
-                                  T* loc_load_modifier = nullptr, T* loc_store_modifier = nullptr) {
+                                  T* loc_load_modifier = nullptr, T* loc_store_modifier = nullptr,
+                                  const T* const* input_batch_ptrs = nullptr, T* const* output_batch_ptrs = nullptr,
+                                  const T* window = nullptr) {
   complex_storage storage = kh.get_specialization_constant<detail::SpecConstComplexStorage>();
   detail::elementwise_multiply multiply_on_load = kh.get_specialization_constant<detail::SpecConstMultiplyOnLoad>();
   detail::elementwise_multiply multiply_on_store = kh.get_specialization_constant<detail::SpecConstMultiplyOnStore>();
   detail::apply_scale_factor apply_scale_factor = kh.get_specialization_constant<detail::SpecConstApplyScaleFactor>();
   detail::complex_conjugate conjugate_on_load = kh.get_specialization_constant<detail::SpecConstConjugateOnLoad>();
   detail::complex_conjugate conjugate_on_store = kh.get_specialization_constant<detail::SpecConstConjugateOnStore>();
+  const bool store_modifier_tables = kh.get_specialization_constant<detail::GlobalSpecConstTwiddleTables>();
 
   T scaling_factor = kh.get_specialization_constant<detail::get_spec_constant_scale<T>()>();
+  detail::fold_integer_input_scale<TIn>(kh, apply_scale_factor, scaling_factor);
 
   const Idx fft_size = kh.get_specialization_constant<detail::SpecConstFftSize>();
+  const Idx store_modifier_table_bits =
+      store_modifier_tables ? twiddle_table_bits(n_transforms * static_cast<IdxGlobal>(fft_size)) : 0;
   const IdxGlobal input_stride = kh.get_specialization_constant<detail::SpecConstInputStride>();
   const IdxGlobal output_stride = kh.get_specialization_constant<detail::SpecConstOutputStride>();
   const IdxGlobal input_distance = kh.get_specialization_constant<detail::SpecConstInputDistance>();
   const IdxGlobal output_distance = kh.get_specialization_constant<detail::SpecConstOutputDistance>();
-
-  const bool is_packed_input = input_stride == 1 && input_distance == fft_size;
-  const bool interleaved_transforms_input = input_distance < input_stride;
-  const bool is_packed_output = output_stride == 1 && output_distance == fft_size;
-  const bool interleaved_transforms_output = output_distance < output_stride;
+  const IdxGlobal batches_per_outer_batch = kh.get_specialization_constant<detail::SpecConstBatchesPerOuterBatch>();
+  const IdxGlobal input_outer_distance = kh.get_specialization_constant<detail::SpecConstInputOuterDistance>();
+  const IdxGlobal output_outer_distance = kh.get_specialization_constant<detail::SpecConstOutputOuterDistance>();
+
+  // The transforms of a subgroup can span two outer batches, which the cooperative copies through local memory do not
+  // handle, so with outer batches each work-item loads and stores its own transform.
+  const bool has_outer_batches = batches_per_outer_batch != 0;
+  const bool is_packed_input = input_stride == 1 && input_distance == fft_size && !has_outer_batches;
+  const bool interleaved_transforms_input = input_distance < input_stride || has_outer_batches;
+  const bool is_packed_output = output_stride == 1 && output_distance == fft_size && !has_outer_batches;
+  const bool interleaved_transforms_output = output_distance < output_stride || has_outer_batches;
+  // The frames of a subgroup overlap, as in a short-time Fourier transform. The span of signal they cover is loaded to
+  // local memory once and each work-item reads its frame from there.
+  const bool is_input_overlapping = input_stride == 1 && input_distance < fft_size && !interleaved_transforms_input;
 
   global_data.log_message_global(__func__, "entered", "fft_size", fft_size, "n_transforms", n_transforms);
 
@@ -142,10 +189,11 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
   Idx subgroup_id = static_cast<Idx>(global_data.sg.get_group_id());
   Idx local_offset = n_reals * SubgroupSize * subgroup_id;
   Idx local_imag_offset = fft_size * SubgroupSize;
-  constexpr Idx BankLinesPerPad = 1;
-  auto loc_view = detail::padded_view(loc, BankLinesPerPad);
-  auto loc_load_modifier_view = detail::padded_view(loc_load_modifier, BankLinesPerPad);
-  auto loc_store_modifier_view = detail::padded_view(loc_store_modifier, BankLinesPerPad);
+  const Idx n_local_banks = kh.get_specialization_constant<detail::SpecConstNumLocalBanks>();
+  const Idx bank_lines_per_pad = kh.get_specialization_constant<detail::SpecConstBankLinesPerPad>();
+  auto loc_view = detail::padded_view(loc, bank_lines_per_pad, n_local_banks);
+  auto loc_load_modifier_view = detail::padded_view(loc_load_modifier, bank_lines_per_pad, n_local_banks);
+  auto loc_store_modifier_view = detail::padded_view(loc_store_modifier, bank_lines_per_pad, n_local_banks);
 
   const IdxGlobal transform_idx_begin = static_cast<IdxGlobal>(global_data.it.get_global_id(0));
   const IdxGlobal transform_idx_step = static_cast<IdxGlobal>(global_data.it.get_global_range(0));
@@ -163,7 +211,13 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
       // copy into local memory cooperatively as a subgroup, allowing coalesced memory access for when elements of a
       // single FFT are sequential. When distance < stride, skip this step and load straight from global to registers
       // since the sequential work-items already access sequential elements.
-      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+      if (storage == complex_storage::INTERLEAVED_COMPLEX && input_batch_ptrs != nullptr) {
+        global_data.log_message_global(__func__, "loading packed data of separate transforms to local memory");
+        for (Idx j = 0; j < n_working; j++) {
+          global2local<level::SUBGROUP, SubgroupSize>(global_data, input_batch_ptrs[leader_i + j], loc_view, n_reals,
+                                                      0, local_offset + j * n_reals);
+        }
+      } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
         global_data.log_message_global(__func__, "loading packed data from global to local memory");
         global2local<level::SUBGROUP, SubgroupSize>(global_data, input, loc_view, n_reals * n_working, global_offset,
                                                     local_offset);
@@ -175,6 +229,20 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
         global2local<level::SUBGROUP, SubgroupSize>(global_data, input_imag, loc_view, fft_size * n_working,
                                                     global_offset, local_offset + local_imag_offset);
       }
+    } else if (is_input_overlapping) {
+      const Idx n_span_complex = static_cast<Idx>(input_distance) * (n_working - 1) + fft_size;
+      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+        global_data.log_message_global(__func__, "loading overlapping frames from global to local memory");
+        global2local<level::SUBGROUP, SubgroupSize>(global_data, input, loc_view, 2 * n_span_complex,
+                                                    global_input_offset, local_offset);
+      } else {
+        global_data.log_message_global(__func__, "loading real overlapping frames from global to local memory");
+        global2local<level::SUBGROUP, SubgroupSize>(global_data, input, loc_view, n_span_complex, global_input_offset,
+                                                    local_offset);
+        global_data.log_message_global(__func__, "loading imaginary overlapping frames from global to local memory");
+        global2local<level::SUBGROUP, SubgroupSize>(global_data, input_imag, loc_view, n_span_complex,
+                                                    global_input_offset, local_offset + local_imag_offset);
+      }
     } else if (!interleaved_transforms_input) {
       if (storage == complex_storage::INTERLEAVED_COMPLEX) {
         std::array<IdxGlobal, 3> global_strides{input_distance * 2, input_stride * 2, 1};
@@ -211,17 +279,21 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
 
     sycl::group_barrier(global_data.sg);
 
+    const IdxGlobal input_batch_offset =
+        get_batch_offset(i, input_distance, input_outer_distance, batches_per_outer_batch);
+    const IdxGlobal output_batch_offset =
+        get_batch_offset(i, output_distance, output_outer_distance, batches_per_outer_batch);
     if (working) {
       if (interleaved_transforms_input) {
         global_data.log_message_global(__func__, "loading transposed data from global to private memory");
         // Load directly into registers from global memory so work-items read from nearby memory addresses.
         // No need of going through local memory either as it is an unnecessary extra write step.
         if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-          detail::strided_view input_view{input, input_stride, input_distance * i * 2};
+          detail::strided_view input_view{input, input_stride, input_batch_offset * 2};
           copy_wi<2>(global_data, input_view, priv, fft_size);
         } else {
-          detail::strided_view input_real_view{input, input_stride, input_distance * i};
-          detail::strided_view input_imag_view{input_imag, input_stride, input_distance * i};
+          detail::strided_view input_real_view{input, input_stride, input_batch_offset};
+          detail::strided_view input_imag_view{input_imag, input_stride, input_batch_offset};
           detail::strided_view priv_real_view{priv, 2};
           detail::strided_view priv_imag_view{priv, 2, 1};
           copy_wi(global_data, input_real_view, priv_real_view, fft_size);
@@ -229,13 +301,15 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
         }
       } else {
         global_data.log_message_global(__func__, "loading non-transposed data from local to private memory");
+        // the frames of overlapping input start `input_distance` apart in local memory
+        const Idx local_frame_offset =
+            subgroup_local_id * (is_input_overlapping ? static_cast<Idx>(input_distance) : fft_size);
         if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-          detail::offset_view offset_local_view{loc_view, local_offset + subgroup_local_id * n_reals};
+          detail::offset_view offset_local_view{loc_view, local_offset + 2 * local_frame_offset};
           copy_wi(global_data, offset_local_view, priv, n_reals);
         } else {
-          detail::offset_view local_real_view{loc_view, local_offset + subgroup_local_id * fft_size};
-          detail::offset_view local_imag_view{loc_view,
-                                              local_offset + subgroup_local_id * fft_size + local_imag_offset};
+          detail::offset_view local_real_view{loc_view, local_offset + local_frame_offset};
+          detail::offset_view local_imag_view{loc_view, local_offset + local_frame_offset + local_imag_offset};
           detail::strided_view priv_real_view{priv, 2};
           detail::strided_view priv_imag_view{priv, 2, 1};
           copy_wi(global_data, local_real_view, priv_real_view, fft_size);
@@ -243,7 +317,16 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
         }
       }
       global_data.log_dump_private("data loaded in registers:", priv, n_reals);
-
+    }
+    if (is_input_overlapping) {
+      // the results are stored to local memory over the frames other work-items of the subgroup are loading
+      sycl::group_barrier(global_data.sg);
+    }
+    if (working) {
+      if (window != nullptr) {
+        global_data.log_message_global(__func__, "applying window");
+        apply_window_inplace(priv, window, fft_size);
+      }
       if (multiply_on_load == detail::elementwise_multiply::APPLIED) {
         // Assumes load modifier data is stored in a transposed fashion (fft_size x  num_batches_local_mem)
         // to ensure much lesser bank conflicts
@@ -263,7 +346,11 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
         // Assumes store modifier data is stored in a transposed fashion (fft_size x  num_batches_local_mem)
         // to ensure much lesser bank conflicts
         global_data.log_message_global(__func__, "applying store modifier");
-        detail::apply_modifier(fft_size, priv, store_modifier_data, i * n_reals);
+        if (store_modifier_tables) {
+          detail::apply_modifier_from_tables(fft_size, priv, store_modifier_data, i, store_modifier_table_bits);
+        } else {
+          detail::apply_modifier(fft_size, priv, store_modifier_data, i * n_reals);
+        }
       }
       if (apply_scale_factor == detail::apply_scale_factor::APPLIED) {
         PORTFFT_UNROLL
@@ -276,13 +363,13 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
 
       if (interleaved_transforms_output) {
         if (storage == complex_storage::INTERLEAVED_COMPLEX) {
-          detail::strided_view output_view{output, output_stride, output_distance * i * 2};
+          detail::strided_view output_view{output, output_stride, output_batch_offset * 2};
           copy_wi<2>(global_data, priv, output_view, fft_size);
         } else {
           detail::strided_view priv_real_view{priv, 2};
           detail::strided_view priv_imag_view{priv, 2, 1};
-          detail::strided_view output_real_view{output, output_stride, output_distance * i};
-          detail::strided_view output_imag_view{output_imag, output_stride, output_distance * i};
+          detail::strided_view output_real_view{output, output_stride, output_batch_offset};
+          detail::strided_view output_imag_view{output_imag, output_stride, output_batch_offset};
           copy_wi(global_data, priv_real_view, output_real_view, fft_size);
           copy_wi(global_data, priv_imag_view, output_imag_view, fft_size);
         }
@@ -305,7 +392,13 @@ PORTFFT_INLINE void workitem_impl(const T* input, T* output, const T* input_imag
     if (is_packed_output) {
       sycl::group_barrier(global_data.sg);
       global_data.log_dump_local("computed data local memory:", loc, n_reals * n_working);
-      if (storage == complex_storage::INTERLEAVED_COMPLEX) {
+      if (storage == complex_storage::INTERLEAVED_COMPLEX && output_batch_ptrs != nullptr) {
+        global_data.log_message_global(__func__, "storing data from local to packed separate transforms");
+        for (Idx j = 0; j < n_working; j++) {
+          local2global<level::SUBGROUP, SubgroupSize>(global_data, loc_view, output_batch_ptrs[leader_i + j], n_reals,
+                                                      local_offset + j * n_reals, 0);
+        }
+      } else if (storage == complex_storage::INTERLEAVED_COMPLEX) {
         global_data.log_message_global(__func__, "storing data from local to packed global memory");
         local2global<level::SUBGROUP, SubgroupSize>(global_data, loc_view, output, n_reals * n_working, local_offset,
                                                     global_offset);
@@ -357,17 +450,18 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
   static sycl::event execute(committed_descriptor_impl& desc, const TIn& in, TOut& out, const TIn& in_imag,
                              TOut& out_imag, const std::vector<sycl::event>& dependencies, IdxGlobal n_transforms,
                              IdxGlobal input_offset, IdxGlobal output_offset, dimension_struct& dimension_data,
-                             direction compute_direction, layout input_layout) {
+                             direction compute_direction, layout input_layout,
+                             const batch_pointers_struct& batch_pointers) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     constexpr detail::memory Mem = std::is_pointer_v<TOut> ? detail::memory::USM : detail::memory::BUFFER;
+    using StorageScalar = detail::get_storage_scalar_t<TIn>;
     auto& kernel_data = compute_direction == direction::FORWARD ? dimension_data.forward_kernels.at(0)
                                                                 : dimension_data.backward_kernels.at(0);
-    std::size_t local_elements =
-        num_scalars_in_local_mem_struct::template inner<detail::level::WORKITEM, Dummy>::execute(
-            desc, kernel_data.length, kernel_data.used_sg_size, kernel_data.factors, kernel_data.num_sgs_per_wg,
-            input_layout);
+    const auto& launch = kernel_data.get_launch_params(input_layout);
+    std::size_t local_elements = launch.local_elements;
     std::size_t global_size = static_cast<std::size_t>(detail::get_global_size_workitem<Scalar>(
-        n_transforms, SubgroupSize, kernel_data.num_sgs_per_wg, desc.n_compute_units));
+        n_transforms, SubgroupSize, launch.num_sgs_per_wg, desc.n_compute_units));
+    const Scalar* window = compute_direction == direction::FORWARD ? desc.core->forward_window.get() : nullptr;
 
     return desc.queue.submit([&](sycl::handler& cgh) {
       cgh.depends_on(dependencies);
@@ -381,9 +475,9 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
       sycl::stream s{1024 * 16 * 8, 1024, cgh};
 #endif
       PORTFFT_LOG_TRACE("Launching workitem kernel with global_size", global_size, "local_size",
-                        SubgroupSize * kernel_data.num_sgs_per_wg, "local memory allocation of size", local_elements);
-      cgh.parallel_for<detail::workitem_kernel<Scalar, Domain, Mem, SubgroupSize>>(
-          sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(SubgroupSize * kernel_data.num_sgs_per_wg)}},
+                        SubgroupSize * launch.num_sgs_per_wg, "local memory allocation of size", local_elements);
+      cgh.parallel_for<detail::workitem_kernel<Scalar, Domain, Mem, SubgroupSize, StorageScalar>>(
+          sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(SubgroupSize * launch.num_sgs_per_wg)}},
           [=
 #ifdef PORTFFT_KERNEL_LOG
                ,
@@ -396,10 +490,13 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
 #endif
                 it};
             global_data.log_message_global("Running workitem kernel");
-            detail::workitem_impl<SubgroupSize>(&in_acc_or_usm[0] + input_offset, &out_acc_or_usm[0] + output_offset,
-                                                &in_imag_acc_or_usm[0] + input_offset,
-                                                &out_imag_acc_or_usm[0] + output_offset, &loc[0], n_transforms,
-                                                global_data, kh);
+            batch_pointers_struct kernel_batch_pointers = batch_pointers;
+            const IdxGlobal kernel_n_transforms = kernel_batch_pointers.resolve_range(n_transforms);
+            detail::workitem_impl<SubgroupSize, Scalar>(
+                &in_acc_or_usm[0] + input_offset, &out_acc_or_usm[0] + output_offset,
+                &in_imag_acc_or_usm[0] + input_offset, &out_imag_acc_or_usm[0] + output_offset, &loc[0],
+                kernel_n_transforms, global_data, kh, nullptr, nullptr, nullptr, nullptr, kernel_batch_pointers.inputs,
+                kernel_batch_pointers.outputs, window);
             global_data.log_message_global("Exiting workitem kernel");
           });
     });
@@ -409,12 +506,16 @@ struct committed_descriptor_impl<Scalar, Domain>::run_kernel_struct<SubgroupSize
 template <typename Scalar, domain Domain>
 template <typename Dummy>
 struct committed_descriptor_impl<Scalar, Domain>::set_spec_constants_struct::inner<detail::level::WORKITEM, Dummy> {
-  static void execute(committed_descriptor_impl& /*desc*/, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
+  static void execute(committed_descriptor_impl& desc, sycl::kernel_bundle<sycl::bundle_state::input>& in_bundle,
                       Idx length, const std::vector<Idx>& /*factors*/, detail::level /*level*/, Idx /*factor_num*/,
                       Idx /*num_factors*/) {
     PORTFFT_LOG_FUNCTION_ENTRY();
     PORTFFT_LOG_TRACE("SpecConstFftSize:", length);
     in_bundle.template set_specialization_constant<detail::SpecConstFftSize>(length);
+    // each work-item loads the whole DFT it works on from local memory
+    Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * length);
+    PORTFFT_LOG_TRACE("SpecConstBankLinesPerPad:", bank_lines_per_pad);
+    in_bundle.template set_specialization_constant<detail::SpecConstBankLinesPerPad>(bank_lines_per_pad);
   }
 };
 
@@ -425,10 +526,14 @@ struct committed_descriptor_impl<Scalar, Domain>::num_scalars_in_local_mem_struc
   static std::size_t execute(committed_descriptor_impl& desc, std::size_t length, Idx used_sg_size,
                              const std::vector<Idx>& /*factors*/, Idx& num_sgs_per_wg, layout /*input_layout*/) {
     PORTFFT_LOG_FUNCTION_ENTRY();
-    Idx num_scalars_per_sg = detail::pad_local(2 * static_cast<Idx>(length) * used_sg_size, 1);
+    const Idx bank_lines_per_pad = desc.bank_lines_per_pad(2 * static_cast<Idx>(length));
+    Idx num_scalars_per_sg =
+        detail::pad_local(2 * static_cast<Idx>(length) * used_sg_size, bank_lines_per_pad, desc.n_local_banks);
     Idx max_n_sgs = desc.local_memory_size / static_cast<Idx>(sizeof(Scalar)) / num_scalars_per_sg;
     num_sgs_per_wg = std::min(Idx(PORTFFT_SGS_IN_WG), std::max(Idx(1), max_n_sgs));
-    Idx res = num_scalars_per_sg * num_sgs_per_wg;
+    // recalculate padding since the padding of a multiple of `num_scalars_per_sg` can be larger
+    Idx res = detail::pad_local(2 * static_cast<Idx>(length) * used_sg_size * num_sgs_per_wg, bank_lines_per_pad,
+                                desc.n_local_banks);
     return static_cast<std::size_t>(res);
   }
 };
@@ -41,7 +41,7 @@ constexpr direction inv(direction dir) { return dir == direction::FORWARD ? dire
 namespace detail {
 enum class pad { DONT_PAD, DO_PAD };
 
-enum class level { WORKITEM, SUBGROUP, WORKGROUP, GLOBAL };
+enum class level { WORKITEM, SUBGROUP, WORKGROUP, GLOBAL, MULTI_DIM };
 
 enum class layout {
   /// Packed layout represents default strides and distance.
@@ -0,0 +1,444 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_PLAN_GROUP_HPP
+#define PORTFFT_PLAN_GROUP_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "common/exceptions.hpp"
+#include "common/helpers.hpp"
+#include "common/logging.hpp"
+#include "common/memory_views.hpp"
+#include "common/subgroup_ct.hpp"
+#include "common/transfers.hpp"
+#include "common/workitem.hpp"
+#include "committed_descriptor.hpp"
+#include "defines.hpp"
+#include "enums.hpp"
+#include "utils.hpp"
+
+namespace portfft {
+namespace detail {
+
+// kernel name
+template <typename Scalar, Idx SubgroupSize>
+class plan_group_kernel;
+
+/**
+ * Entry of the table describing the sub-plans of a plan group on the device.
+ *
+ * @tparam Scalar type of the scalar used for computations
+ */
+template <typename Scalar>
+struct plan_group_entry {
+  const Scalar* input;
+  Scalar* output;
+  // twiddles of the subgroup implementation, null for a sub-plan of the workitem implementation
+  const Scalar* twiddles;
+  // offsets of the first transform from input and output in complex values, for the forward and backward direction
+  std::array<IdxGlobal, 2> input_offsets;
+  std::array<IdxGlobal, 2> output_offsets;
+  IdxGlobal n_transforms;
+  // index of the first workgroup computing this sub-plan
+  IdxGlobal first_wg;
+  // number of complex values each work-item computes and number of work-items computing a transform. A sub-plan of
+  // the workitem implementation has `factor_sg` equal to 1.
+  Idx factor_wi;
+  Idx factor_sg;
+  std::array<Scalar, 2> scales;
+};
+
+/**
+ * Implementation of the kernel of a plan group. Each workgroup computes packed transforms of one sub-plan, each
+ * subgroup computing `SubgroupSize / factor_sg` of them like the subgroup implementation does. With `factor_sg` equal
+ * to 1 that is a transform per work-item, as in the workitem implementation. The factors of the transforms are read
+ * from the table of sub-plans rather than from specialization constants.
+ *
+ * @tparam SubgroupSize size of the subgroup
+ * @tparam T type of the scalar used for computations
+ * @param table table of the sub-plans, sorted by their first workgroup
+ * @param n_entries number of sub-plans
+ * @param loc local memory pointer. Must have space for `2 * factor_wi * SubgroupSize` scalars per subgroup for the
+ * largest sub-plan.
+ * @param dir_idx 0 for the forward direction, 1 for the backward direction
+ * @param global_data global data for the kernel
+ */
+template <Idx SubgroupSize, typename T>
+PORTFFT_INLINE void plan_group_impl(const plan_group_entry<T>* table, Idx n_entries, T* loc, Idx dir_idx,
+                                    global_data_struct<1> global_data) {
+  const IdxGlobal wg_id = static_cast<IdxGlobal>(global_data.it.get_group(0));
+  // last entry whose first workgroup is not after this one
+  Idx first = 0;
+  Idx count = n_entries;
+  while (count > 1) {
+    Idx half = count / 2;
+    if (table[first + half].first_wg <= wg_id) {
+      first += half;
+      count -= half;
+    } else {
+      count = half;
+    }
+  }
+  const plan_group_entry<T> entry = table[first];
+  const Idx factor_wi = entry.factor_wi;
+  const Idx factor_sg = entry.factor_sg;
+  const Idx n_reals_per_wi = 2 * factor_wi;
+  const Idx n_reals_per_fft = n_reals_per_wi * factor_sg;
+  const Idx n_ffts_per_sg = SubgroupSize / factor_sg;
+  const T scaling_factor = entry.scales[static_cast<std::size_t>(dir_idx)];
+  const T* input = entry.input + 2 * entry.input_offsets[static_cast<std::size_t>(dir_idx)];
+  T* output = entry.output + 2 * entry.output_offsets[static_cast<std::size_t>(dir_idx)];
+
+  global_data.log_message_global(__func__, "entered", "sub-plan", first, "FactorWI", factor_wi, "FactorSG", factor_sg);
+
+  T wi_private_scratch[2 * wi_temps(detail::MaxComplexPerWI)];
+  T priv[2 * MaxComplexPerWI];
+  const Idx subgroup_local_id = static_cast<Idx>(global_data.sg.get_local_linear_id());
+  const Idx subgroup_id = static_cast<Idx>(global_data.sg.get_group_id());
+  const Idx n_sgs_in_wg = static_cast<Idx>(global_data.it.get_local_range(0)) / SubgroupSize;
+  const Idx id_of_fft_in_sg = subgroup_local_id / factor_sg;
+  const Idx id_of_wi_in_fft = subgroup_local_id % factor_sg;
+  const Idx local_offset = n_reals_per_fft * n_ffts_per_sg * subgroup_id;
+  auto loc_view = detail::padded_view(loc, 0);
+
+  const IdxGlobal first_fft =
+      ((wg_id - entry.first_wg) * n_sgs_in_wg + subgroup_id) * static_cast<IdxGlobal>(n_ffts_per_sg);
+  const Idx n_ffts =
+      static_cast<Idx>(sycl::clamp(entry.n_transforms - first_fft, IdxGlobal(0), static_cast<IdxGlobal>(n_ffts_per_sg)));
+  const bool working = id_of_fft_in_sg < n_ffts;
+  const IdxGlobal global_offset = static_cast<IdxGlobal>(n_reals_per_fft) * first_fft;
+
+  if (n_ffts > 0) {
+    global_data.log_message_global(__func__, "loading packed data from global to local memory");
+    global2local<level::SUBGROUP, SubgroupSize>(global_data, input, loc_view, n_reals_per_fft * n_ffts, global_offset,
+                                                local_offset);
+  }
+  sycl::group_barrier(global_data.sg);
+  if (working) {
+    local_private_strided_copy<1, Idx>(
+        loc_view, priv, {{1}, {local_offset + id_of_fft_in_sg * n_reals_per_fft + id_of_wi_in_fft * n_reals_per_wi}},
+        factor_wi, detail::transfer_direction::LOCAL_TO_PRIVATE, global_data);
+    // the backward DFT is computed as the conjugate of the forward DFT of the conjugated input
+    if (dir_idx == 1) {
+      conjugate_inplace(priv, factor_wi);
+    }
+  }
+  // all the work-items of the subgroup take part in the exchanges between them
+  sg_dft<SubgroupSize>(priv, global_data.sg, factor_wi, factor_sg, entry.twiddles, wi_private_scratch);
+  sycl::group_barrier(global_data.sg);
+  if (working) {
+    if (dir_idx == 1) {
+      conjugate_inplace(priv, factor_wi);
+    }
+    for (Idx idx = 0; idx < n_reals_per_wi; idx++) {
+      priv[idx] *= scaling_factor;
+    }
+    // the output of a work-item is strided by the number of work-items computing the transform
+    local_private_strided_copy<1, Idx>(
+        loc_view, priv, {{factor_sg}, {local_offset + id_of_fft_in_sg * n_reals_per_fft + 2 * id_of_wi_in_fft}},
+        factor_wi, detail::transfer_direction::PRIVATE_TO_LOCAL, global_data);
+  }
+  sycl::group_barrier(global_data.sg);
+  if (n_ffts > 0) {
+    global_data.log_message_global(__func__, "storing data from local to packed global memory");
+    local2global<level::SUBGROUP, SubgroupSize>(global_data, loc_view, output, n_reals_per_fft * n_ffts, local_offset,
+                                                global_offset);
+  }
+  global_data.log_message_global(__func__, "exited");
+}
+
+}  // namespace detail
+
+/*
+A plan group computes the transforms of several committed descriptors, each with its own length, number of transforms
+and pointers, with a single kernel submission. This saves the launch overhead of one submission per plan when many
+small FFTs of different lengths are computed together. The sub-plans are described by a table in device memory, built
+when the group is first computed after adding plans. Each workgroup finds its sub-plan in the table and computes the
+transforms of it like the workitem or the subgroup implementation does, with the factors of the transforms and the
+twiddles of the subgroup implementation read at runtime.
+
+Only plans committed to the workitem or the subgroup implementation with the Cooley-Tukey algorithm can be added. The
+kernels of the other implementations need local memory and launch parameters of their own for each size, so they can
+not be shared between sub-plans of different lengths.
+*/
+
+/**
+ * A group of committed descriptors computed together with a single kernel submission.
+ *
+ * @tparam Scalar type of the scalar used for computations
+ * @tparam Domain domain of the FFT
+ */
+template <typename Scalar, domain Domain>
+class plan_group {
+  static_assert(Domain == domain::COMPLEX, "Plan groups only support complex transforms");
+
+ public:
+  /**
+   * Alias for `Scalar`.
+   */
+  using scalar_type = Scalar;
+
+  /**
+   * std::complex with `Scalar` scalar.
+   */
+  using complex_type = std::complex<Scalar>;
+
+  /**
+   * Constructor.
+   *
+   * @param queue queue the computations of the group are submitted to
+   */
+  explicit plan_group(sycl::queue& queue)
+      : queue(queue),
+        local_memory_size(static_cast<std::size_t>(
+            queue.get_device().get_info<sycl::info::device::local_mem_size>())) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+  }
+
+  /**
+   * Destructor. Waits for the last computation of the group, which uses its table of sub-plans and the twiddles.
+   */
+  ~plan_group() {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    last_compute.wait();
+  }
+
+  /**
+   * Adds a plan to the group. The plan must be committed to the workitem or the subgroup implementation for a single
+   * dimension, with packed interleaved complex data in both domains, on the device and context of the queue of the
+   * group. The group keeps the twiddles of the plan, the plan itself can be destroyed once added.
+   *
+   * @param plan committed descriptor to add
+   * @param in USM pointer to the input of the transforms of the plan
+   * @param out USM pointer to the output of the transforms of the plan. Must be equal to `in` for an in-place plan.
+   */
+  void add(const committed_descriptor<Scalar, Domain>& plan, const complex_type* in, complex_type* out) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    const detail::committed_descriptor_impl<Scalar, Domain>& impl = plan;
+    const descriptor<Scalar, Domain>& params = impl.params;
+    if (impl.queue.get_context() != queue.get_context() || impl.queue.get_device() != queue.get_device()) {
+      throw invalid_configuration("Plans in a group must be committed on the device and context of the group");
+    }
+    const auto& dimension_data = impl.core->dimensions[0];
+    if (params.lengths.size() != 1 || (dimension_data.level != detail::level::WORKITEM &&
+                                       dimension_data.level != detail::level::SUBGROUP)) {
+      throw unsupported_configuration(
+          "Only 1D plans committed to the workitem or the subgroup implementation can be grouped");
+    }
+    if (dimension_data.algorithm != detail::fft_algorithm::COOLEY_TUKEY) {
+      throw unsupported_configuration("Plans using Bluestein algorithm can not be grouped");
+    }
+    if (params.complex_storage != complex_storage::INTERLEAVED_COMPLEX ||
+        impl.get_committed_layout(direction::FORWARD) != detail::layout::PACKED ||
+        impl.get_committed_layout(direction::BACKWARD) != detail::layout::PACKED) {
+      throw unsupported_configuration("Plans in a group must use packed, interleaved complex data");
+    }
+    if (!params.outer_batch_counts.empty() || !params.forward_window.empty()) {
+      throw unsupported_configuration("Plans with outer batch dimensions or a forward window can not be grouped");
+    }
+    if (params.placement == placement::IN_PLACE && static_cast<const complex_type*>(out) != in) {
+      throw invalid_configuration("The input and output of an in-place plan must be the same");
+    }
+    const Idx plan_sg_size = dimension_data.used_sg_size;
+    if (!entries.empty() && plan_sg_size != subgroup_size) {
+      throw unsupported_configuration("Plans in a group must use the same subgroup size, got ", plan_sg_size,
+                                      " and ", subgroup_size);
+    }
+    subgroup_size = plan_sg_size;
+
+    detail::plan_group_entry<Scalar> entry{};
+    entry.input = reinterpret_cast<const Scalar*>(in);
+    entry.output = reinterpret_cast<Scalar*>(out);
+    if (dimension_data.level == detail::level::SUBGROUP) {
+      const auto& kernel_data = dimension_data.forward_kernels[0];
+      entry.factor_wi = kernel_data.factors[0];
+      entry.factor_sg = kernel_data.factors[1];
+      entry.twiddles = kernel_data.twiddles_forward.get();
+      twiddles.push_back(kernel_data.twiddles_forward);
+    } else {
+      entry.factor_wi = static_cast<Idx>(params.lengths[0]);
+      entry.factor_sg = 1;
+      entry.twiddles = nullptr;
+    }
+    entry.input_offsets[0] = static_cast<IdxGlobal>(params.forward_offset);
+    entry.input_offsets[1] = static_cast<IdxGlobal>(params.backward_offset);
+    entry.output_offsets[0] = static_cast<IdxGlobal>(params.backward_offset);
+    entry.output_offsets[1] = static_cast<IdxGlobal>(params.forward_offset);
+    entry.n_transforms = static_cast<IdxGlobal>(params.number_of_transforms);
+    entry.scales[0] = params.forward_scale;
+    entry.scales[1] = params.backward_scale;
+    entries.push_back(entry);
+    // a subgroup computes `subgroup_size / factor_sg` transforms of `factor_wi * factor_sg` complex values
+    max_local_elements_per_sg = std::max(max_local_elements_per_sg, 2 * static_cast<std::size_t>(entry.factor_wi) *
+                                                                        static_cast<std::size_t>(subgroup_size));
+    table_dirty = true;
+  }
+
+  /**
+   * Get the number of plans in the group.
+   */
+  std::size_t size() const noexcept { return entries.size(); }
+
+  /**
+   * Computes the forward FFTs of all the plans in the group.
+   *
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event compute_forward(const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    prepare();
+    last_compute = dispatch<PORTFFT_SUBGROUP_SIZES>(0, dependencies);
+    return last_compute;
+  }
+
+  /**
+   * Computes the backward FFTs of all the plans in the group.
+   *
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event compute_backward(const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    prepare();
+    last_compute = dispatch<PORTFFT_SUBGROUP_SIZES>(1, dependencies);
+    return last_compute;
+  }
+
+ private:
+  /**
+   * Chooses the launch parameters for the plans added so far and copies the table of sub-plans to the device. Only
+   * done when plans were added since the last computation.
+   */
+  void prepare() {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (entries.empty()) {
+      throw invalid_configuration("No plans were added to the group");
+    }
+    if (!table_dirty) {
+      return;
+    }
+    num_sgs_per_wg = PORTFFT_SGS_IN_WG;
+    while (num_sgs_per_wg > 1 &&
+           max_local_elements_per_sg * static_cast<std::size_t>(num_sgs_per_wg) * sizeof(Scalar) > local_memory_size) {
+      num_sgs_per_wg--;
+    }
+    local_elements = max_local_elements_per_sg * static_cast<std::size_t>(num_sgs_per_wg);
+    n_wgs = 0;
+    for (detail::plan_group_entry<Scalar>& entry : entries) {
+      entry.first_wg = n_wgs;
+      const IdxGlobal ffts_per_wg = static_cast<IdxGlobal>(subgroup_size / entry.factor_sg * num_sgs_per_wg);
+      n_wgs += detail::divide_ceil(entry.n_transforms, ffts_per_wg);
+    }
+    // the table being replaced is freed with its last owner, it must not be in use by a computation
+    last_compute.wait();
+    device_table = detail::make_shared<detail::plan_group_entry<Scalar>>(entries.size(), queue);
+    queue.copy(entries.data(), device_table.get(), entries.size()).wait();
+    table_dirty = false;
+  }
+
+  /**
+   * Submits the kernel of the group with the subgroup size used by its plans.
+   *
+   * @tparam SubgroupSize first subgroup size
+   * @tparam OtherSGSizes other subgroup sizes
+   * @param dir_idx 0 for the forward direction, 1 for the backward direction
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <Idx SubgroupSize, Idx... OtherSGSizes>
+  sycl::event dispatch(Idx dir_idx, const std::vector<sycl::event>& dependencies) {
+    if (SubgroupSize == subgroup_size) {
+      return submit<SubgroupSize>(dir_idx, dependencies);
+    }
+    if constexpr (sizeof...(OtherSGSizes) == 0) {
+      throw internal_error("Subgroup size of the plan group is not one of PORTFFT_SUBGROUP_SIZES");
+    } else {
+      return dispatch<OtherSGSizes...>(dir_idx, dependencies);
+    }
+  }
+
+  /**
+   * Submits the kernel of the group.
+   *
+   * @tparam SubgroupSize size of the subgroup
+   * @param dir_idx 0 for the forward direction, 1 for the backward direction
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  template <Idx SubgroupSize>
+  sycl::event submit(Idx dir_idx, const std::vector<sycl::event>& dependencies) {
+    const std::size_t wg_size = static_cast<std::size_t>(SubgroupSize * num_sgs_per_wg);
+    const std::size_t global_size = static_cast<std::size_t>(n_wgs) * wg_size;
+    const detail::plan_group_entry<Scalar>* table = device_table.get();
+    const Idx n_entries = static_cast<Idx>(entries.size());
+    return queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+      sycl::local_accessor<Scalar, 1> loc(local_elements, cgh);
+#ifdef PORTFFT_KERNEL_LOG
+      sycl::stream s{1024 * 16 * 8, 1024, cgh};
+#endif
+      PORTFFT_LOG_TRACE("Launching plan group kernel with", n_entries, "sub-plans, global_size", global_size,
+                        "local_size", wg_size, "local memory allocation of size", local_elements);
+      cgh.parallel_for<detail::plan_group_kernel<Scalar, SubgroupSize>>(
+          sycl::nd_range<1>{{global_size}, {wg_size}}, [=
+#ifdef PORTFFT_KERNEL_LOG
+                                                            ,
+                                                        global_logging_config = detail::global_logging_config
+#endif
+      ](sycl::nd_item<1> it) PORTFFT_REQD_SUBGROUP_SIZE(SubgroupSize) {
+            detail::global_data_struct global_data{
+#ifdef PORTFFT_KERNEL_LOG
+                s, global_logging_config,
+#endif
+                it};
+            global_data.log_message_global("Running plan group kernel");
+            detail::plan_group_impl<SubgroupSize>(table, n_entries, &loc[0], dir_idx, global_data);
+            global_data.log_message_global("Exiting plan group kernel");
+          });
+    });
+  }
+
+  sycl::queue queue;
+  std::size_t local_memory_size;
+  std::vector<detail::plan_group_entry<Scalar>> entries;
+  std::shared_ptr<detail::plan_group_entry<Scalar>> device_table;
+  // twiddles of the sub-plans of the subgroup implementation, kept alive after the plans are destroyed
+  std::vector<std::shared_ptr<Scalar>> twiddles;
+  // last computation using the table of sub-plans
+  sycl::event last_compute;
+  bool table_dirty = false;
+  Idx subgroup_size = 0;
+  std::size_t max_local_elements_per_sg = 0;
+  Idx num_sgs_per_wg = 1;
+  std::size_t local_elements = 0;
+  IdxGlobal n_wgs = 0;
+};
+
+}  // namespace portfft
+
+#endif  // PORTFFT_PLAN_GROUP_HPP
@@ -0,0 +1,480 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_RAGGED_BATCH_HPP
+#define PORTFFT_RAGGED_BATCH_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/exceptions.hpp"
+#include "common/helpers.hpp"
+#include "common/logging.hpp"
+#include "common/transfers.hpp"
+#include "common/workitem.hpp"
+#include "defines.hpp"
+#include "descriptor.hpp"
+#include "enums.hpp"
+#include "utils.hpp"
+
+namespace portfft {
+
+/**
+ * One transform of a ragged batch: the position of its first complex value in the input and output and its length.
+ */
+struct ragged_segment {
+  std::size_t offset;
+  std::size_t length;
+};
+
+namespace detail {
+
+// kernel names
+template <typename Scalar>
+class ragged_batch_kernel;
+template <typename Scalar>
+class ragged_batch_count_kernel;
+template <typename Scalar>
+class ragged_batch_scan_kernel;
+template <typename Scalar>
+class ragged_batch_scatter_kernel;
+
+/**
+ * Implementation of the kernel of a ragged batch. Each work-item computes the transform of one segment, loading it
+ * straight from global memory into registers, since the segments of neighbouring work-items are neither of the same
+ * length nor adjacent.
+ *
+ * @tparam T type of the scalar used for computations
+ * @param input pointer to global memory containing input data
+ * @param output pointer to global memory for output data
+ * @param segments segments to transform
+ * @param n_segments number of segments
+ * @param max_length largest length computed by the kernel. Segments that are longer or empty are left untouched.
+ * @param scaling_factor factor the result is multiplied by
+ * @param backward whether to compute the backward DFT
+ * @param global_data global data for the kernel
+ */
+template <typename T>
+PORTFFT_INLINE void ragged_batch_impl(const T* input, T* output, const ragged_segment* segments, IdxGlobal n_segments,
+                                      Idx max_length, T scaling_factor, bool backward,
+                                      global_data_struct<1> global_data) {
+  const IdxGlobal segment_idx = static_cast<IdxGlobal>(global_data.it.get_global_id(0));
+  if (segment_idx >= n_segments) {
+    return;
+  }
+  const ragged_segment segment = segments[segment_idx];
+  if (segment.length == 0 || segment.length > static_cast<std::size_t>(max_length)) {
+    return;
+  }
+  const Idx fft_size = static_cast<Idx>(segment.length);
+  const IdxGlobal offset = 2 * static_cast<IdxGlobal>(segment.offset);
+  global_data.log_message_global(__func__, "segment", segment_idx, "fft_size", fft_size);
+
+  T wi_private_scratch[2 * wi_temps(detail::MaxComplexPerWI)];
+  T priv[2 * MaxComplexPerWI];
+  copy_wi<2>(global_data, input + offset, priv, fft_size);
+  // the backward DFT is computed as the conjugate of the forward DFT of the conjugated input
+  if (backward) {
+    conjugate_inplace(priv, fft_size);
+  }
+  wi_dft<0>(priv, priv, fft_size, 1, 1, wi_private_scratch);
+  if (backward) {
+    conjugate_inplace(priv, fft_size);
+  }
+  for (Idx idx = 0; idx < 2 * fft_size; idx++) {
+    priv[idx] *= scaling_factor;
+  }
+  copy_wi<2>(global_data, priv, output + offset, fft_size);
+}
+
+/**
+ * Finds the bucket of the segments of a length computed by a committed descriptor.
+ *
+ * @param bucket_lengths lengths computed by committed descriptors, in ascending order
+ * @param n_buckets number of lengths
+ * @param length length of the segment
+ * @return index of the bucket, or -1 if no committed descriptor computes the length
+ */
+PORTFFT_INLINE inline Idx find_ragged_bucket(const std::size_t* bucket_lengths, Idx n_buckets, std::size_t length) {
+  Idx first = 0;
+  Idx count = n_buckets;
+  while (count > 0) {
+    Idx half = count / 2;
+    if (bucket_lengths[first + half] < length) {
+      first += half + 1;
+      count -= half + 1;
+    } else {
+      count = half;
+    }
+  }
+  return first < n_buckets && bucket_lengths[first] == length ? first : -1;
+}
+
+}  // namespace detail
+
+/*
+A ragged batch computes complex transforms of different lengths, each at its own offset in the input and output. The
+segments are given as an array of `ragged_segment` in USM memory, which can be filled on the device. Each work-item of
+a single kernel computes one segment short enough for a work-item, including prime lengths, without padding the
+segments to a common length.
+
+Longer segments are computed by committed descriptors, one for each of the lengths declared at construction. The
+segments stay on the device: a kernel counts the segments of each declared length, a second one scans the counts into
+the first position of each length and a third one scatters the pointers of the segments into arrays of pointers, in
+which the segments of a length are contiguous. The committed descriptor of each length then computes all its segments
+with a single launch on the arrays of pointers, reading the position and number of its segments from device memory, so
+no data goes through the host and the computation never waits on the host.
+
+Work-items of a subgroup computing segments of different lengths diverge. Segments sorted or grouped by length give
+neighbouring work-items the same amount of work.
+*/
+
+/**
+ * Computes batches of complex FFTs of varying lengths.
+ *
+ * @tparam Scalar type of the scalar used for computations
+ */
+template <typename Scalar>
+class ragged_batch {
+ public:
+  /**
+   * Alias for `Scalar`.
+   */
+  using scalar_type = Scalar;
+
+  /**
+   * std::complex with `Scalar` scalar.
+   */
+  using complex_type = std::complex<Scalar>;
+
+  /**
+   * Constructor. Commits a descriptor for each of the declared lengths longer than a work-item can compute.
+   *
+   * @param queue queue the computations are submitted to
+   * @param max_length largest length of a segment
+   * @param lengths lengths longer than a work-item can compute that segments can have. Segments of other lengths
+   * longer than a work-item can compute are left untouched. Each length must be at most `max_length` and computed by
+   * the workitem or the subgroup implementation.
+   * @param forward_scale scaling factor applied to the result of forward transforms
+   * @param backward_scale scaling factor applied to the result of backward transforms
+   */
+  ragged_batch(sycl::queue& queue, std::size_t max_length, const std::vector<std::size_t>& lengths = {},
+               Scalar forward_scale = 1, Scalar backward_scale = 1)
+      : queue(queue), max_length(max_length), forward_scale(forward_scale), backward_scale(backward_scale) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    if (max_length == 0) {
+      throw invalid_configuration("The maximum length of a ragged batch must be positive");
+    }
+    // all the lengths up to the largest one a work-item computes must fit, since shorter lengths with large prime
+    // factors can need more temporaries than longer ones
+    const Idx wi_limit = static_cast<Idx>(std::min(max_length, static_cast<std::size_t>(detail::MaxComplexPerWI)));
+    while (wi_max_length < wi_limit && detail::fits_in_wi<Scalar>(wi_max_length + 1)) {
+      wi_max_length++;
+    }
+    PORTFFT_LOG_TRACE("Segments up to length", wi_max_length, "are computed by a work-item");
+    const std::size_t max_wg_size = queue.get_device().get_info<sycl::info::device::max_work_group_size>();
+    wg_size = std::min(static_cast<std::size_t>(PORTFFT_SGS_IN_WG * 32), max_wg_size);
+
+    std::vector<std::size_t> sorted_lengths(lengths);
+    std::sort(sorted_lengths.begin(), sorted_lengths.end());
+    sorted_lengths.erase(std::unique(sorted_lengths.begin(), sorted_lengths.end()), sorted_lengths.end());
+    for (std::size_t length : sorted_lengths) {
+      if (length == 0 || length > max_length) {
+        throw invalid_configuration("The lengths of a ragged batch must be between 1 and the maximum length ",
+                                    max_length, ", got ", length);
+      }
+      if (length <= static_cast<std::size_t>(wi_max_length)) {
+        continue;
+      }
+      PORTFFT_LOG_TRACE("Committing a descriptor for segments of length", length);
+      descriptor<Scalar, domain::COMPLEX> desc({length});
+      desc.forward_scale = forward_scale;
+      desc.backward_scale = backward_scale;
+      committed_descriptor<Scalar, domain::COMPLEX> plan = desc.commit(queue);
+      const detail::committed_descriptor_impl<Scalar, domain::COMPLEX>& impl = plan;
+      const detail::level plan_level = impl.core->dimensions[0].level;
+      if (plan_level != detail::level::WORKITEM && plan_level != detail::level::SUBGROUP) {
+        throw unsupported_configuration("Segments of length ", length,
+                                        " are too long for a ragged batch, the longest lengths supported are the ones "
+                                        "computed by the subgroup implementation");
+      }
+      plans.push_back(std::move(plan));
+      plan_lengths.push_back(length);
+    }
+    if (!plan_lengths.empty()) {
+      device_plan_lengths = detail::make_shared<std::size_t>(plan_lengths.size(), queue);
+      bucket_ranges = detail::make_shared<IdxGlobal>(2 * plan_lengths.size(), queue);
+      bucket_cursors = detail::make_shared<IdxGlobal>(plan_lengths.size(), queue);
+      queue.copy(plan_lengths.data(), device_plan_lengths.get(), plan_lengths.size()).wait();
+    }
+  }
+
+  // copies would share the arrays the segments are bucketed into
+  ragged_batch(const ragged_batch&) = delete;
+  ragged_batch& operator=(const ragged_batch&) = delete;
+
+  /**
+   * Destructor. Waits for the last computation, which uses the arrays the segments are bucketed into.
+   */
+  ~ragged_batch() {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    last_compute.wait();
+  }
+
+  /**
+   * Get the largest length of a segment.
+   */
+  std::size_t get_max_length() const noexcept { return max_length; }
+
+  /**
+   * Get the largest length of a segment computed by a work-item. Longer segments are computed with committed
+   * descriptors.
+   */
+  std::size_t get_max_workitem_length() const noexcept { return static_cast<std::size_t>(wi_max_length); }
+
+  /**
+   * Get the lengths computed with committed descriptors, in ascending order.
+   */
+  const std::vector<std::size_t>& get_plan_lengths() const noexcept { return plan_lengths; }
+
+  /**
+   * Computes forward FFTs of the segments of USM memory. Segments longer than the maximum length, or longer than a
+   * work-item computes and not of a length declared at construction, are left untouched.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory for output data, written at the same offsets. May be equal to `in`.
+   * @param segments USM pointer to the segments to transform
+   * @param n_segments number of segments
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event compute_forward(const complex_type* in, complex_type* out, const ragged_segment* segments,
+                              std::size_t n_segments, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return submit(in, out, segments, n_segments, false, dependencies);
+  }
+
+  /**
+   * Computes backward FFTs of the segments of USM memory. Segments longer than the maximum length, or longer than a
+   * work-item computes and not of a length declared at construction, are left untouched.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory for output data, written at the same offsets. May be equal to `in`.
+   * @param segments USM pointer to the segments to transform
+   * @param n_segments number of segments
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event compute_backward(const complex_type* in, complex_type* out, const ragged_segment* segments,
+                               std::size_t n_segments, const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    return submit(in, out, segments, n_segments, true, dependencies);
+  }
+
+ private:
+  /**
+   * Submits the computation of the segments: the kernel computing the segments short enough for a work-item and, if
+   * lengths were declared, the bucketing of the segments and a launch of the committed descriptor of each length.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory for output data
+   * @param segments USM pointer to the segments to transform
+   * @param n_segments number of segments
+   * @param backward whether to compute backward FFTs
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event submit(const complex_type* in, complex_type* out, const ragged_segment* segments, std::size_t n_segments,
+                     bool backward, const std::vector<sycl::event>& dependencies) {
+    sycl::event wi_event = submit_workitem(in, out, segments, n_segments, backward, dependencies);
+    if (plans.empty() || n_segments == 0) {
+      return wi_event;
+    }
+    reserve_segments(n_segments);
+    const sycl::event bucket_event = bucket_segments(in, out, segments, n_segments, dependencies);
+    std::vector<sycl::event> events{wi_event};
+    for (std::size_t bucket = 0; bucket < plans.size(); bucket++) {
+      PORTFFT_LOG_TRACE("Computing the segments of length", plan_lengths[bucket], "with a committed descriptor");
+      detail::committed_descriptor_impl<Scalar, domain::COMPLEX>& impl = plans[bucket];
+      // the number of segments of the length is only known on the device, all the segments are an upper bound of it
+      events.push_back(impl.dispatch_pointer_array(segment_inputs.get(), segment_outputs.get(),
+                                                   backward ? direction::BACKWARD : direction::FORWARD, {bucket_event},
+                                                   n_segments, bucket_ranges.get() + 2 * bucket));
+    }
+    last_compute = queue.ext_oneapi_submit_barrier(events);
+    return last_compute;
+  }
+
+  /**
+   * Makes sure the arrays of pointers the segments are bucketed into can hold `n_segments` segments. Growing them waits
+   * for the last computation.
+   *
+   * @param n_segments number of segments
+   */
+  void reserve_segments(std::size_t n_segments) {
+    if (n_segments <= segment_capacity) {
+      return;
+    }
+    PORTFFT_LOG_TRACE("Allocating arrays of pointers for", n_segments, "segments");
+    last_compute.wait();
+    segment_inputs = detail::make_shared<const complex_type*>(n_segments, queue);
+    segment_outputs = detail::make_shared<complex_type*>(n_segments, queue);
+    segment_capacity = n_segments;
+  }
+
+  /**
+   * Submits the kernels bucketing the segments by length on the device. The segments of the length of each committed
+   * descriptor are gathered into a contiguous range of the arrays of pointers, whose position and size are written to
+   * `bucket_ranges`. The order of the segments within a range is not specified.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory for output data
+   * @param segments USM pointer to the segments to transform
+   * @param n_segments number of segments
+   * @param dependencies events that must complete before the segments are read
+   * @return sycl::event of the last kernel
+   */
+  sycl::event bucket_segments(const complex_type* in, complex_type* out, const ragged_segment* segments,
+                              std::size_t n_segments, const std::vector<sycl::event>& dependencies) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+    using atomic_idx = sycl::atomic_ref<IdxGlobal, sycl::memory_order::relaxed, sycl::memory_scope::device,
+                                        sycl::access::address_space::global_space>;
+    const Idx n_buckets = static_cast<Idx>(plans.size());
+    const std::size_t* lengths = device_plan_lengths.get();
+    IdxGlobal* ranges = bucket_ranges.get();
+    IdxGlobal* cursors = bucket_cursors.get();
+    const complex_type** inputs = segment_inputs.get();
+    complex_type** outputs = segment_outputs.get();
+    // the ranges and arrays of the previous computation may still be in use
+    sycl::event zero_event = queue.fill(ranges, IdxGlobal(0), 2 * plans.size(), last_compute);
+    PORTFFT_LOG_TRACE("Bucketing", n_segments, "segments into", n_buckets, "lengths");
+    sycl::event count_event = queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+      cgh.depends_on(zero_event);
+      cgh.parallel_for<detail::ragged_batch_count_kernel<Scalar>>(sycl::range<1>{n_segments}, [=](sycl::id<1> idx) {
+        const Idx bucket = detail::find_ragged_bucket(lengths, n_buckets, segments[idx[0]].length);
+        if (bucket >= 0) {
+          atomic_idx(ranges[2 * bucket + 1]).fetch_add(1);
+        }
+      });
+    });
+    sycl::event scan_event = queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(count_event);
+      cgh.single_task<detail::ragged_batch_scan_kernel<Scalar>>([=]() {
+        IdxGlobal first = 0;
+        for (Idx bucket = 0; bucket < n_buckets; bucket++) {
+          ranges[2 * bucket] = first;
+          cursors[bucket] = first;
+          first += ranges[2 * bucket + 1];
+        }
+      });
+    });
+    return queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(scan_event);
+      cgh.parallel_for<detail::ragged_batch_scatter_kernel<Scalar>>(sycl::range<1>{n_segments}, [=](sycl::id<1> idx) {
+        const ragged_segment segment = segments[idx[0]];
+        const Idx bucket = detail::find_ragged_bucket(lengths, n_buckets, segment.length);
+        if (bucket >= 0) {
+          const IdxGlobal position = atomic_idx(cursors[bucket]).fetch_add(1);
+          inputs[position] = in + segment.offset;
+          outputs[position] = out + segment.offset;
+        }
+      });
+    });
+  }
+
+  /**
+   * Submits the kernel computing the segments short enough for a work-item.
+   *
+   * @param in USM pointer to memory containing input data
+   * @param out USM pointer to memory for output data
+   * @param segments USM pointer to the segments to transform
+   * @param n_segments number of segments
+   * @param backward whether to compute backward FFTs
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event submit_workitem(const complex_type* in, complex_type* out, const ragged_segment* segments,
+                              std::size_t n_segments, bool backward, const std::vector<sycl::event>& dependencies) {
+    const Scalar* input = reinterpret_cast<const Scalar*>(in);
+    Scalar* output = reinterpret_cast<Scalar*>(out);
+    const Scalar scaling_factor = backward ? backward_scale : forward_scale;
+    const IdxGlobal n_segments_global = static_cast<IdxGlobal>(n_segments);
+    const Idx max_length_copy = wi_max_length;
+    const std::size_t global_size = detail::round_up_to_multiple(std::max(n_segments, std::size_t(1)), wg_size);
+    return queue.submit([&](sycl::handler& cgh) {
+      cgh.depends_on(dependencies);
+#ifdef PORTFFT_KERNEL_LOG
+      sycl::stream s{1024 * 16 * 8, 1024, cgh};
+#endif
+      PORTFFT_LOG_TRACE("Launching ragged batch kernel with", n_segments, "segments, global_size", global_size,
+                        "local_size", wg_size);
+      cgh.parallel_for<detail::ragged_batch_kernel<Scalar>>(
+          sycl::nd_range<1>{{global_size}, {wg_size}}, [=
+#ifdef PORTFFT_KERNEL_LOG
+                                                            ,
+                                                        global_logging_config = detail::global_logging_config
+#endif
+      ](sycl::nd_item<1> it) {
+            detail::global_data_struct global_data{
+#ifdef PORTFFT_KERNEL_LOG
+                s, global_logging_config,
+#endif
+                it};
+            global_data.log_message_global("Running ragged batch kernel");
+            detail::ragged_batch_impl(input, output, segments, n_segments_global, max_length_copy, scaling_factor,
+                                      backward, global_data);
+            global_data.log_message_global("Exiting ragged batch kernel");
+          });
+    });
+  }
+
+  sycl::queue queue;
+  std::size_t max_length;
+  // largest length computed by a work-item
+  Idx wi_max_length = 0;
+  Scalar forward_scale;
+  Scalar backward_scale;
+  std::size_t wg_size;
+  // committed descriptors computing the longer segments and their lengths, in ascending order
+  std::vector<committed_descriptor<Scalar, domain::COMPLEX>> plans;
+  std::vector<std::size_t> plan_lengths;
+  std::shared_ptr<std::size_t> device_plan_lengths;
+  // first position in the arrays of pointers and number of the segments of each length, written by the bucketing
+  std::shared_ptr<IdxGlobal> bucket_ranges;
+  // next position to scatter a segment of each length to
+  std::shared_ptr<IdxGlobal> bucket_cursors;
+  // pointers to the input and output of the segments computed by committed descriptors, grouped by length
+  std::shared_ptr<const complex_type*> segment_inputs;
+  std::shared_ptr<complex_type*> segment_outputs;
+  std::size_t segment_capacity = 0;
+  // last computation using the arrays the segments are bucketed into
+  sycl::event last_compute;
+};
+
+}  // namespace portfft
+
+#endif  // PORTFFT_RAGGED_BATCH_HPP
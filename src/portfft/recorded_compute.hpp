@@ -0,0 +1,142 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_RECORDED_COMPUTE_HPP
+#define PORTFFT_RECORDED_COMPUTE_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "common/logging.hpp"
+#include "enums.hpp"
+
+// Recording into command graphs needs the sycl_ext_oneapi_graph extension. Defining PORTFFT_SYCL_GRAPH to 0 disables
+// it, recorded computations then submit their kernels on every replay.
+#ifndef PORTFFT_SYCL_GRAPH
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+#define PORTFFT_SYCL_GRAPH 1
+#else
+#define PORTFFT_SYCL_GRAPH 0
+#endif
+#endif
+
+namespace portfft {
+
+template <typename Scalar, domain Domain>
+class committed_descriptor;
+
+/**
+ * A computation of a committed descriptor on fixed USM pointers, recorded once and replayed any number of times.
+ *
+ * Where the sycl_ext_oneapi_graph extension is available the kernels of the computation are recorded into an
+ * executable command graph, which each replay submits at once. Otherwise, or if the device or the computation can not
+ * be recorded, each replay submits the kernels like a compute call does.
+ *
+ * A recorded computation is move-only: the command graph refers to the scratch memory of the plan it owns, which a
+ * copy would not share.
+ */
+class recorded_compute {
+ public:
+  recorded_compute(const recorded_compute&) = delete;
+  recorded_compute& operator=(const recorded_compute&) = delete;
+  recorded_compute(recorded_compute&&) = default;
+  recorded_compute& operator=(recorded_compute&&) = default;
+
+  /**
+   * Replays the computation.
+   *
+   * @param dependencies events that must complete before the computation
+   * @return sycl::event associated with this computation
+   */
+  sycl::event replay(const std::vector<sycl::event>& dependencies = {}) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+#if PORTFFT_SYCL_GRAPH
+    if (exec_graph.has_value()) {
+      return queue.submit([&](sycl::handler& cgh) {
+        cgh.depends_on(dependencies);
+        cgh.ext_oneapi_graph(*exec_graph);
+      });
+    }
+#endif
+    return submit(dependencies);
+  }
+
+  /**
+   * Whether the computation was recorded into a command graph, rather than submitting its kernels on every replay.
+   */
+  bool uses_graph() const noexcept {
+#if PORTFFT_SYCL_GRAPH
+    return exec_graph.has_value();
+#else
+    return false;
+#endif
+  }
+
+ private:
+  template <typename Scalar, domain Domain>
+  friend class committed_descriptor;
+
+  /**
+   * Constructor. Records the computation if the device supports it.
+   *
+   * @param queue queue the computation is submitted to
+   * @param submit submits the computation, owning the plan it uses
+   */
+  recorded_compute(sycl::queue queue, std::function<sycl::event(const std::vector<sycl::event>&)> submit)
+      : queue(std::move(queue)), submit(std::move(submit)) {
+    PORTFFT_LOG_FUNCTION_ENTRY();
+#if PORTFFT_SYCL_GRAPH
+    namespace graph_ext = sycl::ext::oneapi::experimental;
+    try {
+      graph_ext::command_graph<graph_ext::graph_state::modifiable> graph(this->queue.get_context(),
+                                                                         this->queue.get_device());
+      graph.begin_recording(this->queue);
+      try {
+        this->submit({});
+      } catch (...) {
+        graph.end_recording(this->queue);
+        throw;
+      }
+      graph.end_recording(this->queue);
+      exec_graph.emplace(graph.finalize());
+      PORTFFT_LOG_TRACE("Recorded the computation into a command graph");
+    } catch (const sycl::exception& e) {
+      PORTFFT_LOG_WARNING("Recording into a command graph failed, the kernels will be submitted on every replay:",
+                          e.what());
+    }
+#endif
+  }
+
+  sycl::queue queue;
+  std::function<sycl::event(const std::vector<sycl::event>&)> submit;
+#if PORTFFT_SYCL_GRAPH
+  using exec_graph_t =
+      sycl::ext::oneapi::experimental::command_graph<sycl::ext::oneapi::experimental::graph_state::executable>;
+  std::optional<exec_graph_t> exec_graph;
+#endif
+};
+
+}  // namespace portfft
+
+#endif  // PORTFFT_RECORDED_COMPUTE_HPP
@@ -36,6 +36,10 @@ constexpr static sycl::specialization_id<IdxGlobal> SpecConstInputStride{};
 constexpr static sycl::specialization_id<IdxGlobal> SpecConstOutputStride{};
 constexpr static sycl::specialization_id<IdxGlobal> SpecConstInputDistance{};
 constexpr static sycl::specialization_id<IdxGlobal> SpecConstOutputDistance{};
+// Number of transforms in each batch of the innermost outer batch dimension, 0 for a single batch dimension
+constexpr static sycl::specialization_id<IdxGlobal> SpecConstBatchesPerOuterBatch{};
+constexpr static sycl::specialization_id<IdxGlobal> SpecConstInputOuterDistance{};
+constexpr static sycl::specialization_id<IdxGlobal> SpecConstOutputOuterDistance{};
 
 constexpr static sycl::specialization_id<complex_storage> SpecConstComplexStorage{};
 constexpr static sycl::specialization_id<detail::elementwise_multiply> SpecConstMultiplyOnLoad{};
@@ -45,9 +49,14 @@ constexpr static sycl::specialization_id<detail::apply_scale_factor> SpecConstAp
 constexpr static sycl::specialization_id<Idx> SubgroupFactorWISpecConst{};
 constexpr static sycl::specialization_id<Idx> SubgroupFactorSGSpecConst{};
 
+constexpr static sycl::specialization_id<Idx> WorkgroupFactorSGNSpecConst{};
+constexpr static sycl::specialization_id<Idx> WorkgroupFactorSGMSpecConst{};
+
 constexpr static sycl::specialization_id<level> GlobalSubImplSpecConst{};
 constexpr static sycl::specialization_id<Idx> GlobalSpecConstLevelNum{};
 constexpr static sycl::specialization_id<Idx> GlobalSpecConstNumFactors{};
+// Whether the store modifiers are the twiddle tables from `calculate_twiddle_tables` instead of a dense array
+constexpr static sycl::specialization_id<bool> GlobalSpecConstTwiddleTables{};
 
 // Specialization constants used for IFFT, when expressed as a IFFT=(conjugate(FFT(conjugate(input))))
 constexpr static sycl::specialization_id<detail::complex_conjugate> SpecConstConjugateOnLoad{};
@@ -55,6 +64,21 @@ constexpr static sycl::specialization_id<detail::complex_conjugate> SpecConstCon
 
 constexpr static sycl::specialization_id<float> SpecConstScaleFactorFloat{};
 constexpr static sycl::specialization_id<double> SpecConstScaleFactorDouble{};
+// Scale applied to integer input values on top of the scale factor. Only used by kernels reading integer input.
+constexpr static sycl::specialization_id<float> SpecConstIntegerInputScaleFloat{};
+constexpr static sycl::specialization_id<double> SpecConstIntegerInputScaleDouble{};
+
+// Maximum number of dimensions of a multi-dimensional transform computed by a single kernel
+constexpr Idx MaxFusedDimensions = 3;
+// Lengths of the dimensions of a multi-dimensional transform computed by a single kernel, ordered from most to least
+// significant. Dimensions that are not used have length 1.
+constexpr static sycl::specialization_id<Idx> SpecConstMultiDimLength0{};
+constexpr static sycl::specialization_id<Idx> SpecConstMultiDimLength1{};
+constexpr static sycl::specialization_id<Idx> SpecConstMultiDimLength2{};
+
+// Padding of local memory, see `pad_local`. The defaults match the padding of kernels that do not set them.
+constexpr static sycl::specialization_id<Idx> SpecConstNumLocalBanks{PORTFFT_N_LOCAL_BANKS};
+constexpr static sycl::specialization_id<Idx> SpecConstBankLinesPerPad{1};
 
 constexpr static sycl::specialization_id<detail::fft_algorithm> SpecConstFFTAlgorithm{};
 constexpr static sycl::specialization_id<Idx> SpecConstCommittedLength{};
@@ -21,7 +21,11 @@
 #ifndef PORTFFT_TRAITS_HPP
 #define PORTFFT_TRAITS_HPP
 
+#include <sycl/sycl.hpp>
+
 #include <complex>
+#include <cstdint>
+#include <type_traits>
 
 #include "defines.hpp"
 #include "enums.hpp"
@@ -74,10 +78,64 @@ struct get_element<T*> {
 template <typename T>
 using get_element_t = typename get_element<T>::type;
 
+/// Specialization of get_elem for buffer
+template <typename T>
+struct get_element<sycl::buffer<T, 1>> {
+  using type = T;
+};
+
 /// get_element::type with any topmost const and/or volatile qualifiers removed.
 template <typename T>
 using get_element_remove_cv_t = std::remove_cv_t<get_element_t<T>>;
 
+/** Test if a type can be used to store real values in global memory. Types narrower than the scalar type used for
+ *  computations are converted when they are loaded and stored. Integer types are only supported for the input.
+ *
+ *  @tparam T The type to test
+ **/
+template <typename T>
+struct is_storage_scalar
+    : std::bool_constant<std::is_floating_point_v<T> || std::is_same_v<T, sycl::half> ||
+                         std::is_same_v<T, sycl::ext::oneapi::bfloat16> || std::is_same_v<T, std::int16_t> ||
+                         std::is_same_v<T, std::int8_t>> {};
+
+/// is_storage_scalar::value shortcut
+template <typename T>
+inline constexpr bool is_storage_scalar_v = is_storage_scalar<std::remove_cv_t<T>>::value;
+
+/** Test if a type is a reduced precision type that can be used to store data in global memory, while the
+ *  computations are done in a wider scalar type.
+ *
+ *  @tparam T The type to test
+ **/
+template <typename T>
+inline constexpr bool is_reduced_precision_storage_v =
+    is_storage_scalar_v<T> && !std::is_floating_point_v<T> && !std::is_integral_v<T>;
+
+/** Test if a type is an integer type that can be used to store input data in global memory, such as raw samples from
+ *  an analog-to-digital converter. The values are converted to the scalar type used for computations on load.
+ *
+ *  @tparam T The type to test
+ **/
+template <typename T>
+inline constexpr bool is_integer_storage_v = is_storage_scalar_v<T> && std::is_integral_v<T>;
+
+/** Get the type of the real values stored in a USM allocation or a buffer
+ *  Examples:
+ *  * type is float for a const std::complex<float>*
+ *  * type is sycl::half for a sycl::half*
+ *
+ *  @tparam T The type of the USM pointer or buffer
+ **/
+template <typename T>
+struct get_storage_scalar {
+  using type = typename get_real<get_element_remove_cv_t<T>>::type;
+};
+
+/// get_storage_scalar::type shortcut
+template <typename T>
+using get_storage_scalar_t = typename get_storage_scalar<T>::type;
+
 /** Test if a view of memory is contiguous
  *  Examples:
  *  * true for a pointer
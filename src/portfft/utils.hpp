@@ -23,6 +23,8 @@
 
 #include <sycl/sycl.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -33,7 +35,7 @@
 
 namespace portfft {
 namespace detail {
-template <typename Scalar, detail::memory>
+template <typename Scalar, detail::memory, typename StorageScalar>
 class transpose_kernel;
 
 /**
@@ -43,22 +45,27 @@ class transpose_kernel;
  * @tparam SubgroupSize size of the subgroup
  * @return vector of kernel ids
  */
-template <template <typename, domain, detail::memory, Idx> class Kernel, typename Scalar, domain Domain,
+template <template <typename, domain, detail::memory, Idx, typename> class Kernel, typename Scalar, domain Domain,
           Idx SubgroupSize>
 std::vector<sycl::kernel_id> get_ids() {
   PORTFFT_LOG_FUNCTION_ENTRY();
   std::vector<sycl::kernel_id> ids;
-  try {
-    ids.push_back(sycl::get_kernel_id<Kernel<Scalar, Domain, memory::USM, SubgroupSize>>());
-  } catch (...) {
+#define PORTFFT_GET_KERNEL_ID(MEMORY, STORAGE)                                                     \
+  try {                                                                                            \
+    ids.push_back(sycl::get_kernel_id<Kernel<Scalar, Domain, (MEMORY), SubgroupSize, STORAGE>>()); \
+  } catch (...) {                                                                                  \
   }
 
+  PORTFFT_GET_KERNEL_ID(memory::USM, Scalar)
+  // reduced precision storage and integer input are only supported with USM
+  PORTFFT_GET_KERNEL_ID(memory::USM, sycl::half)
+  PORTFFT_GET_KERNEL_ID(memory::USM, sycl::ext::oneapi::bfloat16)
+  PORTFFT_GET_KERNEL_ID(memory::USM, std::int16_t)
+  PORTFFT_GET_KERNEL_ID(memory::USM, std::int8_t)
 #ifdef PORTFFT_ENABLE_BUFFER_BUILDS
-  try {
-    ids.push_back(sycl::get_kernel_id<Kernel<Scalar, Domain, memory::BUFFER, SubgroupSize>>());
-  } catch (...) {
-  }
+  PORTFFT_GET_KERNEL_ID(memory::BUFFER, Scalar)
 #endif
+#undef PORTFFT_GET_KERNEL_ID
 
   return ids;
 }
@@ -149,14 +156,16 @@ template <typename Scalar>
 std::vector<sycl::kernel_id> get_transpose_kernel_ids() {
   PORTFFT_LOG_FUNCTION_ENTRY();
   std::vector<sycl::kernel_id> ids;
-#define PORTFFT_GET_TRANSPOSE_KERNEL_ID(MEMORY)                               \
-  try {                                                                       \
-    ids.push_back(sycl::get_kernel_id<transpose_kernel<Scalar, (MEMORY)>>()); \
-  } catch (...) {                                                             \
+#define PORTFFT_GET_TRANSPOSE_KERNEL_ID(MEMORY, STORAGE)                               \
+  try {                                                                                \
+    ids.push_back(sycl::get_kernel_id<transpose_kernel<Scalar, (MEMORY), STORAGE>>()); \
+  } catch (...) {                                                                      \
   }
 
-  PORTFFT_GET_TRANSPOSE_KERNEL_ID(detail::memory::USM)
-  PORTFFT_GET_TRANSPOSE_KERNEL_ID(detail::memory::BUFFER)
+  PORTFFT_GET_TRANSPOSE_KERNEL_ID(detail::memory::USM, Scalar)
+  PORTFFT_GET_TRANSPOSE_KERNEL_ID(detail::memory::USM, sycl::half)
+  PORTFFT_GET_TRANSPOSE_KERNEL_ID(detail::memory::USM, sycl::ext::oneapi::bfloat16)
+  PORTFFT_GET_TRANSPOSE_KERNEL_ID(detail::memory::BUFFER, Scalar)
 #undef PORTFFT_GET_TRANSPOSE_KERNEL_ID
   return ids;
 }
@@ -191,6 +200,42 @@ PORTFFT_INLINE constexpr const sycl::specialization_id<Scalar>& get_spec_constan
   }
 }
 
+/**
+ * Function to get the integer input scale specialization constant.
+ * @tparam Scalar Scalar type associated with the committed descriptor
+ * @return sycl::specialization_id
+ */
+template <typename Scalar>
+PORTFFT_INLINE constexpr const sycl::specialization_id<Scalar>& get_spec_constant_integer_input_scale() {
+  if constexpr (std::is_same_v<Scalar, float>) {
+    return detail::SpecConstIntegerInputScaleFloat;
+  } else {
+    return detail::SpecConstIntegerInputScaleDouble;
+  }
+}
+
+/**
+ * Folds the conversion scale of integer input into the scale factor applied to the result of the computation. The
+ * DFT is linear, so this is equivalent to scaling the values as they are loaded, without adding work to the load path.
+ * Does nothing for non-integer input.
+ *
+ * @tparam TIn type of the real values stored in the input
+ * @tparam T type of the scalar used for computations
+ * @param kh kernel handler associated with the kernel launch
+ * @param apply_scale whether the scale factor needs to be applied. Updated in place.
+ * @param scaling_factor scale factor to apply to the result. Updated in place.
+ */
+template <typename TIn, typename T>
+PORTFFT_INLINE void fold_integer_input_scale(sycl::kernel_handler& kh, apply_scale_factor& apply_scale,
+                                             T& scaling_factor) {
+  if constexpr (std::is_integral_v<TIn>) {
+    T integer_input_scale = kh.get_specialization_constant<get_spec_constant_integer_input_scale<T>()>();
+    scaling_factor = apply_scale == apply_scale_factor::APPLIED ? scaling_factor * integer_input_scale
+                                                                : integer_input_scale;
+    apply_scale = apply_scale_factor::APPLIED;
+  }
+}
+
 /**
  * Return the default strides for a given dft size
  *
@@ -263,6 +308,37 @@ inline IdxGlobal get_bluestein_padded_size(IdxGlobal input_size) {
   return static_cast<IdxGlobal>(std::pow(2, ceil(std::log2(2 * input_size))));
 }
 
+/**
+ * Gets the alignment, in scalars, of the local memory slots a kernel splits its local memory allocation into, so that
+ * each slot can be accessed with vector loads.
+ * @tparam Scalar type of the scalar used for computations
+ * @return alignment in scalars
+ */
+template <typename Scalar>
+constexpr std::size_t local_slot_alignment() {
+  return std::max<std::size_t>(1, PORTFFT_VEC_LOAD_BYTES / sizeof(Scalar));
+}
+
+/**
+ * Decides whether a kernel should double buffer its data in local memory, loading the next batches into a second
+ * local memory slot while the current ones are computed.
+ * @tparam Scalar type of the scalar used for computations
+ * @param local_scalars_with_prefetch number of scalars of local memory the kernel uses with the second slot
+ * @param local_memory_size local memory available on the device, in bytes
+ * @param n_transforms number of transforms computed by the kernel
+ * @param n_transforms_per_iteration number of transforms all the workgroups compute in one iteration of their loop
+ * @return true if the kernel should prefetch
+ */
+template <typename Scalar>
+bool use_local_prefetch(std::size_t local_scalars_with_prefetch, Idx local_memory_size, IdxGlobal n_transforms,
+                        IdxGlobal n_transforms_per_iteration) {
+  if (!PORTFFT_LOCAL_DOUBLE_BUFFERING || n_transforms <= n_transforms_per_iteration) {
+    // every workgroup runs at most one iteration, so there is nothing to prefetch
+    return false;
+  }
+  return local_scalars_with_prefetch * sizeof(Scalar) <= static_cast<std::size_t>(local_memory_size);
+}
+
 }  // namespace detail
 }  // namespace portfft
 #endif
@@ -0,0 +1,359 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_WISDOM_HPP
+#define PORTFFT_WISDOM_HPP
+
+#include <sycl/sycl.hpp>
+
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "common/exceptions.hpp"
+#include "defines.hpp"
+#include "enums.hpp"
+
+namespace portfft {
+
+/**
+ * Decisions made at commit for one of the kernels computing a dimension.
+ */
+struct wisdom_kernel {
+  detail::level level = detail::level::WORKITEM;
+  std::vector<Idx> factors;
+  // subgroups per workgroup for each input layout, indexed by `detail::layout`. The local memory is derived from it at
+  // commit. Not recorded for the kernels of the global implementation, which derive it from the factors.
+  std::array<Idx, 3> num_sgs_per_wg{};
+};
+
+/**
+ * Decisions made at commit for one dimension of the transform, or for all of them if they are computed by the
+ * multi-dimensional kernel.
+ */
+struct wisdom_dimension {
+  detail::level level = detail::level::WORKITEM;
+  // size of the DFT computed, larger than the committed length if Bluestein algorithm is used
+  std::size_t fft_size = 0;
+  Idx subgroup_size = 0;
+  // only used by the global implementation, 0 to choose it at commit
+  Idx num_batches_in_l2 = 0;
+  std::vector<wisdom_kernel> kernels;
+};
+
+/**
+ * Plan decisions recorded for a descriptor shape on a device. The shape is made of the scalar type, the domain, the
+ * lengths, the number of transforms, the placement, the complex storage and the layouts of the data.
+ */
+struct wisdom_entry {
+  std::string device;
+  std::string scalar;
+  domain dom = domain::COMPLEX;
+  std::vector<std::size_t> lengths;
+  std::size_t number_of_transforms = 1;
+  placement place = placement::OUT_OF_PLACE;
+  complex_storage storage = complex_storage::INTERLEAVED_COMPLEX;
+  // layout of the data in forward and backward domain
+  std::array<detail::layout, 2> layouts{detail::layout::PACKED, detail::layout::PACKED};
+  std::vector<wisdom_dimension> dimensions;
+
+  /**
+   * Whether the entry is for the same device and descriptor shape as the other one.
+   *
+   * @param other entry to compare with
+   */
+  bool same_key(const wisdom_entry& other) const {
+    return device == other.device && scalar == other.scalar && dom == other.dom && lengths == other.lengths &&
+           number_of_transforms == other.number_of_transforms && place == other.place && storage == other.storage &&
+           layouts == other.layouts;
+  }
+};
+
+namespace detail {
+
+/**
+ * Get the string identifying a device in wisdom. Plans are only reused on the same device with the same driver.
+ *
+ * @param dev device
+ */
+inline std::string get_wisdom_device_key(const sycl::device& dev) {
+  return dev.get_info<sycl::info::device::vendor>() + "/" + dev.get_info<sycl::info::device::name>() + "/" +
+         dev.get_info<sycl::info::device::driver_version>();
+}
+
+/**
+ * Get the name of the scalar type in wisdom.
+ *
+ * @tparam Scalar type of the scalar used for computations
+ */
+template <typename Scalar>
+constexpr const char* get_wisdom_scalar_name() {
+  return std::is_same_v<Scalar, float> ? "float" : "double";
+}
+
+constexpr std::array<const char*, 5> WisdomLevelNames{"workitem", "subgroup", "workgroup", "global", "multi_dim"};
+
+/**
+ * Parses the name of an implementation level in wisdom.
+ *
+ * @param name name of the level
+ */
+inline level parse_wisdom_level(const std::string& name) {
+  for (std::size_t i = 0; i < WisdomLevelNames.size(); i++) {
+    if (name == WisdomLevelNames[i]) {
+      return static_cast<level>(i);
+    }
+  }
+  throw invalid_configuration("Unknown level in wisdom: ", name);
+}
+
+constexpr std::array<const char*, 3> WisdomLayoutNames{"packed", "unpacked", "batch_interleaved"};
+
+/**
+ * Parses the name of a data layout in wisdom.
+ *
+ * @param name name of the layout
+ */
+inline layout parse_wisdom_layout(const std::string& name) {
+  for (std::size_t i = 0; i < WisdomLayoutNames.size(); i++) {
+    if (name == WisdomLayoutNames[i]) {
+      return static_cast<layout>(i);
+    }
+  }
+  throw invalid_configuration("Unknown layout in wisdom: ", name);
+}
+
+}  // namespace detail
+
+/**
+ * Plan decisions recorded per device and descriptor shape: the implementation level, the factors and subgroup size of
+ * each kernel, the number of batches the global implementation keeps in the last level cache and the number of
+ * subgroups per workgroup of the kernels. Wisdom is exported from committed descriptors with
+ * `committed_descriptor::export_wisdom` and can be passed to `descriptor::commit`, which then applies the recorded
+ * decisions instead of choosing them.
+ *
+ * The text format written by `serialize` is line based and can be edited by hand:
+ * @code
+ * portfft_wisdom 2
+ * entry <scalar> <complex|real> <number_of_transforms> <in_place|out_of_place> <interleaved|split>
+ *       <forward_layout> <backward_layout> <n_lengths> <lengths...>
+ * device <vendor/name/driver_version>
+ * dimension <level> <fft_size> <subgroup_size> <num_batches_in_l2> <n_kernels>
+ * kernel <level> <n_factors> <factors...> <num_sgs_per_wg for PACKED, UNPACKED, BATCH_INTERLEAVED>
+ * end
+ * @endcode
+ */
+class wisdom {
+ public:
+  /**
+   * Adds an entry, replacing the entry for the same device and descriptor shape if there is one.
+   *
+   * @param entry entry to add
+   */
+  void add(const wisdom_entry& entry) {
+    for (wisdom_entry& existing : entries) {
+      if (existing.same_key(entry)) {
+        existing = entry;
+        return;
+      }
+    }
+    entries.push_back(entry);
+  }
+
+  /**
+   * Adds all the entries of other wisdom, replacing the entries for the same device and descriptor shape.
+   *
+   * @param other wisdom to merge into this one
+   */
+  void merge(const wisdom& other) {
+    for (const wisdom_entry& entry : other.entries) {
+      add(entry);
+    }
+  }
+
+  /**
+   * Finds the entry for a device and descriptor shape.
+   *
+   * @param key entry with the device and the descriptor shape to look for
+   * @return pointer to the entry or nullptr if there is none
+   */
+  const wisdom_entry* find(const wisdom_entry& key) const {
+    for (const wisdom_entry& entry : entries) {
+      if (entry.same_key(key)) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  /**
+   * Get the entries of the wisdom.
+   */
+  const std::vector<wisdom_entry>& get_entries() const noexcept { return entries; }
+
+  /**
+   * Writes the wisdom in its text format.
+   */
+  std::string serialize() const {
+    std::ostringstream ss;
+    ss << "portfft_wisdom " << FormatVersion << "\n";
+    for (const wisdom_entry& entry : entries) {
+      ss << "entry " << entry.scalar << " " << (entry.dom == domain::COMPLEX ? "complex" : "real") << " "
+         << entry.number_of_transforms << " " << (entry.place == placement::IN_PLACE ? "in_place" : "out_of_place")
+         << " " << (entry.storage == complex_storage::SPLIT_COMPLEX ? "split" : "interleaved") << " "
+         << layout_name(entry.layouts[0]) << " " << layout_name(entry.layouts[1]) << " " << entry.lengths.size();
+      for (std::size_t length : entry.lengths) {
+        ss << " " << length;
+      }
+      ss << "\ndevice " << entry.device << "\n";
+      for (const wisdom_dimension& dimension : entry.dimensions) {
+        ss << "dimension " << level_name(dimension.level) << " " << dimension.fft_size << " "
+           << dimension.subgroup_size << " " << dimension.num_batches_in_l2 << " " << dimension.kernels.size() << "\n";
+        for (const wisdom_kernel& kernel : dimension.kernels) {
+          ss << "kernel " << level_name(kernel.level) << " " << kernel.factors.size();
+          for (Idx factor : kernel.factors) {
+            ss << " " << factor;
+          }
+          for (Idx num_sgs_per_wg : kernel.num_sgs_per_wg) {
+            ss << " " << num_sgs_per_wg;
+          }
+          ss << "\n";
+        }
+      }
+      ss << "end\n";
+    }
+    return ss.str();
+  }
+
+  /**
+   * Reads wisdom written by `serialize`.
+   *
+   * @param text wisdom in its text format
+   * @return the wisdom read
+   */
+  static wisdom deserialize(const std::string& text) {
+    std::istringstream lines(text);
+    std::string line;
+    std::string tag;
+    int version = 0;
+    if (!std::getline(lines, line) || !(std::istringstream(line) >> tag >> version) || tag != "portfft_wisdom" ||
+        version != FormatVersion) {
+      throw invalid_configuration("Wisdom does not start with a supported header");
+    }
+    wisdom res;
+    wisdom_entry entry;
+    bool in_entry = false;
+    // number of kernels the last dimension was declared with
+    std::size_t n_kernels = 0;
+    // the counts are not trusted for allocating, the values are read one by one until the line runs out
+    auto check_kernel_count = [&]() {
+      if (!entry.dimensions.empty() && entry.dimensions.back().kernels.size() != n_kernels) {
+        throw invalid_configuration("Wisdom declares ", n_kernels, " kernels for a dimension with ",
+                                    entry.dimensions.back().kernels.size());
+      }
+    };
+    while (std::getline(lines, line)) {
+      std::istringstream ss(line);
+      if (!(ss >> tag)) {
+        continue;
+      }
+      if (tag == "entry") {
+        std::string dom;
+        std::string place;
+        std::string storage;
+        std::string forward_layout;
+        std::string backward_layout;
+        std::size_t n_lengths = 0;
+        entry = wisdom_entry{};
+        ss >> entry.scalar >> dom >> entry.number_of_transforms >> place >> storage >> forward_layout >>
+            backward_layout >> n_lengths;
+        if (ss.fail()) {
+          throw invalid_configuration("Malformed line in wisdom: ", line);
+        }
+        entry.dom = dom == "real" ? domain::REAL : domain::COMPLEX;
+        entry.place = place == "in_place" ? placement::IN_PLACE : placement::OUT_OF_PLACE;
+        entry.storage = storage == "split" ? complex_storage::SPLIT_COMPLEX : complex_storage::INTERLEAVED_COMPLEX;
+        entry.layouts = {detail::parse_wisdom_layout(forward_layout), detail::parse_wisdom_layout(backward_layout)};
+        std::size_t length = 0;
+        for (std::size_t i = 0; i < n_lengths && ss >> length; i++) {
+          entry.lengths.push_back(length);
+        }
+        in_entry = true;
+      } else if (tag == "device" && in_entry) {
+        // the device name may contain spaces, it is the rest of the line
+        std::getline(ss >> std::ws, entry.device);
+      } else if (tag == "dimension" && in_entry) {
+        check_kernel_count();
+        wisdom_dimension dimension;
+        std::string level;
+        ss >> level >> dimension.fft_size >> dimension.subgroup_size >> dimension.num_batches_in_l2 >> n_kernels;
+        dimension.level = detail::parse_wisdom_level(level);
+        entry.dimensions.push_back(dimension);
+      } else if (tag == "kernel" && in_entry && !entry.dimensions.empty()) {
+        wisdom_kernel kernel;
+        std::string level;
+        std::size_t n_factors = 0;
+        ss >> level >> n_factors;
+        kernel.level = detail::parse_wisdom_level(level);
+        Idx factor = 0;
+        for (std::size_t i = 0; i < n_factors && ss >> factor; i++) {
+          kernel.factors.push_back(factor);
+        }
+        for (Idx& num_sgs_per_wg : kernel.num_sgs_per_wg) {
+          ss >> num_sgs_per_wg;
+        }
+        if (entry.dimensions.back().kernels.size() == n_kernels) {
+          throw invalid_configuration("Wisdom has more kernels than declared for a dimension");
+        }
+        entry.dimensions.back().kernels.push_back(kernel);
+      } else if (tag == "end" && in_entry) {
+        check_kernel_count();
+        res.add(entry);
+        in_entry = false;
+        continue;
+      } else {
+        throw invalid_configuration("Unexpected line in wisdom: ", line);
+      }
+      if (ss.fail()) {
+        throw invalid_configuration("Malformed line in wisdom: ", line);
+      }
+    }
+    if (in_entry) {
+      throw invalid_configuration("Wisdom ends in the middle of an entry");
+    }
+    return res;
+  }
+
+ private:
+  static constexpr int FormatVersion = 2;
+
+  static const char* level_name(detail::level l) { return detail::WisdomLevelNames[static_cast<std::size_t>(l)]; }
+
+  static const char* layout_name(detail::layout l) { return detail::WisdomLayoutNames[static_cast<std::size_t>(l)]; }
+
+  std::vector<wisdom_entry> entries;
+};
+
+}  // namespace portfft
+
+#endif  // PORTFFT_WISDOM_HPP
@@ -0,0 +1,101 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <chrono>
+#include <complex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <portfft/portfft.hpp>
+
+#include "utils/bench_utils.hpp"
+#include "utils/device_context.hpp"
+
+using ftype = float;
+
+/**
+ * Measures the time of forward FFTs computed with compute_forward or by replaying a recorded computation, from the call
+ * until the computation completes. Run on a CPU device (for example with `ONEAPI_DEVICE_SELECTOR=opencl:cpu`) the
+ * submission cost of the many kernels of the global implementation is a large part of it.
+ *
+ * @param state GBench state
+ * @param q Queue to use
+ * @param lengths lengths of the FFT
+ * @param replay whether to replay a recorded computation rather than calling compute_forward
+ */
+void bench_graph_impl(benchmark::State& state, sycl::queue q, const std::vector<std::size_t>& lengths, bool replay) {
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc(lengths);
+  auto committed = desc.commit(q);
+  const std::size_t size = desc.get_flattened_length();
+  auto in = make_shared<std::complex<ftype>>(size, q);
+  auto out = make_shared<std::complex<ftype>>(size, q);
+  const std::complex<ftype>* in_ptr = in.get();
+  std::complex<ftype>* out_ptr = out.get();
+  portfft::recorded_compute recorded = committed.record_forward(in_ptr, out_ptr);
+  // warmup
+  committed.compute_forward(in_ptr, out_ptr).wait();
+  recorded.replay().wait();
+
+  for (auto _ : state) {
+    auto start = std::chrono::steady_clock::now();
+    sycl::event e = replay ? recorded.replay() : committed.compute_forward(in_ptr, out_ptr);
+    e.wait();
+    auto end = std::chrono::steady_clock::now();
+    state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+  }
+  state.counters["uses_graph"] = replay && recorded.uses_graph() ? 1 : 0;
+}
+
+/**
+ * Separate impl function to handle catching exceptions
+ * @see bench_graph_impl
+ */
+void bench_graph(benchmark::State& state, sycl::queue q, const std::vector<std::size_t>& lengths, bool replay) {
+  try {
+    bench_graph_impl(state, q, lengths, replay);
+  } catch (std::exception& e) {
+    handle_exception(state, e);
+  }
+}
+
+int main(int argc, char** argv) {
+  benchmark::SetDefaultTimeUnit(benchmark::kMicrosecond);
+  benchmark::Initialize(&argc, argv);
+
+  sycl::queue q;
+  add_device_context(q);
+
+  // a workgroup level size with a single kernel, global level sizes with several kernels per factor and a 2D size with a
+  // kernel per dimension
+  const std::vector<std::pair<std::string, std::vector<std::size_t>>> configs{
+      {"4096", {4096}}, {"65536", {65536}}, {"1048576", {1048576}}, {"128x128", {128, 128}}};
+  for (const auto& [name, lengths] : configs) {
+    for (bool replay : {false, true}) {
+      std::string bench_name = std::string(replay ? "replay" : "compute") + "/size=" + name;
+      benchmark::RegisterBenchmark(bench_name.c_str(), bench_graph, q, lengths, replay)->UseManualTime();
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,140 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <portfft/common/local_padding.hpp>
+#include <portfft/common/memory_views.hpp>
+
+#include "utils/bench_utils.hpp"
+#include "utils/device_context.hpp"
+
+using ftype = float;
+
+class local_padding_kernel;
+
+/**
+ * Measures the device time of work-items reading their own rows of a row-major matrix in padded local memory, which
+ * is the access pattern the padding is chosen for.
+ *
+ * @param state GBench state
+ * @param q Queue to use, \p enable_profiling property must be set
+ * @param row_size number of scalars in each row
+ * @param n_banks number of local memory banks used for the padding
+ * @param bank_lines_per_pad padding parameter, 0 for no padding
+ */
+void bench_local_padding_impl(benchmark::State& state, sycl::queue q, portfft::Idx row_size, portfft::Idx n_banks,
+                              portfft::Idx bank_lines_per_pad) {
+  using portfft::Idx;
+  constexpr Idx WgSize = 32;
+  constexpr Idx NIterations = 256;
+  const Idx n_elements = WgSize * row_size;
+  const std::size_t local_size =
+      static_cast<std::size_t>(portfft::detail::pad_local(n_elements, bank_lines_per_pad, n_banks));
+  if (local_size * sizeof(ftype) > q.get_device().get_info<sycl::info::device::local_mem_size>()) {
+    state.SkipWithError("Not enough local memory");
+    return;
+  }
+  const std::size_t n_wgs = 4 * q.get_device().get_info<sycl::info::device::max_compute_units>();
+  const std::size_t global_size = n_wgs * static_cast<std::size_t>(WgSize);
+  auto out = make_shared<ftype>(global_size, q);
+  ftype* out_ptr = out.get();
+
+  auto run = [&]() {
+    return q.submit([&](sycl::handler& cgh) {
+      sycl::local_accessor<ftype, 1> loc(local_size, cgh);
+      cgh.parallel_for<local_padding_kernel>(
+          sycl::nd_range<1>{{global_size}, {static_cast<std::size_t>(WgSize)}}, [=](sycl::nd_item<1> it) {
+            Idx local_id = static_cast<Idx>(it.get_local_linear_id());
+            auto loc_view = portfft::detail::padded_view(&loc[0], bank_lines_per_pad, n_banks);
+            for (Idx i = local_id; i < n_elements; i += WgSize) {
+              loc_view[i] = static_cast<ftype>(i);
+            }
+            sycl::group_barrier(it.get_group());
+            ftype sum = 0;
+            for (Idx i = 0; i < NIterations; i++) {
+              for (Idx j = 0; j < row_size; j++) {
+                sum += loc_view[local_id * row_size + j];
+              }
+            }
+            out_ptr[it.get_global_linear_id()] = sum;
+          });
+    });
+  };
+  // warmup
+  run().wait();
+
+  for (auto _ : state) {
+    sycl::event e = run();
+    e.wait();
+    auto start = e.get_profiling_info<sycl::info::event_profiling::command_start>();
+    auto end = e.get_profiling_info<sycl::info::event_profiling::command_end>();
+    double elapsed_seconds = static_cast<double>(end - start) / 1e9;
+    double bytes_read = static_cast<double>(global_size) * NIterations * row_size * sizeof(ftype);
+    state.counters["local_throughput"] = bytes_read / elapsed_seconds;
+    state.SetIterationTime(elapsed_seconds);
+  }
+}
+
+/**
+ * Separate impl function to handle catching exceptions
+ * @see bench_local_padding_impl
+ */
+void bench_local_padding(benchmark::State& state, sycl::queue q, portfft::Idx row_size, portfft::Idx n_banks,
+                         portfft::Idx bank_lines_per_pad) {
+  try {
+    bench_local_padding_impl(state, q, row_size, n_banks, bank_lines_per_pad);
+  } catch (std::exception& e) {
+    handle_exception(state, e);
+  }
+}
+
+int main(int argc, char** argv) {
+  using portfft::Idx;
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  benchmark::Initialize(&argc, argv);
+
+  sycl::queue q;
+  sycl::queue profiling_q({sycl::property::queue::enable_profiling()});
+  add_device_context(q);
+  Idx n_banks = portfft::detail::get_local_banks(q);
+  benchmark::AddCustomContext("Local memory banks", std::to_string(n_banks));
+
+  // Row sizes, in scalars, that are multiples of the bank line, fractions of it and neither.
+  // "fixed" is the padding used before it was chosen for the device: one pad per row for multiples of a 32 bank line
+  // and one pad per bank line otherwise.
+  for (Idx row_size : {16, 24, 32, 48, 64, 96, 128, 256}) {
+    Idx fixed = row_size % 32 == 0 ? row_size / 32 : 1;
+    Idx chosen = portfft::detail::choose_bank_lines_per_pad<ftype>(row_size, n_banks);
+    std::string prefix = "local_padding/row=" + std::to_string(row_size);
+    benchmark::RegisterBenchmark((prefix + "/unpadded").c_str(), bench_local_padding, profiling_q, row_size, 32, 0)
+        ->UseManualTime();
+    benchmark::RegisterBenchmark((prefix + "/fixed").c_str(), bench_local_padding, profiling_q, row_size, 32, fixed)
+        ->UseManualTime();
+    benchmark::RegisterBenchmark((prefix + "/chosen_" + std::to_string(chosen)).c_str(), bench_local_padding,
+                                 profiling_q, row_size, n_banks, chosen)
+        ->UseManualTime();
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <portfft/portfft.hpp>
+
+#include "utils/bench_utils.hpp"
+#include "utils/device_context.hpp"
+
+using ftype = float;
+
+// number of heap allocations made by the host, including the ones of the SYCL runtime
+std::atomic<std::size_t> n_allocations{0};
+
+void* operator new(std::size_t size) {
+  n_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+
+/**
+ * Measures the host time of a call to compute_forward, from the call until the kernel is submitted, and the number of
+ * host allocations made by it. The device time is not included, each computation is waited for outside of the
+ * measured time.
+ *
+ * @param state GBench state
+ * @param q Queue to use
+ * @param lengths lengths of the FFT
+ * @param batch number of transforms
+ */
+void bench_submission_impl(benchmark::State& state, sycl::queue q, const std::vector<std::size_t>& lengths,
+                           std::size_t batch) {
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc(lengths);
+  desc.number_of_transforms = batch;
+  auto committed = desc.commit(q);
+  const std::size_t size = desc.get_flattened_length() * batch;
+  auto in = make_shared<std::complex<ftype>>(size, q);
+  auto out = make_shared<std::complex<ftype>>(size, q);
+  const std::complex<ftype>* in_ptr = in.get();
+  std::complex<ftype>* out_ptr = out.get();
+  // warmup
+  committed.compute_forward(in_ptr, out_ptr).wait();
+
+  std::size_t total_allocations = 0;
+  for (auto _ : state) {
+    std::size_t allocations_before = n_allocations.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    sycl::event e = committed.compute_forward(in_ptr, out_ptr);
+    auto end = std::chrono::steady_clock::now();
+    total_allocations += n_allocations.load(std::memory_order_relaxed) - allocations_before;
+    e.wait();
+    state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+  }
+  state.counters["allocations_per_call"] =
+      benchmark::Counter(static_cast<double>(total_allocations), benchmark::Counter::kAvgIterations);
+}
+
+/**
+ * Separate impl function to handle catching exceptions
+ * @see bench_submission_impl
+ */
+void bench_submission(benchmark::State& state, sycl::queue q, const std::vector<std::size_t>& lengths,
+                      std::size_t batch) {
+  try {
+    bench_submission_impl(state, q, lengths, batch);
+  } catch (std::exception& e) {
+    handle_exception(state, e);
+  }
+}
+
+int main(int argc, char** argv) {
+  benchmark::SetDefaultTimeUnit(benchmark::kMicrosecond);
+  benchmark::Initialize(&argc, argv);
+
+  sycl::queue q;
+  add_device_context(q);
+
+  // small single transforms, whose device time is short enough for the host overhead of a call to matter
+  for (std::size_t size : {64, 256, 4096}) {
+    std::string name = "submission/size=" + std::to_string(size) + "/batch=1";
+    benchmark::RegisterBenchmark(name.c_str(), bench_submission, q, std::vector<std::size_t>{size}, 1)
+        ->UseManualTime();
+  }
+  benchmark::RegisterBenchmark("submission/size=8x8/batch=1", bench_submission, q, std::vector<std::size_t>{8, 8}, 1)
+      ->UseManualTime();
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <string>
+
+#include <portfft/traits.hpp>
+
+#include "launch_bench.hpp"
+#include "utils/device_context.hpp"
+
+template <typename T>
+void bench_dft(sycl::queue q, sycl::queue profiling_q, const std::string& suffix,
+               const std::vector<std::size_t>& lengths, std::size_t batch) {
+  using ftype = typename portfft::get_real<T>::type;
+  constexpr portfft::domain domain = portfft::get_domain<T>::value;
+
+  portfft::descriptor<ftype, domain> desc(lengths);
+  desc.number_of_transforms = batch;
+
+  register_host_device_benchmark(suffix, q, profiling_q, desc);
+}
+
+int main(int argc, char** argv) {
+  using ftype = float;
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  benchmark::Initialize(&argc, argv);
+
+  sycl::queue q;
+  sycl::queue profiling_q({sycl::property::queue::enable_profiling()});
+  add_device_context(q);
+
+  // Sizes computed by a single work-item. The prime sizes are the ones that benefit the most from the generated
+  // codelets, compare with a build using -DPORTFFT_WI_CODELETS=OFF.
+  // The batch is chosen so all the sizes process as many elements as the small_1d configuration of bench_float.
+  constexpr std::size_t NElements = 128 * 1024 * 1024;
+  for (std::size_t size : {7, 11, 13, 17, 31}) {
+    bench_dft<std::complex<ftype>>(q, profiling_q, "prime_" + std::to_string(size), {size}, NElements / size);
+  }
+  for (std::size_t size : {8, 12, 16, 28}) {
+    bench_dft<std::complex<ftype>>(q, profiling_q, "composite_" + std::to_string(size), {size}, NElements / size);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,74 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_TEST_COMMON_COMPARE_TO_REFERENCE_HPP
+#define PORTFFT_TEST_COMMON_COMPARE_TO_REFERENCE_HPP
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+/**
+ * Default tolerance of `compare_to_reference`, relative to the largest magnitude of the reference.
+ *
+ * @tparam Scalar type of the scalar the result was computed in
+ */
+template <typename Scalar>
+constexpr double default_reference_tolerance = 64 * static_cast<double>(std::numeric_limits<Scalar>::epsilon());
+
+/**
+ * Compares the result of FFTs to a reference computed in double precision. The largest error must be within
+ * `tolerance` times the largest magnitude of the reference, as the error of an FFT is spread evenly over its output.
+ *
+ * @tparam Scalar type of the scalar of the result
+ * @param actual the result to check
+ * @param reference the expected result
+ * @param n_elements number of complex values to compare
+ * @param tolerance allowed error relative to the largest magnitude of the reference
+ * @return success if the result is within the tolerance, otherwise a failure with the largest error
+ */
+template <typename Scalar>
+testing::AssertionResult compare_to_reference(const std::complex<Scalar>* actual,
+                                              const std::complex<double>* reference, std::size_t n_elements,
+                                              double tolerance = default_reference_tolerance<Scalar>) {
+  double max_error = 0;
+  double max_value = 0;
+  std::size_t max_error_idx = 0;
+  for (std::size_t i = 0; i < n_elements; i++) {
+    const std::complex<double> val(static_cast<double>(actual[i].real()), static_cast<double>(actual[i].imag()));
+    const double error = std::abs(val - reference[i]);
+    if (error > max_error) {
+      max_error = error;
+      max_error_idx = i;
+    }
+    max_value = std::max(max_value, std::abs(reference[i]));
+  }
+  if (max_error <= tolerance * max_value) {
+    return testing::AssertionSuccess();
+  }
+  return testing::AssertionFailure() << "largest error " << max_error << " at index " << max_error_idx << ", ref "
+                                     << reference[max_error_idx] << " vs " << actual[max_error_idx]
+                                     << ", allowed error " << tolerance * max_value;
+}
+
+#endif  // PORTFFT_TEST_COMMON_COMPARE_TO_REFERENCE_HPP
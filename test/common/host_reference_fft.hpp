@@ -0,0 +1,398 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#ifndef PORTFFT_COMMON_HOST_REFERENCE_FFT_HPP
+#define PORTFFT_COMMON_HOST_REFERENCE_FFT_HPP
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <portfft/common/host_dft.hpp>
+
+/*
+Host reference FFT used to generate the expected results of tests and benchmarks. All the computations are done in
+double precision regardless of the precision being tested.
+
+A multi-dimensional transform is done one dimension at a time, starting from the innermost one. The 1D transforms along
+a dimension are done `Lanes` lines at a time: the lines are gathered into split real and imaginary arrays with the
+lanes innermost, so that every arithmetic operation is a loop of `Lanes` independent iterations the compiler can
+vectorize. Groups of lines are distributed over the host threads.
+
+Sizes with only small prime factors use the self-sorting Stockham algorithm. Sizes with a large prime factor use
+Bluestein's algorithm with a power of two Stockham transform, so that the cost is O(n log n) for any size.
+*/
+
+namespace host_reference {
+
+/// Number of lines transformed together, 8 doubles fill the widest common SIMD registers
+constexpr std::size_t Lanes = 8;
+
+/// Prime factors larger than this are handled with Bluestein's algorithm
+constexpr std::size_t MaxStockhamRadix = 64;
+
+/**
+ * Runs `func(begin, end)` on contiguous chunks of [0, n) on all the host threads.
+ *
+ * @tparam F type of the function
+ * @param n number of iterations
+ * @param func function to run
+ */
+template <typename F>
+void parallel_for(std::size_t n, F func) {
+  std::size_t n_threads = std::max(1U, std::thread::hardware_concurrency());
+  n_threads = std::min(n_threads, n);
+  if (n_threads <= 1) {
+    func(std::size_t(0), n);
+    return;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(n_threads);
+  for (std::size_t i = 0; i < n_threads; i++) {
+    threads.emplace_back(func, n * i / n_threads, n * (i + 1) / n_threads);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+/**
+ * Forward 1D DFT of `Lanes` lines at once. The data of element `i` of lane `l` is at `re[i * Lanes + l]` and
+ * `im[i * Lanes + l]`. The twiddles and the Bluestein chirp are calculated once in the constructor so a plan can be
+ * shared by all the threads, each of which provides its own workspace.
+ */
+class fft_plan {
+ public:
+  /**
+   * Constructor
+   *
+   * @param size size of the DFT
+   */
+  explicit fft_plan(std::size_t size) : fft_size(size) {
+    std::size_t remaining = size;
+    for (std::size_t radix = 2; remaining > 1; radix++) {
+      if (radix * radix > remaining) {
+        radix = remaining;
+      }
+      for (; remaining % radix == 0; remaining /= radix) {
+        radices.push_back(radix);
+      }
+    }
+    if (!radices.empty()) {
+      max_radix = *std::max_element(radices.begin(), radices.end());
+    }
+    if (max_radix > MaxStockhamRadix) {
+      init_bluestein();
+      return;
+    }
+    std::vector<std::complex<double>> twiddles(fft_size);
+    portfft::detail::host_fft_twiddles(twiddles.data(), fft_size);
+    for (auto twiddle : twiddles) {
+      twiddles_re.push_back(twiddle.real());
+      twiddles_im.push_back(twiddle.imag());
+    }
+  }
+
+  /**
+   * Get the number of doubles of workspace needed by `execute`.
+   */
+  std::size_t workspace_size() const {
+    if (bluestein_plan) {
+      return 2 * Lanes * bluestein_plan->fft_size + bluestein_plan->workspace_size();
+    }
+    return 2 * Lanes * (fft_size + max_radix);
+  }
+
+  /**
+   * Computes the DFTs in place.
+   *
+   * @param re real parts of the lines
+   * @param im imaginary parts of the lines
+   * @param workspace pointer to `workspace_size()` doubles
+   */
+  void execute(double* re, double* im, double* workspace) const {
+    if (bluestein_plan) {
+      execute_bluestein(re, im, workspace);
+    } else {
+      execute_stockham(re, im, workspace);
+    }
+  }
+
+ private:
+  std::size_t fft_size;
+  std::vector<std::size_t> radices;
+  std::size_t max_radix = 1;
+  std::vector<double> twiddles_re;
+  std::vector<double> twiddles_im;
+  // Bluestein's algorithm: exp(-pi*i*k^2/fft_size), the DFT of the conjugate chirp scaled by 1/padded size and the
+  // power of two plan of the padded size.
+  std::vector<double> chirp_re;
+  std::vector<double> chirp_im;
+  std::vector<double> chirp_fft_re;
+  std::vector<double> chirp_fft_im;
+  std::unique_ptr<fft_plan> bluestein_plan;
+
+  void init_bluestein() {
+    std::size_t padded_size = 1;
+    while (padded_size < 2 * fft_size - 1) {
+      padded_size *= 2;
+    }
+    bluestein_plan = std::make_unique<fft_plan>(padded_size);
+    std::vector<std::complex<double>> twiddles(2 * fft_size);
+    portfft::detail::host_fft_twiddles(twiddles.data(), 2 * fft_size);
+    std::vector<double> b_re(Lanes * padded_size, 0);
+    std::vector<double> b_im(Lanes * padded_size, 0);
+    for (std::size_t k = 0; k < fft_size; k++) {
+      std::complex<double> chirp = twiddles[(k * k) % (2 * fft_size)];
+      chirp_re.push_back(chirp.real());
+      chirp_im.push_back(chirp.imag());
+      for (std::size_t idx : {k, (padded_size - k) % padded_size}) {
+        b_re[idx * Lanes] = chirp.real();
+        b_im[idx * Lanes] = -chirp.imag();
+      }
+    }
+    std::vector<double> workspace(bluestein_plan->workspace_size());
+    bluestein_plan->execute(b_re.data(), b_im.data(), workspace.data());
+    for (std::size_t i = 0; i < padded_size; i++) {
+      chirp_fft_re.push_back(b_re[i * Lanes] / static_cast<double>(padded_size));
+      chirp_fft_im.push_back(b_im[i * Lanes] / static_cast<double>(padded_size));
+    }
+  }
+
+  void execute_stockham(double* re, double* im, double* workspace) const {
+    double* x_re = re;
+    double* x_im = im;
+    double* y_re = workspace;
+    double* y_im = y_re + Lanes * fft_size;
+    double* butterfly_re = y_im + Lanes * fft_size;
+    double* butterfly_im = butterfly_re + Lanes * max_radix;
+    std::size_t n = fft_size;
+    std::size_t stride = 1;
+    // Each pass splits DFTs of size `n` into `radix` DFTs of size `n / radix`, with `stride` interleaved DFTs.
+    for (std::size_t radix : radices) {
+      std::size_t m = n / radix;
+      std::size_t radix_twiddle_step = fft_size / radix;
+      std::size_t twiddle_step = fft_size / n;
+      for (std::size_t p = 0; p < m; p++) {
+        for (std::size_t q = 0; q < stride; q++) {
+          for (std::size_t t = 0; t < radix; t++) {
+            std::size_t src = Lanes * (q + stride * (p + t * m));
+            for (std::size_t l = 0; l < Lanes; l++) {
+              butterfly_re[t * Lanes + l] = x_re[src + l];
+              butterfly_im[t * Lanes + l] = x_im[src + l];
+            }
+          }
+          for (std::size_t u = 0; u < radix; u++) {
+            double sum_re[Lanes];
+            double sum_im[Lanes];
+            for (std::size_t l = 0; l < Lanes; l++) {
+              sum_re[l] = butterfly_re[l];
+              sum_im[l] = butterfly_im[l];
+            }
+            for (std::size_t t = 1; t < radix; t++) {
+              std::size_t twiddle_idx = (radix_twiddle_step * t * u) % fft_size;
+              double w_re = twiddles_re[twiddle_idx];
+              double w_im = twiddles_im[twiddle_idx];
+              for (std::size_t l = 0; l < Lanes; l++) {
+                sum_re[l] += butterfly_re[t * Lanes + l] * w_re - butterfly_im[t * Lanes + l] * w_im;
+                sum_im[l] += butterfly_re[t * Lanes + l] * w_im + butterfly_im[t * Lanes + l] * w_re;
+              }
+            }
+            std::size_t twiddle_idx = twiddle_step * p * u;
+            double w_re = twiddles_re[twiddle_idx];
+            double w_im = twiddles_im[twiddle_idx];
+            std::size_t dst = Lanes * (q + stride * (radix * p + u));
+            for (std::size_t l = 0; l < Lanes; l++) {
+              y_re[dst + l] = sum_re[l] * w_re - sum_im[l] * w_im;
+              y_im[dst + l] = sum_re[l] * w_im + sum_im[l] * w_re;
+            }
+          }
+        }
+      }
+      std::swap(x_re, y_re);
+      std::swap(x_im, y_im);
+      stride *= radix;
+      n = m;
+    }
+    if (x_re != re) {
+      std::copy(x_re, x_re + Lanes * fft_size, re);
+      std::copy(x_im, x_im + Lanes * fft_size, im);
+    }
+  }
+
+  void execute_bluestein(double* re, double* im, double* workspace) const {
+    const std::size_t padded_size = bluestein_plan->fft_size;
+    double* a_re = workspace;
+    double* a_im = a_re + Lanes * padded_size;
+    double* inner_workspace = a_im + Lanes * padded_size;
+    std::fill(a_re, a_re + 2 * Lanes * padded_size, 0.0);
+    for (std::size_t k = 0; k < fft_size; k++) {
+      for (std::size_t l = 0; l < Lanes; l++) {
+        std::size_t i = k * Lanes + l;
+        a_re[i] = re[i] * chirp_re[k] - im[i] * chirp_im[k];
+        a_im[i] = re[i] * chirp_im[k] + im[i] * chirp_re[k];
+      }
+    }
+    bluestein_plan->execute(a_re, a_im, inner_workspace);
+    // multiply by the DFT of the conjugate chirp and conjugate, so that the forward DFT below is an inverse DFT
+    for (std::size_t k = 0; k < padded_size; k++) {
+      for (std::size_t l = 0; l < Lanes; l++) {
+        std::size_t i = k * Lanes + l;
+        double prod_re = a_re[i] * chirp_fft_re[k] - a_im[i] * chirp_fft_im[k];
+        double prod_im = a_re[i] * chirp_fft_im[k] + a_im[i] * chirp_fft_re[k];
+        a_re[i] = prod_re;
+        a_im[i] = -prod_im;
+      }
+    }
+    bluestein_plan->execute(a_re, a_im, inner_workspace);
+    for (std::size_t k = 0; k < fft_size; k++) {
+      for (std::size_t l = 0; l < Lanes; l++) {
+        std::size_t i = k * Lanes + l;
+        re[i] = a_re[i] * chirp_re[k] + a_im[i] * chirp_im[k];
+        im[i] = a_re[i] * chirp_im[k] - a_im[i] * chirp_re[k];
+      }
+    }
+  }
+};
+
+/**
+ * Computes forward DFTs of packed data with the batch as the outermost dimension, like numpy.fft.fftn (complex input)
+ * or numpy.fft.rfftn (real input) over all but the first axis. The result is unscaled.
+ *
+ * @tparam InType type of the input, either a real scalar or std::complex
+ * @param input `batches * product(lengths)` input values
+ * @param lengths lengths of the DFT
+ * @param batches number of DFTs
+ * @return the result in double precision. For real input the innermost dimension has `lengths.back() / 2 + 1`
+ * elements.
+ */
+template <typename InType>
+std::vector<std::complex<double>> forward_dft(const InType* input, const std::vector<std::size_t>& lengths,
+                                              std::size_t batches) {
+  constexpr bool IsReal = std::is_floating_point_v<InType>;
+  const std::size_t n_dims = lengths.size();
+  // output lengths
+  std::vector<std::size_t> out_lengths = lengths;
+  if (IsReal) {
+    out_lengths.back() = lengths.back() / 2 + 1;
+  }
+  std::size_t out_elements = batches;
+  for (std::size_t length : out_lengths) {
+    out_elements *= length;
+  }
+  std::vector<std::complex<double>> output(out_elements);
+
+  for (std::size_t dim = n_dims; dim-- > 0;) {
+    const bool first_pass = dim == n_dims - 1;
+    const std::size_t fft_size = lengths[dim];
+    const std::size_t out_size = out_lengths[dim];
+    // distance between the elements of a line in the source (input for the first pass) and in the output
+    std::size_t inner = 1;
+    for (std::size_t d = dim + 1; d < n_dims; d++) {
+      inner *= out_lengths[d];
+    }
+    const std::size_t n_lines = out_elements / out_size;
+    const std::size_t n_groups = (n_lines + Lanes - 1) / Lanes;
+    const fft_plan plan(fft_size);
+
+    parallel_for(n_groups, [&](std::size_t group_begin, std::size_t group_end) {
+      std::vector<double> re(Lanes * fft_size);
+      std::vector<double> im(Lanes * fft_size);
+      std::vector<double> workspace(plan.workspace_size());
+      for (std::size_t group = group_begin; group < group_end; group++) {
+        std::size_t line_begin = group * Lanes;
+        std::size_t group_lanes = std::min(Lanes, n_lines - line_begin);
+        // line `line` of the dimension starts at `outer * fft_size * inner + line % inner` with elements `inner` apart
+        auto line_start = [&](std::size_t line, std::size_t size) {
+          return (line / inner) * size * inner + line % inner;
+        };
+        std::fill(re.begin(), re.end(), 0.0);
+        std::fill(im.begin(), im.end(), 0.0);
+        for (std::size_t l = 0; l < group_lanes; l++) {
+          if (first_pass) {
+            const InType* src = input + line_start(line_begin + l, fft_size);
+            for (std::size_t i = 0; i < fft_size; i++) {
+              if constexpr (IsReal) {
+                re[i * Lanes + l] = static_cast<double>(src[i]);
+              } else {
+                re[i * Lanes + l] = static_cast<double>(src[i].real());
+                im[i * Lanes + l] = static_cast<double>(src[i].imag());
+              }
+            }
+          } else {
+            const std::complex<double>* src = output.data() + line_start(line_begin + l, out_size);
+            for (std::size_t i = 0; i < fft_size; i++) {
+              re[i * Lanes + l] = src[i * inner].real();
+              im[i * Lanes + l] = src[i * inner].imag();
+            }
+          }
+        }
+        plan.execute(re.data(), im.data(), workspace.data());
+        for (std::size_t l = 0; l < group_lanes; l++) {
+          std::complex<double>* dst = output.data() + line_start(line_begin + l, out_size);
+          for (std::size_t i = 0; i < out_size; i++) {
+            dst[i * inner] = {re[i * Lanes + l], im[i * Lanes + l]};
+          }
+        }
+      }
+    });
+  }
+  return output;
+}
+
+/**
+ * Generates deterministic pseudo-random values uniformly distributed in [-1, 1). The value of each element depends
+ * only on its index, so the generation can be done in parallel and gives the same data for any number of threads.
+ *
+ * @tparam T type of the values, either a real scalar or std::complex
+ * @param n_elements number of values to generate
+ * @return the values
+ */
+template <typename T>
+std::vector<T> generate_uniform(std::size_t n_elements) {
+  // splitmix64, mapped to [-1, 1) using the top 53 bits
+  auto uniform = [](std::uint64_t idx) {
+    std::uint64_t z = (idx + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return static_cast<double>(z >> 11) * 0x1.0p-52 - 1.0;
+  };
+  std::vector<T> res(n_elements);
+  parallel_for(n_elements, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++) {
+      if constexpr (std::is_floating_point_v<T>) {
+        res[i] = static_cast<T>(uniform(i));
+      } else {
+        using Scalar = typename T::value_type;
+        res[i] = T(static_cast<Scalar>(uniform(2 * i)), static_cast<Scalar>(uniform(2 * i + 1)));
+      }
+    }
+  });
+  return res;
+}
+
+}  // namespace host_reference
+
+#endif  // PORTFFT_COMMON_HOST_REFERENCE_FFT_HPP
@@ -21,20 +21,21 @@
 #ifndef PORTFFT_COMMON_REFERENCE_DATA_WRANGLER_HPP
 #define PORTFFT_COMMON_REFERENCE_DATA_WRANGLER_HPP
 
-#include <cerrno>
+#include <algorithm>
+#include <cassert>
 #include <complex>
-#include <cstdio>
 #include <exception>
+#include <functional>
 #include <iostream>
-#include <memory>
 #include <numeric>
-#include <sstream>
 #include <string>
 #include <vector>
 
 #include <portfft/descriptor.hpp>
 #include <portfft/enums.hpp>
 
+#include "host_reference_fft.hpp"
+
 // Used to create padding that is either a scalar or a complex value with equal real and imaginary parts.
 template <typename T>
 T padding_representation(float p) {
@@ -46,13 +47,47 @@ T padding_representation(float p) {
   }
 }
 
+/**
+ * Get the lengths of the packed data of a transform in the given direction. The backward data of real transforms only
+ * has the non-redundant half of the innermost dimension.
+ */
+template <typename Descriptor>
+std::vector<std::size_t> get_packed_lengths(const Descriptor& desc, portfft::direction dir) {
+  std::vector<std::size_t> lengths = desc.lengths;
+  if (Descriptor::Domain == portfft::domain::REAL && dir == portfft::direction::BACKWARD) {
+    lengths.back() = lengths.back() / 2 + 1;
+  }
+  return lengths;
+}
+
+/**
+ * Get the offsets of the elements of a single transform in the layout described by \p strides, in row-major order
+ * of the packed data.
+ */
+inline std::vector<std::size_t> get_element_offsets(const std::vector<std::size_t>& lengths,
+                                                    const std::vector<std::size_t>& strides) {
+  std::vector<std::size_t> offsets{0};
+  for (std::size_t d = 0; d < lengths.size(); d++) {
+    std::vector<std::size_t> next;
+    next.reserve(offsets.size() * lengths[d]);
+    for (std::size_t outer : offsets) {
+      for (std::size_t i = 0; i < lengths[d]; i++) {
+        next.push_back(outer + i * strides[d]);
+      }
+    }
+    offsets = std::move(next);
+  }
+  return offsets;
+}
+
 /**
  * Reshare the packed reference data to the layout specified in \p desc.
  */
 template <typename InType, typename Descriptor>
 std::vector<InType> reshape_to_desc(const std::vector<InType>& in, const Descriptor& desc,
                                     portfft::detail::layout layout, portfft::direction dir, float padding_value) {
-  const auto flat_len = desc.get_flattened_length();
+  const auto lengths = get_packed_lengths(desc, dir);
+  const auto flat_len = std::accumulate(lengths.cbegin(), lengths.cend(), std::size_t(1), std::multiplies<>());
 
   // assume we are starting with the packed format of the descriptor
   assert(in.size() == flat_len * desc.number_of_transforms);
@@ -65,22 +100,16 @@ std::vector<InType> reshape_to_desc(const std::vector<InType>& in, const Descrip
   if (layout == portfft::detail::layout::PACKED) {
     std::copy(in.cbegin(), in.cend(), out.begin() + offset);
   } else {
-    // only handling 1D for now
-    assert(desc.lengths.size() == 1);
-    const auto stride = desc.get_strides(dir).back();
+    const auto element_offsets = get_element_offsets(lengths, desc.get_strides(dir));
     const auto distance = desc.get_distance(dir);
 
     // add strides and distances
     InType const* in_iter = in.data();
     InType* out_batch_iter = out.data() + offset;
     for (std::size_t b = 0; b != desc.number_of_transforms; b += 1) {
-      InType* out_transform_iter = out_batch_iter;
-
-      for (std::size_t e = 0; e != flat_len; e += 1) {
-        *out_transform_iter = *in_iter;
-
+      for (std::size_t element_offset : element_offsets) {
+        out_batch_iter[element_offset] = *in_iter;
         in_iter += 1;
-        out_transform_iter += stride;
       }
 
       out_batch_iter += distance;
@@ -114,97 +143,40 @@ auto gen_fourier_data(portfft::descriptor<Scalar, Domain>& desc, portfft::detail
   const auto batches = desc.number_of_transforms;
   const auto& dims = desc.lengths;
 
-  const char* header =
-      "python3 -c \""
-      "import numpy as np\n"
-      "from sys import stdout\n"
-      "def gen_data(batch, dims, is_complex, is_double, debug_input):\n"
-      "  scalar_type = np.double if is_double else np.single\n"
-      "  complex_type = np.complex128 if is_double else np.complex64\n"
-      "  forward_type = complex_type if is_complex else scalar_type\n"
-      "  dataGenDims = [batch] + dims\n"
-      "\n"
-      "  if (debug_input):\n"
-      "    inData = np.arange(np.prod(dataGenDims)).reshape(dataGenDims).astype(forward_type) + 7j\n"
-      "  else:\n"
-      "    rng = np.random.Generator(np.random.SFC64(0))\n"
-      "    inData = rng.uniform(-1, 1, dataGenDims).astype(scalar_type)\n"
-      "    if (is_complex):\n"
-      "      inData = inData + 1j * rng.uniform(-1, 1, dataGenDims).astype(scalar_type)\n"
-      "\n"
-      "  if (is_complex):\n"
-      "    outData = np.fft.fftn(inData, axes=range(1, len(dims) + 1))\n"
-      "  else:\n"
-      "    outData = np.fft.rfftn(inData, axes=range(1, len(dims) + 1))\n"
-      "  # outData is always double precision at this point\n"
-      "  outData = outData.astype(complex_type)\n"
-      "\n"
-      "  # input and output shape is irrelevant when outputting the buffer\n"
-      "  stdout.buffer.write(inData.tobytes())\n"
-      "  stdout.buffer.write(outData.tobytes())\n"
-      "gen_data(";
-
-  std::stringstream command;
-  command << header;
-
-  command << batches << ',';
-
-  assert(dims.size() > 0);
-  command << "[" << dims[0];
-  for (auto itr = dims.cbegin() + 1; itr < dims.cend(); itr += 1) {
-    command << "," << *itr;
-  }
-  command << "],";
-
-  command << (IsRealDomain ? "False" : "True");
-
-  command << "," << (std::is_same_v<Scalar, float> ? "False" : "True");
-
-  command << "," << (debug_input ? "True" : "False");
-
-  command << ")\"";
-
-  FILE* f = popen(command.str().c_str(), "r");
-  if (f == nullptr) {
-    throw std::runtime_error("Command to create reference data failed\n");
-  }
-
-  auto process_close_func = [](FILE* f) {
-    if (pclose(f) != 0) {
-      // Note: strerror may output "Operation not supported" if the process is closed and we have not read all of its
-      // output with std::fread
-      throw std::runtime_error("failed to close validation sub-process, errno:" + std::string(std::strerror(errno)));
-    }
-  };
-  std::unique_ptr<FILE, decltype(process_close_func)> file_closer(f, process_close_func);
-
-  // Do not take into account the descriptor's stride, distance or offset to load data from Numpy.
+  // Do not take into account the descriptor's stride, distance or offset to generate the data.
   auto elements = desc.get_flattened_length() * batches;
-  auto backward_elements = IsRealDomain ? (elements / dims.back()) * (dims.back() / 2 + 1) : elements;
 
   using FwdType = typename std::conditional_t<IsRealDomain, Scalar, std::complex<Scalar>>;
   using BwdType = std::complex<Scalar>;
 
-  std::vector<FwdType> forward(elements);
-  std::vector<BwdType> backward(backward_elements);
-
-  auto fwd_read = std::fread(forward.data(), sizeof(FwdType), elements, f);
-  if (fwd_read != elements) {
-    throw std::runtime_error("Reference data was not transferred correctly");
-  }
-  auto bwd_read = std::fread(backward.data(), sizeof(BwdType), backward_elements, f);
-  if (bwd_read != backward_elements) {
-    throw std::runtime_error("Reference data was not transferred correctly");
+  std::vector<FwdType> forward;
+  if constexpr (debug_input) {
+    forward.resize(elements);
+    for (std::size_t i = 0; i < elements; i++) {
+      if constexpr (IsRealDomain) {
+        forward[i] = static_cast<Scalar>(i);
+      } else {
+        forward[i] = {static_cast<Scalar>(i), 7};
+      }
+    }
+  } else {
+    forward = host_reference::generate_uniform<FwdType>(elements);
   }
 
+  std::vector<std::complex<double>> backward_double = host_reference::forward_dft(forward.data(), dims, batches);
+  std::vector<BwdType> backward(backward_double.size());
+  std::transform(backward_double.cbegin(), backward_double.cend(), backward.begin(), [](std::complex<double> x) {
+    return BwdType(static_cast<Scalar>(x.real()), static_cast<Scalar>(x.imag()));
+  });
+
   // Apply scaling factor to the output
   // Do this before adding offset to avoid scaling the offsets
   if (IsForward) {
     auto scaling_factor = desc.forward_scale;
     std::for_each(backward.begin(), backward.end(), [scaling_factor](auto& x) { x *= scaling_factor; });
   } else {
-    // Numpy scales the output by `1/dft_len` for the backward direction and does not support arbitrary scales.
-    // We need to multiply by `dft_len` to get an unscaled reference and apply an arbitrary scale to it.
+    // The backward transform of the generated backward data is the forward data scaled by `dft_len`. We need to
+    // multiply by `dft_len` to get an unscaled reference and apply an arbitrary scale to it.
     auto scaling_factor = desc.backward_scale * static_cast<Scalar>(desc.get_flattened_length());
     std::for_each(forward.begin(), forward.end(), [scaling_factor](auto& x) { x *= scaling_factor; });
   }
@@ -292,9 +264,8 @@ void verify_dft(const portfft::descriptor<Scalar, Domain>& desc, const std::vect
     throw std::runtime_error("Verification Failed");
   }
 
-  const auto dft_len = desc.get_flattened_length();
   const auto dft_offset = desc.get_offset(inv(Dir));
-  const auto dft_stride = desc.get_strides(inv(Dir)).back();
+  const auto element_offsets = get_element_offsets(get_packed_lengths(desc, inv(Dir)), desc.get_strides(inv(Dir)));
   const auto dft_distance = desc.get_distance(inv(Dir));
 
   for (std::size_t i = 0; i < dft_offset; ++i) {
@@ -331,8 +302,7 @@ void verify_dft(const portfft::descriptor<Scalar, Domain>& desc, const std::vect
 
     Scalar L2_err = 0;
     Scalar L2_norm = 0;
-    for (std::size_t e = 0; e != dft_len; ++e) {
-      const auto batch_offset = e * dft_stride;
+    for (std::size_t batch_offset : element_offsets) {
       BwdType computed_val = this_batch_computed[batch_offset];
       BwdType ref_val = this_batch_ref[batch_offset];
       if constexpr (!IsInterleaved) {
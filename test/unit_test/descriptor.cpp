@@ -21,10 +21,22 @@
 #include <gtest/gtest.h>
 #include <portfft/descriptor.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "compare_to_reference.hpp"
 #include "fft_test_utils.hpp"
+#include "host_reference_fft.hpp"
 
 using Scalar = float;
 static constexpr portfft::domain Domain = portfft::domain::COMPLEX;
+static constexpr std::size_t Batch = 3;
 
 void test_descriptor_lengths() {
   std::vector<std::size_t> lengths{2, 3};
@@ -108,8 +120,269 @@ void test_descriptor_buffer_count() {
   EXPECT_EQ(fwd_output_count, 17);
 }
 
+/**
+ * Computes a batch of forward FFTs with a committed descriptor and compares them to the host reference.
+ *
+ * @param plan committed descriptor for `Batch` out-of-place transforms of size `length`
+ * @param queue queue the descriptor was committed for
+ * @param length length of the FFT
+ */
+template <typename Plan>
+void check_forward_against_reference(Plan& plan, sycl::queue& queue, std::size_t length) {
+  using complex_type = std::complex<Scalar>;
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(length * Batch);
+  std::vector<std::complex<double>> reference = host_reference::forward_dft(input.data(), {length}, Batch);
+  auto in = make_shared<complex_type>(input.size(), queue);
+  auto out = make_shared<complex_type>(input.size(), queue);
+  std::vector<complex_type> output(input.size());
+  queue.copy(input.data(), in.get(), input.size()).wait();
+  plan.compute_forward(static_cast<const complex_type*>(in.get()), out.get()).wait();
+  queue.copy(static_cast<const complex_type*>(out.get()), output.data(), output.size()).wait();
+  EXPECT_TRUE(compare_to_reference(output.data(), reference.data(), output.size())) << "length: " << length;
+}
+
+portfft::descriptor<Scalar, Domain> make_batched_descriptor(std::size_t length) {
+  portfft::descriptor<Scalar, Domain> desc({length});
+  desc.number_of_transforms = Batch;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  return desc;
+}
+
+// copies and moves of a committed descriptor share its compiled plan, each with scratch memory of its own
+void test_committed_descriptor_copy_and_move(std::size_t length) {
+  sycl::queue queue;
+  auto committed = make_batched_descriptor(length).commit(queue);
+  static_assert(std::is_nothrow_move_constructible_v<decltype(committed)>);
+  static_assert(std::is_nothrow_move_assignable_v<decltype(committed)>);
+
+  std::vector<decltype(committed)> plans;
+  plans.push_back(committed);
+  plans.push_back(std::move(committed));
+  plans.push_back(plans.front());
+  for (auto& plan : plans) {
+    check_forward_against_reference(plan, queue, length);
+  }
+}
+
+// several commits can be in flight while the queue is used by a plan committed earlier
+void test_commit_async() {
+  sycl::queue queue;
+  auto small_future = make_batched_descriptor(64).commit_async(queue);
+  auto large_future = make_batched_descriptor(1 << 16).commit_async(queue);
+  auto small = small_future.get();
+  check_forward_against_reference(small, queue, 64);
+  auto large = large_future.get();
+  check_forward_against_reference(large, queue, 1 << 16);
+
+  // errors of the commit are rethrown by the future
+  portfft::descriptor<Scalar, Domain> desc({64, 1 << 16});
+  auto failing_future = desc.commit_async(queue);
+  EXPECT_THROW(failing_future.get(), portfft::unsupported_configuration);
+}
+
+// a plan committed with wisdom makes the recorded decisions and computes the same transform
+void test_wisdom_round_trip(std::size_t length) {
+  sycl::queue queue;
+  auto desc = make_batched_descriptor(length);
+  portfft::wisdom exported;
+  desc.commit(queue).export_wisdom(exported);
+  ASSERT_EQ(exported.get_entries().size(), std::size_t(1));
+  const std::string text = exported.serialize();
+
+  auto committed = desc.commit(queue, portfft::wisdom::deserialize(text));
+  portfft::wisdom reexported;
+  committed.export_wisdom(reexported);
+  EXPECT_EQ(reexported.serialize(), text);
+  check_forward_against_reference(committed, queue, length);
+}
+
+// wisdom is only applied to descriptors of the same shape, and counts that do not match the values are rejected
+void test_wisdom_key_and_malformed() {
+  sycl::queue queue;
+  auto desc = make_batched_descriptor(64);
+  portfft::wisdom exported;
+  desc.commit(queue).export_wisdom(exported);
+  ASSERT_EQ(exported.get_entries().size(), std::size_t(1));
+  portfft::wisdom_entry in_place_key = exported.get_entries()[0];
+  in_place_key.place = portfft::placement::IN_PLACE;
+  EXPECT_EQ(exported.find(in_place_key), nullptr);
+  portfft::wisdom_entry split_key = exported.get_entries()[0];
+  split_key.storage = portfft::complex_storage::SPLIT_COMPLEX;
+  EXPECT_EQ(exported.find(split_key), nullptr);
+
+  const std::string header = "portfft_wisdom 2\nentry float complex 1 out_of_place interleaved packed packed ";
+  // more lengths than the line has
+  EXPECT_THROW(portfft::wisdom::deserialize(header + "1000000000000 64\ndevice d\nend\n"),
+               portfft::invalid_configuration);
+  // fewer kernels than declared for a dimension
+  EXPECT_THROW(portfft::wisdom::deserialize(header + "1 64\ndevice d\ndimension subgroup 64 32 0 1000000000000\n"
+                                                     "kernel subgroup 2 2 32 1 1 1\nend\n"),
+               portfft::invalid_configuration);
+  // more factors than the line has
+  EXPECT_THROW(portfft::wisdom::deserialize(header + "1 64\ndevice d\ndimension subgroup 64 32 0 1\n"
+                                                     "kernel subgroup 1000000000000 2 32 1 1 1\nend\n"),
+               portfft::invalid_configuration);
+}
+
+// transforms along the third dimension of a [2][3][length][5] array, with two outer batch dimensions
+void test_outer_batches(std::size_t length) {
+  using complex_type = std::complex<Scalar>;
+  const std::vector<std::size_t> outer_counts{2, 3};
+  const std::size_t inner_batch = 5;
+  const std::size_t size = outer_counts[0] * outer_counts[1] * length * inner_batch;
+  sycl::queue queue;
+  portfft::descriptor<Scalar, Domain> desc({length});
+  desc.forward_strides = {inner_batch};
+  desc.backward_strides = {inner_batch};
+  desc.forward_distance = 1;
+  desc.backward_distance = 1;
+  desc.number_of_transforms = inner_batch;
+  desc.outer_batch_counts = outer_counts;
+  desc.forward_outer_distances = {outer_counts[1] * length * inner_batch, length * inner_batch};
+  desc.backward_outer_distances = desc.forward_outer_distances;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  EXPECT_EQ(desc.get_input_count(portfft::direction::FORWARD), size);
+  EXPECT_EQ(desc.get_total_transforms(), outer_counts[0] * outer_counts[1] * inner_batch);
+  auto committed = desc.commit(queue);
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(size);
+  std::vector<complex_type> output(size);
+  auto in = make_shared<complex_type>(size, queue);
+  auto out = make_shared<complex_type>(size, queue);
+  queue.copy(input.data(), in.get(), size).wait();
+  committed.compute_forward(static_cast<const complex_type*>(in.get()), out.get()).wait();
+  queue.copy(static_cast<const complex_type*>(out.get()), output.data(), size).wait();
+
+  // gather the transforms, and their results, into packed arrays
+  const std::size_t n_transforms = desc.get_total_transforms();
+  std::vector<complex_type> packed_input(size);
+  std::vector<complex_type> packed_output(size);
+  for (std::size_t t = 0; t < n_transforms; t++) {
+    const std::size_t first = (t / inner_batch) * length * inner_batch + t % inner_batch;
+    for (std::size_t i = 0; i < length; i++) {
+      packed_input[t * length + i] = input[first + i * inner_batch];
+      packed_output[t * length + i] = output[first + i * inner_batch];
+    }
+  }
+  std::vector<std::complex<double>> reference =
+      host_reference::forward_dft(packed_input.data(), {length}, n_transforms);
+  EXPECT_TRUE(compare_to_reference(packed_output.data(), reference.data(), size)) << "length: " << length;
+}
+
+// transforms along the last dimension of a [2][3][5][length] array, with each row padded by one element and each
+// [3][5] plane padded by seven, so only the inner outer batch dimension is laid out as one with the rows
+void test_outer_batches_of_rows(std::size_t length) {
+  using complex_type = std::complex<Scalar>;
+  const std::vector<std::size_t> outer_counts{2, 3};
+  const std::size_t inner_batch = 5;
+  const std::size_t row = length + 1;
+  const std::size_t plane = outer_counts[1] * inner_batch * row + 7;
+  const std::size_t size = outer_counts[0] * plane;
+  sycl::queue queue;
+  portfft::descriptor<Scalar, Domain> desc({length});
+  desc.forward_distance = row;
+  desc.backward_distance = row;
+  desc.number_of_transforms = inner_batch;
+  desc.outer_batch_counts = outer_counts;
+  desc.forward_outer_distances = {plane, inner_batch * row};
+  desc.backward_outer_distances = desc.forward_outer_distances;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  auto committed = desc.commit(queue);
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(size);
+  std::vector<complex_type> output(size);
+  auto in = make_shared<complex_type>(size, queue);
+  auto out = make_shared<complex_type>(size, queue);
+  queue.copy(input.data(), in.get(), size).wait();
+  committed.compute_forward(static_cast<const complex_type*>(in.get()), out.get()).wait();
+  queue.copy(static_cast<const complex_type*>(out.get()), output.data(), size).wait();
+
+  const std::size_t n_transforms = desc.get_total_transforms();
+  const std::size_t packed_size = n_transforms * length;
+  std::vector<complex_type> packed_input(packed_size);
+  std::vector<complex_type> packed_output(packed_size);
+  for (std::size_t t = 0; t < n_transforms; t++) {
+    const std::size_t per_plane = outer_counts[1] * inner_batch;
+    const std::size_t first = (t / per_plane) * plane + (t % per_plane) * row;
+    for (std::size_t i = 0; i < length; i++) {
+      packed_input[t * length + i] = input[first + i];
+      packed_output[t * length + i] = output[first + i];
+    }
+  }
+  std::vector<std::complex<double>> reference =
+      host_reference::forward_dft(packed_input.data(), {length}, n_transforms);
+  EXPECT_TRUE(compare_to_reference(packed_output.data(), reference.data(), packed_size)) << "length: " << length;
+}
+
+// short-time Fourier transform: Hann windowed frames of `frame` values, `hop` values apart, of one signal
+void test_overlapping_windowed_frames(std::size_t frame, std::size_t hop) {
+  using complex_type = std::complex<Scalar>;
+  const std::size_t n_frames = 37;
+  const std::size_t signal_size = (n_frames - 1) * hop + frame;
+  const std::size_t output_size = n_frames * frame;
+  sycl::queue queue;
+  portfft::descriptor<Scalar, Domain> desc({frame});
+  desc.number_of_transforms = n_frames;
+  desc.forward_distance = hop;
+  desc.backward_distance = frame;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  desc.overlapping_forward_batches = true;
+  desc.forward_window.resize(frame);
+  const double pi = std::acos(-1.0);
+  for (std::size_t i = 0; i < frame; i++) {
+    desc.forward_window[i] = static_cast<Scalar>(0.5 - 0.5 * std::cos(2 * pi * static_cast<double>(i) / frame));
+  }
+  EXPECT_EQ(desc.get_input_count(portfft::direction::FORWARD), signal_size);
+  auto committed = desc.commit(queue);
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(signal_size);
+  std::vector<complex_type> output(output_size);
+  auto in = make_shared<complex_type>(signal_size, queue);
+  auto out = make_shared<complex_type>(output_size, queue);
+  queue.copy(input.data(), in.get(), signal_size).wait();
+  committed.compute_forward(static_cast<const complex_type*>(in.get()), out.get()).wait();
+  queue.copy(static_cast<const complex_type*>(out.get()), output.data(), output_size).wait();
+  EXPECT_THROW(committed.compute_backward(static_cast<const complex_type*>(out.get()), in.get()),
+               portfft::invalid_configuration);
+
+  std::vector<complex_type> windowed(output_size);
+  for (std::size_t f = 0; f < n_frames; f++) {
+    for (std::size_t i = 0; i < frame; i++) {
+      windowed[f * frame + i] = input[f * hop + i] * desc.forward_window[i];
+    }
+  }
+  std::vector<std::complex<double>> reference = host_reference::forward_dft(windowed.data(), {frame}, n_frames);
+  EXPECT_TRUE(compare_to_reference(output.data(), reference.data(), output_size)) << "frame: " << frame;
+}
+
 TEST(descriptor, lengths) { test_descriptor_lengths(); }
 TEST(descriptor, strides) { test_descriptor_strides(); }
 TEST(descriptor, distance) { test_descriptor_distance(); }
 TEST(descriptor, scale) { test_descriptor_scale(); }
 TEST(descriptor, buffer_count) { test_descriptor_buffer_count(); }
+TEST(descriptor, committed_copy_and_move) {
+  test_committed_descriptor_copy_and_move(64);
+  // large enough for the global implementation, which needs scratch memory
+  test_committed_descriptor_copy_and_move(1 << 16);
+}
+TEST(descriptor, commit_async) { test_commit_async(); }
+TEST(descriptor, wisdom) {
+  test_wisdom_round_trip(64);
+  test_wisdom_round_trip(1 << 16);
+}
+TEST(descriptor, wisdom_key_and_malformed) { test_wisdom_key_and_malformed(); }
+TEST(descriptor, outer_batches) {
+  // the workitem implementation folds both outer batch dimensions into its kernel
+  test_outer_batches(16);
+  // batch interleaved input, the subgroup implementation is launched once per outer batch
+  test_outer_batches(64);
+  // the workitem and subgroup implementations fold the inner outer batch dimension and launch once per plane
+  test_outer_batches_of_rows(16);
+  test_outer_batches_of_rows(64);
+  test_outer_batches_of_rows(256);
+}
+TEST(descriptor, overlapping_windowed_frames) {
+  // workitem and subgroup implementations
+  test_overlapping_windowed_frames(16, 4);
+  test_overlapping_windowed_frames(64, 16);
+}
@@ -97,6 +97,13 @@ INSTANTIATE_TEST_SUITE_P(workItemTest, FFTTest,
                              all_valid_placement_layouts, fwd_only, complex_storages, ::testing::Values(1, 3, 33000),
                              ::testing::Values(sizes_t{1}, sizes_t{2}, sizes_t{3}, sizes_t{4}, sizes_t{8}))),
                          test_params_print());
+// sizes that use generated codelets in the workitem implementation
+INSTANTIATE_TEST_SUITE_P(workItemCodeletTest, FFTTest,
+                         ::testing::ConvertGenerator<basic_param_tuple>(::testing::Combine(
+                             all_valid_placement_layouts, fwd_only, complex_storages, ::testing::Values(1, 3),
+                             ::testing::Values(sizes_t{5}, sizes_t{7}, sizes_t{11}, sizes_t{12}, sizes_t{13},
+                                               sizes_t{15}, sizes_t{17}, sizes_t{31}))),
+                         test_params_print());
 // sizes that might use workitem or subgroup implementation depending on device
 // and configurations
 INSTANTIATE_TEST_SUITE_P(workItemOrSubgroupTest, FFTTest,
@@ -116,6 +123,23 @@ INSTANTIATE_TEST_SUITE_P(SubgroupRegressionTest, FFTTest,
                              ip_batch_interleaved_layout, fwd_only, interleaved_storage, ::testing::Values(44, 100),
                              ::testing::Values(sizes_t{80}, sizes_t{100}))),
                          test_params_print());
+// subgroup sizes for which the cross-subgroup factor does not divide the subgroup size
+INSTANTIATE_TEST_SUITE_P(SubgroupFactorTest, FFTTest,
+                         ::testing::ConvertGenerator<basic_param_tuple>(::testing::Combine(
+                             all_valid_placement_layouts, fwd_only, complex_storages, ::testing::Values(1, 33),
+                             ::testing::Values(sizes_t{120}, sizes_t{360}))),
+                         test_params_print());
+// enough batches for the subgroup and workgroup kernels to loop and prefetch the next batches into local memory
+INSTANTIATE_TEST_SUITE_P(SubgroupPrefetchTest, FFTTest,
+                         ::testing::ConvertGenerator<basic_param_tuple>(::testing::Combine(
+                             all_valid_placement_layouts, fwd_only, complex_storages, ::testing::Values(40001),
+                             ::testing::Values(sizes_t{64}))),
+                         test_params_print());
+INSTANTIATE_TEST_SUITE_P(WorkgroupPrefetchTest, FFTTest,
+                         ::testing::ConvertGenerator<basic_param_tuple>(::testing::Combine(
+                             all_valid_placement_layouts, fwd_only, complex_storages, ::testing::Values(5001),
+                             ::testing::Values(sizes_t{2048}))),
+                         test_params_print());
 // sizes that might use subgroup or workgroup implementation depending on device
 // and configurations
 INSTANTIATE_TEST_SUITE_P(SubgroupOrWorkgroupTest, FFTTest,
@@ -194,6 +218,14 @@ INSTANTIATE_TEST_SUITE_P(MultidimensionalTest, FFTTest,
                                                sizes_t{2, 3, 6}, sizes_t{2, 3, 2, 3}))),
                          test_params_print());
 
+// Multidimensional FFT test suite for sizes computed by a single kernel
+INSTANTIATE_TEST_SUITE_P(FusedMultidimensionalTest, FFTTest,
+                         ::testing::ConvertGenerator<basic_param_tuple>(::testing::Combine(
+                             all_valid_multi_dim_placement_layouts, both_directions, complex_storages,
+                             ::testing::Values(1, 3),
+                             ::testing::Values(sizes_t{16, 16}, sizes_t{32, 32}, sizes_t{8, 8, 8}, sizes_t{4, 1, 8}))),
+                         test_params_print());
+
 // Offset data test suite
 
 // Pairs of offsets: {forward_offset, backward_offset}
@@ -209,7 +241,7 @@ INSTANTIATE_TEST_SUITE_P(OffsetsMatchedTest, FFTTest,
                          test_params_print());
 INSTANTIATE_TEST_SUITE_P(OffsetsMultiDimensionalTest, FFTTest,
                          ::testing::ConvertGenerator<offsets_param_tuple>(::testing::Combine(
-                             all_valid_multi_dim_placement_layouts, fwd_only, interleaved_storage,
+                             all_valid_multi_dim_placement_layouts, fwd_only, complex_storages,
                              ::testing::Values(33), ::testing::Values(sizes_t{16, 512}), matched_offsets)),
                          test_params_print());
 INSTANTIATE_TEST_SUITE_P(OffsetsMismatchedTest, FFTTest,
@@ -226,7 +258,7 @@ INSTANTIATE_TEST_SUITE_P(OffsetsMDErrorRegressionTest, FFTTest,
                          ::testing::ConvertGenerator<offsets_param_tuple>(::testing::Combine(
                              ::testing::Values(test_placement_layouts_params{
                                  placement::OUT_OF_PLACE, detail::layout::PACKED, detail::layout::PACKED}),
-                             fwd_only, interleaved_storage, ::testing::Values(2), ::testing::Values(sizes_t{4, 4}),
+                             fwd_only, complex_storages, ::testing::Values(2), ::testing::Values(sizes_t{4, 4}),
                              ::testing::Values(std::pair<std::size_t, std::size_t>({2, 0})))),
                          test_params_print());
 
@@ -0,0 +1,87 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <portfft/portfft.hpp>
+
+#include "fft_test_utils.hpp"
+
+using Scalar = float;
+static constexpr portfft::domain Domain = portfft::domain::COMPLEX;
+static constexpr std::size_t NumTransforms = 3;
+
+// Compares the result of a transform of integer input with the result of the same transform of the input already
+// converted and scaled on the host.
+template <typename IntegerT>
+void test_integer_input(std::size_t length) {
+  sycl::queue queue;
+  const Scalar integer_input_scale = 1.f / 128.f;
+  const std::size_t n_elements = length * NumTransforms;
+
+  std::vector<IntegerT> host_integer_input(2 * n_elements);
+  std::vector<std::complex<Scalar>> host_input(n_elements);
+  for (std::size_t i = 0; i < 2 * n_elements; i++) {
+    host_integer_input[i] = static_cast<IntegerT>(static_cast<int>((i * 37) % 255) - 127);
+  }
+  for (std::size_t i = 0; i < n_elements; i++) {
+    host_input[i] = {static_cast<Scalar>(host_integer_input[2 * i]) * integer_input_scale,
+                     static_cast<Scalar>(host_integer_input[2 * i + 1]) * integer_input_scale};
+  }
+
+  portfft::descriptor<Scalar, Domain> desc({length});
+  desc.number_of_transforms = NumTransforms;
+  desc.forward_scale = 0.5f;
+  auto committed_reference = desc.commit(queue);
+  desc.integer_input_scale = integer_input_scale;
+  auto committed = desc.commit(queue);
+
+  auto integer_input = make_shared<IntegerT>(2 * n_elements, queue);
+  auto input = make_shared<std::complex<Scalar>>(n_elements, queue);
+  auto output = make_shared<std::complex<Scalar>>(n_elements, queue);
+  auto reference_output = make_shared<std::complex<Scalar>>(n_elements, queue);
+  queue.copy(host_integer_input.data(), integer_input.get(), 2 * n_elements);
+  queue.copy(host_input.data(), input.get(), n_elements);
+  queue.wait();
+
+  committed.compute_forward(integer_input.get(), output.get()).wait();
+  committed_reference.compute_forward(input.get(), reference_output.get()).wait();
+
+  std::vector<std::complex<Scalar>> host_output(n_elements);
+  std::vector<std::complex<Scalar>> host_reference_output(n_elements);
+  queue.copy(output.get(), host_output.data(), n_elements);
+  queue.copy(reference_output.get(), host_reference_output.data(), n_elements);
+  queue.wait();
+
+  const auto tolerance = static_cast<Scalar>(1e-5 * static_cast<double>(length));
+  for (std::size_t i = 0; i < n_elements; i++) {
+    EXPECT_NEAR(host_output[i].real(), host_reference_output[i].real(), tolerance) << "element " << i;
+    EXPECT_NEAR(host_output[i].imag(), host_reference_output[i].imag(), tolerance) << "element " << i;
+  }
+}
+
+TEST(integer_input, int16_workitem) { test_integer_input<std::int16_t>(8); }
+TEST(integer_input, int8_workitem) { test_integer_input<std::int8_t>(8); }
+TEST(integer_input, int16_subgroup) { test_integer_input<std::int16_t>(64); }
+TEST(integer_input, int16_workgroup) { test_integer_input<std::int16_t>(2048); }
+TEST(integer_input, int16_global) { test_integer_input<std::int16_t>(65536); }
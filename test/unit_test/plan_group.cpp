@@ -0,0 +1,109 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+#include <gtest/gtest.h>
+#include <portfft/portfft.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+
+using ftype = float;
+using complex_type = std::complex<ftype>;
+
+// the plans of a group with their data and the expected results
+struct grouped_plans {
+  std::vector<complex_type*> inputs;
+  std::vector<complex_type*> outputs;
+  std::vector<std::vector<std::complex<double>>> references;
+};
+
+// Adds plans of the given lengths and batches to a group. The reference of the backward DFT is the conjugate of the
+// forward DFT of the conjugate.
+void add_plans(portfft::plan_group<ftype, portfft::domain::COMPLEX>& group, grouped_plans& plans, sycl::queue& queue,
+               const std::vector<std::size_t>& lengths, const std::vector<std::size_t>& batches,
+               portfft::direction dir, ftype scale) {
+  for (std::size_t i = 0; i < lengths.size(); i++) {
+    portfft::descriptor<ftype, portfft::domain::COMPLEX> desc({lengths[i]});
+    desc.number_of_transforms = batches[i];
+    desc.placement = portfft::placement::OUT_OF_PLACE;
+    desc.forward_scale = scale;
+    desc.backward_scale = scale;
+    const std::size_t size = lengths[i] * batches[i];
+    std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(size);
+    std::vector<complex_type> reference_input = input;
+    if (dir == portfft::direction::BACKWARD) {
+      for (auto& x : reference_input) {
+        x = std::conj(x);
+      }
+    }
+    std::vector<std::complex<double>> reference =
+        host_reference::forward_dft(reference_input.data(), {lengths[i]}, batches[i]);
+    for (auto& x : reference) {
+      x = (dir == portfft::direction::BACKWARD ? std::conj(x) : x) * static_cast<double>(scale);
+    }
+    plans.references.push_back(std::move(reference));
+    plans.inputs.push_back(sycl::malloc_shared<complex_type>(size, queue));
+    plans.outputs.push_back(sycl::malloc_shared<complex_type>(size, queue));
+    std::copy(input.begin(), input.end(), plans.inputs.back());
+    group.add(desc.commit(queue), plans.inputs.back(), plans.outputs.back());
+  }
+}
+
+void check_and_free(grouped_plans& plans, sycl::queue& queue) {
+  for (std::size_t i = 0; i < plans.references.size(); i++) {
+    EXPECT_TRUE(compare_to_reference(plans.outputs[i], plans.references[i].data(), plans.references[i].size()))
+        << "plan " << i;
+    sycl::free(plans.inputs[i], queue);
+    sycl::free(plans.outputs[i], queue);
+  }
+}
+
+// lengths 8, 16 and 24 use the workitem implementation, 64 and 128 the subgroup implementation
+void test_plan_group(portfft::direction dir, ftype scale) {
+  sycl::queue queue;
+  const std::vector<std::size_t> lengths{8, 64, 16, 128, 24};
+  const std::vector<std::size_t> batches{100, 33, 3, 5, 37};
+
+  portfft::plan_group<ftype, portfft::domain::COMPLEX> group(queue);
+  grouped_plans plans;
+  add_plans(group, plans, queue, lengths, batches, dir, scale);
+  EXPECT_EQ(group.size(), lengths.size());
+  sycl::event e = dir == portfft::direction::FORWARD ? group.compute_forward() : group.compute_backward();
+  e.wait();
+  check_and_free(plans, queue);
+}
+
+TEST(plan_group, different_lengths_in_one_submission) { test_plan_group(portfft::direction::FORWARD, 1); }
+TEST(plan_group, backward_with_scale) { test_plan_group(portfft::direction::BACKWARD, 0.5f); }
+
+// plans added after a computation rebuild the table of sub-plans, which the computation may still be using
+TEST(plan_group, add_after_compute) {
+  sycl::queue queue;
+  portfft::plan_group<ftype, portfft::domain::COMPLEX> group(queue);
+  grouped_plans plans;
+  add_plans(group, plans, queue, {16, 64}, {1000, 200}, portfft::direction::FORWARD, 1);
+  sycl::event first = group.compute_forward();
+  add_plans(group, plans, queue, {32}, {7}, portfft::direction::FORWARD, 1);
+  group.compute_forward({first}).wait();
+  check_and_free(plans, queue);
+}
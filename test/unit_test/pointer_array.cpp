@@ -0,0 +1,127 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <portfft/portfft.hpp>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+#include "sycl_utils.hpp"
+
+using ftype = float;
+using complex_type = std::complex<ftype>;
+static constexpr std::size_t Batch = 5;
+
+// Reference of a batch of FFTs. The backward DFT is the conjugate of the forward DFT of the conjugate.
+std::vector<std::complex<double>> reference_dft(std::vector<complex_type> input, std::size_t length,
+                                                portfft::direction dir) {
+  if (dir == portfft::direction::BACKWARD) {
+    for (auto& x : input) {
+      x = std::conj(x);
+    }
+  }
+  std::vector<std::complex<double>> reference = host_reference::forward_dft(input.data(), {length}, Batch);
+  if (dir == portfft::direction::BACKWARD) {
+    for (auto& x : reference) {
+      x = std::conj(x);
+    }
+  }
+  return reference;
+}
+
+// Computes a batch of transforms each in its own device allocation. The output is read back with the returned event
+// as its only dependency, so the event must cover the whole computation.
+void test_pointer_array(std::size_t length, portfft::direction dir, portfft::placement place) {
+  sycl::queue queue;
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc({length});
+  desc.number_of_transforms = Batch;
+  desc.placement = place;
+  auto committed = desc.commit(queue);
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(length * Batch);
+  std::vector<std::shared_ptr<complex_type>> inputs;
+  std::vector<std::shared_ptr<complex_type>> outputs;
+  std::vector<const complex_type*> host_ins;
+  std::vector<complex_type*> host_outs;
+  std::vector<sycl::event> copy_events;
+  for (std::size_t i = 0; i < Batch; i++) {
+    inputs.push_back(make_shared<complex_type>(length, queue));
+    outputs.push_back(place == portfft::placement::IN_PLACE ? inputs.back() : make_shared<complex_type>(length, queue));
+    copy_events.push_back(queue.copy(input.data() + i * length, inputs.back().get(), length));
+    host_ins.push_back(inputs.back().get());
+    host_outs.push_back(outputs.back().get());
+  }
+  auto ins = make_shared<const complex_type*>(Batch, queue);
+  auto outs = make_shared<complex_type*>(Batch, queue);
+  copy_events.push_back(queue.copy(host_ins.data(), ins.get(), Batch));
+  copy_events.push_back(queue.copy(host_outs.data(), outs.get(), Batch));
+
+  const complex_type* const* ins_ptr = ins.get();
+  sycl::event compute_event = dir == portfft::direction::FORWARD
+                                  ? committed.compute_forward(ins_ptr, outs.get(), copy_events)
+                                  : committed.compute_backward(ins_ptr, outs.get(), copy_events);
+  std::vector<complex_type> output(length * Batch);
+  std::vector<sycl::event> read_events;
+  for (std::size_t i = 0; i < Batch; i++) {
+    read_events.push_back(queue.copy(static_cast<const complex_type*>(outputs[i].get()), output.data() + i * length,
+                                     length, compute_event));
+  }
+  sycl::event::wait(read_events);
+  EXPECT_EQ(compute_event.get_info<sycl::info::event::command_execution_status>(),
+            sycl::info::event_command_status::complete);
+
+  std::vector<std::complex<double>> reference = reference_dft(input, length, dir);
+  EXPECT_TRUE(compare_to_reference(output.data(), reference.data(), length * Batch)) << "length " << length;
+}
+
+void test_all_configurations(std::size_t length) {
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    for (auto place : {portfft::placement::OUT_OF_PLACE, portfft::placement::IN_PLACE}) {
+      test_pointer_array(length, dir, place);
+    }
+  }
+}
+
+// lengths computed by the workgroup or global implementations can not take arrays of pointers
+void test_pointer_array_unsupported(std::size_t length) {
+  sycl::queue queue;
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc({length});
+  desc.number_of_transforms = Batch;
+  auto committed = desc.commit(queue);
+  auto ins = make_shared<const complex_type*>(Batch, queue);
+  auto outs = make_shared<complex_type*>(Batch, queue);
+  const complex_type* const* ins_ptr = ins.get();
+  EXPECT_THROW(committed.compute_forward(ins_ptr, outs.get()), portfft::unsupported_configuration);
+  EXPECT_THROW(committed.compute_backward(ins_ptr, outs.get()), portfft::unsupported_configuration);
+}
+
+TEST(pointer_array, workitem) { test_all_configurations(16); }
+// a subgroup computes several transforms, each loaded from and stored to its own pointer
+TEST(pointer_array, subgroup) { test_all_configurations(64); }
+// longer transforms, with fewer of them computed by each subgroup
+TEST(pointer_array, subgroup_long) { test_all_configurations(256); }
+TEST(pointer_array, unsupported) {
+  test_pointer_array_unsupported(2048);
+  test_pointer_array_unsupported(1 << 16);
+}
@@ -0,0 +1,146 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+#include <gtest/gtest.h>
+#include <portfft/portfft.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+
+using ftype = float;
+using complex_type = std::complex<ftype>;
+
+// Computes the segments of the given lengths, followed by segments of the untouched lengths and one longer than the
+// maximum length, which must be left untouched. The reference of the backward DFT is the conjugate of the forward DFT
+// of the conjugate.
+void test_ragged_batch(std::size_t max_length, const std::vector<std::size_t>& plan_lengths,
+                       const std::vector<std::size_t>& lengths, const std::vector<std::size_t>& untouched_lengths,
+                       portfft::direction dir, ftype scale, bool in_place = false) {
+  sycl::queue queue;
+  std::vector<portfft::ragged_segment> host_segments;
+  std::size_t size = 0;
+  for (std::size_t length : lengths) {
+    // leave a gap after each segment, which must not be written
+    host_segments.push_back({size, length});
+    size += length + 1;
+  }
+  std::vector<std::size_t> all_untouched_lengths(untouched_lengths);
+  all_untouched_lengths.push_back(max_length + 1);
+  for (std::size_t length : all_untouched_lengths) {
+    host_segments.push_back({size, length});
+    size += length;
+  }
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(size);
+  complex_type* in = sycl::malloc_shared<complex_type>(size, queue);
+  complex_type* out = in_place ? in : sycl::malloc_shared<complex_type>(size, queue);
+  portfft::ragged_segment* segments = sycl::malloc_shared<portfft::ragged_segment>(host_segments.size(), queue);
+  std::fill(out, out + size, complex_type(-1, -1));
+  std::copy(input.begin(), input.end(), in);
+  std::copy(host_segments.begin(), host_segments.end(), segments);
+  // in place, the untouched data is the input
+  auto expected_untouched = [&](std::size_t idx) { return in_place ? input[idx] : complex_type(-1, -1); };
+
+  portfft::ragged_batch<ftype> batch(queue, max_length, plan_lengths, scale, scale);
+  sycl::event e = dir == portfft::direction::FORWARD
+                      ? batch.compute_forward(in, out, segments, host_segments.size())
+                      : batch.compute_backward(in, out, segments, host_segments.size());
+  e.wait();
+
+  for (std::size_t i = 0; i < lengths.size(); i++) {
+    const portfft::ragged_segment& segment = host_segments[i];
+    const complex_type* segment_input = input.data() + segment.offset;
+    std::vector<complex_type> reference_input(segment_input, segment_input + segment.length);
+    if (dir == portfft::direction::BACKWARD) {
+      for (auto& x : reference_input) {
+        x = std::conj(x);
+      }
+    }
+    std::vector<std::complex<double>> reference =
+        host_reference::forward_dft(reference_input.data(), {segment.length}, 1);
+    for (auto& x : reference) {
+      x = (dir == portfft::direction::BACKWARD ? std::conj(x) : x) * static_cast<double>(scale);
+    }
+    EXPECT_TRUE(compare_to_reference(out + segment.offset, reference.data(), segment.length))
+        << "length " << segment.length;
+    EXPECT_EQ(out[segment.offset + segment.length], expected_untouched(segment.offset + segment.length));
+  }
+  for (std::size_t i = lengths.size(); i < host_segments.size(); i++) {
+    const portfft::ragged_segment& segment = host_segments[i];
+    for (std::size_t idx = segment.offset; idx < segment.offset + segment.length; idx++) {
+      EXPECT_EQ(out[idx], expected_untouched(idx)) << "untouched length " << segment.length;
+    }
+  }
+  sycl::free(in, queue);
+  if (!in_place) {
+    sycl::free(out, queue);
+  }
+  sycl::free(segments, queue);
+}
+
+TEST(ragged_batch, segments_of_different_lengths) {
+  test_ragged_batch(16, {}, {8, 3, 16, 13, 5, 16, 7, 1}, {}, portfft::direction::FORWARD, 1);
+}
+TEST(ragged_batch, backward_with_scale) {
+  test_ragged_batch(16, {}, {8, 3, 16, 13, 5, 16, 7, 1}, {}, portfft::direction::BACKWARD, 0.25f);
+}
+// segments longer than a work-item computes are bucketed by length on the device and each declared length is computed
+// with one launch of its committed descriptor, segments of other long lengths are left untouched
+TEST(ragged_batch, segments_longer_than_a_workitem) {
+  const std::vector<std::size_t> plan_lengths{96, 128, 512};
+  const std::vector<std::size_t> lengths{8, 128, 512, 13, 128, 96, 1, 128, 512};
+  test_ragged_batch(512, plan_lengths, lengths, {320}, portfft::direction::FORWARD, 1);
+  test_ragged_batch(512, plan_lengths, lengths, {320}, portfft::direction::BACKWARD, 0.5f);
+  test_ragged_batch(512, plan_lengths, lengths, {320}, portfft::direction::FORWARD, 1, true);
+}
+// the same batch computed twice reuses the arrays the segments are bucketed into
+TEST(ragged_batch, repeated_computation) {
+  sycl::queue queue;
+  const std::size_t length = 128;
+  const std::size_t n_segments = 4;
+  complex_type* data = sycl::malloc_shared<complex_type>(n_segments * length, queue);
+  portfft::ragged_segment* segments = sycl::malloc_shared<portfft::ragged_segment>(n_segments, queue);
+  for (std::size_t i = 0; i < n_segments; i++) {
+    segments[i] = {i * length, length};
+  }
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(n_segments * length);
+  std::copy(input.begin(), input.end(), data);
+  portfft::ragged_batch<ftype> batch(queue, length, {length});
+  // a forward and a backward FFT multiply the input by the length
+  sycl::event forward = batch.compute_forward(data, data, segments, n_segments);
+  batch.compute_backward(data, data, segments, n_segments, {forward}).wait();
+  std::vector<std::complex<double>> reference;
+  for (const complex_type& x : input) {
+    reference.push_back(std::complex<double>(x) * static_cast<double>(length));
+  }
+  EXPECT_TRUE(compare_to_reference(data, reference.data(), n_segments * length));
+  sycl::free(data, queue);
+  sycl::free(segments, queue);
+}
+TEST(ragged_batch, invalid_lengths) {
+  sycl::queue queue;
+  EXPECT_THROW(portfft::ragged_batch<ftype>(queue, 128, {256}), portfft::invalid_configuration);
+  EXPECT_THROW(portfft::ragged_batch<ftype>(queue, 128, {0}), portfft::invalid_configuration);
+  // computed by the global implementation
+  EXPECT_THROW(portfft::ragged_batch<ftype>(queue, 1 << 16, {1 << 16}), portfft::unsupported_configuration);
+}
@@ -0,0 +1,116 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <complex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <portfft/portfft.hpp>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+#include "sycl_utils.hpp"
+
+using ftype = float;
+using complex_type = std::complex<ftype>;
+static constexpr std::size_t Batch = 3;
+
+static_assert(!std::is_copy_constructible_v<portfft::recorded_compute>);
+static_assert(!std::is_copy_assignable_v<portfft::recorded_compute>);
+static_assert(std::is_move_constructible_v<portfft::recorded_compute>);
+
+// Whether computations recorded on the queue are expected to be recorded into a command graph. The kernels of all the
+// implementations can be recorded, so a fallback to submitting them on every replay is a failure.
+bool expect_graph(sycl::queue& queue) {
+#if defined(SYCL_EXT_ONEAPI_GRAPH) && PORTFFT_SYCL_GRAPH
+  return queue.get_device().has(sycl::aspect::ext_oneapi_limited_graph);
+#else
+  static_cast<void>(queue);
+  return false;
+#endif
+}
+
+// Reference of a batch of FFTs. The backward DFT is the conjugate of the forward DFT of the conjugate.
+std::vector<std::complex<double>> reference_dft(std::vector<complex_type> input, std::size_t length,
+                                                portfft::direction dir) {
+  if (dir == portfft::direction::BACKWARD) {
+    for (auto& x : input) {
+      x = std::conj(x);
+    }
+  }
+  std::vector<std::complex<double>> reference = host_reference::forward_dft(input.data(), {length}, Batch);
+  if (dir == portfft::direction::BACKWARD) {
+    for (auto& x : reference) {
+      x = std::conj(x);
+    }
+  }
+  return reference;
+}
+
+// Records a computation, then replays it several times with new input written to the same USM allocation, which the
+// replays must read rather than the data present when it was recorded.
+void test_recorded_compute(std::size_t length, portfft::direction dir) {
+  sycl::queue queue;
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc({length});
+  desc.number_of_transforms = Batch;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  auto committed = desc.commit(queue);
+
+  const std::size_t size = length * Batch;
+  auto in = make_shared<complex_type>(size, queue);
+  auto out = make_shared<complex_type>(size, queue);
+  const complex_type* in_ptr = in.get();
+  portfft::recorded_compute recorded = dir == portfft::direction::FORWARD
+                                           ? committed.record_forward(in_ptr, out.get())
+                                           : committed.record_backward(in_ptr, out.get());
+  EXPECT_EQ(recorded.uses_graph(), expect_graph(queue)) << "length " << length;
+
+  std::vector<complex_type> output(size);
+  for (std::size_t replay = 0; replay < 3; replay++) {
+    std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(size);
+    // the copy is not waited for, the replay depends on it
+    sycl::event copy_event = queue.copy(input.data(), in.get(), size);
+    recorded.replay({copy_event}).wait();
+    queue.copy(static_cast<const complex_type*>(out.get()), output.data(), size).wait();
+    std::vector<std::complex<double>> reference = reference_dft(input, length, dir);
+    EXPECT_TRUE(compare_to_reference(output.data(), reference.data(), size))
+        << "length " << length << ", replay " << replay;
+    if (replay == 0) {
+      // the computation the recording is moved to replays the same graph
+      portfft::recorded_compute moved = std::move(recorded);
+      recorded = std::move(moved);
+      EXPECT_EQ(recorded.uses_graph(), expect_graph(queue));
+    }
+  }
+}
+
+void test_all_directions(std::size_t length) {
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    test_recorded_compute(length, dir);
+  }
+}
+
+TEST(recorded_compute, workitem) { test_all_directions(16); }
+TEST(recorded_compute, subgroup) { test_all_directions(64); }
+TEST(recorded_compute, workgroup) { test_all_directions(2048); }
+// the global implementation uses the scratch memory of the plan the recording owns
+TEST(recorded_compute, global) { test_all_directions(1 << 16); }
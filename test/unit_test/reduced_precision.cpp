@@ -0,0 +1,143 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <complex>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <portfft/portfft.hpp>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+#include "sycl_utils.hpp"
+
+using Scalar = float;
+static constexpr portfft::domain Domain = portfft::domain::COMPLEX;
+static constexpr std::size_t NumTransforms = 3;
+
+/**
+ * Machine epsilon of a reduced precision storage type: 2^-10 for half and 2^-7 for bfloat16.
+ */
+template <typename StorageT>
+constexpr double storage_epsilon = std::is_same_v<StorageT, sycl::half> ? 0x1.0p-10 : 0x1.0p-7;
+
+// Computes a transform of data stored in a reduced precision type and compares it with the host reference of the
+// input as it was rounded to the storage type. The result is rounded when it is stored, so the tolerance is set by the
+// precision of the storage type rather than the precision of the computation.
+template <typename StorageT>
+void test_reduced_precision(std::size_t length, portfft::direction dir, portfft::complex_storage storage) {
+  sycl::queue queue;
+  const std::size_t n_elements = length * NumTransforms;
+  portfft::descriptor<Scalar, Domain> desc({length});
+  desc.number_of_transforms = NumTransforms;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  desc.complex_storage = storage;
+  auto committed = desc.commit(queue);
+
+  // the input rounded to the storage type, in interleaved and split form
+  std::vector<std::complex<Scalar>> host_input = host_reference::generate_uniform<std::complex<Scalar>>(n_elements);
+  std::vector<StorageT> host_interleaved(2 * n_elements);
+  for (std::size_t i = 0; i < n_elements; i++) {
+    host_interleaved[2 * i] = static_cast<StorageT>(host_input[i].real());
+    host_interleaved[2 * i + 1] = static_cast<StorageT>(host_input[i].imag());
+    host_input[i] = {static_cast<Scalar>(host_interleaved[2 * i]), static_cast<Scalar>(host_interleaved[2 * i + 1])};
+  }
+
+  // the backward DFT is the conjugate of the forward DFT of the conjugate
+  std::vector<std::complex<Scalar>> reference_input = host_input;
+  if (dir == portfft::direction::BACKWARD) {
+    for (auto& x : reference_input) {
+      x = std::conj(x);
+    }
+  }
+  std::vector<std::complex<double>> reference =
+      host_reference::forward_dft(reference_input.data(), {length}, NumTransforms);
+  if (dir == portfft::direction::BACKWARD) {
+    for (auto& x : reference) {
+      x = std::conj(x);
+    }
+  }
+
+  std::vector<StorageT> host_output(2 * n_elements);
+  if (storage == portfft::complex_storage::INTERLEAVED_COMPLEX) {
+    auto input = make_shared<StorageT>(2 * n_elements, queue);
+    auto output = make_shared<StorageT>(2 * n_elements, queue);
+    queue.copy(host_interleaved.data(), input.get(), 2 * n_elements).wait();
+    const StorageT* in = input.get();
+    sycl::event e = dir == portfft::direction::FORWARD ? committed.compute_forward(in, output.get())
+                                                       : committed.compute_backward(in, output.get());
+    e.wait();
+    queue.copy(output.get(), host_output.data(), 2 * n_elements).wait();
+  } else {
+    std::vector<StorageT> host_real(n_elements);
+    std::vector<StorageT> host_imag(n_elements);
+    for (std::size_t i = 0; i < n_elements; i++) {
+      host_real[i] = host_interleaved[2 * i];
+      host_imag[i] = host_interleaved[2 * i + 1];
+    }
+    auto input_real = make_shared<StorageT>(n_elements, queue);
+    auto input_imag = make_shared<StorageT>(n_elements, queue);
+    auto output_real = make_shared<StorageT>(n_elements, queue);
+    auto output_imag = make_shared<StorageT>(n_elements, queue);
+    queue.copy(host_real.data(), input_real.get(), n_elements);
+    queue.copy(host_imag.data(), input_imag.get(), n_elements);
+    queue.wait();
+    const StorageT* in_real = input_real.get();
+    const StorageT* in_imag = input_imag.get();
+    sycl::event e = dir == portfft::direction::FORWARD
+                        ? committed.compute_forward(in_real, in_imag, output_real.get(), output_imag.get())
+                        : committed.compute_backward(in_real, in_imag, output_real.get(), output_imag.get());
+    e.wait();
+    queue.copy(output_real.get(), host_real.data(), n_elements);
+    queue.copy(output_imag.get(), host_imag.data(), n_elements);
+    queue.wait();
+    for (std::size_t i = 0; i < n_elements; i++) {
+      host_output[2 * i] = host_real[i];
+      host_output[2 * i + 1] = host_imag[i];
+    }
+  }
+
+  std::vector<std::complex<Scalar>> output(n_elements);
+  for (std::size_t i = 0; i < n_elements; i++) {
+    output[i] = {static_cast<Scalar>(host_output[2 * i]), static_cast<Scalar>(host_output[2 * i + 1])};
+  }
+  // rounding each output value to the storage type is the largest source of error
+  EXPECT_TRUE(compare_to_reference(output.data(), reference.data(), n_elements, 2 * storage_epsilon<StorageT>))
+      << "length " << length;
+}
+
+template <typename StorageT>
+void test_all_directions_and_storages(std::size_t length) {
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    for (auto storage : {portfft::complex_storage::INTERLEAVED_COMPLEX, portfft::complex_storage::SPLIT_COMPLEX}) {
+      test_reduced_precision<StorageT>(length, dir, storage);
+    }
+  }
+}
+
+TEST(reduced_precision, half_workitem) { test_all_directions_and_storages<sycl::half>(8); }
+TEST(reduced_precision, half_subgroup) { test_all_directions_and_storages<sycl::half>(64); }
+TEST(reduced_precision, half_workgroup) { test_all_directions_and_storages<sycl::half>(2048); }
+TEST(reduced_precision, half_global) { test_all_directions_and_storages<sycl::half>(65536); }
+TEST(reduced_precision, bfloat16_workitem) { test_all_directions_and_storages<sycl::ext::oneapi::bfloat16>(8); }
+TEST(reduced_precision, bfloat16_subgroup) { test_all_directions_and_storages<sycl::ext::oneapi::bfloat16>(64); }
+TEST(reduced_precision, bfloat16_workgroup) { test_all_directions_and_storages<sycl::ext::oneapi::bfloat16>(2048); }
+TEST(reduced_precision, bfloat16_global) { test_all_directions_and_storages<sycl::ext::oneapi::bfloat16>(65536); }
@@ -0,0 +1,85 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <gtest/gtest.h>
+#include <portfft/descriptor.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <numeric>
+#include <vector>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+
+using ftype = float;
+using complex_type = std::complex<ftype>;
+
+/**
+ * Gets queues on the NUMA sub-devices of the default device, or two queues on the default device if it can not be
+ * partitioned that way. All the queues share a context.
+ */
+std::vector<sycl::queue> get_shard_queues() {
+  sycl::device dev{sycl::default_selector_v};
+  std::vector<sycl::device> devices;
+  const auto affinity_domains = dev.get_info<sycl::info::device::partition_affinity_domains>();
+  if (std::find(affinity_domains.begin(), affinity_domains.end(), sycl::info::partition_affinity_domain::numa) !=
+      affinity_domains.end()) {
+    devices = dev.create_sub_devices<sycl::info::partition_property::partition_by_affinity_domain>(
+        sycl::info::partition_affinity_domain::numa);
+  }
+  std::vector<sycl::queue> queues;
+  if (devices.size() < 2) {
+    sycl::context ctx(dev);
+    queues = {sycl::queue(ctx, dev), sycl::queue(ctx, dev)};
+  } else {
+    sycl::context ctx(devices);
+    for (const sycl::device& sub_device : devices) {
+      queues.emplace_back(ctx, sub_device);
+    }
+  }
+  return queues;
+}
+
+TEST(sharding, batch_split_between_queues) {
+  std::vector<sycl::queue> queues = get_shard_queues();
+  const std::vector<std::size_t> lengths{8, 32};
+  constexpr std::size_t Batch = 29;
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc(lengths);
+  desc.number_of_transforms = Batch;
+  desc.placement = portfft::placement::OUT_OF_PLACE;
+  auto committed = desc.commit(queues);
+  std::vector<std::size_t> shard_sizes = committed.get_shard_sizes();
+  EXPECT_EQ(shard_sizes.size(), queues.size());
+  EXPECT_EQ(std::accumulate(shard_sizes.begin(), shard_sizes.end(), std::size_t(0)), Batch);
+
+  const std::size_t size = desc.get_flattened_length() * Batch;
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(size);
+  std::vector<std::complex<double>> reference = host_reference::forward_dft(input.data(), lengths, Batch);
+  // shared allocations are accessible from all the devices of the context
+  complex_type* in = sycl::malloc_shared<complex_type>(size, queues.front());
+  complex_type* out = sycl::malloc_shared<complex_type>(size, queues.front());
+  std::copy(input.begin(), input.end(), in);
+  committed.compute_forward(in, out).wait();
+
+  EXPECT_TRUE(compare_to_reference(out, reference.data(), size));
+  sycl::free(in, queues.front());
+  sycl::free(out, queues.front());
+}
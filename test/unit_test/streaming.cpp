@@ -0,0 +1,162 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <gtest/gtest.h>
+#include <portfft/descriptor.hpp>
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "compare_to_reference.hpp"
+#include "host_reference_fft.hpp"
+
+using ftype = float;
+using complex_type = std::complex<ftype>;
+
+/**
+ * Compares the result of an FFT to the host reference.
+ *
+ * @param input input of the FFT
+ * @param output output of the FFT
+ * @param lengths lengths of the FFT
+ * @param batch number of transforms
+ * @param dir direction of the FFT
+ */
+void check_against_reference(const std::vector<complex_type>& input, const std::vector<complex_type>& output,
+                             const std::vector<std::size_t>& lengths, std::size_t batch, portfft::direction dir) {
+  // the backward DFT is the conjugate of the forward DFT of the conjugate
+  std::vector<complex_type> reference_input = input;
+  if (dir == portfft::direction::BACKWARD) {
+    std::transform(input.begin(), input.end(), reference_input.begin(), [](complex_type x) { return std::conj(x); });
+  }
+  std::vector<std::complex<double>> reference = host_reference::forward_dft(reference_input.data(), lengths, batch);
+  if (dir == portfft::direction::BACKWARD) {
+    std::transform(reference.begin(), reference.end(), reference.begin(),
+                   [](std::complex<double> x) { return std::conj(x); });
+  }
+  EXPECT_TRUE(compare_to_reference(output.data(), reference.data(), output.size()));
+}
+
+/**
+ * Computes a streaming FFT with a small device memory budget and compares it to the host reference.
+ *
+ * @param lengths lengths of the FFT
+ * @param batch number of transforms
+ * @param device_memory_budget device memory budget in bytes
+ * @param expect_chunks whether the budget is expected to fit whole transforms
+ * @param dir direction of the FFT
+ * @param place placement of the FFT
+ * @param ring_size number of chunks in flight
+ */
+void test_streaming(const std::vector<std::size_t>& lengths, std::size_t batch, std::size_t device_memory_budget,
+                    bool expect_chunks, portfft::direction dir, portfft::placement place, std::size_t ring_size = 2) {
+  sycl::queue queue;
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc(lengths);
+  desc.number_of_transforms = batch;
+  desc.placement = place;
+  const std::size_t fft_size = desc.get_flattened_length();
+  auto committed = desc.commit_streaming(queue, device_memory_budget, ring_size);
+  EXPECT_EQ(committed.get_transforms_per_chunk() != 0, expect_chunks);
+  EXPECT_EQ(committed.get_ring_size(), ring_size);
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(fft_size * batch);
+  std::vector<complex_type> output(fft_size * batch);
+  if (place == portfft::placement::IN_PLACE) {
+    output = input;
+    dir == portfft::direction::FORWARD ? committed.compute_forward(output.data())
+                                       : committed.compute_backward(output.data());
+  } else {
+    dir == portfft::direction::FORWARD ? committed.compute_forward(input.data(), output.data())
+                                       : committed.compute_backward(input.data(), output.data());
+  }
+  check_against_reference(input, output, lengths, batch, dir);
+}
+
+// the budget fits a few transforms at a time, giving many chunks and a partial last one
+TEST(streaming, batch_chunks) {
+  constexpr std::size_t Budget = 16 * 1024;
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    for (auto place : {portfft::placement::OUT_OF_PLACE, portfft::placement::IN_PLACE}) {
+      test_streaming({64}, 101, Budget, true, dir, place);
+      test_streaming({8, 16}, 33, Budget, true, dir, place);
+    }
+  }
+}
+
+// chunks of a size computed by the global implementation, whose kernels use the scratch memory of the plan shared by
+// the chunks in flight
+TEST(streaming, global_level_chunks) {
+  constexpr std::size_t Budget = 8 * 1024 * 1024;
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    test_streaming({65536}, 9, Budget, true, dir, portfft::placement::OUT_OF_PLACE);
+  }
+}
+
+// the budget does not fit a single transform, which is computed in slabs of a 64 x 96 decomposition
+TEST(streaming, four_step_slabs) {
+  constexpr std::size_t Budget = 64 * 1024;
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    test_streaming({64 * 96}, 3, Budget, false, dir, portfft::placement::OUT_OF_PLACE);
+  }
+}
+
+// more chunks in flight than the two slots of the default ring, and a single one
+TEST(streaming, ring_size) {
+  constexpr std::size_t Budget = 64 * 1024;
+  for (std::size_t ring_size : {1, 4}) {
+    test_streaming({64}, 101, Budget, true, portfft::direction::FORWARD, portfft::placement::OUT_OF_PLACE, ring_size);
+    test_streaming({64 * 96}, 2, Budget, false, portfft::direction::FORWARD, portfft::placement::OUT_OF_PLACE,
+                   ring_size);
+  }
+}
+
+/**
+ * Streams host data through the ring of device buffers of a plan committed for the device, in chunks that wrap around
+ * the ring with a partial last one, and in chunks chosen by timing the plan, and compares it to the host reference.
+ *
+ * @param lengths lengths of the FFT
+ * @param batch number of transforms
+ * @param chunk_batches number of transforms in each chunk
+ */
+void test_pipelined_chunks(const std::vector<std::size_t>& lengths, std::size_t batch, std::size_t chunk_batches) {
+  sycl::queue queue;
+  portfft::descriptor<ftype, portfft::domain::COMPLEX> desc(lengths);
+  desc.number_of_transforms = batch;
+  auto committed = desc.commit(queue);
+
+  std::vector<complex_type> input = host_reference::generate_uniform<complex_type>(lengths[0] * batch);
+  for (auto dir : {portfft::direction::FORWARD, portfft::direction::BACKWARD}) {
+    for (std::size_t chunk : {chunk_batches, std::size_t(0)}) {
+      std::vector<complex_type> output(input.size());
+      sycl::event e = dir == portfft::direction::FORWARD
+                          ? committed.compute_forward_stream(input.data(), output.data(), chunk)
+                          : committed.compute_backward_stream(input.data(), output.data(), chunk);
+      e.wait();
+      check_against_reference(input, output, lengths, batch, dir);
+    }
+  }
+}
+
+TEST(streaming, pipelined_chunks) {
+  test_pipelined_chunks({64}, 37, 5);
+  // the global implementation uses the scratch memory of the plan shared by the chunks in flight
+  test_pipelined_chunks({65536}, 11, 2);
+}
@@ -19,6 +19,7 @@
  **************************************************************************/
 
 #include <gtest/gtest.h>
+#include <portfft/common/local_padding.hpp>
 #include <portfft/common/memory_views.hpp>
 #include <portfft/common/transfers.hpp>
 
@@ -34,17 +35,20 @@ constexpr ftype sentinel_b = -888;
 constexpr ftype sentinel_loc1 = -777;
 constexpr ftype sentinel_loc2 = -666;
 
-template <portfft::detail::pad Pad, std::size_t BankGroupsPerPad>
+template <typename StorageT, portfft::detail::pad Pad, std::size_t BankGroupsPerPad>
 class test_transfers_kernel;
 
-template <portfft::detail::pad Pad, std::size_t BankGroupsPerPad>
+// StorageT is the type in global memory, local and private memory always use ftype
+template <typename StorageT, portfft::detail::pad Pad, std::size_t BankGroupsPerPad>
 void test() {
-  std::vector<ftype> a, b;
+  const StorageT storage_sentinel_a = static_cast<StorageT>(sentinel_a);
+  const StorageT storage_sentinel_b = static_cast<StorageT>(sentinel_b);
+  std::vector<StorageT> a, b;
   a.resize(N * wg_size);
   b.resize(N * wg_size);
 
   for (std::size_t i = 0; i < N * wg_size; i++) {
-    a[i] = static_cast<ftype>(i);
+    a[i] = static_cast<StorageT>(i);
   }
 
   sycl::queue q;
@@ -53,17 +57,17 @@ void test() {
   ftype* sentinels_loc1_dev = sentinels_loc1_dev_sptr.get();
   ftype* sentinels_loc2_dev = sentinels_loc2_dev_sptr.get();
 
-  auto a_dev_sptr = make_shared<ftype>(N * wg_size + 2 * N_sentinel_values, q);
-  auto b_dev_sptr = make_shared<ftype>(N * wg_size + 2 * N_sentinel_values, q);
-  ftype* a_dev = a_dev_sptr.get();
-  ftype* b_dev = b_dev_sptr.get();
-  ftype* a_dev_work = a_dev + N_sentinel_values;
-  ftype* b_dev_work = b_dev + N_sentinel_values;
+  auto a_dev_sptr = make_shared<StorageT>(N * wg_size + 2 * N_sentinel_values, q);
+  auto b_dev_sptr = make_shared<StorageT>(N * wg_size + 2 * N_sentinel_values, q);
+  StorageT* a_dev = a_dev_sptr.get();
+  StorageT* b_dev = b_dev_sptr.get();
+  StorageT* a_dev_work = a_dev + N_sentinel_values;
+  StorageT* b_dev_work = b_dev + N_sentinel_values;
 
-  q.fill(a_dev, sentinel_a, N_sentinel_values);
-  q.fill(a_dev + N * wg_size + N_sentinel_values, sentinel_a, N_sentinel_values);
+  q.fill(a_dev, storage_sentinel_a, N_sentinel_values);
+  q.fill(a_dev + N * wg_size + N_sentinel_values, storage_sentinel_a, N_sentinel_values);
   q.copy(a.data(), a_dev_work, N * wg_size);
-  q.fill(b_dev, sentinel_b, N * wg_size + 2 * N_sentinel_values);
+  q.fill(b_dev, storage_sentinel_b, N * wg_size + 2 * N_sentinel_values);
   q.wait();
 
   std::size_t padded_local_size =
@@ -75,7 +79,7 @@ void test() {
 #ifdef PORTFFT_KERNEL_LOG
     sycl::stream s{1024 * 8, 1024, h};
 #endif
-    h.parallel_for<test_transfers_kernel<Pad, BankGroupsPerPad>>(
+    h.parallel_for<test_transfers_kernel<StorageT, Pad, BankGroupsPerPad>>(
         sycl::nd_range<1>({wg_size}, {wg_size}), [=
 #ifdef PORTFFT_KERNEL_LOG
                                                       ,
@@ -123,8 +127,8 @@ void test() {
 
   q.wait();
 
-  std::vector<ftype> b_sentinels_start(N_sentinel_values);
-  std::vector<ftype> b_sentinels_end(N_sentinel_values);
+  std::vector<StorageT> b_sentinels_start(N_sentinel_values);
+  std::vector<StorageT> b_sentinels_end(N_sentinel_values);
   std::vector<ftype> loc1_sentinels(N_sentinel_values * 2);
   std::vector<ftype> loc2_sentinels(N_sentinel_values * 2);
   q.copy(sentinels_loc1_dev, loc1_sentinels.data(), N_sentinel_values * 2);
@@ -134,10 +138,12 @@ void test() {
   q.copy(b_dev_work, b.data(), N * wg_size);
   q.wait();
 
-  expect_arrays_eq(a, b);
+  for (std::size_t i = 0; i < N * wg_size; i++) {
+    EXPECT_EQ(static_cast<ftype>(a[i]), static_cast<ftype>(b[i]));
+  }
   for (std::size_t i = 0; i < N_sentinel_values; i++) {
-    EXPECT_EQ(b_sentinels_start[i], sentinel_b);
-    EXPECT_EQ(b_sentinels_end[i], sentinel_b);
+    EXPECT_EQ(static_cast<ftype>(b_sentinels_start[i]), static_cast<ftype>(storage_sentinel_b));
+    EXPECT_EQ(static_cast<ftype>(b_sentinels_end[i]), static_cast<ftype>(storage_sentinel_b));
   }
   for (std::size_t i = 0; i < N_sentinel_values * 2; i++) {
     EXPECT_EQ(loc1_sentinels[i], sentinel_loc1);
@@ -145,8 +151,41 @@ void test() {
   }
 }
 
-TEST(transfers, unpadded) { test<portfft::detail::pad::DONT_PAD, 0>(); }
-
-TEST(transfers, padded1) { test<portfft::detail::pad::DO_PAD, 1>(); }
-TEST(transfers, padded3) { test<portfft::detail::pad::DO_PAD, 3>(); }
-TEST(transfers, padded4) { test<portfft::detail::pad::DO_PAD, 4>(); }
+TEST(transfers, unpadded) { test<ftype, portfft::detail::pad::DONT_PAD, 0>(); }
+
+TEST(transfers, padded1) { test<ftype, portfft::detail::pad::DO_PAD, 1>(); }
+TEST(transfers, padded3) { test<ftype, portfft::detail::pad::DO_PAD, 3>(); }
+TEST(transfers, padded4) { test<ftype, portfft::detail::pad::DO_PAD, 4>(); }
+
+// converting reduced precision values to ftype and back is exact, so the copies must be lossless
+TEST(transfers, half_unpadded) { test<sycl::half, portfft::detail::pad::DONT_PAD, 0>(); }
+TEST(transfers, half_padded3) { test<sycl::half, portfft::detail::pad::DO_PAD, 3>(); }
+TEST(transfers, bfloat16_unpadded) { test<sycl::ext::oneapi::bfloat16, portfft::detail::pad::DONT_PAD, 0>(); }
+TEST(transfers, bfloat16_padded3) { test<sycl::ext::oneapi::bfloat16, portfft::detail::pad::DO_PAD, 3>(); }
+
+// Padding chosen for the bank count must remove the bank conflicts of consecutive work-items accessing elements a row
+// apart, where padding can remove them
+TEST(local_padding, bank_line_multiple_rows) {
+  for (int n_banks : {16, 32, 64}) {
+    for (int row_size : {2 * n_banks, 4 * n_banks, 8 * n_banks}) {
+      int bank_lines_per_pad = portfft::detail::choose_bank_lines_per_pad<float>(row_size, n_banks);
+      EXPECT_EQ(bank_lines_per_pad, row_size / n_banks);
+      EXPECT_EQ(portfft::detail::count_column_bank_conflicts<float>(row_size, n_banks, bank_lines_per_pad),
+                std::min(row_size, 4 * n_banks));
+    }
+  }
+}
+TEST(local_padding, bank_line_fraction_rows) {
+  constexpr int NBanks = 32;
+  for (int row_size : {NBanks / 2, NBanks / 4}) {
+    int bank_lines_per_pad = portfft::detail::choose_bank_lines_per_pad<float>(row_size, NBanks);
+    EXPECT_EQ(bank_lines_per_pad, 1);
+    EXPECT_EQ(portfft::detail::count_column_bank_conflicts<float>(row_size, NBanks, bank_lines_per_pad), row_size);
+  }
+}
+TEST(local_padding, no_padding_needed) {
+  // rows of an odd number of elements are already spread over all the banks
+  EXPECT_EQ(portfft::detail::choose_bank_lines_per_pad<float>(33, 32), 0);
+  // no padding for local memory without banks
+  EXPECT_EQ(portfft::detail::choose_bank_lines_per_pad<float>(64, 0), 0);
+}
@@ -0,0 +1,135 @@
+/***************************************************************************
+ *
+ *  Copyright (C) Codeplay Software Ltd.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  Codeplay's portFFT
+ *
+ **************************************************************************/
+
+#include <gtest/gtest.h>
+#include <portfft/common/twiddle_tables.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+#include "fft_test_utils.hpp"
+
+using ftype = float;
+
+class test_twiddle_tables_kernel;
+
+// Compares the twiddles calculated on the fly from the twiddle tables to the ones stored densely by the global
+// implementation.
+void test_twiddle_tables(portfft::IdxGlobal n_twiddles) {
+  using portfft::IdxGlobal;
+  sycl::queue q;
+  const portfft::Idx table_bits = portfft::detail::twiddle_table_bits(n_twiddles);
+  const IdxGlobal tables_size = portfft::detail::twiddle_tables_size(n_twiddles);
+  EXPECT_LE(tables_size, 4 * static_cast<IdxGlobal>(std::sqrt(static_cast<double>(n_twiddles))) + 2);
+
+  auto tables_sptr = make_shared<ftype>(static_cast<std::size_t>(2 * tables_size), q);
+  auto from_tables_sptr = make_shared<ftype>(static_cast<std::size_t>(2 * n_twiddles), q);
+  auto dense_sptr = make_shared<ftype>(static_cast<std::size_t>(2 * n_twiddles), q);
+  ftype* tables = tables_sptr.get();
+  ftype* from_tables = from_tables_sptr.get();
+  ftype* dense = dense_sptr.get();
+
+  sycl::event tables_event = portfft::detail::calculate_twiddle_tables(q, n_twiddles, tables);
+  q.submit([&](sycl::handler& cgh) {
+    cgh.depends_on(tables_event);
+    cgh.parallel_for<test_twiddle_tables_kernel>(
+        sycl::range<1>(static_cast<std::size_t>(n_twiddles)), [=](sycl::item<1> it) {
+          IdxGlobal exponent = static_cast<IdxGlobal>(it.get_id(0));
+          sycl::vec<ftype, 2> twiddle = portfft::detail::get_twiddle_from_tables(tables, exponent, table_bits);
+          from_tables[2 * exponent] = twiddle[0];
+          from_tables[2 * exponent + 1] = twiddle[1];
+          std::complex<ftype> dense_twiddle = portfft::detail::calculate_twiddle_reduced<ftype>(exponent, n_twiddles);
+          dense[2 * exponent] = dense_twiddle.real();
+          dense[2 * exponent + 1] = dense_twiddle.imag();
+        });
+  });
+  q.wait();
+
+  std::vector<ftype> from_tables_host(static_cast<std::size_t>(2 * n_twiddles));
+  std::vector<ftype> dense_host(static_cast<std::size_t>(2 * n_twiddles));
+  q.copy(from_tables, from_tables_host.data(), from_tables_host.size());
+  q.copy(dense, dense_host.data(), dense_host.size());
+  q.wait();
+
+  // both are within a few ulp of the exact twiddles, so much closer than the FFT tests' tolerance
+  const double tolerance = 16 * std::numeric_limits<ftype>::epsilon();
+  double max_error = 0;
+  for (std::size_t i = 0; i < dense_host.size(); i++) {
+    max_error = std::max(max_error, static_cast<double>(std::abs(from_tables_host[i] - dense_host[i])));
+  }
+  EXPECT_LE(max_error, tolerance) << "n_twiddles: " << n_twiddles;
+}
+
+TEST(twiddle_tables, power_of_two) {
+  test_twiddle_tables(64);
+  test_twiddle_tables(1 << 20);
+}
+
+TEST(twiddle_tables, not_power_of_two) {
+  test_twiddle_tables(1000);
+  test_twiddle_tables(3 * 4096);
+  test_twiddle_tables(3 * 5 * 7 * 11 * 13 * 17 * 19);
+}
+
+// Compares the twiddles calculated on the host with exact angle reduction to a long double reference, for exponents
+// spread over the whole range and close to the quadrant boundaries, including exponents larger than the number of
+// twiddles.
+template <typename T>
+void test_twiddle_reduction_accuracy(portfft::IdxGlobal n_twiddles) {
+  using portfft::IdxGlobal;
+  const long double pi = std::acos(-1.0L);
+  std::vector<IdxGlobal> exponents;
+  const IdxGlobal step = std::max(IdxGlobal(1), n_twiddles / 65536);
+  for (IdxGlobal n = 0; n < n_twiddles; n += step) {
+    exponents.push_back(n);
+  }
+  for (IdxGlobal eighth = 1; eighth < 8; eighth++) {
+    const IdxGlobal boundary = eighth * n_twiddles / 8;
+    for (IdxGlobal n = std::max(IdxGlobal(0), boundary - 2); n <= boundary + 2; n++) {
+      exponents.push_back(n);
+      exponents.push_back(n + 5 * n_twiddles);
+    }
+  }
+  exponents.push_back(n_twiddles - 1);
+
+  double max_error = 0;
+  for (IdxGlobal n : exponents) {
+    const long double angle = -2 * pi * static_cast<long double>(n % n_twiddles) / static_cast<long double>(n_twiddles);
+    const std::complex<T> twiddle = portfft::detail::calculate_twiddle_reduced<T>(n, n_twiddles);
+    max_error = std::max(max_error, static_cast<double>(std::abs(static_cast<long double>(twiddle.real()) -
+                                                                 std::cos(angle))));
+    max_error = std::max(max_error, static_cast<double>(std::abs(static_cast<long double>(twiddle.imag()) -
+                                                                 std::sin(angle))));
+  }
+  // the reduced angle is exact, leaving only the rounding of its remainder and of cospi and sinpi
+  EXPECT_LE(max_error, 4 * std::numeric_limits<T>::epsilon()) << "n_twiddles: " << n_twiddles;
+}
+
+TEST(twiddle_reduction, accuracy) {
+  for (portfft::IdxGlobal n_twiddles : {portfft::IdxGlobal(64), portfft::IdxGlobal(1000), portfft::IdxGlobal(3 * 4096),
+                                        portfft::IdxGlobal(1 << 20), portfft::IdxGlobal(3 * 5 * 7 * 11 * 13 * 17 * 19),
+                                        portfft::IdxGlobal(1) << 40}) {
+    test_twiddle_reduction_accuracy<float>(n_twiddles);
+    test_twiddle_reduction_accuracy<double>(n_twiddles);
+  }
+}